@@ -24,6 +24,7 @@
 #include "http/middleware/telemetry.hpp"
 #include "ledger/chain/consensus/bad_miner.hpp"
 #include "ledger/chain/consensus/dummy_miner.hpp"
+#include "ledger/chaincode/compiled_contract_cache.hpp"
 #include "ledger/chaincode/contract_http_interface.hpp"
 #include "ledger/consensus/naive_entropy_generator.hpp"
 #include "ledger/consensus/stake_snapshot.hpp"
@@ -75,6 +76,7 @@ using DkgServicePtr   = std::unique_ptr<dkg::DkgService>;
 using ConstByteArray  = byte_array::ConstByteArray;
 
 static const std::size_t HTTP_THREADS{4};
+static const std::size_t MAX_PREFETCHED_TXS{100000};
 static char const *      SNAPSHOT_FILENAME = "snapshot.json";
 
 bool WaitForLaneServersToStart()
@@ -215,6 +217,9 @@ Constellation::Constellation(CertificatePtr certificate, Config config)
   , lane_services_()
   , storage_(std::make_shared<StorageUnitClient>(internal_muddle_.AsEndpoint(), shard_cfgs_,
                                                  cfg_.log2_num_lanes))
+  , state_cache_(std::make_shared<BlockStateCache>(storage_, cfg_.log2_num_lanes))
+  , tx_prefetcher_(
+        std::make_shared<TxPrefetcher>(storage_, cfg_.log2_num_lanes, MAX_PREFETCHED_TXS))
   , lane_control_(internal_muddle_.AsEndpoint(), shard_cfgs_, cfg_.log2_num_lanes)
   , dag_{GenerateDAG(cfg_.features.IsEnabled("synergetic"), "dag_db_", true, certificate)}
   , dkg_{CreateDkgService(cfg_, certificate->identity().identifier(), muddle_.AsEndpoint())}
@@ -223,8 +228,10 @@ Constellation::Constellation(CertificatePtr certificate, Config config)
   , execution_manager_{std::make_shared<ExecutionManager>(
         cfg_.num_executors, cfg_.log2_num_lanes, storage_,
         [this] {
-          return std::make_shared<Executor>(storage_, stake_ ? &stake_->update_queue() : nullptr);
-        })}
+          return std::make_shared<Executor>(
+              state_cache_, stake_ ? &stake_->update_queue() : nullptr, tx_prefetcher_);
+        },
+        tx_prefetcher_)}
   , chain_{cfg_.features.IsEnabled(FeatureFlags::MAIN_CHAIN_BLOOM_FILTER),
            ledger::MainChain::Mode::LOAD_PERSISTENT_DB}
   , block_packer_{cfg_.log2_num_lanes}
@@ -232,7 +239,7 @@ Constellation::Constellation(CertificatePtr certificate, Config config)
                        dag_,
                        stake_,
                        *execution_manager_,
-                       *storage_,
+                       *state_cache_,
                        block_packer_,
                        *this,
                        tx_status_cache_,
@@ -268,6 +275,11 @@ Constellation::Constellation(CertificatePtr certificate, Config config)
   FETCH_LOG_INFO(LOGGING_NAME, "");
 
   // Enable experimental features
+  if (cfg_.features.IsEnabled(FeatureFlags::PERSISTENT_CONTRACT_CACHE))
+  {
+    ledger::CompiledContractCache::Instance().EnablePersistence(cfg_.db_prefix + "_contract_");
+  }
+
   if (cfg_.features.IsEnabled("synergetic"))
   {
     assert(dag_);
@@ -527,6 +539,7 @@ void Constellation::Run(UriList const &initial_peers, core::WeakRunnable bootstr
   reactor_.Stop();
   execution_manager_->Stop();
 
+  state_cache_.reset();
   storage_.reset();
 
   lane_services_.Stop();
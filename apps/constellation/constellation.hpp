@@ -32,9 +32,11 @@
 #include "ledger/genesis_loading/genesis_file_creator.hpp"
 #include "ledger/protocols/dag_service.hpp"
 #include "ledger/protocols/main_chain_rpc_service.hpp"
+#include "ledger/storage_unit/block_state_cache.hpp"
 #include "ledger/storage_unit/lane_remote_control.hpp"
 #include "ledger/storage_unit/storage_unit_bundled_service.hpp"
 #include "ledger/storage_unit/storage_unit_client.hpp"
+#include "ledger/storage_unit/transaction_prefetcher.hpp"
 #include "ledger/transaction_processor.hpp"
 #include "ledger/transaction_status_cache.hpp"
 #include "miner/basic_miner.hpp"
@@ -128,6 +130,10 @@ private:
   using StorageUnitClient      = ledger::StorageUnitClient;
   using LaneIndex              = ledger::LaneIdentity::lane_type;
   using StorageUnitClientPtr   = std::shared_ptr<StorageUnitClient>;
+  using BlockStateCache        = ledger::BlockStateCache;
+  using BlockStateCachePtr     = std::shared_ptr<BlockStateCache>;
+  using TxPrefetcher           = ledger::TransactionPrefetcher;
+  using TxPrefetcherPtr        = std::shared_ptr<TxPrefetcher>;
   using Flag                   = std::atomic<bool>;
   using ExecutionManager       = ledger::ExecutionManager;
   using ExecutionManagerPtr    = std::shared_ptr<ExecutionManager>;
@@ -176,6 +182,8 @@ private:
   TxStatusCache        tx_status_cache_;  ///< Cache of transaction status
   LaneServices         lane_services_;    ///< The lane services
   StorageUnitClientPtr storage_;          ///< The storage client to the lane services
+  BlockStateCachePtr   state_cache_;      ///< The block scoped state overlay used for execution
+  TxPrefetcherPtr      tx_prefetcher_;    ///< Loads block transactions ahead of the executors
   LaneRemoteControl    lane_control_;     ///< The lane control client for the lane services
 
   DAGPtr             dag_;
@@ -347,6 +347,10 @@ int main(int argc, char **argv)
 
   vm->AttachOutputDevice(fetch::vm::VM::STDOUT, std::cout);
 
+  // optionally collect the opcode pair frequencies, reporting the N most frequent pairs
+  auto const num_opcode_stats = params.program().GetParam<std::size_t>("opcode-stats", 0);
+  vm->SetOpcodeStatistics(num_opcode_stats > 0);
+
   // Execute the requested function
   std::string        error;
   std::string        console;
@@ -359,6 +363,18 @@ int main(int argc, char **argv)
     std::cerr << error << std::endl;
     return 1;
   }
+  if (num_opcode_stats > 0)
+  {
+    auto const statistics = vm->GetOpcodePairStatistics();
+
+    std::cout << "\nMost frequent opcode pairs:\n";
+    for (std::size_t i = 0; (i < num_opcode_stats) && (i < statistics.size()); ++i)
+    {
+      auto const &pair = statistics[i];
+      std::cout << pair.count << '\t' << pair.first << " -> " << pair.second << '\n';
+    }
+  }
+
   // if there is any console output print it
   if (!console.empty())
   {
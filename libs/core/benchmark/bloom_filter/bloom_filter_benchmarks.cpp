@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/blocked_bloom_filter.hpp"
+#include "core/bloom_filter.hpp"
+#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+using fetch::BasicBloomFilter;
+using fetch::BlockedBloomFilter;
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+
+using Digests = std::vector<ConstByteArray>;
+
+constexpr std::size_t NUM_DIGESTS = 1u << 14u;
+
+/*
+ * Generate a set of random 32 byte digests
+ */
+Digests GenerateDigests(std::size_t count, uint64_t seed)
+{
+  std::mt19937_64 rng{seed};
+
+  Digests digests{};
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ByteArray digest;
+    digest.Resize(32);
+    for (std::size_t offset = 0; offset < digest.size(); offset += sizeof(uint64_t))
+    {
+      uint64_t const value = rng();
+      std::memcpy(digest.pointer() + offset, &value, sizeof(value));
+    }
+
+    digests.emplace_back(digest);
+  }
+
+  return digests;
+}
+
+template <typename Filter>
+void BloomFilter_Add(benchmark::State &state)
+{
+  auto const digests = GenerateDigests(NUM_DIGESTS, 1);
+
+  Filter      filter{};
+  std::size_t index{0};
+  for (auto _ : state)
+  {
+    filter.Add(digests[index++ % digests.size()]);
+  }
+}
+
+template <typename Filter>
+void BloomFilter_Match(benchmark::State &state)
+{
+  auto const present = GenerateDigests(NUM_DIGESTS, 1);
+  auto const absent  = GenerateDigests(NUM_DIGESTS, 2);
+
+  Filter filter{};
+  for (auto const &digest : present)
+  {
+    filter.Add(digest);
+  }
+
+  std::size_t index{0};
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(filter.Match(present[index % present.size()]));
+    benchmark::DoNotOptimize(filter.Match(absent[index % absent.size()]));
+    ++index;
+  }
+}
+
+void BlockedBloomFilter_MatchBatch(benchmark::State &state)
+{
+  auto const batch_size = static_cast<std::size_t>(state.range(0));
+  auto const present    = GenerateDigests(NUM_DIGESTS, 1);
+  auto const queries    = GenerateDigests(NUM_DIGESTS, 2);
+
+  BlockedBloomFilter filter{};
+  for (auto const &digest : present)
+  {
+    filter.Add(digest);
+  }
+
+  std::size_t offset{0};
+  for (auto _ : state)
+  {
+    auto const begin = queries.begin() + static_cast<std::ptrdiff_t>(offset);
+    benchmark::DoNotOptimize(
+        filter.Match(begin, begin + static_cast<std::ptrdiff_t>(batch_size)));
+
+    offset = (offset + batch_size) % (queries.size() - batch_size);
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BloomFilter_Add, BasicBloomFilter);
+BENCHMARK_TEMPLATE(BloomFilter_Add, BlockedBloomFilter);
+BENCHMARK_TEMPLATE(BloomFilter_Match, BasicBloomFilter);
+BENCHMARK_TEMPLATE(BloomFilter_Match, BlockedBloomFilter);
+BENCHMARK(BlockedBloomFilter_MatchBatch)->Arg(16)->Arg(256)->Arg(4096);
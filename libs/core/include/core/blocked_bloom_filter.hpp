@@ -0,0 +1,185 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+#include "vectorise/memory/shared_array.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+
+/*
+ * A cache-blocked Bloom filter.
+ *
+ * The filter is split into 64-byte (cache line sized) blocks. All the bits for a given element
+ * are placed in a single block, one in each of the block's 64-bit words, so that each query
+ * touches exactly one cache line. The block and bit positions are derived directly from the
+ * element bytes without any intermediate allocations, which makes it well suited to elements
+ * which are already uniformly distributed, such as transaction digests.
+ *
+ * The interface mirrors that of BasicBloomFilter, with the addition of batch queries and
+ * serialization so that the filter can be persisted rather than rebuilt.
+ *
+ * Not thread-safe.
+ */
+class BlockedBloomFilter
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Results        = std::vector<bool>;
+
+  static constexpr std::size_t WORDS_PER_BLOCK      = 8;
+  static constexpr std::size_t BLOCK_SIZE_IN_BYTES  = WORDS_PER_BLOCK * sizeof(uint64_t);
+  static constexpr std::size_t BITS_PER_ELEMENT     = WORDS_PER_BLOCK;
+  static constexpr std::size_t DEFAULT_SIZE_IN_BITS = 8 * 10 * 1024 * 1024;
+
+  /*
+   * Construct a Bloom filter of (at least) the given number of bits
+   */
+  explicit BlockedBloomFilter(std::size_t size_in_bits = DEFAULT_SIZE_IN_BITS);
+  BlockedBloomFilter(BlockedBloomFilter const &) = delete;
+  BlockedBloomFilter(BlockedBloomFilter &&)      = default;
+  ~BlockedBloomFilter()                          = default;
+
+  BlockedBloomFilter &operator=(BlockedBloomFilter const &) = delete;
+  BlockedBloomFilter &operator=(BlockedBloomFilter &&) = default;
+
+  /*
+   * Check if the argument matches the Bloom filter. Returns a pair of
+   * a Boolean (false if the element had never been added; true if the
+   * argument had been added or is a false positive) and the number of
+   * bits which were checked.
+   */
+  std::pair<bool, std::size_t> Match(ConstByteArray const &);
+  /*
+   * Check a sequence of elements against the Bloom filter. The blocks for
+   * all the elements are prefetched before any of them are checked, so
+   * that the memory accesses overlap. Returns the match result for each
+   * of the elements, in order.
+   */
+  template <typename Iterator>
+  Results Match(Iterator begin, Iterator end);
+  /*
+   * Set the bits of the Bloom filter corresponding to the argument
+   */
+  void Add(ConstByteArray const &);
+  /*
+   * Inform the Bloom filter of detected false positives. This is used to
+   * track the quality of the filter. Returns false if the quality of the
+   * filter has deteriorated below a predefined threshold; true otherwise.
+   */
+  bool ReportFalsePositives(std::size_t);
+  /*
+   * Clear all the elements from the filter
+   */
+  void Reset();
+
+  std::size_t size() const;
+  std::size_t entry_count() const;
+
+private:
+  using Blocks = memory::SharedArray<uint64_t>;
+
+  struct Key
+  {
+    std::size_t block;  ///< The index of the block containing the element's bits
+    uint32_t    hash;   ///< The hash from which the bit in each word is derived
+  };
+
+  using Keys = std::vector<Key>;
+
+  Key  ToKey(ConstByteArray const &element) const;
+  void Prefetch(Key const &key) const;
+  bool Check(Key const &key) const;
+
+  Blocks      blocks_;
+  std::size_t num_blocks_{0};
+  std::size_t entry_count_{0};
+  std::size_t positive_count_{0};
+  std::size_t false_positive_count_{0};
+
+  template <typename T>
+  friend void Serialize(T &serializer, BlockedBloomFilter const &filter);
+
+  template <typename T>
+  friend void Deserialize(T &serializer, BlockedBloomFilter &filter);
+};
+
+template <typename Iterator>
+BlockedBloomFilter::Results BlockedBloomFilter::Match(Iterator begin, Iterator end)
+{
+  Keys keys{};
+  for (auto it = begin; it != end; ++it)
+  {
+    keys.emplace_back(ToKey(*it));
+    Prefetch(keys.back());
+  }
+
+  Results results(keys.size(), false);
+  for (std::size_t i = 0; i < keys.size(); ++i)
+  {
+    if (Check(keys[i]))
+    {
+      results[i] = true;
+      ++positive_count_;
+    }
+  }
+
+  return results;
+}
+
+template <typename T>
+void Serialize(T &serializer, BlockedBloomFilter const &filter)
+{
+  auto const *      data = reinterpret_cast<uint8_t const *>(filter.blocks_.pointer());
+  std::size_t const size = filter.num_blocks_ * BlockedBloomFilter::BLOCK_SIZE_IN_BYTES;
+
+  serializer << static_cast<uint64_t>(filter.num_blocks_)
+             << static_cast<uint64_t>(filter.entry_count_)
+             << byte_array::ConstByteArray{data, size};
+}
+
+template <typename T>
+void Deserialize(T &serializer, BlockedBloomFilter &filter)
+{
+  uint64_t              num_blocks{0};
+  uint64_t              entry_count{0};
+  byte_array::ByteArray data;
+
+  serializer >> num_blocks >> entry_count >> data;
+
+  if ((num_blocks == 0) || (data.size() != num_blocks * BlockedBloomFilter::BLOCK_SIZE_IN_BYTES))
+  {
+    throw std::runtime_error("Malformed Bloom filter");
+  }
+
+  BlockedBloomFilter output{num_blocks * BlockedBloomFilter::BLOCK_SIZE_IN_BYTES * 8u};
+  std::memcpy(output.blocks_.pointer(), data.pointer(), data.size());
+  output.entry_count_ = entry_count;
+
+  filter = std::move(output);
+}
+
+}  // namespace fetch
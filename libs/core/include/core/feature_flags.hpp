@@ -31,7 +31,9 @@ namespace core {
 class FeatureFlags
 {
 public:
-  constexpr static char const *MAIN_CHAIN_BLOOM_FILTER = "main_chain_bloom_filter";
+  constexpr static char const *MAIN_CHAIN_BLOOM_FILTER    = "main_chain_bloom_filter";
+  constexpr static char const *PERSISTENT_CONTRACT_CACHE  = "persistent_contract_cache";
+  constexpr static char const *PIPELINED_BLOCK_VALIDATION = "pipelined_block_validation";
 
   using ConstByteArray = byte_array::ConstByteArray;
   using FlagSet        = std::unordered_set<ConstByteArray>;
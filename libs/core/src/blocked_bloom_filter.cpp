@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/blocked_bloom_filter.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace fetch {
+namespace {
+
+// Aim for 1 false positive per this many positive queries
+constexpr std::size_t INVERSE_TARGET_FALSE_POSITIVE_RATE = 100000u;
+
+// No point in evaluating the filter's quality until this many positive queries
+// have been executed
+constexpr std::size_t MEANINGFUL_STATS_THRESHOLD = 5u * INVERSE_TARGET_FALSE_POSITIVE_RATE;
+
+// Odd multipliers used to derive an independent bit position for each word of a block
+constexpr uint32_t SALTS[BlockedBloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+    0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u};
+
+using Block = uint64_t[BlockedBloomFilter::WORDS_PER_BLOCK];
+
+/*
+ * The finalisation step of SplitMix64, used to spread the entropy of a word over all of its bits
+ */
+constexpr uint64_t Mix(uint64_t value)
+{
+  value = (value ^ (value >> 30u)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27u)) * 0x94d049bb133111ebull;
+  return value ^ (value >> 31u);
+}
+
+/*
+ * Compute the mask of bits which are set in each of the words of a block for a given element
+ */
+void ComputeMask(uint32_t hash, Block &mask)
+{
+  for (std::size_t i = 0; i < BlockedBloomFilter::WORDS_PER_BLOCK; ++i)
+  {
+    mask[i] = uint64_t{1} << ((hash * SALTS[i]) >> 26u);
+  }
+}
+
+/*
+ * Determine if all the bits of the mask are set in the block
+ */
+bool ContainsMask(uint64_t const *block, Block const &mask)
+{
+#if defined(__AVX2__)
+  auto const *block_vec = reinterpret_cast<__m256i const *>(block);
+  auto const *mask_vec  = reinterpret_cast<__m256i const *>(mask);
+
+  // testc computes (~block & mask) == 0 for each half of the block
+  return _mm256_testc_si256(_mm256_load_si256(block_vec), _mm256_loadu_si256(mask_vec)) &&
+         _mm256_testc_si256(_mm256_load_si256(block_vec + 1), _mm256_loadu_si256(mask_vec + 1));
+#elif defined(__SSE2__)
+  auto const *block_vec = reinterpret_cast<__m128i const *>(block);
+  auto const *mask_vec  = reinterpret_cast<__m128i const *>(mask);
+
+  // accumulate the bits of the mask which are not present in the block
+  __m128i missing = _mm_setzero_si128();
+  for (std::size_t i = 0; i < BlockedBloomFilter::WORDS_PER_BLOCK / 2; ++i)
+  {
+    missing = _mm_or_si128(
+        missing, _mm_andnot_si128(_mm_load_si128(block_vec + i), _mm_loadu_si128(mask_vec + i)));
+  }
+
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(missing, _mm_setzero_si128())) == 0xFFFF;
+#else
+  uint64_t missing{0};
+  for (std::size_t i = 0; i < BlockedBloomFilter::WORDS_PER_BLOCK; ++i)
+  {
+    missing |= mask[i] & ~block[i];
+  }
+
+  return missing == 0;
+#endif
+}
+
+}  // namespace
+
+constexpr std::size_t BlockedBloomFilter::WORDS_PER_BLOCK;
+constexpr std::size_t BlockedBloomFilter::BLOCK_SIZE_IN_BYTES;
+constexpr std::size_t BlockedBloomFilter::BITS_PER_ELEMENT;
+constexpr std::size_t BlockedBloomFilter::DEFAULT_SIZE_IN_BITS;
+
+BlockedBloomFilter::BlockedBloomFilter(std::size_t size_in_bits)
+  : num_blocks_{std::max<std::size_t>(
+        (size_in_bits + (BLOCK_SIZE_IN_BYTES * 8u) - 1u) / (BLOCK_SIZE_IN_BYTES * 8u), 1u)}
+{
+  blocks_ = Blocks(num_blocks_ * WORDS_PER_BLOCK);
+  blocks_.SetAllZero();
+}
+
+std::pair<bool, std::size_t> BlockedBloomFilter::Match(ConstByteArray const &element)
+{
+  Key const  key     = ToKey(element);
+  bool const matched = Check(key);
+
+  if (matched)
+  {
+    ++positive_count_;
+  }
+
+  return {matched, BITS_PER_ELEMENT};
+}
+
+void BlockedBloomFilter::Add(ConstByteArray const &element)
+{
+  Key const key = ToKey(element);
+
+  Block mask;
+  ComputeMask(key.hash, mask);
+
+  uint64_t *block = blocks_.pointer() + (key.block * WORDS_PER_BLOCK);
+
+  bool is_new_entry = false;
+  for (std::size_t i = 0; i < WORDS_PER_BLOCK; ++i)
+  {
+    is_new_entry |= (block[i] & mask[i]) != mask[i];
+    block[i] |= mask[i];
+  }
+
+  if (is_new_entry)
+  {
+    ++entry_count_;
+  }
+}
+
+bool BlockedBloomFilter::ReportFalsePositives(std::size_t count)
+{
+  false_positive_count_ += count;
+  if (positive_count_ > MEANINGFUL_STATS_THRESHOLD)
+  {
+    return (false_positive_count_ * INVERSE_TARGET_FALSE_POSITIVE_RATE) < positive_count_;
+  }
+
+  return true;
+}
+
+void BlockedBloomFilter::Reset()
+{
+  blocks_.SetAllZero();
+  entry_count_          = 0;
+  positive_count_       = 0;
+  false_positive_count_ = 0;
+}
+
+std::size_t BlockedBloomFilter::size() const
+{
+  return num_blocks_ * BLOCK_SIZE_IN_BYTES * 8u;
+}
+
+std::size_t BlockedBloomFilter::entry_count() const
+{
+  return entry_count_;
+}
+
+BlockedBloomFilter::Key BlockedBloomFilter::ToKey(ConstByteArray const &element) const
+{
+  // fold the element into a single 64-bit value, one word at a time
+  uint64_t hash = Mix(element.size());
+  for (std::size_t offset = 0; offset < element.size(); offset += sizeof(uint64_t))
+  {
+    uint64_t word{0};
+    std::memcpy(&word, element.pointer() + offset,
+                std::min(sizeof(uint64_t), element.size() - offset));
+
+    hash = Mix(hash ^ word);
+  }
+
+  // the upper half selects the block and the lower half the bits within it
+  return {static_cast<std::size_t>((hash >> 32u) % num_blocks_), static_cast<uint32_t>(hash)};
+}
+
+void BlockedBloomFilter::Prefetch(Key const &key) const
+{
+#if defined(__GNUC__)
+  __builtin_prefetch(blocks_.pointer() + (key.block * WORDS_PER_BLOCK));
+#else
+  (void)key;
+#endif
+}
+
+bool BlockedBloomFilter::Check(Key const &key) const
+{
+  Block mask;
+  ComputeMask(key.hash, mask);
+
+  return ContainsMask(blocks_.pointer() + (key.block * WORDS_PER_BLOCK), mask);
+}
+
+}  // namespace fetch
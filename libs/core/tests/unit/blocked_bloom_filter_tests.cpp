@@ -0,0 +1,192 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/blocked_bloom_filter.hpp"
+#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/serializers/byte_array.hpp"
+#include "core/serializers/byte_array_buffer.hpp"
+
+#include "gmock/gmock.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace fetch;
+
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+
+/*
+ * Generate a (uniformly distributed) 32 byte digest, unique to the index
+ */
+ConstByteArray Digest(std::size_t index)
+{
+  std::mt19937_64 rng{index};
+
+  ByteArray digest;
+  digest.Resize(32);
+  for (std::size_t offset = 0; offset < digest.size(); offset += sizeof(uint64_t))
+  {
+    uint64_t const value = rng();
+    std::memcpy(digest.pointer() + offset, &value, sizeof(value));
+  }
+
+  return {digest};
+}
+
+class BlockedBloomFilterTests : public ::testing::Test
+{
+public:
+  static constexpr std::size_t SIZE_IN_BITS = 1u << 20u;
+
+  BlockedBloomFilter filter{SIZE_IN_BITS};
+};
+
+TEST_F(BlockedBloomFilterTests, empty_bloom_filter_reports_matches_no_items)
+{
+  EXPECT_FALSE(filter.Match("abc").first);
+  EXPECT_FALSE(filter.Match(Digest(0)).first);
+}
+
+TEST_F(BlockedBloomFilterTests, items_which_had_been_added_are_matched)
+{
+  filter.Add("abc");
+  EXPECT_TRUE(filter.Match("abc").first);
+  EXPECT_EQ(filter.Match("abc").second, BlockedBloomFilter::BITS_PER_ELEMENT);
+  EXPECT_FALSE(filter.Match("xyz").first);
+  EXPECT_EQ(filter.entry_count(), 1u);
+}
+
+TEST_F(BlockedBloomFilterTests, elements_of_any_length_may_be_added)
+{
+  std::vector<ConstByteArray> const elements{"", "a", "abcdefgh", "abcdefghi", Digest(1)};
+
+  for (auto const &element : elements)
+  {
+    filter.Add(element);
+  }
+
+  for (auto const &element : elements)
+  {
+    EXPECT_TRUE(filter.Match(element).first);
+  }
+}
+
+TEST_F(BlockedBloomFilterTests, batch_queries_match_individual_queries)
+{
+  static constexpr std::size_t NUM_ELEMENTS = 1000;
+
+  std::vector<ConstByteArray> elements{};
+  for (std::size_t i = 0; i < NUM_ELEMENTS; ++i)
+  {
+    elements.emplace_back(Digest(i));
+
+    // only add every other element
+    if ((i % 2) == 0)
+    {
+      filter.Add(elements.back());
+    }
+  }
+
+  auto const results = filter.Match(elements.begin(), elements.end());
+  ASSERT_EQ(results.size(), elements.size());
+
+  for (std::size_t i = 0; i < NUM_ELEMENTS; ++i)
+  {
+    EXPECT_EQ(results[i], filter.Match(elements[i]).first);
+
+    // there are no false negatives
+    if ((i % 2) == 0)
+    {
+      EXPECT_TRUE(results[i]);
+    }
+  }
+}
+
+TEST_F(BlockedBloomFilterTests, false_positive_rate_is_low_when_lightly_loaded)
+{
+  static constexpr std::size_t NUM_ELEMENTS = 10000;
+
+  for (std::size_t i = 0; i < NUM_ELEMENTS; ++i)
+  {
+    filter.Add(Digest(i));
+  }
+
+  std::size_t false_positives{0};
+  for (std::size_t i = NUM_ELEMENTS; i < 2 * NUM_ELEMENTS; ++i)
+  {
+    if (filter.Match(Digest(i)).first)
+    {
+      ++false_positives;
+    }
+  }
+
+  // with 100 bits per element the expected rate is well below 0.1%
+  EXPECT_LT(false_positives, NUM_ELEMENTS / 1000);
+}
+
+TEST_F(BlockedBloomFilterTests, reset_clears_all_elements)
+{
+  filter.Add(Digest(0));
+  filter.Reset();
+
+  EXPECT_FALSE(filter.Match(Digest(0)).first);
+  EXPECT_EQ(filter.entry_count(), 0u);
+}
+
+TEST_F(BlockedBloomFilterTests, filter_may_be_serialized_and_deserialized)
+{
+  for (std::size_t i = 0; i < 100; ++i)
+  {
+    filter.Add(Digest(i));
+  }
+
+  serializers::ByteArrayBuffer buffer;
+  buffer << filter;
+
+  BlockedBloomFilter output{};
+  buffer.seek(0);
+  buffer >> output;
+
+  EXPECT_EQ(output.size(), filter.size());
+  EXPECT_EQ(output.entry_count(), filter.entry_count());
+
+  for (std::size_t i = 0; i < 200; ++i)
+  {
+    EXPECT_EQ(output.Match(Digest(i)).first, filter.Match(Digest(i)).first);
+  }
+}
+
+TEST_F(BlockedBloomFilterTests, malformed_filters_are_rejected)
+{
+  serializers::ByteArrayBuffer buffer;
+  buffer << uint64_t{2} << uint64_t{0} << ConstByteArray{"too short"};
+
+  BlockedBloomFilter output{};
+  buffer.seek(0);
+  EXPECT_THROW(buffer >> output, std::runtime_error);
+}
+
+}  // namespace
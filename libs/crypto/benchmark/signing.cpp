@@ -20,11 +20,15 @@
 #include "core/byte_array/const_byte_array.hpp"
 #include "core/random/lcg.hpp"
 #include "crypto/ecdsa.hpp"
+#include "crypto/ecdsa_batch_verifier.hpp"
 
 #include "benchmark/benchmark.h"
 
+#include <cstddef>
 #include <stdexcept>
+#include <vector>
 
+using fetch::crypto::ECDSABatchVerifier;
 using fetch::crypto::ECDSASigner;
 using fetch::crypto::ECDSAVerifier;
 using fetch::byte_array::ConstByteArray;
@@ -80,6 +84,39 @@ void VerifySignature(benchmark::State &state)
   }
 }
 
+void VerifySignatureBatch(benchmark::State &state)
+{
+  auto const batch_size = static_cast<std::size_t>(state.range(0));
+
+  // generate the signed messages from a small number of signers
+  std::vector<ECDSASigner>    signers(4);
+  std::vector<ConstByteArray> messages;
+  std::vector<ConstByteArray> signatures;
+
+  for (std::size_t i = 0; i < batch_size; ++i)
+  {
+    messages.emplace_back(GenerateRandomData<2048>());
+    signatures.emplace_back(signers[i % signers.size()].Sign(messages.back()));
+  }
+
+  ECDSABatchVerifier verifier{};
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < batch_size; ++i)
+    {
+      verifier.Add(signers[i % signers.size()].identity().identifier(), messages[i],
+                   signatures[i]);
+    }
+
+    // run the verification
+    benchmark::DoNotOptimize(verifier.Verify());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
 }  // namespace
 
 BENCHMARK(VerifySignature);
+BENCHMARK(VerifySignatureBatch)->Arg(1)->Arg(16)->Arg(64)->Arg(256);
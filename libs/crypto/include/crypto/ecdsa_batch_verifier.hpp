@@ -0,0 +1,95 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/ecdsa_public_key_cache.hpp"
+#include "crypto/openssl_common.hpp"
+#include "crypto/openssl_context_session.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * Verifies a batch of (canonical secp256k1) ECDSA signatures.
+ *
+ * Signatures are queued with Add() and then checked together with Verify(). Compared with
+ * verifying each of the signatures individually:
+ *
+ * - The public keys are taken from the public key cache rather than being parsed each time
+ * - The curve group and big number context are only created once per verifier
+ * - The modular inverses of the signature s values, which are required by every verification,
+ *   are computed together with a single inversion (Montgomery's trick)
+ *
+ * A verifier instance is not thread safe, but it is intended to be long lived (for example one
+ * per worker thread) so that the setup costs are only paid once.
+ */
+class ECDSABatchVerifier
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Results        = std::vector<bool>;
+
+  // Construction / Destruction
+  explicit ECDSABatchVerifier(ECDSAPublicKeyCache &cache = ECDSAPublicKeyCache::Instance());
+  ECDSABatchVerifier(ECDSABatchVerifier const &) = delete;
+  ECDSABatchVerifier(ECDSABatchVerifier &&)      = delete;
+  ~ECDSABatchVerifier()                          = default;
+
+  std::size_t Add(ConstByteArray const &identity, ConstByteArray const &data,
+                  ConstByteArray const &signature);
+  Results     Verify();
+
+  std::size_t size() const;
+
+  // Operators
+  ECDSABatchVerifier &operator=(ECDSABatchVerifier const &) = delete;
+  ECDSABatchVerifier &operator=(ECDSABatchVerifier &&) = delete;
+
+private:
+  using PublicKeyPtr = ECDSAPublicKeyCache::PublicKeyPtr;
+  using Session      = openssl::context::Session<BN_CTX>;
+  using GroupPtr     = openssl::uniq_ptr_type<EC_GROUP>;
+  using PointPtr     = openssl::uniq_ptr_type<EC_POINT>;
+  using BigNumPtr    = openssl::uniq_ptr_type<BIGNUM>;
+  using BigNums      = std::vector<BigNumPtr>;
+
+  struct Item
+  {
+    PublicKeyPtr   key;        ///< The public key of the signer (empty if invalid)
+    ConstByteArray digest;     ///< The message digest
+    ConstByteArray signature;  ///< The canonical signature
+  };
+
+  using Items = std::vector<Item>;
+
+  BigNumPtr DigestToBigNum(ConstByteArray const &digest) const;
+  bool      ParseSignature(ConstByteArray const &signature, BIGNUM *r, BIGNUM *s) const;
+
+  ECDSAPublicKeyCache &cache_;    ///< The source of parsed public keys
+  GroupPtr             group_;    ///< The curve group
+  BigNumPtr            order_;    ///< The order of the curve group
+  Session              session_;  ///< The big number context
+  Items                items_;    ///< The pending signatures
+};
+
+}  // namespace crypto
+}  // namespace fetch
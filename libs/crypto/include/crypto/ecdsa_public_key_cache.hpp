@@ -0,0 +1,100 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/fnv.hpp"  // needed for std::hash<ConstByteArray>
+#include "crypto/openssl_ecdsa_public_key.hpp"
+
+#include <array>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * A bounded, thread safe cache of parsed ECDSA public keys indexed by the (canonical) identity
+ * bytes.
+ *
+ * Parsing a public key requires the curve group to be created and the point to be validated,
+ * which is a significant fraction of the cost of verifying a single signature. Since the same
+ * signers tend to be seen repeatedly the parsed keys are retained. The cache is split into a
+ * number of independently locked stripes, each of which evicts its least recently used key once
+ * it is full.
+ */
+class ECDSAPublicKeyCache
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using PublicKey      = openssl::ECDSAPublicKey<>;
+  using PublicKeyPtr   = std::shared_ptr<PublicKey const>;
+
+  static constexpr std::size_t DEFAULT_CAPACITY = 1u << 14u;  // 16K
+
+  static ECDSAPublicKeyCache &Instance();
+
+  // Construction / Destruction
+  explicit ECDSAPublicKeyCache(std::size_t capacity = DEFAULT_CAPACITY);
+  ECDSAPublicKeyCache(ECDSAPublicKeyCache const &) = delete;
+  ECDSAPublicKeyCache(ECDSAPublicKeyCache &&)      = delete;
+  ~ECDSAPublicKeyCache()                           = default;
+
+  PublicKeyPtr Lookup(ConstByteArray const &identity);
+
+  std::size_t size() const;
+  std::size_t capacity() const;
+
+  // Operators
+  ECDSAPublicKeyCache &operator=(ECDSAPublicKeyCache const &) = delete;
+  ECDSAPublicKeyCache &operator=(ECDSAPublicKeyCache &&) = delete;
+
+private:
+  static constexpr std::size_t NUM_STRIPES = 16;
+
+  using Mutex = std::mutex;
+  using Order = std::list<ConstByteArray>;
+
+  struct Element
+  {
+    PublicKeyPtr    key;       ///< The parsed public key
+    Order::iterator position;  ///< The position of the key in the usage order
+  };
+
+  using Elements = std::unordered_map<ConstByteArray, Element>;
+
+  struct Stripe
+  {
+    mutable Mutex lock;      ///< The lock for the stripe
+    Elements      elements;  ///< The cached keys
+    Order         order;     ///< The identities ordered from most to least recently used
+  };
+
+  using Stripes = std::array<Stripe, NUM_STRIPES>;
+
+  Stripe &LookupStripe(ConstByteArray const &identity);
+
+  std::size_t const stripe_capacity_;  ///< The maximum number of keys in each stripe
+  Stripes           stripes_;          ///< The cache stripes
+};
+
+}  // namespace crypto
+}  // namespace fetch
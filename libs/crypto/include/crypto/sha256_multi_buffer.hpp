@@ -0,0 +1,56 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * A request to compute SHA256(first || second) where both inputs are 32 byte digests. This is the
+ * operation used to combine the children of a node in a Merkle tree.
+ */
+struct SHA256DigestPair
+{
+  uint8_t const *first;   ///< The first 32 byte input
+  uint8_t const *second;  ///< The second 32 byte input
+  uint8_t *      output;  ///< The location the 32 byte result is written to
+};
+
+/**
+ * Hash a batch of independent digest pairs. Since the messages are a fixed 64 bytes, the padding
+ * block is constant and the messages are processed side by side in the SIMD lanes available to
+ * the build (8 with AVX2, 4 with SSE2), with any remainder falling back to the scalar code.
+ *
+ * The outputs are only written once all of the inputs for a group of lanes have been read, however
+ * the outputs of one pair must not alias the inputs of another.
+ *
+ * @param pairs The array of pairs to be hashed
+ * @param count The number of pairs in the array
+ */
+void HashDigestPairs(SHA256DigestPair const *pairs, std::size_t count);
+
+/**
+ * @return The number of digest pairs which are hashed in parallel by this build
+ */
+std::size_t DigestPairLanes();
+
+}  // namespace crypto
+}  // namespace fetch
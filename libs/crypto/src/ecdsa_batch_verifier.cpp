@@ -0,0 +1,243 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/ecdsa_batch_verifier.hpp"
+#include "crypto/hash.hpp"
+#include "crypto/sha256.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace fetch {
+namespace crypto {
+namespace {
+
+using Curve = openssl::ECDSACurve<NID_secp256k1>;
+
+void Check(int status, char const *operation)
+{
+  if (!status)
+  {
+    throw std::runtime_error(std::string{"ECDSABatchVerifier: "} + operation + " failed.");
+  }
+}
+
+}  // namespace
+
+/**
+ * Construct the batch verifier
+ *
+ * @param cache The public key cache to be used
+ */
+ECDSABatchVerifier::ECDSABatchVerifier(ECDSAPublicKeyCache &cache)
+  : cache_{cache}
+  , group_{EC_GROUP_new_by_curve_name(Curve::nid)}
+  , order_{BN_new()}
+{
+  Check(group_ != nullptr, "EC_GROUP_new_by_curve_name(...)");
+  Check(EC_GROUP_get_order(group_.get(), order_.get(), session_.context().get()),
+        "EC_GROUP_get_order(...)");
+}
+
+/**
+ * Add a signature to the batch
+ *
+ * @param identity The identity (canonical public key) of the signer
+ * @param data The signed message
+ * @param signature The canonical signature
+ * @return The index of the signature in the results of the next call to Verify()
+ */
+std::size_t ECDSABatchVerifier::Add(ConstByteArray const &identity, ConstByteArray const &data,
+                                    ConstByteArray const &signature)
+{
+  items_.emplace_back(Item{cache_.Lookup(identity), Hash<SHA256>(data), signature});
+
+  return items_.size() - 1u;
+}
+
+/**
+ * Verify all the signatures in the batch, after which the batch is empty
+ *
+ * @return The verification result for each of the signatures in the order they were added
+ */
+ECDSABatchVerifier::Results ECDSABatchVerifier::Verify()
+{
+  // take the pending signatures, so that the batch is empty however the verification exits
+  Items items{};
+  std::swap(items, items_);
+
+  Results results(items.size(), false);
+
+  BN_CTX *const ctx = session_.context().get();
+
+  // parse the signatures, discarding any which are malformed
+  std::vector<std::size_t> indices;
+  BigNums                  r_values;
+  BigNums                  s_values;
+  BigNums                  products;
+
+  indices.reserve(items.size());
+  r_values.reserve(items.size());
+  s_values.reserve(items.size());
+  products.reserve(items.size());
+
+  for (std::size_t i = 0; i < items.size(); ++i)
+  {
+    BigNumPtr r{BN_new()};
+    BigNumPtr s{BN_new()};
+
+    if (!items[i].key || !ParseSignature(items[i].signature, r.get(), s.get()))
+    {
+      continue;
+    }
+
+    // accumulate the running product of the s values
+    BigNumPtr product{BN_dup(s.get())};
+    if (!products.empty())
+    {
+      Check(BN_mod_mul(product.get(), products.back().get(), s.get(), order_.get(), ctx),
+            "BN_mod_mul(...)");
+    }
+
+    indices.push_back(i);
+    r_values.emplace_back(std::move(r));
+    s_values.emplace_back(std::move(s));
+    products.emplace_back(std::move(product));
+  }
+
+  if (!indices.empty())
+  {
+    // a single inversion of the product of all the s values...
+    BigNumPtr inverse{BN_mod_inverse(nullptr, products.back().get(), order_.get(), ctx)};
+    Check(inverse != nullptr, "BN_mod_inverse(...)");
+
+    BigNumPtr w{BN_new()};
+    BigNumPtr u1{BN_new()};
+    BigNumPtr u2{BN_new()};
+    BigNumPtr x{BN_new()};
+    PointPtr  point{EC_POINT_new(group_.get())};
+
+    for (std::size_t j = indices.size(); j > 0; --j)
+    {
+      std::size_t const k    = j - 1u;
+      Item const &      item = items[indices[k]];
+
+      // ...is unwound to recover the inverse of each of the individual s values
+      if (k > 0)
+      {
+        Check(BN_mod_mul(w.get(), inverse.get(), products[k - 1u].get(), order_.get(), ctx),
+              "BN_mod_mul(...)");
+        Check(BN_mod_mul(inverse.get(), inverse.get(), s_values[k].get(), order_.get(), ctx),
+              "BN_mod_mul(...)");
+      }
+      else
+      {
+        Check(BN_copy(w.get(), inverse.get()) != nullptr, "BN_copy(...)");
+      }
+
+      // u1 = z / s and u2 = r / s
+      BigNumPtr const z = DigestToBigNum(item.digest);
+      Check(BN_mod_mul(u1.get(), z.get(), w.get(), order_.get(), ctx), "BN_mod_mul(...)");
+      Check(BN_mod_mul(u2.get(), r_values[k].get(), w.get(), order_.get(), ctx),
+            "BN_mod_mul(...)");
+
+      // the signature is valid when the x coordinate of u1 * G + u2 * Q is r (mod n)
+      Check(EC_POINT_mul(group_.get(), point.get(), u1.get(), item.key->keyAsEC_POINT().get(),
+                         u2.get(), ctx),
+            "EC_POINT_mul(...)");
+
+      if (EC_POINT_is_at_infinity(group_.get(), point.get()))
+      {
+        continue;
+      }
+
+      Check(EC_POINT_get_affine_coordinates_GFp(group_.get(), point.get(), x.get(), nullptr, ctx),
+            "EC_POINT_get_affine_coordinates_GFp(...)");
+      Check(BN_nnmod(x.get(), x.get(), order_.get(), ctx), "BN_nnmod(...)");
+
+      results[indices[k]] = (BN_cmp(x.get(), r_values[k].get()) == 0);
+    }
+  }
+
+  return results;
+}
+
+/**
+ * Get the number of signatures waiting to be verified
+ *
+ * @return The number of pending signatures
+ */
+std::size_t ECDSABatchVerifier::size() const
+{
+  return items_.size();
+}
+
+/**
+ * Convert a message digest into an integer, truncating it to the bit length of the group order
+ *
+ * @param digest The message digest
+ * @return The integer value
+ */
+ECDSABatchVerifier::BigNumPtr ECDSABatchVerifier::DigestToBigNum(
+    ConstByteArray const &digest) const
+{
+  BigNumPtr z{BN_bin2bn(digest.pointer(), static_cast<int>(digest.size()), nullptr)};
+  Check(z != nullptr, "BN_bin2bn(...)");
+
+  int const digest_bits = static_cast<int>(digest.size() * 8u);
+  int const order_bits  = BN_num_bits(order_.get());
+  if (digest_bits > order_bits)
+  {
+    Check(BN_rshift(z.get(), z.get(), digest_bits - order_bits), "BN_rshift(...)");
+  }
+
+  return z;
+}
+
+/**
+ * Parse a canonical signature, checking that the values are in the range [1, n)
+ *
+ * @param signature The canonical signature
+ * @param r The output r value
+ * @param s The output s value
+ * @return true if the signature is well formed, otherwise false
+ */
+bool ECDSABatchVerifier::ParseSignature(ConstByteArray const &signature, BIGNUM *r,
+                                        BIGNUM *s) const
+{
+  if (signature.size() != Curve::signatureSize)
+  {
+    return false;
+  }
+
+  auto const half = static_cast<int>(Curve::signatureSize >> 1u);
+  if (!BN_bin2bn(signature.pointer(), half, r) || !BN_bin2bn(signature.pointer() + half, half, s))
+  {
+    return false;
+  }
+
+  auto const in_range = [this](BIGNUM const *value) {
+    return !BN_is_zero(value) && (BN_cmp(value, order_.get()) < 0);
+  };
+
+  return in_range(r) && in_range(s);
+}
+
+}  // namespace crypto
+}  // namespace fetch
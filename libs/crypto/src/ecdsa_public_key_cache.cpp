@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/ecdsa_public_key_cache.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * Get the process wide public key cache
+ *
+ * @return The cache instance
+ */
+ECDSAPublicKeyCache &ECDSAPublicKeyCache::Instance()
+{
+  static ECDSAPublicKeyCache instance{};
+  return instance;
+}
+
+/**
+ * Construct the cache
+ *
+ * @param capacity The (approximate) maximum number of keys to be retained
+ */
+ECDSAPublicKeyCache::ECDSAPublicKeyCache(std::size_t capacity)
+  : stripe_capacity_{std::max<std::size_t>((capacity + NUM_STRIPES - 1) / NUM_STRIPES, 1)}
+{}
+
+/**
+ * Lookup the parsed public key for a given identity, parsing it if it is not already present
+ *
+ * @param identity The canonical public key bytes of the identity
+ * @return The parsed public key, or an empty pointer if the identity is not a valid key
+ */
+ECDSAPublicKeyCache::PublicKeyPtr ECDSAPublicKeyCache::Lookup(ConstByteArray const &identity)
+{
+  if (identity.empty())
+  {
+    return {};
+  }
+
+  auto &stripe = LookupStripe(identity);
+
+  {
+    std::lock_guard<Mutex> lock(stripe.lock);
+
+    auto it = stripe.elements.find(identity);
+    if (it != stripe.elements.end())
+    {
+      // mark the key as the most recently used
+      stripe.order.splice(stripe.order.begin(), stripe.order, it->second.position);
+
+      return it->second.key;
+    }
+  }
+
+  // parse the key outside of the lock since this is the expensive part of the operation
+  PublicKeyPtr key;
+  try
+  {
+    key = std::make_shared<PublicKey const>(identity);
+  }
+  catch (std::exception const &)
+  {
+    // invalid keys are not cached, so that they can not be used to flush out valid entries
+    return {};
+  }
+
+  std::lock_guard<Mutex> lock(stripe.lock);
+
+  // another thread might have parsed the same key in the meantime
+  auto it = stripe.elements.find(identity);
+  if (it != stripe.elements.end())
+  {
+    return it->second.key;
+  }
+
+  // make space for the new key
+  if (stripe.elements.size() >= stripe_capacity_)
+  {
+    stripe.elements.erase(stripe.order.back());
+    stripe.order.pop_back();
+  }
+
+  stripe.order.push_front(identity);
+  stripe.elements.emplace(identity, Element{key, stripe.order.begin()});
+
+  return key;
+}
+
+/**
+ * Get the number of keys currently in the cache
+ *
+ * @return The number of keys
+ */
+std::size_t ECDSAPublicKeyCache::size() const
+{
+  std::size_t total{0};
+
+  for (auto const &stripe : stripes_)
+  {
+    std::lock_guard<Mutex> lock(stripe.lock);
+    total += stripe.elements.size();
+  }
+
+  return total;
+}
+
+/**
+ * Get the maximum number of keys that can be retained by the cache
+ *
+ * @return The capacity
+ */
+std::size_t ECDSAPublicKeyCache::capacity() const
+{
+  return stripe_capacity_ * NUM_STRIPES;
+}
+
+ECDSAPublicKeyCache::Stripe &ECDSAPublicKeyCache::LookupStripe(ConstByteArray const &identity)
+{
+  return stripes_[std::hash<ConstByteArray>{}(identity) % NUM_STRIPES];
+}
+
+}  // namespace crypto
+}  // namespace fetch
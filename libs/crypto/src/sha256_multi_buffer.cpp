@@ -0,0 +1,425 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/sha256_multi_buffer.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace fetch {
+namespace crypto {
+namespace {
+
+constexpr std::size_t DIGEST_WORDS = 8;
+constexpr std::size_t BLOCK_WORDS  = 16;
+constexpr std::size_t ROUNDS       = 64;
+
+constexpr uint32_t INITIAL_STATE[DIGEST_WORDS] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                                  0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+constexpr uint32_t ROUND_CONSTANTS[ROUNDS] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+using RoundWords = std::array<uint32_t, ROUNDS>;
+
+uint32_t Rotr(uint32_t value, int bits)
+{
+  return (value >> bits) | (value << (32 - bits));
+}
+
+/**
+ * The second block of a 64 byte message only contains the padding, so its message schedule is
+ * identical for every input and can be combined with the round constants ahead of time.
+ */
+RoundWords const &PaddingBlockRoundWords()
+{
+  static RoundWords const words = []() {
+    RoundWords schedule{};
+    schedule[0]  = 0x80000000u;
+    schedule[15] = 512u;  // message length in bits
+
+    for (std::size_t t = BLOCK_WORDS; t < ROUNDS; ++t)
+    {
+      uint32_t const w15 = schedule[t - 15];
+      uint32_t const w2  = schedule[t - 2];
+      uint32_t const s0  = Rotr(w15, 7) ^ Rotr(w15, 18) ^ (w15 >> 3u);
+      uint32_t const s1  = Rotr(w2, 17) ^ Rotr(w2, 19) ^ (w2 >> 10u);
+      schedule[t]        = schedule[t - 16] + s0 + schedule[t - 7] + s1;
+    }
+
+    RoundWords combined{};
+    for (std::size_t t = 0; t < ROUNDS; ++t)
+    {
+      combined[t] = schedule[t] + ROUND_CONSTANTS[t];
+    }
+
+    return combined;
+  }();
+
+  return words;
+}
+
+uint32_t LoadBigEndian(uint8_t const *data)
+{
+  return (static_cast<uint32_t>(data[0]) << 24u) | (static_cast<uint32_t>(data[1]) << 16u) |
+         (static_cast<uint32_t>(data[2]) << 8u) | static_cast<uint32_t>(data[3]);
+}
+
+void StoreBigEndian(uint32_t value, uint8_t *data)
+{
+  data[0] = static_cast<uint8_t>(value >> 24u);
+  data[1] = static_cast<uint8_t>(value >> 16u);
+  data[2] = static_cast<uint8_t>(value >> 8u);
+  data[3] = static_cast<uint8_t>(value);
+}
+
+/**
+ * Lane policies. Each provides the 32 bit word operations needed by SHA256, applied to WIDTH
+ * independent messages at once.
+ */
+struct ScalarLanes
+{
+  using Word = uint32_t;
+
+  static constexpr std::size_t WIDTH = 1;
+
+  static Word Set(uint32_t value)
+  {
+    return value;
+  }
+
+  static Word Load(uint32_t const *values)
+  {
+    return values[0];
+  }
+
+  static void Store(Word word, uint32_t *values)
+  {
+    values[0] = word;
+  }
+
+  static Word Add(Word a, Word b)
+  {
+    return a + b;
+  }
+
+  static Word Xor(Word a, Word b)
+  {
+    return a ^ b;
+  }
+
+  static Word And(Word a, Word b)
+  {
+    return a & b;
+  }
+
+  static Word AndNot(Word a, Word b)
+  {
+    return ~a & b;
+  }
+
+  template <int BITS>
+  static Word ShiftRight(Word a)
+  {
+    return a >> BITS;
+  }
+
+  template <int BITS>
+  static Word Rotr(Word a)
+  {
+    return (a >> BITS) | (a << (32 - BITS));
+  }
+};
+
+#ifdef __SSE2__
+struct SSE2Lanes
+{
+  using Word = __m128i;
+
+  static constexpr std::size_t WIDTH = 4;
+
+  static Word Set(uint32_t value)
+  {
+    return _mm_set1_epi32(static_cast<int>(value));
+  }
+
+  static Word Load(uint32_t const *values)
+  {
+    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(values));
+  }
+
+  static void Store(Word word, uint32_t *values)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(values), word);
+  }
+
+  static Word Add(Word a, Word b)
+  {
+    return _mm_add_epi32(a, b);
+  }
+
+  static Word Xor(Word a, Word b)
+  {
+    return _mm_xor_si128(a, b);
+  }
+
+  static Word And(Word a, Word b)
+  {
+    return _mm_and_si128(a, b);
+  }
+
+  static Word AndNot(Word a, Word b)
+  {
+    return _mm_andnot_si128(a, b);
+  }
+
+  template <int BITS>
+  static Word ShiftRight(Word a)
+  {
+    return _mm_srli_epi32(a, BITS);
+  }
+
+  template <int BITS>
+  static Word Rotr(Word a)
+  {
+    return _mm_or_si128(_mm_srli_epi32(a, BITS), _mm_slli_epi32(a, 32 - BITS));
+  }
+};
+#endif
+
+#ifdef __AVX2__
+struct AVX2Lanes
+{
+  using Word = __m256i;
+
+  static constexpr std::size_t WIDTH = 8;
+
+  static Word Set(uint32_t value)
+  {
+    return _mm256_set1_epi32(static_cast<int>(value));
+  }
+
+  static Word Load(uint32_t const *values)
+  {
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(values));
+  }
+
+  static void Store(Word word, uint32_t *values)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(values), word);
+  }
+
+  static Word Add(Word a, Word b)
+  {
+    return _mm256_add_epi32(a, b);
+  }
+
+  static Word Xor(Word a, Word b)
+  {
+    return _mm256_xor_si256(a, b);
+  }
+
+  static Word And(Word a, Word b)
+  {
+    return _mm256_and_si256(a, b);
+  }
+
+  static Word AndNot(Word a, Word b)
+  {
+    return _mm256_andnot_si256(a, b);
+  }
+
+  template <int BITS>
+  static Word ShiftRight(Word a)
+  {
+    return _mm256_srli_epi32(a, BITS);
+  }
+
+  template <int BITS>
+  static Word Rotr(Word a)
+  {
+    return _mm256_or_si256(_mm256_srli_epi32(a, BITS), _mm256_slli_epi32(a, 32 - BITS));
+  }
+};
+#endif
+
+template <typename L>
+struct Compressor
+{
+  using Word = typename L::Word;
+
+  /**
+   * Run the 64 rounds of the compression function over the state, where round_words[t] is the
+   * sum of the message schedule and the round constant for round t
+   */
+  template <typename RoundWord>
+  static void Rounds(Word *state, RoundWord &&round_word)
+  {
+    Word a = state[0];
+    Word b = state[1];
+    Word c = state[2];
+    Word d = state[3];
+    Word e = state[4];
+    Word f = state[5];
+    Word g = state[6];
+    Word h = state[7];
+
+    for (std::size_t t = 0; t < ROUNDS; ++t)
+    {
+      Word const s1 =
+          L::Xor(L::Xor(L::template Rotr<6>(e), L::template Rotr<11>(e)), L::template Rotr<25>(e));
+      Word const ch = L::Xor(L::And(e, f), L::AndNot(e, g));
+      Word const t1 = L::Add(L::Add(h, s1), L::Add(ch, round_word(t)));
+
+      Word const s0 =
+          L::Xor(L::Xor(L::template Rotr<2>(a), L::template Rotr<13>(a)), L::template Rotr<22>(a));
+      Word const maj = L::Xor(L::Xor(L::And(a, b), L::And(a, c)), L::And(b, c));
+      Word const t2  = L::Add(s0, maj);
+
+      h = g;
+      g = f;
+      f = e;
+      e = L::Add(d, t1);
+      d = c;
+      c = b;
+      b = a;
+      a = L::Add(t1, t2);
+    }
+
+    state[0] = L::Add(state[0], a);
+    state[1] = L::Add(state[1], b);
+    state[2] = L::Add(state[2], c);
+    state[3] = L::Add(state[3], d);
+    state[4] = L::Add(state[4], e);
+    state[5] = L::Add(state[5], f);
+    state[6] = L::Add(state[6], g);
+    state[7] = L::Add(state[7], h);
+  }
+
+  /**
+   * Hash up to WIDTH digest pairs, unused lanes are filled with zeros and their results discarded
+   */
+  static void Hash(SHA256DigestPair const *pairs, std::size_t count)
+  {
+    uint32_t lanes[L::WIDTH];
+    Word     schedule[ROUNDS];
+
+    // load the message words, the first block is the concatenation of the two digests
+    for (std::size_t t = 0; t < BLOCK_WORDS; ++t)
+    {
+      for (std::size_t lane = 0; lane < L::WIDTH; ++lane)
+      {
+        lanes[lane] = 0;
+
+        if (lane < count)
+        {
+          uint8_t const *input = (t < DIGEST_WORDS) ? pairs[lane].first : pairs[lane].second;
+          lanes[lane]          = LoadBigEndian(input + ((t % DIGEST_WORDS) * 4u));
+        }
+      }
+
+      schedule[t] = L::Load(lanes);
+    }
+
+    for (std::size_t t = BLOCK_WORDS; t < ROUNDS; ++t)
+    {
+      Word const w15 = schedule[t - 15];
+      Word const w2  = schedule[t - 2];
+      Word const s0  = L::Xor(L::Xor(L::template Rotr<7>(w15), L::template Rotr<18>(w15)),
+                             L::template ShiftRight<3>(w15));
+      Word const s1  = L::Xor(L::Xor(L::template Rotr<17>(w2), L::template Rotr<19>(w2)),
+                             L::template ShiftRight<10>(w2));
+      schedule[t]    = L::Add(L::Add(schedule[t - 16], s0), L::Add(schedule[t - 7], s1));
+    }
+
+    Word state[DIGEST_WORDS];
+    for (std::size_t i = 0; i < DIGEST_WORDS; ++i)
+    {
+      state[i] = L::Set(INITIAL_STATE[i]);
+    }
+
+    Rounds(state, [&schedule](std::size_t t) {
+      return L::Add(schedule[t], L::Set(ROUND_CONSTANTS[t]));
+    });
+
+    auto const &padding = PaddingBlockRoundWords();
+    Rounds(state, [&padding](std::size_t t) { return L::Set(padding[t]); });
+
+    // write out the digests
+    for (std::size_t i = 0; i < DIGEST_WORDS; ++i)
+    {
+      L::Store(state[i], lanes);
+
+      for (std::size_t lane = 0; lane < count; ++lane)
+      {
+        StoreBigEndian(lanes[lane], pairs[lane].output + (i * 4u));
+      }
+    }
+  }
+};
+
+#if defined(__AVX2__)
+using WidestLanes = AVX2Lanes;
+#elif defined(__SSE2__)
+using WidestLanes = SSE2Lanes;
+#else
+using WidestLanes = ScalarLanes;
+#endif
+
+}  // namespace
+
+void HashDigestPairs(SHA256DigestPair const *pairs, std::size_t count)
+{
+  std::size_t offset = 0;
+
+  // process full groups of lanes, followed by a partially filled group for the remainder
+  while (offset < count)
+  {
+    std::size_t const remaining = count - offset;
+
+    if (remaining == 1)
+    {
+      Compressor<ScalarLanes>::Hash(pairs + offset, 1);
+      break;
+    }
+
+    std::size_t const batch = (remaining < WidestLanes::WIDTH) ? remaining : WidestLanes::WIDTH;
+    Compressor<WidestLanes>::Hash(pairs + offset, batch);
+    offset += batch;
+  }
+}
+
+std::size_t DigestPairLanes()
+{
+  return WidestLanes::WIDTH;
+}
+
+}  // namespace crypto
+}  // namespace fetch
@@ -17,6 +17,7 @@
 //------------------------------------------------------------------------------
 
 #include "crypto/ecdsa.hpp"
+#include "crypto/ecdsa_public_key_cache.hpp"
 #include "crypto/verifier.hpp"
 
 namespace fetch {
@@ -49,11 +50,21 @@ std::unique_ptr<Verifier> Verifier::Build(Identity const &identity)
 bool Verifier::Verify(Identity const &identity, ConstByteArray const &data,
                       ConstByteArray const &signature)
 {
-  // build a compatible verifier
-  auto verifier = Build(identity);
+  if (signature.empty())
+  {
+    return false;
+  }
+
+  // only signature scheme currently supported, reuse the previously parsed public key if possible
+  auto const public_key = ECDSAPublicKeyCache::Instance().Lookup(identity.identifier());
+  if (!public_key)
+  {
+    return false;
+  }
 
   // determine if the signature is valid
-  return verifier->Verify(data, signature);
+  openssl::ECDSASignature<> const sig{signature};
+  return sig.Verify(*public_key, data);
 }
 
 /**
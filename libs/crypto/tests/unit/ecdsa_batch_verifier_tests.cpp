@@ -0,0 +1,156 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "crypto/ecdsa.hpp"
+#include "crypto/ecdsa_batch_verifier.hpp"
+#include "crypto/ecdsa_public_key_cache.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+using fetch::crypto::ECDSABatchVerifier;
+using fetch::crypto::ECDSAPublicKeyCache;
+using fetch::crypto::ECDSASigner;
+using fetch::crypto::ECDSAVerifier;
+
+ConstByteArray Message(std::size_t index)
+{
+  return ConstByteArray{"message number " + std::to_string(index)};
+}
+
+ConstByteArray Corrupt(ConstByteArray const &value)
+{
+  ByteArray copy = value.Copy();
+  copy[copy.size() / 2] ^= 0x01;
+  return ConstByteArray{copy};
+}
+
+TEST(ECDSABatchVerifierTests, ValidSignaturesAreAccepted)
+{
+  ECDSAPublicKeyCache cache{};
+  ECDSABatchVerifier  verifier{cache};
+
+  std::vector<ECDSASigner> signers(3);
+  for (std::size_t i = 0; i < 12; ++i)
+  {
+    auto &signer = signers[i % signers.size()];
+    EXPECT_EQ(verifier.Add(signer.identity().identifier(), Message(i), signer.Sign(Message(i))),
+              i);
+  }
+
+  auto const results = verifier.Verify();
+
+  ASSERT_EQ(results.size(), 12u);
+  for (auto const result : results)
+  {
+    EXPECT_TRUE(result);
+  }
+
+  // only the distinct public keys are retained and the batch has been emptied
+  EXPECT_EQ(cache.size(), signers.size());
+  EXPECT_EQ(verifier.size(), 0u);
+}
+
+TEST(ECDSABatchVerifierTests, InvalidSignaturesAreRejectedIndividually)
+{
+  ECDSABatchVerifier verifier{};
+  ECDSASigner        signer{};
+  ECDSASigner        other{};
+
+  auto const identity  = signer.identity().identifier();
+  auto const signature = signer.Sign(Message(0));
+  auto const zero      = ConstByteArray{std::string(64, '\0')};
+
+  verifier.Add(identity, Message(0), signature);                        // valid
+  verifier.Add(identity, Message(1), signature);                        // wrong message
+  verifier.Add(other.identity().identifier(), Message(0), signature);   // wrong signer
+  verifier.Add(identity, Message(0), Corrupt(signature));               // corrupt signature
+  verifier.Add(identity, Message(0), signature.SubArray(0, 32));        // short signature
+  verifier.Add(identity, Message(0), ConstByteArray{});                 // missing signature
+  verifier.Add(Corrupt(identity), Message(0), signature);               // invalid public key
+  verifier.Add(identity, Message(0), zero);                             // zero r and s
+  verifier.Add(identity, Message(2), signer.Sign(Message(2)));          // valid
+
+  auto const results = verifier.Verify();
+
+  EXPECT_EQ(results, (ECDSABatchVerifier::Results{true, false, false, false, false, false, false,
+                                                  false, true}));
+}
+
+TEST(ECDSABatchVerifierTests, ResultsMatchTheSingleVerifier)
+{
+  ECDSABatchVerifier verifier{};
+
+  std::vector<ECDSASigner> signers(4);
+  std::vector<bool>        expected;
+
+  for (std::size_t i = 0; i < 32; ++i)
+  {
+    auto &     signer    = signers[i % signers.size()];
+    auto const data      = Message(i);
+    auto       signature = signer.Sign(data);
+
+    // corrupt some of the signatures
+    if ((i % 3) == 0)
+    {
+      signature = Corrupt(signature);
+    }
+
+    ECDSAVerifier single{signer.identity()};
+    expected.push_back(single.Verify(data, signature));
+
+    verifier.Add(signer.identity().identifier(), data, signature);
+  }
+
+  EXPECT_EQ(verifier.Verify(), expected);
+}
+
+TEST(ECDSAPublicKeyCacheTests, CacheIsBounded)
+{
+  ECDSAPublicKeyCache cache{16};
+  EXPECT_EQ(cache.capacity(), 16u);
+
+  ECDSASigner signer{};
+  auto const  key = cache.Lookup(signer.identity().identifier());
+  ASSERT_TRUE(static_cast<bool>(key));
+
+  // the same parsed key is returned for subsequent lookups
+  EXPECT_EQ(cache.Lookup(signer.identity().identifier()), key);
+
+  for (std::size_t i = 0; i < 64; ++i)
+  {
+    EXPECT_TRUE(static_cast<bool>(cache.Lookup(ECDSASigner{}.identity().identifier())));
+    EXPECT_LE(cache.size(), cache.capacity());
+  }
+
+  // invalid keys are not cached
+  std::size_t const size = cache.size();
+  EXPECT_FALSE(static_cast<bool>(cache.Lookup(Corrupt(signer.identity().identifier()))));
+  EXPECT_FALSE(static_cast<bool>(cache.Lookup(ConstByteArray{})));
+  EXPECT_EQ(cache.size(), size);
+}
+
+}  // namespace
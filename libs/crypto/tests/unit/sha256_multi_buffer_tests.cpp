@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/byte_array/encoders.hpp"
+#include "crypto/sha256.hpp"
+#include "crypto/sha256_multi_buffer.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::crypto::DigestPairLanes;
+using fetch::crypto::HashDigestPairs;
+using fetch::crypto::SHA256;
+using fetch::crypto::SHA256DigestPair;
+
+constexpr std::size_t DIGEST_SIZE = SHA256::size_in_bytes;
+
+ByteArray ReferenceHash(uint8_t const *first, uint8_t const *second)
+{
+  ByteArray output;
+  output.Resize(DIGEST_SIZE);
+
+  SHA256 hasher;
+  hasher.Reset();
+  hasher.Update(first, DIGEST_SIZE);
+  hasher.Update(second, DIGEST_SIZE);
+  hasher.Final(output.pointer());
+
+  return output;
+}
+
+TEST(SHA256MultiBufferTests, empty_digests_match_known_value)
+{
+  uint8_t const zeros[DIGEST_SIZE] = {};
+  uint8_t       output[DIGEST_SIZE];
+
+  SHA256DigestPair const pair{zeros, zeros, output};
+  HashDigestPairs(&pair, 1);
+
+  EXPECT_EQ(fetch::byte_array::ToHex(ByteArray{output, DIGEST_SIZE}),
+            "f5a5fd42d16a20302798ef6ed309979b43003d2320d9f0e8ea9831a92759fb4b");
+}
+
+TEST(SHA256MultiBufferTests, batches_match_reference_implementation)
+{
+  uint32_t seed = 12345;
+
+  // cover the scalar path, partially filled lane groups and multiple full groups
+  for (std::size_t count = 0; count <= (DigestPairLanes() * 3) + 1; ++count)
+  {
+    std::vector<uint8_t> inputs(count * 2 * DIGEST_SIZE);
+    for (auto &byte : inputs)
+    {
+      seed = (seed * 1103515245u) + 12345u;
+      byte = static_cast<uint8_t>(seed >> 16u);
+    }
+
+    std::vector<uint8_t>          outputs(count * DIGEST_SIZE);
+    std::vector<SHA256DigestPair> pairs(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      pairs[i] = {&inputs[i * 2 * DIGEST_SIZE], &inputs[(i * 2 + 1) * DIGEST_SIZE],
+                  &outputs[i * DIGEST_SIZE]};
+    }
+
+    HashDigestPairs(pairs.data(), pairs.size());
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(ReferenceHash(pairs[i].first, pairs[i].second),
+                (ByteArray{pairs[i].output, DIGEST_SIZE}))
+          << "pair " << i << " of " << count;
+    }
+  }
+}
+
+}  // namespace
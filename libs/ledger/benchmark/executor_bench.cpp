@@ -23,15 +23,29 @@
 #include "ledger/chain/address.hpp"
 #include "ledger/chain/transaction_builder.hpp"
 #include "ledger/chaincode/token_contract.hpp"
+#include "ledger/execution_manager.hpp"
 #include "ledger/executor.hpp"
 #include "ledger/identifier.hpp"
 #include "ledger/state_sentinel_adapter.hpp"
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
 namespace {
 
 using fetch::ledger::Executor;
+using fetch::ledger::ExecutionManager;
+using fetch::ledger::ExecutorInterface;
+using fetch::ledger::Block;
+using fetch::ledger::TransactionLayout;
+using fetch::ledger::Digest;
 using fetch::ledger::Transaction;
 using fetch::ledger::TransactionBuilder;
 using fetch::ledger::Address;
@@ -89,6 +103,197 @@ void Executor_BasicBenchmark(benchmark::State &state)
   }
 }
 
+/**
+ * Compare the execution of plain transfers using the generic path (through the token contract)
+ * and the native fast path
+ *
+ * Arguments: (fast path enabled, number of transfers)
+ */
+void Executor_Transfers(benchmark::State &state)
+{
+  bool const        fast_path     = state.range(0) != 0;
+  std::size_t const num_transfers = static_cast<std::size_t>(state.range(1));
+
+  auto     storage = std::make_shared<InMemoryStorageUnit>();
+  Executor executor{storage, nullptr};
+  executor.EnableTransferFastPath(fast_path);
+
+  BitVector shards{1};
+  shards.SetAllOne();
+
+  // create a transaction with transfers to a number of different wallets
+  ECDSASigner        signer{};
+  Address const      from{signer.identity()};
+  TransactionBuilder builder{};
+
+  builder.From(from).ValidUntil(1000).ChargeRate(1).ChargeLimit(50);
+  for (std::size_t i = 0; i < num_transfers; ++i)
+  {
+    ECDSASigner recipient{};
+    builder.Transfer(Address{recipient.identity()}, 1);
+  }
+
+  auto const tx = builder.Signer(signer.identity()).Seal().Sign(signer).Build();
+  storage->AddTransaction(*tx);
+
+  // add enough funds for every iteration to succeed
+  {
+    StateSentinelAdapter adapter{*storage, Identifier{"fetch.token"}, shards};
+
+    TokenContract tokens{};
+
+    tokens.Attach(adapter);
+    tokens.AddTokens(from, 1ull << 62u);
+    tokens.Detach();
+  }
+
+  for (auto _ : state)
+  {
+    auto const result = executor.Execute(tx->digest(), 1, 1, shards);
+    if (ExecutorInterface::Status::SUCCESS != result.status)
+    {
+      state.SkipWithError("Transaction execution failed");
+      break;
+    }
+  }
+
+  state.counters["tx/s"] =
+      benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+/**
+ * Executor which simply occupies the calling thread for a fixed period of time, so that the
+ * scheduling overhead and parallelism of the execution manager can be measured in isolation
+ */
+class BusyExecutor : public ExecutorInterface
+{
+public:
+  using Clock = std::chrono::high_resolution_clock;
+
+  static constexpr std::chrono::microseconds EXECUTION_TIME{50};
+
+  Result Execute(Digest const &, BlockIndex, SliceIndex, BitVector const &) override
+  {
+    auto const deadline = Clock::now() + EXECUTION_TIME;
+    while (Clock::now() < deadline)
+    {
+      // spin
+    }
+
+    return {Status::SUCCESS, 0, 0, 0};
+  }
+
+  void SettleFees(fetch::ledger::Address const &, TokenAmount, uint32_t) override
+  {}
+};
+
+constexpr std::chrono::microseconds BusyExecutor::EXECUTION_TIME;
+
+/**
+ * Generate a block in which each transaction uses one or two (randomly selected) lanes
+ *
+ * @param log2_num_lanes The log2 number of lanes
+ * @param num_slices The number of slices
+ * @return The generated block body
+ */
+Block::Body GenerateBlock(uint32_t log2_num_lanes, std::size_t num_slices)
+{
+  std::mt19937 rng{42};
+
+  std::size_t const num_lanes = 1u << log2_num_lanes;
+
+  Block::Body block{};
+  block.slices.resize(num_slices);
+
+  std::vector<std::size_t> lanes(num_lanes);
+  for (auto &slice : block.slices)
+  {
+    // randomly pack the lanes into transactions which use 1 or 2 lanes
+    std::iota(lanes.begin(), lanes.end(), 0);
+    std::shuffle(lanes.begin(), lanes.end(), rng);
+
+    std::size_t offset = 0;
+    while (offset < num_lanes)
+    {
+      std::size_t const size = std::min<std::size_t>((rng() & 1u) + 1u, num_lanes - offset);
+
+      BitVector mask{num_lanes};
+      for (std::size_t i = 0; i < size; ++i)
+      {
+        mask.set(lanes[offset + i], 1);
+      }
+
+      fetch::byte_array::ByteArray digest;
+      digest.Resize(32);
+      for (std::size_t i = 0; i < digest.size(); ++i)
+      {
+        digest[i] = static_cast<uint8_t>(rng() & 0xFFu);
+      }
+
+      slice.emplace_back(TransactionLayout{digest, mask, 1, 0, 100});
+      offset += size;
+    }
+  }
+
+  return block;
+}
+
+void ExecutionManager_BlockExecution(benchmark::State &state)
+{
+  static constexpr uint32_t    LOG2_NUM_LANES = 4;
+  static constexpr std::size_t NUM_SLICES     = 16;
+
+  auto const num_executors = static_cast<std::size_t>(state.range(0));
+
+  auto storage = std::make_shared<InMemoryStorageUnit>();
+  auto manager =
+      std::make_shared<ExecutionManager>(num_executors, LOG2_NUM_LANES, storage,
+                                         []() { return std::make_shared<BusyExecutor>(); });
+
+  auto const  block            = GenerateBlock(LOG2_NUM_LANES, NUM_SLICES);
+  std::size_t num_transactions = 0;
+  for (auto const &slice : block.slices)
+  {
+    num_transactions += slice.size();
+  }
+
+  manager->Start();
+
+  for (auto _ : state)
+  {
+    if (ExecutionManager::ScheduleStatus::SCHEDULED != manager->Execute(block))
+    {
+      state.SkipWithError("Unable to schedule block");
+      break;
+    }
+
+    // wait for the block execution to complete
+    while (ExecutionManager::State::IDLE != manager->GetState())
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  manager->Stop();
+
+  state.counters["tx/s"] = benchmark::Counter(
+      static_cast<double>(num_transactions * static_cast<std::size_t>(state.iterations())),
+      benchmark::Counter::kIsRate);
+}
+
 }  // namespace
 
 BENCHMARK(Executor_BasicBenchmark);
+BENCHMARK(Executor_Transfers)
+    ->Args({0, 1})
+    ->Args({1, 1})
+    ->Args({0, 4})
+    ->Args({1, 4})
+    ->Args({0, 16})
+    ->Args({1, 16})
+    ->ArgNames({"fast", "transfers"});
+BENCHMARK(ExecutionManager_BlockExecution)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -123,6 +123,22 @@ bool InMemoryStorageUnit::GetTransaction(Digest const &digest, Transaction &tx)
   return success;
 }
 
+InMemoryStorageUnit::Transactions InMemoryStorageUnit::GetTransactions(DigestSet const &digests)
+{
+  Transactions transactions{};
+
+  for (auto const &digest : digests)
+  {
+    auto it = tx_store_.find(digest);
+    if (it != tx_store_.end())
+    {
+      transactions.push_back(*(it->second));
+    }
+  }
+
+  return transactions;
+}
+
 bool InMemoryStorageUnit::HasTransaction(Digest const &digest)
 {
   return tx_store_.find(digest) != tx_store_.end();
@@ -51,10 +51,11 @@ public:
 
   /// @name Transaction Interface
   /// @{
-  void AddTransaction(Transaction const &tx) override;
-  bool GetTransaction(Digest const &digest, Transaction &tx) override;
-  bool HasTransaction(Digest const &digest) override;
-  void IssueCallForMissingTxs(DigestSet const &tx_set) override;
+  void         AddTransaction(Transaction const &tx) override;
+  bool         GetTransaction(Digest const &digest, Transaction &tx) override;
+  Transactions GetTransactions(DigestSet const &digests) override;
+  bool         HasTransaction(Digest const &digest) override;
+  void         IssueCallForMissingTxs(DigestSet const &tx_set) override;
   /// @}
 
   TxLayouts PollRecentTx(uint32_t) override;
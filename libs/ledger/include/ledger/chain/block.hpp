@@ -80,6 +80,7 @@ public:
 
   // Helper functions
   std::size_t GetTransactionCount() const;
+  Digest      CalculateDigest() const;
   void        UpdateDigest();
   void        UpdateTimestamp();
 };
@@ -23,6 +23,7 @@
 #include "core/state_machine.hpp"
 #include "core/threading/synchronised_state.hpp"
 #include "ledger/chain/block.hpp"
+#include "ledger/chain/block_prevalidator.hpp"
 #include "ledger/chain/main_chain.hpp"
 #include "ledger/chain/transaction.hpp"
 #include "ledger/dag/dag_interface.hpp"
@@ -269,6 +270,7 @@ private:
   using DeadlineTimer        = fetch::moment::DeadlineTimer;
   using SynergeticExecMgrPtr = std::unique_ptr<SynergeticExecutionManagerInterface>;
   using SynExecStatus        = SynergeticExecutionManagerInterface::ExecStatus;
+  using BlockPrevalidatorPtr = std::unique_ptr<BlockPrevalidator>;
 
   /// @name Monitor State
   /// @{
@@ -298,6 +300,7 @@ private:
   bool            ScheduleNextBlock();
   bool            ScheduleBlock(Block const &block);
   ExecutionStatus QueryExecutorStatus();
+  void            SchedulePrevalidation();
   void            UpdateNextBlockTime();
   void            UpdateTxStatus(Block const &block);
 
@@ -353,6 +356,11 @@ private:
   SynergeticExecMgrPtr synergetic_exec_mgr_;
   /// }
 
+  /// @name Pipelined Validation
+  /// @{
+  BlockPrevalidatorPtr prevalidator_;  ///< Stateless checks for upcoming blocks (when enabled)
+  /// @}
+
   /// @name Telemetry
   /// @{
   telemetry::CounterPtr reload_state_count_;
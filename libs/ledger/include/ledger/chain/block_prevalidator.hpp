@@ -0,0 +1,127 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/digest.hpp"
+#include "ledger/chain/main_chain.hpp"
+#include "telemetry/telemetry.hpp"
+#include "vectorise/threading/pool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+
+namespace fetch {
+namespace ledger {
+
+class StorageUnitInterface;
+
+/**
+ * Runs the stateless block checks (those which do not depend on the execution of previous blocks)
+ * on a pool of worker threads.
+ *
+ * During catch up the Block Coordinator schedules the blocks which follow the block currently
+ * being executed, so that by the time each of them reaches pre-execution validation the proof,
+ * digest / merkle root, lane and slice checks have been completed and the transactions that are
+ * missing from storage have already been requested from peers.
+ *
+ * Only the checks which are also made when blocks are received are performed here, so that whether
+ * a block is accepted does not depend on the pipeline being enabled.
+ *
+ * The scheduling and query methods are not thread safe and should only be called from the owning
+ * (state machine) thread.
+ */
+class BlockPrevalidator
+{
+public:
+  using BlockPtr = MainChain::BlockPtr;
+
+  struct Config
+  {
+    std::size_t num_lanes;    ///< The expected number of lanes
+    std::size_t num_slices;   ///< The expected number of slices
+    std::size_t num_threads;  ///< The number of worker threads
+    std::size_t max_pending;  ///< The maximum number of blocks scheduled at any one time
+  };
+
+  /**
+   * The outcome of the stateless checks for a block
+   */
+  struct Result
+  {
+    bool        valid{false};     ///< Flag to signal if all the checks passed
+    char const *reason{nullptr};  ///< The reason for the failure (if any)
+    DigestSet   missing_txs{};    ///< The transactions which were not present in storage
+  };
+
+  enum class Status
+  {
+    UNKNOWN,   ///< The block has not been scheduled
+    PENDING,   ///< The checks for the block are still in progress
+    COMPLETE,  ///< The checks for the block have completed
+  };
+
+  // Construction / Destruction
+  BlockPrevalidator(StorageUnitInterface &storage_unit, Config const &config);
+  BlockPrevalidator(BlockPrevalidator const &) = delete;
+  BlockPrevalidator(BlockPrevalidator &&)      = delete;
+  ~BlockPrevalidator()                         = default;
+
+  /// @name Pipeline
+  /// @{
+  bool        Schedule(BlockPtr const &block);
+  Status      Query(Digest const &hash, Result &result);
+  void        Prune(uint64_t block_number);
+  void        Reset();
+  std::size_t size() const;
+  /// @}
+
+  Result Validate(Block const &block);
+
+  // Operators
+  BlockPrevalidator &operator=(BlockPrevalidator const &) = delete;
+  BlockPrevalidator &operator=(BlockPrevalidator &&) = delete;
+
+private:
+  using ThreadPool = threading::Pool;
+
+  struct Entry
+  {
+    uint64_t            block_number;  ///< The height of the scheduled block
+    std::future<Result> result;        ///< The (eventual) result of the checks
+  };
+
+  using Entries = DigestMap<Entry>;
+
+  StorageUnitInterface &storage_unit_;
+  Config const          config_;
+  Entries               entries_;  ///< The blocks which have been scheduled (keyed by hash)
+
+  /// @name Telemetry
+  /// @{
+  telemetry::CounterPtr validated_count_;
+  telemetry::CounterPtr invalid_count_;
+  telemetry::CounterPtr missing_tx_count_;
+  /// @}
+
+  ThreadPool threads_;  ///< Declared last so that workers stop before the state they reference
+};
+
+}  // namespace ledger
+}  // namespace fetch
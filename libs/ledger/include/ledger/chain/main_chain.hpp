@@ -17,7 +17,7 @@
 //
 //------------------------------------------------------------------------------
 
-#include "core/bloom_filter.hpp"
+#include "core/blocked_bloom_filter.hpp"
 #include "core/byte_array/byte_array.hpp"
 #include "core/byte_array/decoders.hpp"
 #include "core/mutex.hpp"
@@ -184,17 +184,20 @@ private:
     }
   };
 
-  using IntBlockPtr   = std::shared_ptr<Block>;
-  using BlockMap      = std::unordered_map<BlockHash, IntBlockPtr>;
-  using References    = std::unordered_multimap<BlockHash, BlockHash>;
-  using Proof         = Block::Proof;
-  using TipsMap       = std::unordered_map<BlockHash, Tip>;
-  using BlockHashList = std::list<BlockHash>;
-  using LooseBlockMap = std::unordered_map<BlockHash, BlockHashList>;
-  using BlockStore    = fetch::storage::ObjectStore<DbRecord>;
-  using BlockStorePtr = std::unique_ptr<BlockStore>;
-  using RMutex        = std::recursive_mutex;
-  using RLock         = std::unique_lock<RMutex>;
+  using IntBlockPtr      = std::shared_ptr<Block>;
+  using BlockMap         = std::unordered_map<BlockHash, IntBlockPtr>;
+  using References       = std::unordered_multimap<BlockHash, BlockHash>;
+  using TransactionIndex = std::unordered_multimap<Digest, BlockHash>;
+  using Proof            = Block::Proof;
+  using TipsMap          = std::unordered_map<BlockHash, Tip>;
+  using BlockHashList    = std::list<BlockHash>;
+  using LooseBlockMap    = std::unordered_map<BlockHash, BlockHashList>;
+  using BlockStore       = fetch::storage::ObjectStore<DbRecord>;
+  using BlockStorePtr    = std::unique_ptr<BlockStore>;
+  using TxStore          = fetch::storage::ObjectStore<uint64_t>;
+  using TxStorePtr       = std::unique_ptr<TxStore>;
+  using RMutex           = std::recursive_mutex;
+  using RLock            = std::unique_lock<RMutex>;
 
   struct HeaviestTip
   {
@@ -207,6 +210,10 @@ private:
   /// @name Persistence Management
   /// @{
   void RecoverFromFile(Mode mode);
+  bool LoadTransactionIndexHead(BlockHash const &head_hash);
+  void KeepTransactionIndexHead();
+  bool LoadBloomFilter(BlockHash const &head_hash);
+  void KeepBloomFilter();
   void WriteToFile();
   void TrimCache();
   void FlushBlock(IntBlockPtr const &block);
@@ -232,8 +239,11 @@ private:
   /// @{
   void                CacheBlock(IntBlockPtr const &block) const;
   BlockMap::size_type UncacheBlock(BlockHash const &hash) const;
+  BlockMap::iterator  UncacheBlock(BlockMap::iterator it) const;
   void                KeepBlock(IntBlockPtr const &block) const;
   bool                LoadBlock(BlockHash const &hash, Block &block) const;
+  void                KeepTransactions(Block const &block) const;
+  void                ForgetTransactions(Block const &block) const;
   /// @}
 
   /// @name Tip Management
@@ -245,27 +255,30 @@ private:
 
   static IntBlockPtr CreateGenesisBlock();
 
-  BlockHash GetHeadHash();
+  BlockHash GetHeadHash() const;
   void      SetHeadHash(BlockHash const &hash);
 
   bool RemoveTree(BlockHash const &hash, BlockHashSet &invalidated_blocks);
 
-  BlockStorePtr block_store_;  /// < Long term storage and backup
-  std::fstream  head_store_;
+  BlockStorePtr        block_store_;  /// < Long term storage and backup
+  TxStorePtr           tx_store_;     /// < Block numbers of the transactions in long term storage
+  mutable std::fstream head_store_;
 
   mutable RMutex   lock_;         ///< Mutex protecting block_chain_, tips_ & heaviest_
   mutable BlockMap block_chain_;  ///< All recent blocks are kept in memory
   // The whole tree of previous-next relations among cached blocks
-  mutable References                references_;
-  TipsMap                           tips_;          ///< Keep track of the tips
-  HeaviestTip                       heaviest_;      ///< Heaviest block/tip
-  LooseBlockMap                     loose_blocks_;  ///< Waiting (loose) blocks
-  std::unique_ptr<BasicBloomFilter> bloom_filter_;
-  bool const                        enable_bloom_filter_;
-  telemetry::GaugePtr<std::size_t>  bloom_filter_queried_bit_count_;
-  telemetry::CounterPtr             bloom_filter_query_count_;
-  telemetry::CounterPtr             bloom_filter_positive_count_;
-  telemetry::CounterPtr             bloom_filter_false_positive_count_;
+  mutable References                  references_;
+  // The cached blocks which contain each transaction
+  mutable TransactionIndex            tx_index_;
+  TipsMap                             tips_;          ///< Keep track of the tips
+  HeaviestTip                         heaviest_;      ///< Heaviest block/tip
+  LooseBlockMap                       loose_blocks_;  ///< Waiting (loose) blocks
+  std::unique_ptr<BlockedBloomFilter> bloom_filter_;
+  bool const                          enable_bloom_filter_;
+  telemetry::GaugePtr<std::size_t>    bloom_filter_queried_bit_count_;
+  telemetry::CounterPtr               bloom_filter_query_count_;
+  telemetry::CounterPtr               bloom_filter_positive_count_;
+  telemetry::CounterPtr               bloom_filter_false_positive_count_;
 
   /**
    * Serializer for the DbRecord
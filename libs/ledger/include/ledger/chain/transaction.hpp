@@ -24,9 +24,14 @@
 #include "ledger/chain/digest.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace fetch {
+namespace crypto {
+class ECDSABatchVerifier;
+}
+
 namespace ledger {
 
 /**
@@ -133,6 +138,9 @@ public:
   bool Verify();
   bool IsVerified() const;
   bool IsSignedByFromAddress() const;
+
+  static void VerifyBatch(std::vector<std::shared_ptr<Transaction>> const &transactions,
+                          crypto::ECDSABatchVerifier &                     verifier);
   /// @}
 
   // Operators
@@ -0,0 +1,131 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/fnv.hpp"  // needed for std::hash<ConstByteArray>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace fetch {
+
+namespace vm {
+struct Executable;
+class Module;
+}  // namespace vm
+
+namespace ledger {
+
+/**
+ * Process wide, size bounded LRU cache of compiled smart contracts keyed by the contract digest.
+ *
+ * Entries are immutable once they have been added to the cache and as such can be shared between
+ * all of the executor threads. Optionally, the compiled executables can also be persisted to disk
+ * so that they do not need to be recompiled after a restart.
+ */
+class CompiledContractCache
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Executable     = vm::Executable;
+  using ExecutablePtr  = std::shared_ptr<Executable const>;
+  using ModulePtr      = std::shared_ptr<vm::Module>;
+
+  struct Entry
+  {
+    ExecutablePtr executable;  ///< The compiled executable
+    ModulePtr     module;      ///< The module the executable was compiled against
+    std::size_t   size{0};     ///< The estimated memory footprint of the executable
+  };
+
+  using EntryPtr = std::shared_ptr<Entry const>;
+
+  static constexpr std::size_t DEFAULT_MAX_SIZE = 64u * 1024u * 1024u;  // 64MB
+
+  static CompiledContractCache &Instance();
+
+  // Construction / Destruction
+  explicit CompiledContractCache(std::size_t max_size = DEFAULT_MAX_SIZE);
+  CompiledContractCache(CompiledContractCache const &) = delete;
+  CompiledContractCache(CompiledContractCache &&)      = delete;
+  ~CompiledContractCache()                             = default;
+
+  /// @name In Memory Cache
+  /// @{
+  EntryPtr Lookup(ConstByteArray const &digest);
+  EntryPtr Add(ConstByteArray const &digest, ExecutablePtr executable, ModulePtr module);
+  void     SetMaxSize(std::size_t max_size);
+  void     Clear();
+  /// @}
+
+  /// @name Persistent Executables
+  /// @{
+  void EnablePersistence(std::string path_prefix);
+  bool LoadExecutable(ConstByteArray const &digest, Executable &executable) const;
+  bool StoreExecutable(ConstByteArray const &digest, Executable const &executable) const;
+  /// @}
+
+  /// @name Statistics
+  /// @{
+  std::size_t size() const;
+  std::size_t num_entries() const;
+  uint64_t    hits() const;
+  uint64_t    misses() const;
+  /// @}
+
+  static std::size_t EstimateSize(Executable const &executable);
+
+  // Operators
+  CompiledContractCache &operator=(CompiledContractCache const &) = delete;
+  CompiledContractCache &operator=(CompiledContractCache &&) = delete;
+
+private:
+  using Mutex      = std::mutex;
+  using DigestList = std::list<ConstByteArray>;
+  using Counter    = std::atomic<uint64_t>;
+
+  struct Element
+  {
+    EntryPtr             entry;
+    DigestList::iterator position;
+  };
+
+  using Elements = std::unordered_map<ConstByteArray, Element>;
+
+  std::string GeneratePath(ConstByteArray const &digest) const;
+  void        Evict();
+
+  mutable Mutex lock_;           ///< guards all of the cache members
+  std::size_t   max_size_;       ///< The maximum (estimated) size of the cache
+  std::size_t   size_{0};        ///< The current (estimated) size of the cache
+  DigestList    lru_{};          ///< The digests of the entries, most recently used first
+  Elements      elements_{};     ///< The map of digest to cache entry
+  std::string   path_prefix_{};  ///< The file prefix for persisted executables, empty if disabled
+  Counter       hits_{0};
+  Counter       misses_{0};
+};
+
+}  // namespace ledger
+}  // namespace fetch
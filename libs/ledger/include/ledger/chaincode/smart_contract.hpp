@@ -44,7 +44,7 @@ class SmartContract : public Contract
 public:
   using ConstByteArray = byte_array::ConstByteArray;
   using Executable     = fetch::vm::Executable;
-  using ExecutablePtr  = std::shared_ptr<Executable>;
+  using ExecutablePtr  = std::shared_ptr<Executable const>;
 
   static constexpr char const *LOGGING_NAME = "SmartContract";
 
@@ -57,11 +57,16 @@ public:
     return digest_;
   }
 
-  ExecutablePtr executable()
+  ExecutablePtr executable() const
   {
     return executable_;
   }
 
+  BlockIndex block_index() const
+  {
+    return block_index_;
+  }
+
 private:
   using ModulePtr = std::shared_ptr<vm::Module>;
 
@@ -73,8 +78,8 @@ private:
   BlockIndex     block_index_{};  ///< The index current contract's block
   std::string    source_;         ///< The source of the current contract
   ConstByteArray digest_;         ///< The digest of the current contract
-  ExecutablePtr  executable_;     ///< The internal script object of the parsed source
-  ModulePtr      module_;         ///< The internal module instance for the contract
+  ExecutablePtr  executable_;     ///< The (shared) compiled executable for the contract
+  ModulePtr      module_;         ///< The (shared) module the executable was compiled against
   std::string    init_fn_name_;
 };
 
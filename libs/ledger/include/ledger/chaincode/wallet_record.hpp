@@ -58,7 +58,7 @@ using DeedShrdPtr = std::shared_ptr<Deed>;
  *
  * @return true if deserialisation passed successfully, false otherwise.
  */
-bool DeedFromVariant(Variant const &variant_deed, DeedShrdPtr &deed)
+inline bool DeedFromVariant(Variant const &variant_deed, DeedShrdPtr &deed)
 {
   auto const num_of_items_in_deed = variant_deed.size();
   if (num_of_items_in_deed == 1 && variant_deed.Has(ADDRESS_NAME))
@@ -21,10 +21,13 @@
 #include "ledger/executor_interface.hpp"
 
 #include <atomic>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <future>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
@@ -51,6 +54,15 @@ public:
   BitVector const &shards() const;
   Status           status() const;
   uint64_t         fee() const;
+  SliceIndex       slice() const;
+  /// @}
+
+  /// @name Dependency Tracking
+  /// @{
+  void                               AddDependent(ExecutionItem &item);
+  std::vector<ExecutionItem *> const &dependents() const;
+  std::size_t                        num_dependencies() const;
+  bool                               ResolveDependency();
   /// @}
 
   void Execute(ExecutorInterface &executor);
@@ -62,6 +74,8 @@ public:
 private:
   using AtomicStatus = std::atomic<Status>;
   using AtomicFee    = std::atomic<uint64_t>;
+  using Counter      = std::atomic<std::size_t>;
+  using ItemList     = std::vector<ExecutionItem *>;
 
   Digest       digest_;
   BlockIndex   block_{0};
@@ -69,6 +83,8 @@ private:
   BitVector    shards_;
   AtomicStatus status_{Status::NOT_RUN};
   AtomicFee    fee_{0};
+  ItemList     dependents_{};  ///< The items that can only be run once this one completes
+  Counter      pending_{0};    ///< The number of unresolved dependencies of this item
 };
 
 inline ExecutionItem::ExecutionItem(Digest digest, BlockIndex block, SliceIndex slice,
@@ -99,6 +115,45 @@ inline uint64_t ExecutionItem::fee() const
   return fee_;
 }
 
+inline ExecutionItem::SliceIndex ExecutionItem::slice() const
+{
+  return slice_;
+}
+
+/**
+ * Register an item which must not be executed until this item has completed.
+ *
+ * This must only be called during planning, i.e. before any of the items are dispatched
+ *
+ * @param item The dependent execution item
+ */
+inline void ExecutionItem::AddDependent(ExecutionItem &item)
+{
+  dependents_.push_back(&item);
+  ++item.pending_;
+}
+
+inline std::vector<ExecutionItem *> const &ExecutionItem::dependents() const
+{
+  return dependents_;
+}
+
+inline std::size_t ExecutionItem::num_dependencies() const
+{
+  return pending_;
+}
+
+/**
+ * Signal that one of the items that this item depends on has completed
+ *
+ * @return true if all the dependencies have been resolved and the item is ready to run
+ */
+inline bool ExecutionItem::ResolveDependency()
+{
+  assert(pending_ > 0);
+  return (--pending_) == 0;
+}
+
 inline void ExecutionItem::Execute(ExecutorInterface &executor)
 {
   try
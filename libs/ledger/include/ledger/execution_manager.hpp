@@ -24,9 +24,10 @@
 #include "ledger/chain/constants.hpp"
 #include "ledger/execution_item.hpp"
 #include "ledger/execution_manager_interface.hpp"
+#include "ledger/execution_ready_queue.hpp"
 #include "ledger/executor.hpp"
 #include "ledger/storage_unit/storage_unit_interface.hpp"
-#include "network/details/thread_pool.hpp"
+#include "ledger/storage_unit/transaction_prefetcher.hpp"
 #include "storage/object_store.hpp"
 
 #include <atomic>
@@ -45,6 +46,18 @@ namespace ledger {
 /**
  * The Execution Manager is the object which orchestrates the execution of a
  * specified block across a series of executors and lanes.
+ *
+ * Rather than executing the block slice by slice, the manager builds a dependency graph from the
+ * lane masks of the transactions. A transaction only depends on the most recent transaction (in
+ * block order) that used each of its lanes, therefore transactions that do not share any lanes
+ * with earlier pending work are dispatched immediately and executors are not held at slice
+ * boundaries.
+ *
+ * Each worker thread owns a single executor for its whole lifetime and keeps its own statistics
+ * counters which are aggregated by the monitor thread. Ready items are handed off through a lock
+ * free queue per worker: a worker pushes the items released by its own executions onto its own
+ * queue and steals from the queues of the other workers once its own queue is empty. Workers
+ * only take a lock when there is no work left and they go to sleep.
  */
 class ExecutionManager : public ExecutionManagerInterface,
                          public std::enable_shared_from_this<ExecutionManager>
@@ -53,14 +66,16 @@ public:
   using StorageUnitPtr  = std::shared_ptr<StorageUnitInterface>;
   using ExecutorPtr     = std::shared_ptr<ExecutorInterface>;
   using ExecutorFactory = std::function<ExecutorPtr()>;
+  using TxPrefetcherPtr = std::shared_ptr<TransactionPrefetcher>;
 
   // Construction / Destruction
   ExecutionManager(std::size_t num_executors, uint32_t log2_num_lanes, StorageUnitPtr storage,
-                   ExecutorFactory const &factory);
+                   ExecutorFactory const &factory, TxPrefetcherPtr prefetcher = TxPrefetcherPtr{});
 
   /// @name Execution Manager Interface
   /// @{
   ScheduleStatus Execute(Block::Body const &block) override;
+  void           PrefetchTransactions(Block::Body const &block) override;
   void           SetLastProcessedBlock(Digest digest) override;
   Digest         LastProcessedBlock() override;
   State          GetState() override;
@@ -72,25 +87,40 @@ public:
   void Stop();
 
   // statistics
-  std::size_t completed_executions() const
-  {
-    return completed_executions_;
-  }
+  std::size_t completed_executions() const;
 
 private:
-  struct Counters
+  using Mutex   = std::mutex;
+  using Counter = std::atomic<std::size_t>;
+  using Flag    = std::atomic<bool>;
+
+  /**
+   * The statistics for a single worker. These are only ever written by the owning worker thread
+   */
+  struct WorkerCounters
   {
-    std::size_t active{0};
-    std::size_t remaining{0};
+    Flag    active{false};
+    Counter completed{0};
+  };
+
+  struct Worker
+  {
+    explicit Worker(std::size_t log2_queue_size)
+      : queue{log2_queue_size}
+    {}
+
+    std::size_t                  index{0};
+    ExecutorPtr                  executor;
+    WorkerCounters               counters{};
+    ExecutionReadyQueue          queue;  ///< The items ready to be run, may be stolen by others
+    std::unique_ptr<std::thread> thread;
   };
 
   using ExecutionItemPtr  = std::unique_ptr<ExecutionItem>;
   using ExecutionItemList = std::vector<ExecutionItemPtr>;
-  using ExecutionPlan     = std::vector<ExecutionItemList>;
-  using ThreadPool        = fetch::network::ThreadPool;
-  using Mutex             = std::mutex;
-  using Counter           = std::atomic<std::size_t>;
-  using Flag              = std::atomic<bool>;
+  using ExecutionPlan     = ExecutionItemList;
+  using WorkerPtr         = std::unique_ptr<Worker>;
+  using WorkerList        = std::vector<WorkerPtr>;
   using StateHash         = StorageUnitInterface::Hash;
   using ExecutorList      = std::vector<ExecutorPtr>;
   using StateHashCache    = storage::ObjectStore<StateHash>;
@@ -99,7 +129,6 @@ private:
   using Condition         = std::condition_variable;
   using ResourceID        = storage::ResourceID;
   using AtomicState       = std::atomic<State>;
-  using SyncCounters      = SynchronisedState<Counters>;
   using SyncedState       = SynchronisedState<State>;
 
   uint32_t const log2_num_lanes_;
@@ -109,33 +138,39 @@ private:
 
   SyncedState state_{State::IDLE};
 
-  StorageUnitPtr storage_;
+  StorageUnitPtr  storage_;
+  TxPrefetcherPtr prefetcher_;  ///< Loads the transactions of a block ahead of the executors
 
   Mutex         execution_plan_lock_;  ///< guards `execution_plan_`
-  ExecutionPlan execution_plan_;
+  ExecutionPlan execution_plan_;       ///< The execution items in block order
+  Flag          halted_{false};        ///< Set when the remaining items should not be executed
 
   Digest  last_block_hash_ = GENESIS_DIGEST;
   Address last_block_miner_{};
 
   Mutex     monitor_lock_;
+  bool      block_pending_{false};  ///< guarded by `monitor_lock_`
   Condition monitor_wake_;
   Condition monitor_notify_;
 
-  Mutex        idle_executors_lock_;  ///< guards `idle_executors`
-  ExecutorList idle_executors_;
-
-  Counter completed_executions_{0};
-  Counter num_slices_{0};
+  Counter remaining_{0};  ///< The number of items in the current plan yet to complete
+  Counter queued_{0};     ///< The number of items in the worker queues (may briefly overstate)
+  Counter sleepers_{0};   ///< The number of workers waiting on `idle_wake_`
 
-  SyncCounters counters_{};
+  Mutex     idle_lock_;
+  Condition idle_wake_;
 
-  ThreadPool thread_pool_;
+  WorkerList workers_;
   ThreadPtr  monitor_thread_;
 
   void MonitorThreadEntrypoint();
+  void WorkerThreadEntrypoint(Worker &worker);
 
-  bool PlanExecution(Block::Body const &block);
-  void DispatchExecution(ExecutionItem &item);
+  bool        PlanExecution(Block::Body const &block);
+  void        ScheduleExecution(ExecutionItem &item, Worker &worker);
+  void        DispatchExecution(ExecutionItem &item, Worker &worker);
+  bool        NextItem(Worker &worker, ExecutionItem *&item);
+  std::size_t num_active_executors() const;
 };
 
 }  // namespace ledger
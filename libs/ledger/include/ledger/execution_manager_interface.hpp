@@ -58,11 +58,12 @@ public:
 
   /// @name Execution Manager Interface
   /// @{
-  virtual ScheduleStatus Execute(Block::Body const &block)          = 0;
-  virtual void           SetLastProcessedBlock(Digest block_digest) = 0;
-  virtual Digest         LastProcessedBlock()                       = 0;
-  virtual State          GetState()                                 = 0;
-  virtual bool           Abort()                                    = 0;
+  virtual ScheduleStatus Execute(Block::Body const &block)              = 0;
+  virtual void           PrefetchTransactions(Block::Body const &block) = 0;
+  virtual void           SetLastProcessedBlock(Digest block_digest)     = 0;
+  virtual Digest         LastProcessedBlock()                           = 0;
+  virtual State          GetState()                                     = 0;
+  virtual bool           Abort()                                        = 0;
   /// @}
 };
 
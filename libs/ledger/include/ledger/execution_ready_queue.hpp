@@ -0,0 +1,91 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace fetch {
+namespace ledger {
+
+class ExecutionItem;
+
+/**
+ * A lock free queue of the execution items which are ready to be run by a worker.
+ *
+ * The queue is a fixed size ring of slots, each carrying a sequence number which tells pushing
+ * and popping threads whether the slot is free or holds an item for their position. Items may be
+ * pushed and popped concurrently from any thread, so that the owning worker and workers stealing
+ * from it can all pop from the same queue.
+ *
+ * When the ring is full, items are stored in a mutex protected overflow queue instead. This slow
+ * path is only taken when more items are ready than there are slots, so that the ring can be kept
+ * small without ever rejecting an item. Items are not guaranteed to be popped in push order.
+ */
+class ExecutionReadyQueue
+{
+public:
+  // Construction / Destruction
+  explicit ExecutionReadyQueue(std::size_t log2_size);
+  ExecutionReadyQueue(ExecutionReadyQueue const &) = delete;
+  ExecutionReadyQueue(ExecutionReadyQueue &&)      = delete;
+  ~ExecutionReadyQueue()                           = default;
+
+  void Push(ExecutionItem *item);
+  bool Pop(ExecutionItem *&item);
+
+  std::size_t overflow_count() const;
+
+  // Operators
+  ExecutionReadyQueue &operator=(ExecutionReadyQueue const &) = delete;
+  ExecutionReadyQueue &operator=(ExecutionReadyQueue &&) = delete;
+
+private:
+  struct Slot
+  {
+    std::atomic<std::size_t> sequence{0};
+    ExecutionItem *          item{nullptr};
+  };
+
+  using Slots         = std::unique_ptr<Slot[]>;
+  using Mutex         = std::mutex;
+  using OverflowQueue = std::deque<ExecutionItem *>;
+  using Position      = std::atomic<std::size_t>;
+
+  bool TryPush(ExecutionItem *item);
+  bool TryPop(ExecutionItem *&item);
+  bool PopOverflow(ExecutionItem *&item);
+
+  std::size_t const mask_;  ///< The mask used to map a position onto a slot
+  Slots             slots_;
+
+  Position tail_{0};  ///< The position of the next push
+  Position head_{0};  ///< The position of the next pop
+
+  std::atomic<std::size_t> overflow_size_{0};  ///< The number of items in the overflow queue
+  Mutex                    overflow_lock_;
+
+  /// The items which did not fit in the ring (protected by overflow_lock_)
+  OverflowQueue overflow_;
+};
+
+}  // namespace ledger
+}  // namespace fetch
@@ -22,6 +22,7 @@
 #include "ledger/chaincode/chain_code_cache.hpp"
 #include "ledger/executor_interface.hpp"
 #include "ledger/storage_unit/storage_unit_interface.hpp"
+#include "ledger/storage_unit/transaction_prefetcher.hpp"
 
 #include <cstdint>
 #include <memory>
@@ -41,11 +42,13 @@ class StakeUpdateInterface;
 class Executor : public ExecutorInterface
 {
 public:
-  using StorageUnitPtr = std::shared_ptr<StorageUnitInterface>;
-  using ConstByteArray = byte_array::ConstByteArray;
+  using StorageUnitPtr  = std::shared_ptr<StorageUnitInterface>;
+  using ConstByteArray  = byte_array::ConstByteArray;
+  using TxPrefetcherPtr = std::shared_ptr<TransactionPrefetcher>;
 
   // Construction / Destruction
-  explicit Executor(StorageUnitPtr storage, StakeUpdateInterface *stake_updates);
+  explicit Executor(StorageUnitPtr storage, StakeUpdateInterface *stake_updates,
+                    TxPrefetcherPtr prefetcher = TxPrefetcherPtr{});
   ~Executor() override = default;
 
   /// @name Executor Interface
@@ -55,6 +58,8 @@ public:
   void   SettleFees(Address const &miner, TokenAmount amount, uint32_t log2_num_lanes) override;
   /// @}
 
+  void EnableTransferFastPath(bool enable);
+
 private:
   using TokenContractPtr        = std::shared_ptr<TokenContract>;
   using TransactionPtr          = std::shared_ptr<Transaction>;
@@ -65,16 +70,23 @@ private:
   bool ExecuteTransactionContract(Result &result);
   bool ProcessTransfers(Result &result);
   void DeductFees(Result &result);
+  bool ExecuteTransfers(Result &result);
   bool Cleanup();
 
   /// @name Resources
   /// @{
   StakeUpdateInterface *stake_updates_{nullptr};
   StorageUnitPtr        storage_;             ///< The collection of resources
+  TxPrefetcherPtr       prefetcher_;          ///< The (optional) source of prefetched transactions
   ChainCodeCache        chain_code_cache_{};  //< The factory to create new chain code instances
   TokenContractPtr      token_contract_;
   /// @}
 
+  /// @name Configuration
+  /// @{
+  bool transfer_fast_path_{true};  ///< Whether plain transfers are executed natively
+  /// @}
+
   /// @name Per Execution State
   /// @{
   BlockIndex              block_;
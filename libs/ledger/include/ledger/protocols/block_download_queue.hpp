@@ -0,0 +1,161 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/fnv.hpp"  // needed for std::hash<ConstByteArray>
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/digest.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Schedules the download of a known section of the chain from a number of peers in parallel.
+ *
+ * The hashes of the blocks to be downloaded are split into fixed size windows, each of which is
+ * requested (as a single range request) from one of the available peers. Requests which fail, time
+ * out or return the wrong blocks are retried with a different peer. Requests rejected by peers
+ * which do not support them are also retried, without counting towards the attempts for the
+ * window. Downloaded windows are handed back strictly in chain order (oldest first) so that the
+ * blocks can be streamed into the main chain without becoming loose.
+ *
+ * Not thread safe.
+ */
+class BlockDownloadQueue
+{
+public:
+  using Address     = byte_array::ConstByteArray;
+  using BlockHash   = Digest;
+  using BlockHashes = std::vector<BlockHash>;
+  using Blocks      = std::vector<Block>;
+  using Clock       = std::chrono::steady_clock;
+  using Timepoint   = Clock::time_point;
+  using Duration    = Clock::duration;
+
+  struct Config
+  {
+    std::size_t window_size;            ///< The (maximum) number of blocks in each request
+    std::size_t max_requests_per_peer;  ///< The maximum number of requests in flight per peer
+    std::size_t max_windows_ahead;      ///< The maximum number of windows ahead of the delivery
+    std::size_t max_attempts;           ///< The number of times each window can be requested
+    Duration    timeout;                ///< The time after which a request is considered failed
+  };
+
+  /**
+   * A range request which should be made to a peer
+   */
+  struct Request
+  {
+    uint64_t    id;      ///< The unique identifier for the request
+    std::size_t window;  ///< The index of the window being requested
+    Address     peer;    ///< The peer the request should be made to
+    BlockHash   start;   ///< The most recent block hash of the range
+    uint64_t    size;    ///< The number of blocks in the range
+  };
+
+  using Requests = std::vector<Request>;
+
+  /**
+   * A downloaded window of blocks
+   */
+  struct Segment
+  {
+    Address peer;    ///< The peer which provided the blocks
+    Blocks  blocks;  ///< The blocks, ordered oldest first
+  };
+
+  // Construction / Destruction
+  explicit BlockDownloadQueue(Config const &config);
+  BlockDownloadQueue(BlockDownloadQueue const &) = delete;
+  BlockDownloadQueue(BlockDownloadQueue &&)      = delete;
+  ~BlockDownloadQueue()                          = default;
+
+  void Reset(BlockHashes hashes);
+
+  /// @name Scheduling
+  /// @{
+  bool     NextRequest(Address const &peer, Timepoint const &now, Request &request);
+  bool     Complete(Request const &request, Blocks blocks);
+  void     Fail(Request const &request);
+  void     Reject(Request const &request);
+  Requests Expire(Timepoint const &now);
+  bool     NextSegment(Segment &segment);
+  /// @}
+
+  /// @name Status
+  /// @{
+  bool        IsComplete() const;
+  bool        HasFailed() const;
+  std::size_t num_outstanding() const;
+  std::size_t num_remaining_blocks() const;
+  /// @}
+
+  // Operators
+  BlockDownloadQueue &operator=(BlockDownloadQueue const &) = delete;
+  BlockDownloadQueue &operator=(BlockDownloadQueue &&) = delete;
+
+private:
+  enum class WindowState
+  {
+    PENDING,
+    REQUESTED,
+    DOWNLOADED,
+    DELIVERED,
+  };
+
+  using AddressSet = std::unordered_set<Address>;
+  using PeerCounts = std::unordered_map<Address, std::size_t>;
+
+  struct Window
+  {
+    std::size_t offset{0};                    ///< The index of the window's oldest block hash
+    std::size_t size{0};                      ///< The number of blocks in the window
+    WindowState state{WindowState::PENDING};  ///< The current download state of the window
+    uint64_t    request_id{0};                ///< The request currently in flight (if any)
+    Address     peer;                         ///< The peer the window was last requested from
+    Timepoint   deadline{};                   ///< The time at which the current request expires
+    std::size_t attempts{0};                  ///< The number of requests made for the window
+    AddressSet  failed_peers;                 ///< The peers which failed to deliver the window
+    Blocks      blocks;                       ///< The downloaded blocks (oldest first)
+  };
+
+  using Windows = std::vector<Window>;
+
+  Window *LookupRequest(Request const &request);
+  void    Release(Window &window);
+
+  Config const config_;
+  BlockHashes  hashes_;              ///< The hashes to be downloaded (oldest first)
+  Windows      windows_;             ///< The windows that make up the download
+  std::size_t  next_delivery_{0};    ///< The index of the next window to be delivered
+  PeerCounts   peer_requests_;       ///< The number of requests in flight for each peer
+  std::size_t  num_outstanding_{0};  ///< The total number of requests in flight
+  uint64_t     next_request_id_{1};  ///< The identifier for the next request
+  bool         failed_{false};       ///< Flag to signal a window could not be downloaded
+};
+
+}  // namespace ledger
+}  // namespace fetch
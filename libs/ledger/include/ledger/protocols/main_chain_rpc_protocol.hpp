@@ -28,12 +28,15 @@ namespace ledger {
 class MainChainProtocol : public service::Protocol
 {
 public:
-  using Blocks = std::vector<Block>;
+  using Blocks      = std::vector<Block>;
+  using BlockHashes = std::vector<Digest>;
 
   enum
   {
     HEAVIEST_CHAIN   = 1,
-    COMMON_SUB_CHAIN = 3
+    COMMON_SUB_CHAIN = 3,
+    CHAIN_HASHES     = 4,
+    CHAIN_SEGMENT    = 5
   };
 
   explicit MainChainProtocol(MainChain &chain)
@@ -41,6 +44,8 @@ public:
   {
     Expose(HEAVIEST_CHAIN, this, &MainChainProtocol::GetHeaviestChain);
     Expose(COMMON_SUB_CHAIN, this, &MainChainProtocol::GetCommonSubChain);
+    Expose(CHAIN_HASHES, this, &MainChainProtocol::GetChainHashes);
+    Expose(CHAIN_SEGMENT, this, &MainChainProtocol::GetChainSegment);
   }
 
 private:
@@ -65,6 +70,36 @@ private:
     return Copy(blocks);
   }
 
+  BlockHashes GetChainHashes(Digest const &start, Digest const &last_seen, uint64_t limit)
+  {
+    LOG_STACK_TRACE_POINT;
+
+    MainChain::Blocks blocks;
+
+    // the same walk as the common sub chain, but only the (much smaller) hashes are returned
+    if (!chain_.GetPathToCommonAncestor(blocks, start, last_seen, limit))
+    {
+      // sanity check
+      blocks.clear();
+    }
+
+    BlockHashes hashes{};
+    hashes.reserve(blocks.size());
+
+    for (auto const &block : blocks)
+    {
+      hashes.emplace_back(block->body.hash);
+    }
+
+    return hashes;
+  }
+
+  Blocks GetChainSegment(Digest const &start, uint64_t limit)
+  {
+    LOG_STACK_TRACE_POINT;
+    return Copy(chain_.GetChainPreceding(start, limit));
+  }
+
   static Blocks Copy(MainChain::Blocks const &blocks)
   {
     Blocks output{};
@@ -22,6 +22,7 @@
 #include "core/random/lcg.hpp"
 #include "core/state_machine.hpp"
 #include "ledger/chain/main_chain.hpp"
+#include "ledger/protocols/block_download_queue.hpp"
 #include "ledger/protocols/main_chain_rpc_protocol.hpp"
 #include "network/generics/backgrounded_work.hpp"
 #include "network/generics/has_worker_thread.hpp"
@@ -33,6 +34,8 @@
 #include "telemetry/telemetry.hpp"
 
 #include <memory>
+#include <unordered_set>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
@@ -46,6 +49,12 @@ class MainChainSyncWorker;
  * around and nodes will attempt to determine the heaviest chain of their peers and specifically
  * request them. Peers are guarded by the main chain limiting request sizes.
  *
+ * When blocks are missing, the hashes of the missing section of the chain are requested from a
+ * single peer. The blocks themselves are then downloaded as a series of range requests spread
+ * over all the connected peers, and added to the chain in order as they arrive. Peers running the
+ * previous release, which lack the requests for the hashes and the ranges, are remembered while
+ * they stay connected. They are left out of the range requests and are asked for the blocks of the
+ * missing section of the chain directly.
  */
 class MainChainRpcService : public muddle::rpc::Server,
                             public std::enable_shared_from_this<MainChainRpcService>
@@ -57,6 +66,7 @@ public:
     WAIT_FOR_HEAVIEST_CHAIN,
     SYNCHRONISING,
     WAITING_FOR_RESPONSE,
+    DOWNLOADING,
     SYNCHRONISED,
   };
 
@@ -115,8 +125,20 @@ public:
 
 private:
   using BlockList       = fetch::ledger::MainChainProtocol::Blocks;
+  using BlockHashList   = fetch::ledger::MainChainProtocol::BlockHashes;
   using StateMachine    = core::StateMachine<State>;
   using StateMachinePtr = std::shared_ptr<StateMachine>;
+  using DownloadQueue   = BlockDownloadQueue;
+  using Timepoint       = DownloadQueue::Timepoint;
+
+  struct DownloadRequest
+  {
+    DownloadQueue::Request request;  ///< The range being requested
+    Promise                promise;  ///< The promise for the response from the peer
+  };
+
+  using DownloadRequests = std::vector<DownloadRequest>;
+  using AddressSet       = std::unordered_set<Address>;
 
   /// @name Subscription Handlers
   /// @{
@@ -128,7 +150,16 @@ private:
   static char const *ToString(State state);
   Address            GetRandomTrustedPeer() const;
   void               HandleChainResponse(Address const &peer, BlockList block_list);
+  void               AddBlocks(Address const &peer, BlockList &blocks);
   bool               IsBlockValid(Block &block) const;
+  void               RequestCommonSubChain();
+  /// @}
+
+  /// @name Block Download
+  /// @{
+  void StartDownload(BlockHashList hashes);
+  void PollDownloadRequests(Timepoint const &now);
+  void IssueDownloadRequests(Timepoint const &now);
   /// @}
 
   /// @name State Machine Handlers
@@ -137,6 +168,7 @@ private:
   State OnWaitForHeaviestChain();
   State OnSynchronising();
   State OnWaitingForResponse();
+  State OnDownloading();
   State OnSynchronised(State current, State previous);
   /// @}
 
@@ -161,6 +193,14 @@ private:
   Address         current_peer_address_;
   BlockHash       current_missing_block_;
   Promise         current_request_;
+  bool            current_request_is_sub_chain_{false};  ///< Made with the COMMON_SUB_CHAIN call
+  /// @}
+
+  /// @name Block Download Data
+  /// @{
+  DownloadQueue    download_queue_;     ///< The schedule for the blocks being downloaded
+  DownloadRequests download_requests_;  ///< The range requests currently in flight
+  AddressSet       unsupported_peers_;  ///< Peers which lack the chain hashes and range requests
   /// @}
 
   /// @name Telemetry
@@ -174,7 +214,10 @@ private:
   telemetry::CounterPtr state_wait_heaviest_;
   telemetry::CounterPtr state_synchronising_;
   telemetry::CounterPtr state_wait_response_;
+  telemetry::CounterPtr state_downloading_;
   telemetry::CounterPtr state_synchronised_;
+  telemetry::CounterPtr sync_request_count_;
+  telemetry::CounterPtr sync_request_failed_count_;
 
   /// @}
 };
@@ -0,0 +1,124 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/mutex.hpp"
+#include "ledger/storage_unit/storage_unit_interface.hpp"
+#include "telemetry/telemetry.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * A write back overlay of the state database which lives for the duration of a block.
+ *
+ * The executors read and write the state through the overlay (each transaction still stages its
+ * own writes in a CachedStorageAdapter so that they can be rolled back on failure). The resulting
+ * writes are only sent to the underlying storage unit once the block has been executed, which is
+ * signalled by the state hash being requested or committed. Reverting the state discards the
+ * overlay.
+ *
+ * The overlay is partitioned by lane so that executors working on disjoint lanes do not contend.
+ */
+class BlockStateCache final : public StorageUnitInterface
+{
+public:
+  using StorageUnitPtr = std::shared_ptr<StorageUnitInterface>;
+
+  // Construction / Destruction
+  BlockStateCache(StorageUnitPtr storage, uint32_t log2_num_lanes);
+  BlockStateCache(BlockStateCache const &) = delete;
+  BlockStateCache(BlockStateCache &&)      = delete;
+  ~BlockStateCache() override              = default;
+
+  void Flush();
+  void Discard();
+
+  /// @name State Interface
+  /// @{
+  Document Get(ResourceAddress const &key) override;
+  Document GetOrCreate(ResourceAddress const &key) override;
+  void     Set(ResourceAddress const &key, StateValue const &value) override;
+  bool     Lock(ShardIndex index) override;
+  bool     Unlock(ShardIndex index) override;
+  Keys     KeyDump() const override;
+  void     Reset() override;
+  /// @}
+
+  /// @name Transaction Interface
+  /// @{
+  void         AddTransaction(Transaction const &tx) override;
+  bool         GetTransaction(Digest const &digest, Transaction &tx) override;
+  Transactions GetTransactions(DigestSet const &digests) override;
+  bool         HasTransaction(Digest const &digest) override;
+  void         IssueCallForMissingTxs(DigestSet const &tx_set) override;
+  TxLayouts    PollRecentTx(uint32_t max_to_poll) override;
+  /// @}
+
+  /// @name Revertible Document Store Interface
+  /// @{
+  Hash CurrentHash() override;
+  Hash LastCommitHash() override;
+  bool RevertToHash(Hash const &hash, uint64_t index) override;
+  Hash Commit(uint64_t index) override;
+  bool HashExists(Hash const &hash, uint64_t index) override;
+  /// @}
+
+  // Operators
+  BlockStateCache &operator=(BlockStateCache const &) = delete;
+  BlockStateCache &operator=(BlockStateCache &&) = delete;
+
+private:
+  struct Entry
+  {
+    Document document{};    ///< The value (or absence of a value) of the resource
+    bool     dirty{false};  ///< Whether the value needs to be written to the storage unit
+  };
+
+  using Entries = std::unordered_map<ResourceAddress, Entry>;
+  using Mutex   = mutex::Mutex;
+
+  struct Partition
+  {
+    Mutex   lock{__LINE__, __FILE__};
+    Entries entries{};
+  };
+
+  using Partitions = std::vector<std::unique_ptr<Partition>>;
+
+  Partition &LookupPartition(ResourceAddress const &key);
+
+  StorageUnitPtr storage_;         ///< The underlying storage unit
+  uint32_t const log2_num_lanes_;  ///< The number of lanes (and partitions)
+  Partitions     partitions_;      ///< The overlay entries for each lane
+
+  /// @name Telemetry
+  /// @{
+  telemetry::CounterPtr hit_count_;
+  telemetry::CounterPtr miss_count_;
+  telemetry::CounterPtr flushed_count_;
+  /// @}
+};
+
+}  // namespace ledger
+}  // namespace fetch
@@ -70,11 +70,12 @@ public:
 
   /// @name Storage Unit Interface
   /// @{
-  void      AddTransaction(Transaction const &tx) override;
-  bool      GetTransaction(ConstByteArray const &digest, Transaction &tx) override;
-  bool      HasTransaction(ConstByteArray const &digest) override;
-  void      IssueCallForMissingTxs(DigestSet const &tx_set) override;
-  TxLayouts PollRecentTx(uint32_t max_to_poll) override;
+  void         AddTransaction(Transaction const &tx) override;
+  bool         GetTransaction(ConstByteArray const &digest, Transaction &tx) override;
+  Transactions GetTransactions(DigestSet const &digests) override;
+  bool         HasTransaction(ConstByteArray const &digest) override;
+  void         IssueCallForMissingTxs(DigestSet const &tx_set) override;
+  TxLayouts    PollRecentTx(uint32_t max_to_poll) override;
 
   Document GetOrCreate(ResourceAddress const &key) override;
   Document Get(ResourceAddress const &key) override;
@@ -61,6 +61,7 @@ public:
   using Hash           = byte_array::ConstByteArray;
   using ConstByteArray = byte_array::ConstByteArray;
   using TxLayouts      = std::vector<TransactionLayout>;
+  using Transactions   = std::vector<Transaction>;
 
   // Construction / Destruction
   StorageUnitInterface()           = default;
@@ -68,10 +69,11 @@ public:
 
   /// @name Transaction Interface
   /// @{
-  virtual void AddTransaction(Transaction const &tx)                 = 0;
-  virtual bool GetTransaction(Digest const &digest, Transaction &tx) = 0;
-  virtual bool HasTransaction(Digest const &digest)                  = 0;
-  virtual void IssueCallForMissingTxs(DigestSet const &tx_set)       = 0;
+  virtual void         AddTransaction(Transaction const &tx)                 = 0;
+  virtual bool         GetTransaction(Digest const &digest, Transaction &tx) = 0;
+  virtual Transactions GetTransactions(DigestSet const &digests)             = 0;
+  virtual bool         HasTransaction(Digest const &digest)                  = 0;
+  virtual void         IssueCallForMissingTxs(DigestSet const &tx_set)       = 0;
   /// @}
 
   virtual TxLayouts PollRecentTx(uint32_t) = 0;
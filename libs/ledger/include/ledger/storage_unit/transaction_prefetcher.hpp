@@ -0,0 +1,108 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/digest.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/storage_unit/storage_unit_interface.hpp"
+#include "telemetry/telemetry.hpp"
+#include "vectorise/threading/pool.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Loads the transactions of queued blocks from the lanes ahead of their execution.
+ *
+ * The transactions of each block are requested in bulk, with a separate request for each lane made
+ * on its own background thread, and held in a cache keyed by digest. The transactions of a lane are
+ * available as soon as the response from that lane arrives. Executors look up the transaction
+ * bodies in the cache rather than making a storage request for each transaction. A lookup for a
+ * transaction which is still being loaded waits briefly for its lane, after which the caller is
+ * expected to fetch it directly. When full, the transactions of the oldest prefetched block are
+ * discarded first.
+ *
+ * Thread safe.
+ */
+class TransactionPrefetcher
+{
+public:
+  using StorageUnitPtr = std::shared_ptr<StorageUnitInterface>;
+
+  // Construction / Destruction
+  TransactionPrefetcher(StorageUnitPtr storage, uint32_t log2_num_lanes, std::size_t max_size);
+  TransactionPrefetcher(TransactionPrefetcher const &) = delete;
+  TransactionPrefetcher(TransactionPrefetcher &&)      = delete;
+  ~TransactionPrefetcher()                             = default;
+
+  void Prefetch(Block::Body const &block);
+  bool Lookup(Digest const &digest, Transaction &tx);
+  void Clear();
+
+  std::size_t size() const;
+
+  // Operators
+  TransactionPrefetcher &operator=(TransactionPrefetcher const &) = delete;
+  TransactionPrefetcher &operator=(TransactionPrefetcher &&) = delete;
+
+private:
+  using Mutex        = std::mutex;
+  using Condition    = std::condition_variable;
+  using Cache        = DigestMap<Transaction>;
+  using ThreadPool   = threading::Pool;
+  using LaneDigests  = std::vector<DigestSet>;
+  using BlockDigests = std::map<uint64_t, DigestSet>;
+  using BlockIndex   = DigestMap<uint64_t>;
+
+  void Load(DigestSet const &digests);
+  void EvictOldestBlock();
+  void Untrack(Digest const &digest);
+
+  StorageUnitPtr    storage_;
+  uint32_t const    log2_num_lanes_;
+  std::size_t const max_size_;  ///< The maximum number of transactions cached or being loaded
+
+  mutable Mutex lock_;
+  Cache         cache_;          ///< The loaded transactions (guarded by `lock_`)
+  DigestSet     in_flight_;      ///< The transactions being loaded (guarded by `lock_`)
+  Condition     loaded_;         ///< Signalled when the bulk load for a lane completes
+  BlockDigests  blocks_;         ///< The held (cached or in flight) digests of each block
+  BlockIndex    block_index_;    ///< The block for which each held digest was prefetched
+  uint64_t      next_block_{0};  ///< The index of the next block to be prefetched
+
+  /// @name Telemetry
+  /// @{
+  telemetry::CounterPtr requested_count_;
+  telemetry::CounterPtr hit_count_;
+  telemetry::CounterPtr miss_count_;
+  /// @}
+
+  ThreadPool threads_;  ///< Declared last so that workers stop before the state they reference
+};
+
+}  // namespace ledger
+}  // namespace fetch
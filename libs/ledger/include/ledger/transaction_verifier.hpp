@@ -62,6 +62,7 @@ public:
 
 private:
   static constexpr std::size_t QUEUE_SIZE = 1u << 16u;  // 65K
+  static constexpr std::size_t BATCH_SIZE = 64;
 
   using Flag            = std::atomic<bool>;
   using VerifiedQueue   = core::MPSCQueue<TransactionPtr, QUEUE_SIZE>;
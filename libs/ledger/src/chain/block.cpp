@@ -48,9 +48,11 @@ std::size_t Block::GetTransactionCount() const
 }
 
 /**
- * Populate the block hash field based on the contents of the current block
+ * Calculate the block hash based on the contents of the current block
+ *
+ * @return The calculated block hash
  */
-void Block::UpdateDigest()
+Digest Block::CalculateDigest() const
 {
   crypto::MerkleTree tx_merkle_tree{GetTransactionCount()};
 
@@ -76,7 +78,16 @@ void Block::UpdateDigest()
   crypto::SHA256 hash;
   hash.Reset();
   hash.Update(buf.data());
-  body.hash = hash.Final();
+
+  return hash.Final();
+}
+
+/**
+ * Populate the block hash field based on the contents of the current block
+ */
+void Block::UpdateDigest()
+{
+  body.hash = CalculateDigest();
 
   proof.SetHeader(body.hash);
 }
@@ -52,6 +52,7 @@ using ScheduleStatus       = fetch::ledger::ExecutionManagerInterface::ScheduleS
 using ExecutionState       = fetch::ledger::ExecutionManagerInterface::State;
 using SynergeticExecMgrPtr = std::unique_ptr<SynergeticExecutionManagerInterface>;
 using SynergeticMinerPtr   = std::unique_ptr<SynergeticMinerInterface>;
+using BlockPrevalidatorPtr = std::unique_ptr<BlockPrevalidator>;
 using ProverPtr            = BlockCoordinator::ProverPtr;
 using DAGPtr               = std::shared_ptr<ledger::DAGInterface>;
 
@@ -63,6 +64,9 @@ const std::chrono::seconds      WAIT_BEFORE_ASKING_FOR_MISSING_TX_INTERVAL{30};
 const std::chrono::seconds      WAIT_FOR_TX_TIMEOUT_INTERVAL{30};
 const uint32_t                  THRESHOLD_FOR_FAST_SYNCING{100u};
 const std::size_t               DIGEST_LENGTH_BYTES{32};
+const std::size_t               PREVALIDATION_THREADS{4};
+const std::size_t               PREVALIDATION_DEPTH{16};
+const std::chrono::milliseconds PREVALIDATION_POLL_INTERVAL{5};
 
 SynergeticExecMgrPtr CreateSynergeticExecutor(core::FeatureFlags const &features, DAGPtr dag,
                                               StorageUnitInterface &storage_unit)
@@ -77,6 +81,22 @@ SynergeticExecMgrPtr CreateSynergeticExecutor(core::FeatureFlags const &features
 
   return execution_mgr;
 }
+
+BlockPrevalidatorPtr CreatePrevalidator(core::FeatureFlags const &features,
+                                        StorageUnitInterface &storage_unit, std::size_t num_lanes,
+                                        std::size_t num_slices)
+{
+  BlockPrevalidatorPtr prevalidator{};
+
+  if (features.IsEnabled(core::FeatureFlags::PIPELINED_BLOCK_VALIDATION))
+  {
+    prevalidator = std::make_unique<BlockPrevalidator>(
+        storage_unit, BlockPrevalidator::Config{num_lanes, num_slices, PREVALIDATION_THREADS,
+                                                PREVALIDATION_DEPTH * 2u});
+  }
+
+  return prevalidator;
+}
 }  // namespace
 
 /**
@@ -114,6 +134,7 @@ BlockCoordinator::BlockCoordinator(MainChain &chain, DAGPtr dag, StakeManagerPtr
   , exec_wait_periodic_{EXEC_NOTIFY_INTERVAL}
   , syncing_periodic_{NOTIFY_INTERVAL}
   , synergetic_exec_mgr_{CreateSynergeticExecutor(features, dag, storage_unit_)}
+  , prevalidator_{CreatePrevalidator(features, storage_unit_, num_lanes, num_slices)}
   , reload_state_count_{telemetry::Registry::Instance().CreateCounter(
         "ledger_block_coordinator_reload_state_total",
         "The total number of times in the reload state")}
@@ -428,10 +449,23 @@ BlockCoordinator::State BlockCoordinator::OnSynchronising()
 
     blocks_to_common_ancestor_.pop_back();
 
+    // while this block is being executed, check the blocks which follow it in the background
+    if (prevalidator_)
+    {
+      SchedulePrevalidation();
+    }
+
     if (blocks_to_common_ancestor_.size() < THRESHOLD_FOR_FAST_SYNCING)
     {
       blocks_to_common_ancestor_.clear();
     }
+    else
+    {
+      // when fast syncing, start loading the transactions of the block which follows this one (the
+      // last entry of the path being the current block)
+      auto const following = blocks_to_common_ancestor_.crbegin() + 1;
+      execution_manager_.PrefetchTransactions((*following)->body);
+    }
 
     return State::PRE_EXEC_BLOCK_VALIDATION;
   }
@@ -523,6 +557,35 @@ BlockCoordinator::State BlockCoordinator::OnPreExecBlockValidation()
     return State::RESET;
   }};
 
+  // Check: Ensure the stateless checks have passed. During catch up these will normally have been
+  // completed in the background while the previous block was executing
+  if (prevalidator_)
+  {
+    BlockPrevalidator::Result result{};
+
+    switch (prevalidator_->Query(current_block_->body.hash, result))
+    {
+    case BlockPrevalidator::Status::PENDING:
+      state_machine_->Delay(PREVALIDATION_POLL_INTERVAL);
+      return State::PRE_EXEC_BLOCK_VALIDATION;
+
+    case BlockPrevalidator::Status::UNKNOWN:
+      result = prevalidator_->Validate(*current_block_);
+      break;
+
+    case BlockPrevalidator::Status::COMPLETE:
+      break;
+    }
+
+    if (!result.valid)
+    {
+      return fail(result.reason);
+    }
+
+    // only the transactions which were missing need to be waited for
+    pending_txs_ = std::make_unique<DigestSet>(std::move(result.missing_txs));
+  }
+
   // Check: Ensure that we have a previous block
 
   if (!is_genesis)
@@ -722,6 +785,9 @@ BlockCoordinator::State BlockCoordinator::OnWaitForTransactions(State current, S
     // clear the pending transaction set
     pending_txs_.reset();
 
+    // start loading the transactions for the executors while the remaining checks are made
+    execution_manager_.PrefetchTransactions(current_block_->body);
+
     return State::SYNERGETIC_EXECUTION;
   }
   else
@@ -1175,6 +1241,26 @@ BlockCoordinator::ExecutionStatus BlockCoordinator::QueryExecutorStatus()
   return status;
 }
 
+/**
+ * Internal: Schedule the stateless checks for the current block and the blocks which follow it on
+ * the path being synchronised
+ */
+void BlockCoordinator::SchedulePrevalidation()
+{
+  assert(current_block_);
+
+  // discard the results for blocks which have already been passed
+  prevalidator_->Prune(current_block_->body.block_number);
+
+  // the path is ordered from the most recent block back to the current block
+  std::size_t count{0};
+  for (auto it = blocks_to_common_ancestor_.crbegin();
+       (it != blocks_to_common_ancestor_.crend()) && (count <= PREVALIDATION_DEPTH); ++it, ++count)
+  {
+    prevalidator_->Schedule(*it);
+  }
+}
+
 void BlockCoordinator::UpdateNextBlockTime()
 {
   next_block_time_ = Clock::now() + block_period_;
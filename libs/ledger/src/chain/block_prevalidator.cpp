@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chain/block_prevalidator.hpp"
+#include "ledger/chain/constants.hpp"
+#include "ledger/storage_unit/storage_unit_interface.hpp"
+#include "telemetry/counter.hpp"
+#include "telemetry/registry.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+constexpr std::size_t DIGEST_LENGTH_BYTES = 32;
+
+BlockPrevalidator::Result Fail(char const *reason)
+{
+  BlockPrevalidator::Result result{};
+  result.reason = reason;
+
+  return result;
+}
+
+}  // namespace
+
+/**
+ * Construct the block prevalidator
+ *
+ * @param storage_unit The reference to the storage unit (used for transaction prefetching)
+ * @param config The configuration for the prevalidator
+ */
+BlockPrevalidator::BlockPrevalidator(StorageUnitInterface &storage_unit, Config const &config)
+  : storage_unit_{storage_unit}
+  , config_{config}
+  , validated_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_block_prevalidator_validated_total",
+        "The total number of blocks which have been prevalidated")}
+  , invalid_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_block_prevalidator_invalid_total",
+        "The total number of blocks which have failed prevalidation")}
+  , missing_tx_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_block_prevalidator_missing_tx_total",
+        "The total number of missing transactions requested ahead of execution")}
+  , threads_{config.num_threads, "BlkPreVal"}
+{}
+
+/**
+ * Schedule the stateless checks for a block on the worker threads
+ *
+ * @param block The block to be checked
+ * @return true if the block was scheduled, otherwise false if it has already been scheduled or
+ * the pipeline is full
+ */
+bool BlockPrevalidator::Schedule(BlockPtr const &block)
+{
+  if (entries_.size() >= config_.max_pending)
+  {
+    return false;
+  }
+
+  if (entries_.find(block->body.hash) != entries_.end())
+  {
+    return false;
+  }
+
+  auto result = threads_.Dispatch([this, block]() { return Validate(*block); });
+  entries_.emplace(block->body.hash, Entry{block->body.block_number, std::move(result)});
+
+  return true;
+}
+
+/**
+ * Query the (non blocking) status of the checks for a specified block. Once complete the result is
+ * handed to the caller and the block is removed from the pipeline.
+ *
+ * @param hash The hash of the block being queried
+ * @param result The output result, populated when the checks are complete
+ * @return The status of the checks for the block
+ */
+BlockPrevalidator::Status BlockPrevalidator::Query(Digest const &hash, Result &result)
+{
+  auto it = entries_.find(hash);
+  if (it == entries_.end())
+  {
+    return Status::UNKNOWN;
+  }
+
+  if (it->second.result.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+  {
+    return Status::PENDING;
+  }
+
+  result = it->second.result.get();
+  entries_.erase(it);
+
+  return Status::COMPLETE;
+}
+
+/**
+ * Discard the scheduled blocks which are below the specified height, since they can no longer be
+ * executed in the current pass over the chain
+ *
+ * @param block_number The height below which entries are discarded
+ */
+void BlockPrevalidator::Prune(uint64_t block_number)
+{
+  auto it = entries_.begin();
+  while (it != entries_.end())
+  {
+    if (it->second.block_number < block_number)
+    {
+      it = entries_.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
+/**
+ * Discard all the scheduled blocks. Checks which are already in progress will complete in the
+ * background and their results are dropped.
+ */
+void BlockPrevalidator::Reset()
+{
+  entries_.clear();
+}
+
+/**
+ * Get the number of blocks which are currently scheduled
+ *
+ * @return The number of blocks
+ */
+std::size_t BlockPrevalidator::size() const
+{
+  return entries_.size();
+}
+
+/**
+ * Perform the stateless checks on the specified block. Thread safe.
+ *
+ * @param block The block to be checked
+ * @return The result of the checks
+ */
+BlockPrevalidator::Result BlockPrevalidator::Validate(Block const &block)
+{
+  validated_count_->increment();
+
+  // the genesis block is fixed and therefore need not be checked
+  if (GENESIS_DIGEST == block.body.previous_hash)
+  {
+    Result result{};
+    result.valid = true;
+
+    return result;
+  }
+
+  auto fail = [this](char const *reason) {
+    invalid_count_->increment();
+    return Fail(reason);
+  };
+
+  // Check: Ensure the digests are the correct size
+  if ((DIGEST_LENGTH_BYTES != block.body.hash.size()) ||
+      (DIGEST_LENGTH_BYTES != block.body.previous_hash.size()))
+  {
+    return fail("Block hash size mismatch");
+  }
+
+  // Check: Ensure the number of lanes is correct
+  if (config_.num_lanes != (1u << block.body.log2_num_lanes))
+  {
+    return fail("Lane count mismatch");
+  }
+
+  // Check: Ensure the number of slices is correct
+  if (config_.num_slices != block.body.slices.size())
+  {
+    return fail("Slice count mismatch");
+  }
+
+  // Check: Ensure the block hash (and therefore the merkle root of the transactions) is correct
+  Digest const digest = block.CalculateDigest();
+  if (digest != block.body.hash)
+  {
+    return fail("Block hash mismatch");
+  }
+
+  // Check: Ensure the proof is valid for the block hash
+  Block::Proof proof{block.proof};
+  proof.SetHeader(digest);
+  if (!proof())
+  {
+    return fail("Invalid proof");
+  }
+
+  // Collect: The unique set of transactions referenced by the block
+  DigestSet digests{};
+  for (auto const &slice : block.body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      digests.insert(tx.digest());
+    }
+  }
+
+  // Prefetch: request any of the transactions not yet in storage so that they are likely to have
+  // arrived by the time the block is ready to be executed
+  Result result{};
+  result.valid = true;
+
+  for (auto const &tx_digest : digests)
+  {
+    if (!storage_unit_.HasTransaction(tx_digest))
+    {
+      result.missing_txs.insert(tx_digest);
+    }
+  }
+
+  if (!result.missing_txs.empty())
+  {
+    missing_tx_count_->add(result.missing_txs.size());
+    storage_unit_.IssueCallForMissingTxs(result.missing_txs);
+  }
+
+  return result;
+}
+
+}  // namespace ledger
+}  // namespace fetch
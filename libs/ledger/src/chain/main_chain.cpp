@@ -17,9 +17,11 @@
 //------------------------------------------------------------------------------
 
 #include "core/assert.hpp"
-#include "core/bloom_filter.hpp"
+#include "core/blocked_bloom_filter.hpp"
 #include "core/byte_array/byte_array.hpp"
 #include "core/byte_array/encoders.hpp"
+#include "core/serializers/byte_array.hpp"
+#include "core/serializers/byte_array_buffer.hpp"
 #include "crypto/hash.hpp"
 #include "crypto/sha256.hpp"
 #include "ledger/chain/main_chain.hpp"
@@ -33,7 +35,10 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <deque>
+#include <exception>
+#include <fstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -47,7 +52,10 @@ namespace ledger {
 
 namespace {
 
-void AddBlockToBloomFilter(BasicBloomFilter &bf, Block const &block)
+constexpr char const *BLOOM_FILTER_FILENAME  = "chain.bloom.db";
+constexpr char const *TX_INDEX_HEAD_FILENAME = "chain.tx.head.db";
+
+void AddBlockToBloomFilter(BlockedBloomFilter &bf, Block const &block)
 {
   for (auto const &slice : block.body.slices)
   {
@@ -66,7 +74,7 @@ void AddBlockToBloomFilter(BasicBloomFilter &bf, Block const &block)
  * @param mode Flag to signal which storage mode has been requested
  */
 MainChain::MainChain(bool const enable_bloom_filter, Mode mode)
-  : bloom_filter_{std::make_unique<BasicBloomFilter>()}
+  : bloom_filter_{std::make_unique<BlockedBloomFilter>()}
   , enable_bloom_filter_{enable_bloom_filter}
   , bloom_filter_queried_bit_count_(telemetry::Registry::Instance().CreateGauge<std::size_t>(
         "ledger_main_chain_bloom_filter_queried_bit_number",
@@ -83,8 +91,9 @@ MainChain::MainChain(bool const enable_bloom_filter, Mode mode)
 {
   if (Mode::IN_MEMORY_DB != mode)
   {
-    // create the block store
+    // create the block and transaction stores
     block_store_ = std::make_unique<BlockStore>();
+    tx_store_    = std::make_unique<TxStore>();
 
     RecoverFromFile(mode);
   }
@@ -104,6 +113,10 @@ MainChain::~MainChain()
   if (block_store_)
   {
     block_store_->Flush(false);
+    tx_store_->Flush(false);
+
+    KeepTransactionIndexHead();
+    KeepBloomFilter();
   }
 }
 
@@ -116,10 +129,13 @@ void MainChain::Reset()
   loose_blocks_.clear();
   block_chain_.clear();
   references_.clear();
+  tx_index_.clear();
+  bloom_filter_->Reset();
 
   if (block_store_)
   {
     block_store_->New("chain.db", "chain.index.db");
+    tx_store_->New("chain.tx.db", "chain.tx.index.db");
     head_store_.close();
     head_store_.open("chain.head.db",
                      std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
@@ -152,11 +168,6 @@ BlockStatus MainChain::AddBlock(Block const &blk)
   FETCH_LOG_DEBUG(LOGGING_NAME, "New Block: 0x", block->body.hash.ToHex(), " -> ", ToString(status),
                   " (weight: ", block->weight, " total: ", block->total_weight, ")");
 
-  if (status == BlockStatus::ADDED)
-  {
-    AddBlockToBloomFilter(*bloom_filter_, *block);
-  }
-
   return status;
 }
 
@@ -173,6 +184,17 @@ void MainChain::CacheBlock(IntBlockPtr const &block) const
   auto retVal{block_chain_.emplace(hash, block)};
   // under all circumstances, it _should_ be a fresh block
   ASSERT(retVal.second);
+  // record the transactions which are contained in the block. Loose blocks are included so that
+  // the bloom filter already covers them when they are later attached to the chain
+  for (auto const &slice : block->body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      tx_index_.emplace(tx.digest(), hash);
+    }
+  }
+  AddBlockToBloomFilter(*bloom_filter_, *block);
+
   // keep parent-child reference
   references_.emplace(block->body.previous_hash, std::move(hash));
 }
@@ -185,10 +207,47 @@ void MainChain::CacheBlock(IntBlockPtr const &block) const
  */
 MainChain::BlockMap::size_type MainChain::UncacheBlock(BlockHash const &hash) const
 {
-  return block_chain_.erase(hash);
+  auto const it = block_chain_.find(hash);
+  if (it == block_chain_.end())
+  {
+    return 0;
+  }
+
+  UncacheBlock(it);
+  return 1;
   // references are kept intact while this cache is alive
 }
 
+/**
+ * Internal: erase a block from the cache
+ *
+ * @param it The iterator to the cache entry to be erased
+ * @return The iterator following the erased entry
+ */
+MainChain::BlockMap::iterator MainChain::UncacheBlock(BlockMap::iterator it) const
+{
+  auto const &block = *it->second;
+
+  // remove the transactions contained in the block from the index
+  for (auto const &slice : block.body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      auto const range = tx_index_.equal_range(tx.digest());
+      for (auto entry = range.first; entry != range.second; ++entry)
+      {
+        if (entry->second == block.body.hash)
+        {
+          tx_index_.erase(entry);
+          break;
+        }
+      }
+    }
+  }
+
+  return block_chain_.erase(it);
+}
+
 /**
  * Internal: insert a block into the permanent store maintaining references
  *
@@ -231,6 +290,44 @@ void MainChain::KeepBlock(IntBlockPtr const &block) const
 
   // now write the block itself; if next_hash is genesis, it will be rewritten later by a child
   block_store_->Set(storage::ResourceID(hash), record);
+
+  KeepTransactions(*block);
+}
+
+/**
+ * Internal: record the block number of each of the transactions in a block in the permanent store
+ *
+ * @param block The block being kept
+ */
+void MainChain::KeepTransactions(Block const &block) const
+{
+  ASSERT(static_cast<bool>(tx_store_));
+
+  for (auto const &slice : block.body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      tx_store_->Set(storage::ResourceID(tx.digest()), block.body.block_number);
+    }
+  }
+}
+
+/**
+ * Internal: remove the transactions of a block from the permanent store
+ *
+ * @param block The block which is no longer part of the stored chain
+ */
+void MainChain::ForgetTransactions(Block const &block) const
+{
+  ASSERT(static_cast<bool>(tx_store_));
+
+  for (auto const &slice : block.body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      tx_store_->Erase(storage::ResourceID(tx.digest()));
+    }
+  }
 }
 
 /**
@@ -248,7 +345,6 @@ bool MainChain::LoadBlock(BlockHash const &hash, Block &block) const
   if (block_store_->Get(storage::ResourceID(hash), record))
   {
     block = record.block;
-    AddBlockToBloomFilter(*bloom_filter_, block);
 
     return true;
   }
@@ -315,7 +411,7 @@ bool MainChain::RemoveTree(BlockHash const &removed_hash, BlockHashSet &invalida
       references_.erase(children.first, children.second);
 
       // next, remove the block record from the cache, if found
-      if (block_chain_.erase(hash))
+      if (UncacheBlock(hash))
       {
         retVal = true;
       }
@@ -685,6 +781,7 @@ void MainChain::RecoverFromFile(Mode mode)
   if (Mode::CREATE_PERSISTENT_DB == mode)
   {
     block_store_->New("chain.db", "chain.index.db");
+    tx_store_->New("chain.tx.db", "chain.tx.index.db");
     head_store_.open("chain.head.db",
                      std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
     return;
@@ -692,6 +789,7 @@ void MainChain::RecoverFromFile(Mode mode)
   else if (Mode::LOAD_PERSISTENT_DB == mode)
   {
     block_store_->Load("chain.db", "chain.index.db");
+    tx_store_->Load("chain.tx.db", "chain.tx.index.db");
     head_store_.open("chain.head.db", std::ios::binary | std::ios::in | std::ios::out);
   }
   else
@@ -706,11 +804,30 @@ void MainChain::RecoverFromFile(Mode mode)
   // retrieve the starting hash
   BlockHash head_block_hash = GetHeadHash();
 
+  // the transaction index and the bloom filter are rebuilt from the stored blocks if they are not
+  // present or out of date
+  bool const rebuild_tx_index     = !LoadTransactionIndexHead(head_block_hash);
+  bool const rebuild_bloom_filter = !LoadBloomFilter(head_block_hash);
+
   bool recovery_complete{false};
   if (!head_block_hash.empty() && LoadBlock(head_block_hash, *block))
   {
     auto block_index = block->body.block_number;
 
+    if (rebuild_tx_index)
+    {
+      FETCH_LOG_INFO(LOGGING_NAME, "Transaction index is incomplete, rebuilding");
+
+      // start from an empty store so that no entries from abandoned branches are carried over
+      tx_store_->New("chain.tx.db", "chain.tx.index.db");
+      KeepTransactions(*block);
+    }
+
+    if (rebuild_bloom_filter)
+    {
+      AddBlockToBloomFilter(*bloom_filter_, *block);
+    }
+
     // Save the head
     head = block;
 
@@ -727,6 +844,16 @@ void MainChain::RecoverFromFile(Mode mode)
         break;
       }
 
+      if (rebuild_tx_index)
+      {
+        KeepTransactions(*next);
+      }
+
+      if (rebuild_bloom_filter)
+      {
+        AddBlockToBloomFilter(*bloom_filter_, *next);
+      }
+
       block_index = next->body.block_number;
     }
 
@@ -776,6 +903,8 @@ void MainChain::RecoverFromFile(Mode mode)
   if (!recovery_complete)
   {
     block_store_->New("chain.db", "chain.index.db");
+    tx_store_->New("chain.tx.db", "chain.tx.index.db");
+    bloom_filter_->Reset();
 
     // reopen the file and clear the contents
     head_store_.close();
@@ -784,6 +913,128 @@ void MainChain::RecoverFromFile(Mode mode)
   }
 }
 
+/**
+ * Internal: Determine if the transaction store was completely written at the current head
+ *
+ * The marker is consumed when it is read, so that the index is rebuilt if the node stops without
+ * writing it again on shutdown.
+ *
+ * @param head_hash The hash of the head block which the index is expected to cover
+ * @return true if the index is complete, otherwise false if it needs to be rebuilt
+ */
+bool MainChain::LoadTransactionIndexHead(BlockHash const &head_hash)
+{
+  byte_array::ByteArray buffer;
+  buffer.Resize(head_hash.size());
+
+  {
+    std::ifstream stream{TX_INDEX_HEAD_FILENAME, std::ios::binary};
+    if (!stream.is_open())
+    {
+      return false;
+    }
+
+    stream.read(reinterpret_cast<char *>(buffer.pointer()),
+                static_cast<std::streamsize>(buffer.size()));
+
+    if (stream.gcount() != static_cast<std::streamsize>(buffer.size()))
+    {
+      buffer = byte_array::ByteArray{};
+    }
+  }
+
+  std::remove(TX_INDEX_HEAD_FILENAME);
+
+  return !head_hash.empty() && (head_hash == buffer);
+}
+
+/**
+ * Internal: Record the head up to which the transaction store is complete
+ */
+void MainChain::KeepTransactionIndexHead()
+{
+  BlockHash const head_hash = GetHeadHash();
+  if (head_hash.empty())
+  {
+    return;
+  }
+
+  std::ofstream stream{TX_INDEX_HEAD_FILENAME, std::ios::binary | std::ios::trunc};
+  stream.write(reinterpret_cast<char const *>(head_hash.pointer()),
+               static_cast<std::streamsize>(head_hash.size()));
+}
+
+/**
+ * Internal: Load the bloom filter from the permanent store
+ *
+ * @param head_hash The hash of the head block which the filter is expected to cover
+ * @return true if the filter was loaded, otherwise false if it needs to be rebuilt
+ */
+bool MainChain::LoadBloomFilter(BlockHash const &head_hash)
+{
+  if (head_hash.empty())
+  {
+    return false;
+  }
+
+  std::ifstream stream{BLOOM_FILTER_FILENAME, std::ios::binary | std::ios::ate};
+  if (!stream.is_open())
+  {
+    return false;
+  }
+
+  byte_array::ByteArray buffer;
+  buffer.Resize(static_cast<std::size_t>(stream.tellg()));
+
+  stream.seekg(0);
+  stream.read(reinterpret_cast<char *>(buffer.pointer()),
+              static_cast<std::streamsize>(buffer.size()));
+
+  try
+  {
+    serializers::ByteArrayBuffer serializer{buffer};
+
+    BlockHash          filter_head_hash;
+    BlockedBloomFilter filter{};
+    serializer >> filter_head_hash >> filter;
+
+    // the filter is only usable if it was written at the same point in the chain
+    if (filter_head_hash != head_hash)
+    {
+      FETCH_LOG_INFO(LOGGING_NAME, "Bloom filter is out of date, rebuilding");
+      return false;
+    }
+
+    *bloom_filter_ = std::move(filter);
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to load the bloom filter: ", ex.what());
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Internal: Write the bloom filter to the permanent store, along with the head hash it covers
+ */
+void MainChain::KeepBloomFilter()
+{
+  BlockHash const head_hash = GetHeadHash();
+  if (head_hash.empty())
+  {
+    return;
+  }
+
+  serializers::ByteArrayBuffer serializer;
+  serializer << head_hash << *bloom_filter_;
+
+  std::ofstream stream{BLOOM_FILTER_FILENAME, std::ios::binary | std::ios::trunc};
+  stream.write(reinterpret_cast<char const *>(serializer.data().pointer()),
+               static_cast<std::streamsize>(serializer.data().size()));
+}
+
 /**
  * Internal: Flush confirmed blocks to disk
  */
@@ -824,6 +1075,23 @@ void MainChain::WriteToFile()
     {
       FETCH_LOG_DEBUG(LOGGING_NAME, "Writing genesis. ");
 
+      // any previously stored branch drops off the stored chain
+      BlockHash const current_head_hash = GetHeadHash();
+      Block           current_file_head{};
+      if (!current_head_hash.empty() && LoadBlock(current_head_hash, current_file_head))
+      {
+        while ((current_file_head.body.block_number > 0) &&
+               (current_file_head.body.hash != block->body.hash))
+        {
+          ForgetTransactions(current_file_head);
+
+          if (!LoadBlock(current_file_head.body.previous_hash, current_file_head))
+          {
+            break;
+          }
+        }
+      }
+
       KeepBlock(block);
       SetHeadHash(block->body.hash);
     }
@@ -837,17 +1105,26 @@ void MainChain::WriteToFile()
 
       LoadBlock(GetHeadHash(), *current_file_head);
 
+      // the blocks written to the file, and the blocks which have dropped off the stored chain
+      std::vector<IntBlockPtr> kept_blocks{};
+      std::vector<IntBlockPtr> abandoned_blocks{};
+
       // Now keep adding the block and its prev to the file until we are certain the file contains
       // an unbroken chain. Assuming that the current_file_head is unbroken we can write until we
       // touch it or it's root.
       for (;;)
       {
         KeepBlock(block);
+        kept_blocks.push_back(block);
 
         // Keep the current_file_head one block behind
         while (current_file_head->body.block_number > block->body.block_number - 1)
         {
-          LoadBlock(current_file_head->body.previous_hash, *current_file_head);
+          auto previous = std::make_shared<Block>();
+          LoadBlock(current_file_head->body.previous_hash, *previous);
+
+          abandoned_blocks.push_back(std::move(current_file_head));
+          current_file_head = std::move(previous);
         }
 
         // Successful case
@@ -860,6 +1137,22 @@ void MainChain::WriteToFile()
         LookupBlock(block->body.previous_hash, block);
       }
 
+      // When the stored head has been rewritten (a reorg) the transactions of the old branch are
+      // removed from the transaction store. Since both branches can contain the same transactions
+      // the entries of the new branch are written again afterwards.
+      if (!abandoned_blocks.empty())
+      {
+        for (auto const &abandoned : abandoned_blocks)
+        {
+          ForgetTransactions(*abandoned);
+        }
+
+        for (auto const &kept : kept_blocks)
+        {
+          KeepTransactions(*kept);
+        }
+      }
+
       // Success - we kept a copy of the new head to write
       SetHeadHash(block_head->body.hash);
     }
@@ -869,6 +1162,7 @@ void MainChain::WriteToFile()
 
     // Force flush of the file object!
     block_store_->Flush(false);
+    tx_store_->Flush(false);
 
     // as final step do some sanity checks
     TrimCache();
@@ -924,7 +1218,7 @@ void MainChain::TrimCache()
         }
 
         // remove the entry from the main block chain
-        chain_it = block_chain_.erase(chain_it);
+        chain_it = UncacheBlock(chain_it);
       }
       else
       {
@@ -1437,7 +1731,7 @@ bool MainChain::HeaviestTip::Update(Block const &block)
   return updated;
 }
 
-MainChain::BlockHash MainChain::GetHeadHash()
+MainChain::BlockHash MainChain::GetHeadHash() const
 {
   byte_array::ByteArray buffer;
 
@@ -1490,55 +1784,149 @@ DigestSet MainChain::DetectDuplicateTransactions(BlockHash const &starting_hash,
     return {};
   }
 
+  FETCH_LOCK(lock_);
+
+  // query the bloom filter for all the transactions at once
+  auto const matches = bloom_filter_->Match(transactions.begin(), transactions.end());
+
   DigestSet potential_duplicates{};
+  auto      result = matches.begin();
   for (auto const &digest : transactions)
   {
-
-    std::pair<bool, std::size_t> const result = bloom_filter_->Match(digest);
-    bloom_filter_queried_bit_count_->set(result.second);
-    if (result.first)
+    if (*result++)
     {
-      bloom_filter_positive_count_->increment();
       potential_duplicates.insert(digest);
     }
-    bloom_filter_query_count_->increment();
   }
 
-  auto search_chain_for_duplicates =
-      [this, block](DigestSet const &transaction_digests) mutable -> DigestSet {
-    DigestSet duplicates{};
-    for (;;)
+  bloom_filter_queried_bit_count_->set(BlockedBloomFilter::BITS_PER_ELEMENT);
+  bloom_filter_query_count_->add(transactions.size());
+  bloom_filter_positive_count_->add(potential_duplicates.size());
+
+  DigestSet const &candidates = enable_bloom_filter_ ? potential_duplicates : transactions;
+
+  // Step 1. Locate the candidates in the recent (cached) blocks. Only blocks which are not above
+  // the starting block can be ancestors of it
+  std::vector<std::pair<Digest, BlockHash>> recent_matches{};
+  uint64_t lowest_block_number = block->body.block_number + 1;
+  for (auto const &digest : candidates)
+  {
+    auto const range = tx_index_.equal_range(digest);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      IntBlockPtr containing_block;
+      if (LookupBlockFromCache(it->second, containing_block) &&
+          (containing_block->body.block_number <= block->body.block_number))
+      {
+        lowest_block_number = std::min(lowest_block_number, containing_block->body.block_number);
+        recent_matches.emplace_back(digest, it->second);
+      }
+    }
+  }
+
+  // Step 2. Walk back from the starting block through the cache, as far as the lowest match. When
+  // there is a permanent store the walk continues until the chain leaves the cache
+  bool const   search_store = static_cast<bool>(tx_store_);
+  bool         reached_store{false};
+  BlockHash    stored_hash{};
+  uint64_t     stored_height{0};
+  BlockHashSet ancestors{};
+
+  if (!IsBlockInCache(block->body.hash))
+  {
+    // the starting block has itself been loaded from the permanent store
+    reached_store = search_store;
+    stored_hash   = block->body.hash;
+    stored_height = block->body.block_number;
+  }
+  else
+  {
+    IntBlockPtr current = block;
+    while (search_store || (current->body.block_number >= lowest_block_number))
     {
-      // Traversing the chain fully is costly: break out early if we know the transactions are all
-      // duplicated (or both sets are empty)
-      if (transaction_digests.size() == duplicates.size())
+      ancestors.insert(current->body.hash);
+
+      if (GENESIS_DIGEST == current->body.previous_hash)
       {
         break;
       }
 
-      for (auto const &slice : block->body.slices)
+      IntBlockPtr previous;
+      if (!LookupBlockFromCache(current->body.previous_hash, previous))
       {
-        for (auto const &tx : slice)
+        reached_store = search_store && (current->body.block_number > 0);
+        stored_hash   = current->body.previous_hash;
+        stored_height = current->body.block_number - 1;
+        break;
+      }
+
+      current = std::move(previous);
+    }
+  }
+
+  DigestSet duplicates{};
+  for (auto const &match : recent_matches)
+  {
+    if (ancestors.find(match.second) != ancestors.end())
+    {
+      duplicates.insert(match.first);
+    }
+  }
+
+  // Step 3. The stored block which has been reached is not necessarily part of the stored chain,
+  // e.g. while the stored head moves over to another branch. Walk it and the stored head back to
+  // their common block, checking the blocks which are not on the stored chain directly. In the
+  // common case the stored head is one of the cached ancestors, which means the stored block is
+  // below it on the stored chain and the walk (and its block loads) can be skipped
+  BlockHash const head_hash = reached_store ? GetHeadHash() : BlockHash{};
+  if (reached_store && (stored_hash != head_hash) && (ancestors.find(head_hash) == ancestors.end()))
+  {
+    Block branch{};
+    Block stored{};
+
+    reached_store = !head_hash.empty() && LoadBlock(stored_hash, branch) &&
+                    LoadBlock(head_hash, stored);
+    while (reached_store && (branch.body.hash != stored.body.hash))
+    {
+      if (branch.body.block_number >= stored.body.block_number)
+      {
+        for (auto const &slice : branch.body.slices)
         {
-          if (transaction_digests.find(tx.digest()) != transaction_digests.end())
+          for (auto const &tx : slice)
           {
-            duplicates.insert(tx.digest());
+            if (candidates.find(tx.digest()) != candidates.end())
+            {
+              duplicates.insert(tx.digest());
+            }
           }
         }
-      }
 
-      // exit the loop once we can no longer find the block
-      if (!LookupBlock(block->body.previous_hash, block, false))
+        reached_store = LoadBlock(branch.body.previous_hash, branch);
+      }
+      else
       {
-        break;
+        reached_store = LoadBlock(stored.body.previous_hash, stored);
       }
     }
 
-    return duplicates;
-  };
+    stored_height = branch.body.block_number;
+  }
 
-  DigestSet const duplicates =
-      search_chain_for_duplicates(enable_bloom_filter_ ? potential_duplicates : transactions);
+  // Step 4. Lookup the remaining candidates in the permanent store, which only contains the
+  // transactions of the stored chain
+  if (reached_store)
+  {
+    for (auto const &digest : candidates)
+    {
+      uint64_t block_number{0};
+      if ((duplicates.find(digest) == duplicates.end()) &&
+          tx_store_->Get(storage::ResourceID(digest), block_number) &&
+          (block_number <= stored_height))
+      {
+        duplicates.insert(digest);
+      }
+    }
+  }
 
   auto const false_positives = potential_duplicates.size() - duplicates.size();
 
@@ -18,9 +18,13 @@
 
 #include "ledger/chain/transaction.hpp"
 
+#include "crypto/ecdsa_batch_verifier.hpp"
 #include "crypto/verifier.hpp"
 #include "ledger/chain/transaction_serializer.hpp"
 
+#include <cstddef>
+#include <exception>
+
 namespace fetch {
 namespace ledger {
 
@@ -87,6 +91,87 @@ bool Transaction::Verify()
   return verified_;
 }
 
+/**
+ * Verify the contents of a batch of transactions, sharing the verification work between them
+ *
+ * The result for each transaction is identical to calling Verify() on it individually
+ *
+ * @param transactions The transactions to be verified
+ * @param verifier The batch verifier to be used
+ */
+void Transaction::VerifyBatch(std::vector<std::shared_ptr<Transaction>> const &transactions,
+                              crypto::ECDSABatchVerifier &                     verifier)
+{
+  struct Pending
+  {
+    Transaction *tx;     ///< The transaction being verified
+    std::size_t  first;  ///< The index of the result for the first signatory
+  };
+
+  std::vector<Pending> pending;
+  pending.reserve(transactions.size());
+
+  // queue all the signatures from the transactions that still need to be verified
+  for (auto const &tx : transactions)
+  {
+    if (tx->verification_completed_)
+    {
+      continue;
+    }
+
+    // ensure that there are some signatories (otherwise it is invalid)
+    if (tx->signatories_.empty())
+    {
+      tx->verified_               = false;
+      tx->verification_completed_ = true;
+      continue;
+    }
+
+    ConstByteArray const payload = TransactionSerializer::SerializePayload(*tx);
+
+    std::size_t const first = verifier.size();
+    for (auto const &signatory : tx->signatories_)
+    {
+      verifier.Add(signatory.identity.identifier(), payload, signatory.signature);
+
+      // ensure is well formed
+      assert(!signatory.address.address().empty());
+    }
+
+    pending.emplace_back(Pending{tx.get(), first});
+  }
+
+  // verify all of the signatures together
+  crypto::ECDSABatchVerifier::Results results{};
+  try
+  {
+    results = verifier.Verify();
+  }
+  catch (std::exception const &)
+  {
+    // the batch could not be checked, so the transactions (which have not yet been marked as
+    // complete) are verified individually instead
+    for (auto const &entry : pending)
+    {
+      entry.tx->Verify();
+    }
+
+    return;
+  }
+
+  for (auto const &entry : pending)
+  {
+    bool all_verified{true};
+    for (std::size_t i = 0; i < entry.tx->signatories_.size(); ++i)
+    {
+      all_verified = all_verified && results[entry.first + i];
+    }
+
+    entry.tx->verified_               = all_verified;
+    entry.tx->verification_completed_ = true;
+  }
+}
+
 bool Transaction::IsSignedByFromAddress() const
 {
   auto const it = std::find_if(
@@ -0,0 +1,690 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/encoders.hpp"
+#include "core/filesystem/read_file_contents.hpp"
+#include "core/logger.hpp"
+#include "core/mutex.hpp"
+#include "core/serializers/byte_array_buffer.hpp"
+#include "ledger/chaincode/compiled_contract_cache.hpp"
+#include "version/fetch_version.hpp"
+#include "vm/generator.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+using serializers::ByteArrayBuffer;
+using vm::Annotation;
+using vm::AnnotationElement;
+using vm::AnnotationLiteral;
+using vm::TypeInfo;
+
+constexpr char const *LOGGING_NAME   = "CompiledContractCache";
+constexpr uint64_t    FILE_MAGIC     = 0x4558454843544546ull;  // FETCHEXE
+constexpr uint32_t    FORMAT_VERSION = 2;
+constexpr uint64_t    MAX_ELEMENTS   = 1ull << 20u;
+
+/**
+ * Read a container length from the buffer, checking that it is sensible
+ *
+ * @param buffer The buffer to read from
+ * @return The number of elements
+ */
+std::size_t ReadLength(ByteArrayBuffer &buffer)
+{
+  uint64_t length{0};
+  buffer >> length;
+
+  if ((length > MAX_ELEMENTS) || (static_cast<int64_t>(length) > buffer.bytes_left()))
+  {
+    throw std::runtime_error("Invalid container length in serialized executable");
+  }
+
+  return static_cast<std::size_t>(length);
+}
+
+void Write(ByteArrayBuffer &buffer, AnnotationLiteral const &literal)
+{
+  buffer << static_cast<uint8_t>(literal.type);
+
+  switch (literal.type)
+  {
+  case vm::AnnotationLiteralType::Boolean:
+    buffer << static_cast<uint8_t>(literal.boolean);
+    break;
+  case vm::AnnotationLiteralType::Integer:
+    buffer << literal.integer;
+    break;
+  case vm::AnnotationLiteralType::Real:
+    buffer << literal.real;
+    break;
+  case vm::AnnotationLiteralType::String:
+  case vm::AnnotationLiteralType::Identifier:
+    buffer << literal.str;
+    break;
+  case vm::AnnotationLiteralType::Unknown:
+    break;
+  }
+}
+
+void Read(ByteArrayBuffer &buffer, AnnotationLiteral &literal)
+{
+  uint8_t type{0};
+  buffer >> type;
+
+  switch (static_cast<vm::AnnotationLiteralType>(type))
+  {
+  case vm::AnnotationLiteralType::Boolean:
+  {
+    uint8_t value{0};
+    buffer >> value;
+    literal.SetBoolean(value != 0);
+    break;
+  }
+  case vm::AnnotationLiteralType::Integer:
+  {
+    int64_t value{0};
+    buffer >> value;
+    literal.SetInteger(value);
+    break;
+  }
+  case vm::AnnotationLiteralType::Real:
+  {
+    double value{0};
+    buffer >> value;
+    literal.SetReal(value);
+    break;
+  }
+  case vm::AnnotationLiteralType::String:
+  {
+    std::string value;
+    buffer >> value;
+    literal.SetString(value);
+    break;
+  }
+  case vm::AnnotationLiteralType::Identifier:
+  {
+    std::string value;
+    buffer >> value;
+    literal.SetIdentifier(value);
+    break;
+  }
+  case vm::AnnotationLiteralType::Unknown:
+    literal = AnnotationLiteral{};
+    break;
+  default:
+    throw std::runtime_error("Invalid annotation literal in serialized executable");
+  }
+}
+
+void Write(ByteArrayBuffer &buffer, vm::AnnotationArray const &annotations)
+{
+  buffer << static_cast<uint64_t>(annotations.size());
+  for (auto const &annotation : annotations)
+  {
+    buffer << annotation.name;
+    buffer << static_cast<uint64_t>(annotation.elements.size());
+    for (auto const &element : annotation.elements)
+    {
+      buffer << static_cast<uint8_t>(element.type);
+      Write(buffer, element.name);
+      Write(buffer, element.value);
+    }
+  }
+}
+
+void Read(ByteArrayBuffer &buffer, vm::AnnotationArray &annotations)
+{
+  annotations.resize(ReadLength(buffer));
+  for (auto &annotation : annotations)
+  {
+    buffer >> annotation.name;
+
+    annotation.elements.resize(ReadLength(buffer));
+    for (auto &element : annotation.elements)
+    {
+      uint8_t type{0};
+      buffer >> type;
+
+      element.type = static_cast<vm::AnnotationElementType>(type);
+      Read(buffer, element.name);
+      Read(buffer, element.value);
+    }
+  }
+}
+
+void Write(ByteArrayBuffer &buffer, TypeInfo const &type_info)
+{
+  buffer << static_cast<uint8_t>(type_info.type_kind) << type_info.name
+         << type_info.template_type_id << type_info.parameter_type_ids;
+}
+
+void Read(ByteArrayBuffer &buffer, TypeInfo &type_info)
+{
+  uint8_t type_kind{0};
+  buffer >> type_kind >> type_info.name >> type_info.template_type_id;
+
+  type_info.type_kind = static_cast<vm::TypeKind>(type_kind);
+
+  type_info.parameter_type_ids.resize(ReadLength(buffer));
+  for (auto &type_id : type_info.parameter_type_ids)
+  {
+    buffer >> type_id;
+  }
+}
+
+void Write(ByteArrayBuffer &buffer, vm::Executable::Function const &function)
+{
+  buffer << function.name;
+  Write(buffer, function.annotations);
+  buffer << static_cast<int32_t>(function.num_variables)
+         << static_cast<int32_t>(function.num_parameters) << function.return_type_id;
+
+  buffer << static_cast<uint64_t>(function.variables.size());
+  for (auto const &variable : function.variables)
+  {
+    buffer << variable.name << variable.type_id << variable.scope_number;
+  }
+
+  buffer << static_cast<uint64_t>(function.instructions.size());
+  for (auto const &instruction : function.instructions)
+  {
+    buffer << instruction.opcode << instruction.type_id << instruction.index << instruction.data;
+  }
+
+  buffer << function.pc_to_line_map_;
+}
+
+vm::Executable::Function ReadFunction(ByteArrayBuffer &buffer)
+{
+  std::string         name;
+  vm::AnnotationArray annotations;
+  int32_t             num_variables{0};
+  int32_t             num_parameters{0};
+  vm::TypeId          return_type_id{0};
+
+  buffer >> name;
+  Read(buffer, annotations);
+  buffer >> num_variables >> num_parameters >> return_type_id;
+
+  vm::Executable::Function function{name, annotations, num_parameters, return_type_id};
+
+  std::size_t const num_stored_variables = ReadLength(buffer);
+  for (std::size_t i = 0; i < num_stored_variables; ++i)
+  {
+    std::string variable_name;
+    vm::TypeId  type_id{0};
+    uint16_t    scope_number{0};
+    buffer >> variable_name >> type_id >> scope_number;
+
+    function.AddVariable(variable_name, type_id, scope_number);
+  }
+
+  if (function.num_variables != num_variables)
+  {
+    throw std::runtime_error("Inconsistent variables in serialized executable");
+  }
+
+  std::size_t const num_instructions = ReadLength(buffer);
+  for (std::size_t i = 0; i < num_instructions; ++i)
+  {
+    uint16_t opcode{0};
+    buffer >> opcode;
+
+    vm::Executable::Instruction instruction{opcode};
+    buffer >> instruction.type_id >> instruction.index >> instruction.data;
+
+    function.AddInstruction(instruction);
+  }
+
+  buffer >> function.pc_to_line_map_;
+
+  return function;
+}
+
+void Write(ByteArrayBuffer &buffer, vm::Executable const &executable)
+{
+  buffer << executable.name << executable.strings;
+
+  // only primitive constants can be stored as their raw values
+  buffer << static_cast<uint64_t>(executable.constants.size());
+  for (auto const &constant : executable.constants)
+  {
+    if (!constant.IsPrimitive())
+    {
+      throw std::runtime_error("Unable to serialize non primitive constant");
+    }
+
+    buffer << constant.type_id << constant.primitive.ui64;
+  }
+
+  buffer << static_cast<uint64_t>(executable.types.size());
+  for (auto const &type_info : executable.types)
+  {
+    Write(buffer, type_info);
+  }
+
+  buffer << static_cast<uint64_t>(executable.functions.size());
+  for (auto const &function : executable.functions)
+  {
+    Write(buffer, function);
+  }
+}
+
+void Read(ByteArrayBuffer &buffer, vm::Executable &executable)
+{
+  buffer >> executable.name >> executable.strings;
+
+  executable.constants.resize(ReadLength(buffer));
+  for (auto &constant : executable.constants)
+  {
+    vm::TypeId type_id{0};
+    uint64_t   raw{0};
+    buffer >> type_id >> raw;
+
+    if (type_id > vm::TypeIds::PrimitiveMaxId)
+    {
+      throw std::runtime_error("Invalid constant in serialized executable");
+    }
+
+    constant.type_id        = type_id;
+    constant.primitive.ui64 = raw;
+  }
+
+  executable.types.resize(ReadLength(buffer));
+  for (auto &type_info : executable.types)
+  {
+    Read(buffer, type_info);
+  }
+
+  std::size_t const num_functions = ReadLength(buffer);
+  for (std::size_t i = 0; i < num_functions; ++i)
+  {
+    auto function = ReadFunction(buffer);
+    executable.AddFunction(function);
+  }
+}
+
+/**
+ * Write the contents of the buffer to a file and flush them to disk
+ *
+ * @param path The path of the file to be written
+ * @param buffer The contents of the file
+ * @return true if successful, otherwise false
+ */
+bool WriteFileContents(std::string const &path, ByteArrayBuffer const &buffer)
+{
+  int const fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  uint8_t const *data    = buffer.data().pointer();
+  std::size_t    size    = buffer.size();
+  bool           success = true;
+
+  while (success && (size > 0))
+  {
+    ssize_t const written = write(fd, data, size);
+
+    if (written < 0)
+    {
+      success = (errno == EINTR);
+      continue;
+    }
+
+    data += written;
+    size -= static_cast<std::size_t>(written);
+  }
+
+  success = success && (fsync(fd) == 0);
+  success = (close(fd) == 0) && success;
+
+  return success;
+}
+
+}  // namespace
+
+/**
+ * Get the reference to the process wide cache
+ *
+ * @return The cache instance
+ */
+CompiledContractCache &CompiledContractCache::Instance()
+{
+  static CompiledContractCache instance;
+  return instance;
+}
+
+/**
+ * Construct a cache with the specified size limit
+ *
+ * @param max_size The maximum (estimated) size in bytes of all the cached executables
+ */
+CompiledContractCache::CompiledContractCache(std::size_t max_size)
+  : max_size_{max_size}
+{}
+
+/**
+ * Lookup a compiled contract in the cache
+ *
+ * @param digest The digest of the contract source
+ * @return The cache entry if found, otherwise nullptr
+ */
+CompiledContractCache::EntryPtr CompiledContractCache::Lookup(ConstByteArray const &digest)
+{
+  EntryPtr entry{};
+
+  {
+    FETCH_LOCK(lock_);
+
+    auto it = elements_.find(digest);
+    if (it != elements_.end())
+    {
+      // move the entry to the front of the LRU list
+      lru_.splice(lru_.begin(), lru_, it->second.position);
+
+      entry = it->second.entry;
+    }
+  }
+
+  if (entry)
+  {
+    ++hits_;
+  }
+  else
+  {
+    ++misses_;
+  }
+
+  return entry;
+}
+
+/**
+ * Add a compiled contract to the cache. After this point the executable and module must not be
+ * modified
+ *
+ * @param digest The digest of the contract source
+ * @param executable The compiled executable
+ * @param module The module against which the executable was compiled
+ * @return The cache entry for the contract (which might have been added by another thread)
+ */
+CompiledContractCache::EntryPtr CompiledContractCache::Add(ConstByteArray const &digest,
+                                                           ExecutablePtr         executable,
+                                                           ModulePtr             module)
+{
+  auto entry        = std::make_shared<Entry>();
+  entry->size       = EstimateSize(*executable);
+  entry->executable = std::move(executable);
+  entry->module     = std::move(module);
+
+  FETCH_LOCK(lock_);
+
+  // another thread might have compiled the same contract in the meantime
+  auto it = elements_.find(digest);
+  if (it != elements_.end())
+  {
+    return it->second.entry;
+  }
+
+  lru_.push_front(digest);
+  elements_.emplace(digest, Element{entry, lru_.begin()});
+  size_ += entry->size;
+
+  Evict();
+
+  return entry;
+}
+
+/**
+ * Update the maximum size of the cache
+ *
+ * @param max_size The maximum (estimated) size in bytes
+ */
+void CompiledContractCache::SetMaxSize(std::size_t max_size)
+{
+  FETCH_LOCK(lock_);
+  max_size_ = max_size;
+  Evict();
+}
+
+/**
+ * Remove all the entries from the in memory cache
+ */
+void CompiledContractCache::Clear()
+{
+  FETCH_LOCK(lock_);
+  elements_.clear();
+  lru_.clear();
+  size_ = 0;
+}
+
+/**
+ * Enable the persistence of the compiled executables
+ *
+ * @param path_prefix The file path prefix for each of the executable files
+ */
+void CompiledContractCache::EnablePersistence(std::string path_prefix)
+{
+  FETCH_LOCK(lock_);
+  path_prefix_ = std::move(path_prefix);
+}
+
+/**
+ * Attempt to load a previously persisted executable
+ *
+ * @param digest The digest of the contract source
+ * @param executable The executable to be populated
+ * @return true if successful, otherwise false
+ */
+bool CompiledContractCache::LoadExecutable(ConstByteArray const &digest,
+                                           Executable &          executable) const
+{
+  std::string const path = GeneratePath(digest);
+  if (path.empty())
+  {
+    return false;
+  }
+
+  auto const contents = core::ReadContentsOfFile(path.c_str());
+  if (contents.empty())
+  {
+    return false;
+  }
+
+  bool success{false};
+
+  try
+  {
+    ByteArrayBuffer buffer{contents};
+
+    uint64_t    magic{0};
+    uint32_t    format_version{0};
+    std::string build_version;
+    buffer >> magic >> format_version >> build_version;
+
+    // executables are only valid for the module layout of the build which generated them
+    if ((FILE_MAGIC == magic) && (FORMAT_VERSION == format_version) &&
+        (build_version == version::FULL))
+    {
+      Executable loaded{};
+      Read(buffer, loaded);
+
+      executable = std::move(loaded);
+      success    = true;
+    }
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to load executable for 0x", digest.ToHex(), ": ",
+                   ex.what());
+  }
+
+  return success;
+}
+
+/**
+ * Persist a compiled executable to disk (if enabled)
+ *
+ * @param digest The digest of the contract source
+ * @param executable The executable to be stored
+ * @return true if successful, otherwise false
+ */
+bool CompiledContractCache::StoreExecutable(ConstByteArray const &digest,
+                                            Executable const &    executable) const
+{
+  std::string const path = GeneratePath(digest);
+  if (path.empty())
+  {
+    return false;
+  }
+
+  ByteArrayBuffer buffer;
+
+  try
+  {
+    buffer << FILE_MAGIC << FORMAT_VERSION << std::string{version::FULL};
+    Write(buffer, executable);
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to persist executable for 0x", digest.ToHex(), ": ",
+                   ex.what());
+    return false;
+  }
+
+  // write to a temporary file first so that partially written files are never loaded. The
+  // contents must be on disk before the rename, otherwise a crash could leave a truncated file
+  // under the final name
+  std::string const temp_path = path + ".tmp";
+  if (!WriteFileContents(temp_path, buffer))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to persist executable to: ", temp_path);
+    std::remove(temp_path.c_str());
+    return false;
+  }
+
+  return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+
+std::size_t CompiledContractCache::size() const
+{
+  FETCH_LOCK(lock_);
+  return size_;
+}
+
+std::size_t CompiledContractCache::num_entries() const
+{
+  FETCH_LOCK(lock_);
+  return elements_.size();
+}
+
+uint64_t CompiledContractCache::hits() const
+{
+  return hits_;
+}
+
+uint64_t CompiledContractCache::misses() const
+{
+  return misses_;
+}
+
+/**
+ * Estimate the memory footprint of a compiled executable
+ *
+ * @param executable The executable to be evaluated
+ * @return The estimated size in bytes
+ */
+std::size_t CompiledContractCache::EstimateSize(Executable const &executable)
+{
+  std::size_t size = sizeof(Executable) + executable.name.size();
+
+  for (auto const &str : executable.strings)
+  {
+    size += sizeof(str) + str.size();
+  }
+
+  size += executable.constants.size() * sizeof(vm::Variant);
+
+  for (auto const &type_info : executable.types)
+  {
+    size += sizeof(type_info) + type_info.name.size() +
+            (type_info.parameter_type_ids.size() * sizeof(vm::TypeId));
+  }
+
+  for (auto const &function : executable.functions)
+  {
+    size += sizeof(function) + function.name.size();
+    size += function.instructions.size() * sizeof(Executable::Instruction);
+    size += function.handlers.size() * sizeof(vm::OpcodeHandler);
+    size += function.pc_to_line_map_.size() * (2u * sizeof(uint16_t) + 32u);
+
+    for (auto const &variable : function.variables)
+    {
+      size += sizeof(variable) + variable.name.size();
+    }
+  }
+
+  return size;
+}
+
+std::string CompiledContractCache::GeneratePath(ConstByteArray const &digest) const
+{
+  FETCH_LOCK(lock_);
+
+  if (path_prefix_.empty())
+  {
+    return {};
+  }
+
+  return path_prefix_ + std::string{digest.ToHex()} + ".etch.bin";
+}
+
+/**
+ * Remove the least recently used entries until the cache is within its size limit. The most
+ * recently added entry is always retained
+ *
+ * Must be called with the lock held
+ */
+void CompiledContractCache::Evict()
+{
+  while ((size_ > max_size_) && (lru_.size() > 1))
+  {
+    auto it = elements_.find(lru_.back());
+    assert(it != elements_.end());
+
+    size_ -= it->second.entry->size;
+    elements_.erase(it);
+    lru_.pop_back();
+  }
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -22,6 +22,7 @@
 #include "crypto/hash.hpp"
 #include "crypto/sha256.hpp"
 #include "ledger/chain/transaction.hpp"
+#include "ledger/chaincode/compiled_contract_cache.hpp"
 #include "ledger/chaincode/smart_contract.hpp"
 #include "ledger/chaincode/smart_contract_exception.hpp"
 #include "ledger/chaincode/vm_definition.hpp"
@@ -32,6 +33,7 @@
 #include "variant/variant_utils.hpp"
 #include "vm/address.hpp"
 #include "vm/function_decorators.hpp"
+#include "vm/vm_pool.hpp"
 #include "vm_modules/vm_factory.hpp"
 
 #include <algorithm>
@@ -88,6 +90,31 @@ void ValidateAddressesInParams(Transaction const &tx, vm::ParameterPack const &p
   }
 }
 
+/**
+ * Create the module against which contracts are compiled and executed. Since the module is shared
+ * between all the instances of the same contract, the bindings must not refer to a specific
+ * contract instance directly. Instead it is looked up from the context of the executing VM.
+ *
+ * @return The newly created module
+ */
+std::shared_ptr<vm::Module> CreateModule()
+{
+  auto module = VMFactory::GetModule(VMFactory::USE_SMART_CONTRACTS);
+
+  module->CreateFreeFunction("getBlockNumber", [](vm::VM *vm) -> SmartContract::BlockIndex {
+    auto const *contract = vm->GetContext<SmartContract>();
+    if (contract == nullptr)
+    {
+      vm->RuntimeError("getBlockNumber is not available in this context");
+      return 0;
+    }
+
+    return contract->block_index();
+  });
+
+  return module;
+}
+
 }  // namespace
 
 /**
@@ -98,8 +125,6 @@ void ValidateAddressesInParams(Transaction const &tx, vm::ParameterPack const &p
 SmartContract::SmartContract(std::string const &source)
   : source_{source}
   , digest_{GenerateDigest(source)}
-  , executable_{std::make_shared<Executable>()}
-  , module_{VMFactory::GetModule(VMFactory::USE_SMART_CONTRACTS)}
 {
   if (source_.empty())
   {
@@ -109,17 +134,44 @@ SmartContract::SmartContract(std::string const &source)
 
   FETCH_LOG_DEBUG(LOGGING_NAME, "Constructing contract: 0x", contract_digest().ToHex());
 
-  module_->CreateFreeFunction("getBlockNumber", [this](vm::VM *) { return block_index_; });
-
-  // create and compile the executable
-  auto errors = vm_modules::VMFactory::Compile(module_, source_, *executable_);
+  auto &cache = CompiledContractCache::Instance();
 
-  // if there are any compilation errors
-  if (!errors.empty())
+  // in the normal case the contract will have already been compiled
+  auto entry = cache.Lookup(digest_);
+  if (!entry)
   {
-    throw SmartContractException(SmartContractException::Category::COMPILATION, std::move(errors));
+    auto module     = CreateModule();
+    auto executable = std::make_shared<Executable>();
+
+    if (cache.LoadExecutable(digest_, *executable))
+    {
+      // the module was not used to compile the executable, so its details must be populated
+      module->RegisterBindings();
+
+      // the dispatch handlers are not persisted and must be resolved again
+      vm::VMPool::ThreadLocal().Acquire(module)->ResolveOpcodeHandlers(*executable);
+    }
+    else
+    {
+      // create and compile the executable
+      auto errors = vm_modules::VMFactory::Compile(module, source_, *executable);
+
+      // if there are any compilation errors
+      if (!errors.empty())
+      {
+        throw SmartContractException(SmartContractException::Category::COMPILATION,
+                                     std::move(errors));
+      }
+
+      cache.StoreExecutable(digest_, *executable);
+    }
+
+    entry = cache.Add(digest_, std::move(executable), std::move(module));
   }
 
+  executable_ = entry->executable;
+  module_     = entry->module;
+
   // since we now have a fully compiled executable we can evaluate the functions and assign the
   // mapping
 
@@ -432,8 +484,9 @@ Contract::Status SmartContract::InvokeAction(std::string const &name, Transactio
   }
 
   // Get clean VM instance
-  auto vm = std::make_unique<vm::VM>(module_.get());
+  auto vm = vm::VMPool::ThreadLocal().Acquire(module_);
   vm->SetIOObserver(state());
+  vm->SetContext(this);
 
   // lookup the function / entry point which will be executed
   Executable::Function const *target_function = executable_->FindFunction(name);
@@ -494,8 +547,9 @@ Contract::Status SmartContract::InvokeAction(std::string const &name, Transactio
 Contract::Status SmartContract::InvokeInit(Address const &owner)
 {
   // Get clean VM instance
-  auto vm = std::make_unique<vm::VM>(module_.get());
+  auto vm = vm::VMPool::ThreadLocal().Acquire(module_);
   vm->SetIOObserver(state());
+  vm->SetContext(this);
 
   FETCH_LOG_DEBUG(LOGGING_NAME, "Running SC init function: ", init_fn_name_);
 
@@ -545,8 +599,9 @@ SmartContract::Status SmartContract::InvokeQuery(std::string const &name, Query
                                                  Query &response)
 {
   // get clean VM instance
-  auto vm = std::make_unique<vm::VM>(module_.get());
+  auto vm = vm::VMPool::ThreadLocal().Acquire(module_);
   vm->SetIOObserver(state());
+  vm->SetContext(this);
 
   // lookup the executable
   Executable::Function const *target_function = executable_->FindFunction(name);
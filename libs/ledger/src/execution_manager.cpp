@@ -25,10 +25,11 @@
 #include "ledger/execution_manager.hpp"
 #include "ledger/executor.hpp"
 #include "ledger/state_adapter.hpp"
-#include "moment/deadline_timer.hpp"
 #include "storage/resource_mapper.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -36,37 +37,78 @@
 static constexpr char const *LOGGING_NAME              = "ExecutionManager";
 static constexpr std::size_t MAX_STARTUP_ITERATIONS    = 20;
 static constexpr std::size_t STARTUP_ITERATION_TIME_MS = 100;
+static constexpr std::size_t LOG2_READY_QUEUE_SIZE     = 10;
 
 namespace fetch {
 namespace ledger {
+namespace {
+
+enum class Outcome
+{
+  COMPLETE,
+  STALL,
+  ERROR,
+  FATAL_ERROR
+};
+
+/**
+ * Classify the status of an executed item in terms of its effect on the block execution
+ *
+ * @param status The execution status
+ * @return The corresponding outcome
+ */
+Outcome ClassifyStatus(ExecutionItem::Status status)
+{
+  switch (status)
+  {
+  case ExecutionItem::Status::SUCCESS:
+    return Outcome::COMPLETE;
+  case ExecutionItem::Status::TX_LOOKUP_FAILURE:
+    return Outcome::STALL;
+  case ExecutionItem::Status::CHAIN_CODE_LOOKUP_FAILURE:
+  case ExecutionItem::Status::CHAIN_CODE_EXEC_FAILURE:
+  case ExecutionItem::Status::CONTRACT_NAME_PARSE_FAILURE:
+  case ExecutionItem::Status::CONTRACT_LOOKUP_FAILURE:
+  case ExecutionItem::Status::TX_NOT_VALID_FOR_BLOCK:
+  case ExecutionItem::Status::INSUFFICIENT_AVAILABLE_FUNDS:
+  case ExecutionItem::Status::TRANSFER_FAILURE:
+  case ExecutionItem::Status::INSUFFICIENT_CHARGE:
+    return Outcome::ERROR;
+  default:
+    return Outcome::FATAL_ERROR;
+  }
+}
+
+}  // namespace
 
 /**
  * Constructs a execution manager instance
  *
  * @param num_executors The specified number of executors (and threads)
+ * @param log2_num_lanes Log2 of the number of lanes
+ * @param storage The storage unit
+ * @param factory The factory used to create the executors
+ * @param prefetcher The (optional) prefetcher shared with the executors
  */
 ExecutionManager::ExecutionManager(std::size_t num_executors, uint32_t log2_num_lanes,
-                                   StorageUnitPtr storage, ExecutorFactory const &factory)
+                                   StorageUnitPtr storage, ExecutorFactory const &factory,
+                                   TxPrefetcherPtr prefetcher)
   : log2_num_lanes_{log2_num_lanes}
   , storage_(std::move(storage))
-  , idle_executors_()
-  , thread_pool_(network::MakeThreadPool(num_executors, "Executor"))
+  , prefetcher_{std::move(prefetcher)}
 {
-  // setup the executor pool
-  {
-    FETCH_LOCK(idle_executors_lock_);
-
-    // ensure lists are reserved
-    idle_executors_.reserve(num_executors);
+  // ensure lists are reserved
+  workers_.reserve(num_executors);
 
-    // create the executor instances
-    for (std::size_t i = 0; i < num_executors; ++i)
-    {
-      auto executor = factory();
-      assert(static_cast<bool>(executor));
+  // create the workers, each of which owns a single executor instance
+  for (std::size_t i = 0; i < num_executors; ++i)
+  {
+    auto worker      = std::make_unique<Worker>(LOG2_READY_QUEUE_SIZE);
+    worker->index    = i;
+    worker->executor = factory();
+    assert(static_cast<bool>(worker->executor));
 
-      idle_executors_.emplace_back(std::move(executor));
-    }
+    workers_.emplace_back(std::move(worker));
   }
 }
 
@@ -93,6 +135,10 @@ ExecutionManager::ScheduleStatus ExecutionManager::Execute(Block::Body const &bl
 
   // TODO(issue 33): Detect and handle number of lanes updates
 
+  // start loading the transactions in bulk while the execution is planned (unless the block
+  // coordinator has already requested them)
+  PrefetchTransactions(block);
+
   // plan the execution for this block
   if (!PlanExecution(block))
   {
@@ -102,7 +148,6 @@ ExecutionManager::ScheduleStatus ExecutionManager::Execute(Block::Body const &bl
   // update the last block hash
   last_block_hash_  = block.hash;
   last_block_miner_ = block.miner;
-  num_slices_       = block.slices.size();
 
   // update the state otherwise there is a race between when the executor thread wakes up
   state_.Set(State::ACTIVE);
@@ -110,16 +155,34 @@ ExecutionManager::ScheduleStatus ExecutionManager::Execute(Block::Body const &bl
   // trigger the monitor / dispatch thread
   {
     FETCH_LOCK(monitor_lock_);
+    block_pending_ = true;
     monitor_wake_.notify_one();
   }
 
   return ScheduleStatus::SCHEDULED;
 }
 
+/**
+ * Start loading the transactions of a block which is expected to be executed soon. Does not block.
+ *
+ * @param block The block whose transactions should be loaded
+ */
+void ExecutionManager::PrefetchTransactions(Block::Body const &block)
+{
+  if (prefetcher_)
+  {
+    prefetcher_->Prefetch(block);
+  }
+}
+
 /**
  * Given a input block, plan the execution of the transactions across the lanes
  * and slices
  *
+ * Each transaction is made dependent on the last transaction (in block order) which used each of
+ * its lanes. This preserves the ordering guarantees of the slices for transactions which conflict
+ * while allowing all others to be executed as soon as possible.
+ *
  * @param block The input block to plan
  * @return true if successful, otherwise false
  */
@@ -127,15 +190,24 @@ bool ExecutionManager::PlanExecution(Block::Body const &block)
 {
   FETCH_LOCK(execution_plan_lock_);
 
-  // clear and resize the execution plan
+  std::size_t num_transactions{0};
+  for (auto const &slice : block.slices)
+  {
+    num_transactions += slice.size();
+  }
+
+  // clear and reserve the execution plan
   execution_plan_.clear();
-  execution_plan_.resize(block.slices.size());
+  execution_plan_.reserve(num_transactions);
+
+  // the last execution item to have been planned on each of the lanes
+  std::size_t const            num_lanes = 1u << log2_num_lanes_;
+  std::vector<ExecutionItem *> lane_owners(num_lanes, nullptr);
+  std::vector<ExecutionItem *> dependencies{};
 
   uint64_t slice_index = 0;
   for (auto const &slice : block.slices)
   {
-    auto &slice_plan = execution_plan_[slice_index];
-
     // process the transactions
     for (auto const &tx : slice)
     {
@@ -143,9 +215,33 @@ bool ExecutionManager::PlanExecution(Block::Body const &block)
       // and some level of dynamic scaling should be applied.
       assert((1u << log2_num_lanes_) == tx.mask().size());
 
+      auto item =
+          std::make_unique<ExecutionItem>(tx.digest(), block.block_number, slice_index, tx.mask());
+
+      // determine the set of (unique) items that this item depends on
+      dependencies.clear();
+      for (std::size_t lane = 0; lane < num_lanes; ++lane)
+      {
+        if (tx.mask().bit(lane))
+        {
+          ExecutionItem *previous = lane_owners[lane];
+          if (previous &&
+              (std::find(dependencies.begin(), dependencies.end(), previous) == dependencies.end()))
+          {
+            dependencies.push_back(previous);
+          }
+
+          lane_owners[lane] = item.get();
+        }
+      }
+
+      for (auto *dependency : dependencies)
+      {
+        dependency->AddDependent(*item);
+      }
+
       // insert the item into the execution plan
-      slice_plan.emplace_back(
-          std::make_unique<ExecutionItem>(tx.digest(), block.block_number, slice_index, tx.mask()));
+      execution_plan_.emplace_back(std::move(item));
     }
 
     ++slice_index;
@@ -155,37 +251,67 @@ bool ExecutionManager::PlanExecution(Block::Body const &block)
 }
 
 /**
- * Dispatches an execution item to the next available executor
+ * Post an execution item (whose dependencies have all been resolved) to the queue of a worker
  *
- * This function should be called from a context of a thread pool
+ * @param item The execution item to be scheduled
+ * @param worker The worker whose queue the item is added to
+ */
+void ExecutionManager::ScheduleExecution(ExecutionItem &item, Worker &worker)
+{
+  // counted before the push so that a worker which sees the count as zero can never miss the item
+  queued_.fetch_add(1);
+  worker.queue.Push(&item);
+
+  // only wake a worker when one has gone to sleep
+  if (sleepers_.load() != 0)
+  {
+    FETCH_LOCK(idle_lock_);
+    idle_wake_.notify_one();
+  }
+}
+
+/**
+ * Take the next item to be run by a worker, first from its own queue and otherwise from the
+ * queues of the other workers
  *
- * @param item The execution item to dispatch
+ * @param worker The worker looking for an item
+ * @param item The reference to the item to be populated
+ * @return true if an item was found, otherwise false
  */
-void ExecutionManager::DispatchExecution(ExecutionItem &item)
+bool ExecutionManager::NextItem(Worker &worker, ExecutionItem *&item)
 {
-  ExecutorPtr executor;
+  bool found = worker.queue.Pop(item);
 
-  // lookup a free executor
+  for (std::size_t i = 1; !found && (i < workers_.size()); ++i)
   {
-    FETCH_LOCK(idle_executors_lock_);
-    if (!idle_executors_.empty())
-    {
-      executor = idle_executors_.back();
-      idle_executors_.pop_back();
-    }
+    found = workers_[(worker.index + i) % workers_.size()]->queue.Pop(item);
+  }
+
+  if (found)
+  {
+    queued_.fetch_sub(1);
   }
 
-  // We must have a executor present for this to work. This should always
-  // be the case provided num_executors == num_threads (in thread pool)
-  assert(executor);
+  return found;
+}
 
-  if (executor)
+/**
+ * Dispatches an execution item to the executor of the calling worker
+ *
+ * This function must only be called from the worker's own thread
+ *
+ * @param item The execution item to dispatch
+ * @param worker The worker executing the item
+ */
+void ExecutionManager::DispatchExecution(ExecutionItem &item, Worker &worker)
+{
+  // once the block execution has been halted the remaining items are simply drained
+  if (!halted_)
   {
-    // increment the active counters
-    counters_.Apply([](Counters &counters) { counters.active++; });
+    worker.counters.active.store(true, std::memory_order_relaxed);
 
     // execute the item
-    item.Execute(*executor);
+    item.Execute(*worker.executor);
 
     // determine what the status is
     if (ExecutorInterface::Status::SUCCESS != item.status())
@@ -194,24 +320,88 @@ void ExecutionManager::DispatchExecution(ExecutionItem &item)
                      " status: ", ledger::ToString(item.status()));
     }
 
-    counters_.Apply([](Counters &counters) {
-      counters.active--;
-      counters.remaining--;
-    });
+    // stalls and fatal errors mean that the block can not be completed
+    auto const outcome = ClassifyStatus(item.status());
+    if ((Outcome::STALL == outcome) || (Outcome::FATAL_ERROR == outcome))
+    {
+      halted_ = true;
+    }
 
-    ++completed_executions_;
+    worker.counters.active.store(false, std::memory_order_relaxed);
+    worker.counters.completed.fetch_add(1, std::memory_order_relaxed);
+  }
 
+  // release any items that were waiting on this one, they are most likely to be run by this worker
+  for (auto *dependent : item.dependents())
+  {
+    if (dependent->ResolveDependency())
     {
-      FETCH_LOCK(idle_executors_lock_);
-      idle_executors_.push_back(std::move(executor));
+      ScheduleExecution(*dependent, worker);
     }
   }
-  else
+
+  // must be the last operation on the item, since the plan can be cleared once all the items have
+  // been completed. Only the completion of the final item needs to wake the monitor
+  if (remaining_.fetch_sub(1) == 1)
   {
-    FETCH_LOG_ERROR(LOGGING_NAME, "Failed to secure an idle executor");
+    FETCH_LOCK(monitor_lock_);
+    monitor_notify_.notify_all();
   }
 }
 
+/**
+ * The main loop for each of the worker threads
+ *
+ * @param worker The worker (and associated executor) being serviced by this thread
+ */
+void ExecutionManager::WorkerThreadEntrypoint(Worker &worker)
+{
+  SetThreadName("Executor", worker.index);
+
+  while (running_)
+  {
+    ExecutionItem *item{nullptr};
+
+    if (NextItem(worker, item))
+    {
+      DispatchExecution(*item, worker);
+      continue;
+    }
+
+    // wait for the next item to be made ready. The schedulers only take the lock to wake a worker
+    // once they have seen it registered as a sleeper
+    std::unique_lock<std::mutex> lock(idle_lock_);
+    sleepers_.fetch_add(1);
+    idle_wake_.wait(lock, [this]() { return (queued_.load() != 0) || !running_; });
+    sleepers_.fetch_sub(1);
+  }
+}
+
+std::size_t ExecutionManager::completed_executions() const
+{
+  std::size_t total{0};
+  for (auto const &worker : workers_)
+  {
+    total += worker->counters.completed.load(std::memory_order_relaxed);
+  }
+
+  return total;
+}
+
+std::size_t ExecutionManager::num_active_executors() const
+{
+  std::size_t total{0};
+  for (auto const &worker : workers_)
+  {
+    if (worker->counters.active.load(std::memory_order_relaxed))
+    {
+      ++total;
+    }
+  }
+
+  return total;
+}
+
 /**
  * Starts the execution manager running
  */
@@ -238,8 +428,12 @@ void ExecutionManager::Start()
     throw std::runtime_error("Failed waiting for the monitor to start");
   }
 
-  // fire up the main worker thread pool
-  thread_pool_->Start();
+  // fire up the worker threads
+  for (auto &worker : workers_)
+  {
+    worker->thread = std::make_unique<std::thread>(&ExecutionManager::WorkerThreadEntrypoint, this,
+                                                   std::ref(*worker));
+  }
 }
 
 /**
@@ -261,8 +455,30 @@ void ExecutionManager::Stop()
   monitor_thread_->join();
   monitor_thread_.reset();
 
-  // tear down the thread pool
-  thread_pool_->Stop();
+  // tear down the worker threads
+  {
+    FETCH_LOCK(idle_lock_);
+    idle_wake_.notify_all();
+  }
+
+  for (auto &worker : workers_)
+  {
+    if (worker->thread)
+    {
+      worker->thread->join();
+      worker->thread.reset();
+    }
+  }
+
+  // drop any items which were not run
+  for (auto &worker : workers_)
+  {
+    ExecutionItem *item{nullptr};
+    while (worker->queue.Pop(item))
+    {
+    }
+  }
+  queued_ = 0;
 }
 
 void ExecutionManager::SetLastProcessedBlock(Digest hash)
@@ -298,7 +514,7 @@ void ExecutionManager::MonitorThreadEntrypoint()
     STALLED,
     COMPLETED,
     IDLE,
-    SCHEDULE_NEXT_SLICE,
+    SCHEDULE_EXECUTION,
     RUNNING,
     SETTLE_FEES,
     BOOKMARKING_STATE
@@ -306,8 +522,7 @@ void ExecutionManager::MonitorThreadEntrypoint()
 
   MonitorState monitor_state = MonitorState::COMPLETED;
 
-  std::size_t current_slice        = 0;
-  uint64_t    aggregate_block_fees = 0;
+  uint64_t aggregate_block_fees = 0;
 
   Digest current_block;
 
@@ -340,14 +555,20 @@ void ExecutionManager::MonitorThreadEntrypoint()
 
     case MonitorState::IDLE:
     {
-      state_.Set(State::IDLE);
-
       FETCH_LOG_DEBUG(LOGGING_NAME, "Now Idle");
 
       // enter the idle state where we wait for the next block to be posted
       {
         std::unique_lock<std::mutex> lock(monitor_lock_);
-        monitor_wake_.wait(lock);
+
+        // a block might have already been posted in which case the state must not be reset
+        if (!block_pending_)
+        {
+          state_.Set(State::IDLE);
+        }
+
+        monitor_wake_.wait(lock, [this]() { return block_pending_ || !running_; });
+        block_pending_ = false;
       }
 
       state_.Set(State::ACTIVE);
@@ -355,18 +576,17 @@ void ExecutionManager::MonitorThreadEntrypoint()
 
       FETCH_LOG_DEBUG(LOGGING_NAME, "Now Active");
 
-      // schedule the next slice if we have been triggered
+      // schedule the block execution if we have been triggered
       if (running_)
       {
-        monitor_state        = MonitorState::SCHEDULE_NEXT_SLICE;
-        current_slice        = 0;
+        monitor_state        = MonitorState::SCHEDULE_EXECUTION;
         aggregate_block_fees = 0;
       }
 
       break;
     }
 
-    case MonitorState::SCHEDULE_NEXT_SLICE:
+    case MonitorState::SCHEDULE_EXECUTION:
     {
       FETCH_LOCK(execution_plan_lock_);
 
@@ -376,17 +596,22 @@ void ExecutionManager::MonitorThreadEntrypoint()
       }
       else
       {
-        auto const &slice_plan = execution_plan_[current_slice];
+        halted_ = false;
 
         // determine the target number of executions being expected (must be
         // done before the thread pool dispatch)
-        counters_.Set(Counters{0, slice_plan.size()});
+        remaining_ = execution_plan_.size();
 
-        auto self = shared_from_this();
-        for (auto &item : slice_plan)
+        // dispatch all the items which are not waiting on any others, spread across the workers.
+        // The remaining items will be dispatched as their dependencies complete
+        std::size_t next_worker{0};
+        for (auto &item : execution_plan_)
         {
-          // create the closure and dispatch to the thread pool
-          thread_pool_->Post([self, &item]() { self->DispatchExecution(*item); });
+          if (item->num_dependencies() == 0)
+          {
+            ScheduleExecution(*item, *workers_[next_worker]);
+            next_worker = (next_worker + 1) % workers_.size();
+          }
         }
 
         monitor_state = MonitorState::RUNNING;
@@ -398,47 +623,58 @@ void ExecutionManager::MonitorThreadEntrypoint()
     case MonitorState::RUNNING:
     {
       // wait for the execution to complete
-      bool const finished =
-          counters_.WaitFor(std::chrono::seconds{2},
-                            [](Counters const &counters) { return counters.remaining == 0; });
+      bool finished{false};
+      {
+        std::unique_lock<std::mutex> lock(monitor_lock_);
+        finished = monitor_notify_.wait_for(lock, std::chrono::seconds{2},
+                                            [this]() { return (remaining_ == 0) || !running_; });
+      }
+
+      if (!running_)
+      {
+        break;
+      }
 
       if (!finished)
       {
-        FETCH_LOG_WARN(LOGGING_NAME,
-                       "### Extra long execution: remaining: ", counters_.Get().remaining);
+        FETCH_LOG_WARN(LOGGING_NAME, "### Extra long execution: remaining: ", remaining_,
+                       " active: ", num_active_executors());
       }
       else
       {
+        FETCH_LOCK(execution_plan_lock_);
+
         // evaluate the status of the executions
         std::size_t num_complete{0};
         std::size_t num_stalls{0};
         std::size_t num_errors{0};
         std::size_t num_fatal_errors{0};
+        std::size_t num_skipped{0};
 
         // look through all execution items and determine if it was successful
-        for (auto const &item : execution_plan_[current_slice])
+        for (auto const &item : execution_plan_)
         {
           assert(item);
 
-          switch (item->status())
+          // items are not run once the execution has been halted
+          if (ExecutionItem::Status::NOT_RUN == item->status())
           {
-          case ExecutionItem::Status::SUCCESS:
+            ++num_skipped;
+            continue;
+          }
+
+          switch (ClassifyStatus(item->status()))
+          {
+          case Outcome::COMPLETE:
             ++num_complete;
             break;
-          case ExecutionItem::Status::TX_LOOKUP_FAILURE:
+          case Outcome::STALL:
             ++num_stalls;
             break;
-          case ExecutionItem::Status::CHAIN_CODE_LOOKUP_FAILURE:
-          case ExecutionItem::Status::CHAIN_CODE_EXEC_FAILURE:
-          case ExecutionItem::Status::CONTRACT_NAME_PARSE_FAILURE:
-          case ExecutionItem::Status::CONTRACT_LOOKUP_FAILURE:
-          case ExecutionItem::Status::TX_NOT_VALID_FOR_BLOCK:
-          case ExecutionItem::Status::INSUFFICIENT_AVAILABLE_FUNDS:
-          case ExecutionItem::Status::TRANSFER_FAILURE:
-          case ExecutionItem::Status::INSUFFICIENT_CHARGE:
+          case Outcome::ERROR:
             ++num_errors;
             break;
-          default:
+          case Outcome::FATAL_ERROR:
             ++num_fatal_errors;
             break;
           }
@@ -448,26 +684,18 @@ void ExecutionManager::MonitorThreadEntrypoint()
         }
 
         // only provide debug if required
-        if (num_complete + num_stalls + num_errors + num_fatal_errors)
+        if (num_stalls + num_errors + num_fatal_errors + num_skipped)
         {
-          if (num_stalls + num_errors + num_fatal_errors)
-          {
-            FETCH_LOG_WARN(LOGGING_NAME, "Slice ", current_slice,
-                           " Execution Status - Complete: ", num_complete, " Stalls: ", num_stalls,
-                           " Errors: ", num_errors, " Fatal Errors: ", num_fatal_errors);
-          }
-          else
-          {
-            FETCH_LOG_DEBUG(LOGGING_NAME, "Slice ", current_slice,
-                            " Execution Status - Complete: ", num_complete, " Stalls: ", num_stalls,
-                            " Errors: ", num_errors);
-          }
+          FETCH_LOG_WARN(LOGGING_NAME, "Block Execution Status - Complete: ", num_complete,
+                         " Stalls: ", num_stalls, " Errors: ", num_errors,
+                         " Fatal Errors: ", num_fatal_errors, " Skipped: ", num_skipped);
+        }
+        else
+        {
+          FETCH_LOG_DEBUG(LOGGING_NAME, "Block Execution Status - Complete: ", num_complete);
         }
 
-        // increment the slice counter
-        ++current_slice;
-
-        // decide the next monitor state based on the status of the slice execution
+        // decide the next monitor state based on the status of the block execution
         if (num_fatal_errors)
         {
           monitor_state = MonitorState::FAILED;
@@ -476,10 +704,6 @@ void ExecutionManager::MonitorThreadEntrypoint()
         {
           monitor_state = MonitorState::STALLED;
         }
-        else if (num_slices_ > current_slice)
-        {
-          monitor_state = MonitorState::SCHEDULE_NEXT_SLICE;
-        }
         else
         {
           monitor_state = MonitorState::SETTLE_FEES;
@@ -491,34 +715,12 @@ void ExecutionManager::MonitorThreadEntrypoint()
 
     case MonitorState::SETTLE_FEES:
     {
-      moment::DeadlineTimer executor_deadline("ExecMgr");
-      executor_deadline.Restart(1000u);
-
-      // In rare cases due to scheduling, no executors might have been returned to the idle queue.
-      // This busy wait loop will catch this event and has a fixed duration.
-      for (;;)
+      // all the items have completed at this point so none of the executors are in use. Simply use
+      // the first one to settle the fees
+      if (!workers_.empty())
       {
-        if (executor_deadline.HasExpired())
-        {
-          FETCH_LOG_WARN(LOGGING_NAME, "Unable to locate free executor to settle miner fees");
-          break;
-        }
-
-        // attempt to settle the fees using one of the free executors
-        {
-          FETCH_LOCK(idle_executors_lock_);
-          if (!idle_executors_.empty())
-          {
-            // get the first one and settle the fees
-            idle_executors_.front()->SettleFees(last_block_miner_, aggregate_block_fees,
-                                                log2_num_lanes_);
-
-            break;
-          }
-        }
-
-        // due to the race on the idle executors wait here
-        std::this_thread::sleep_for(std::chrono::milliseconds{2});
+        workers_.front()->executor->SettleFees(last_block_miner_, aggregate_block_fees,
+                                               log2_num_lanes_);
       }
 
       // move on to the next state
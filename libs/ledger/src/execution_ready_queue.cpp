@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/mutex.hpp"
+#include "ledger/execution_ready_queue.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Construct the ready queue
+ *
+ * @param log2_size The log2 of the number of slots in the ring
+ */
+ExecutionReadyQueue::ExecutionReadyQueue(std::size_t log2_size)
+  : mask_{(std::size_t{1} << log2_size) - 1u}
+  , slots_{std::make_unique<Slot[]>(mask_ + 1u)}
+{
+  assert(log2_size > 0);
+
+  // each slot starts out free for the push at its own position
+  for (std::size_t i = 0; i <= mask_; ++i)
+  {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * Add an item to the queue, may be called from any thread
+ *
+ * @param item The item to be added
+ */
+void ExecutionReadyQueue::Push(ExecutionItem *item)
+{
+  assert(item != nullptr);
+
+  if (!TryPush(item))
+  {
+    FETCH_LOCK(overflow_lock_);
+    overflow_.push_back(item);
+    overflow_size_.fetch_add(1);
+  }
+}
+
+/**
+ * Remove an item from the queue, may be called from any thread
+ *
+ * @param item The reference to the item to be populated
+ * @return true if an item was removed, otherwise false if the queue was empty
+ */
+bool ExecutionReadyQueue::Pop(ExecutionItem *&item)
+{
+  return TryPop(item) || PopOverflow(item);
+}
+
+/**
+ * Get the number of items currently held in the overflow queue
+ *
+ * @return The number of overflowing items
+ */
+std::size_t ExecutionReadyQueue::overflow_count() const
+{
+  return overflow_size_.load();
+}
+
+/**
+ * Attempt to add an item to the ring
+ *
+ * @param item The item to be added
+ * @return true if successful, otherwise false if the ring is full
+ */
+bool ExecutionReadyQueue::TryPush(ExecutionItem *item)
+{
+  std::size_t position = tail_.load(std::memory_order_relaxed);
+
+  for (;;)
+  {
+    Slot &            slot     = slots_[position & mask_];
+    std::size_t const sequence = slot.sequence.load(std::memory_order_acquire);
+    auto const        delta    = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+    if (delta == 0)
+    {
+      // the slot is free for this position, claim it
+      if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+      {
+        slot.item = item;
+        slot.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    }
+    else if (delta < 0)
+    {
+      // the slot still holds the item from the previous lap
+      return false;
+    }
+    else
+    {
+      // another thread has pushed to this position
+      position = tail_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+/**
+ * Attempt to remove an item from the ring
+ *
+ * @param item The reference to the item to be populated
+ * @return true if successful, otherwise false if the ring is empty
+ */
+bool ExecutionReadyQueue::TryPop(ExecutionItem *&item)
+{
+  std::size_t position = head_.load(std::memory_order_relaxed);
+
+  for (;;)
+  {
+    Slot &            slot     = slots_[position & mask_];
+    std::size_t const sequence = slot.sequence.load(std::memory_order_acquire);
+    auto const delta = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+    if (delta == 0)
+    {
+      // the slot holds the item for this position, claim it
+      if (head_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+      {
+        item = slot.item;
+
+        // free the slot for the push one lap ahead
+        slot.sequence.store(position + mask_ + 1, std::memory_order_release);
+        return true;
+      }
+    }
+    else if (delta < 0)
+    {
+      // nothing has been pushed to this position yet
+      return false;
+    }
+    else
+    {
+      // another thread has popped this position
+      position = head_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+/**
+ * Attempt to remove an item from the overflow queue
+ *
+ * @param item The reference to the item to be populated
+ * @return true if successful, otherwise false if the overflow queue was empty
+ */
+bool ExecutionReadyQueue::PopOverflow(ExecutionItem *&item)
+{
+  // avoid the lock in the common case where nothing has overflowed
+  if (overflow_size_.load() == 0)
+  {
+    return false;
+  }
+
+  FETCH_LOCK(overflow_lock_);
+
+  if (overflow_.empty())
+  {
+    return false;
+  }
+
+  item = overflow_.front();
+  overflow_.pop_front();
+  overflow_size_.fetch_sub(1);
+
+  return true;
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -21,9 +21,11 @@
 #include "core/logger.hpp"
 #include "core/macros.hpp"
 #include "core/mutex.hpp"
+#include "core/serializers/byte_array_buffer.hpp"
 #include "ledger/chain/transaction.hpp"
 #include "ledger/chaincode/contract.hpp"
 #include "ledger/chaincode/token_contract.hpp"
+#include "ledger/chaincode/wallet_record.hpp"
 #include "ledger/consensus/stake_update_interface.hpp"
 #include "ledger/executor.hpp"
 #include "ledger/state_sentinel_adapter.hpp"
@@ -32,7 +34,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <limits>
 #include <random>
+#include <vector>
 
 static constexpr char const *LOGGING_NAME    = "Executor";
 static constexpr uint64_t    TRANSFER_CHARGE = 1;
@@ -89,16 +93,98 @@ bool IsCreateWealth(Transaction const &tx)
          (tx.chain_code() == "fetch.token") && (tx.action() == "wealth");
 }
 
+bool IsTransferOnly(Transaction const &tx)
+{
+  return tx.contract_mode() == Transaction::ContractMode::NOT_PRESENT;
+}
+
+/**
+ * A token wallet loaded by the transfer fast path
+ */
+struct Wallet
+{
+  Address const * address;
+  ResourceAddress resource;
+  uint32_t        lane;
+  WalletRecord    record{};
+  bool            exists{false};
+};
+
+using Wallets = std::vector<Wallet>;
+
+/**
+ * Lookup a wallet, loading it from the storage if it has not already been loaded
+ *
+ * @param wallets The set of loaded wallets (with the capacity for all of the wallets)
+ * @param storage The storage to load from
+ * @param shards The shards which the transaction is allowed to access
+ * @param address The address of the wallet
+ * @return The wallet, or nullptr if it is in a shard which can not be accessed
+ */
+Wallet *LoadWallet(Wallets &wallets, StorageInterface &storage, BitVector const &shards,
+                   Address const &address)
+{
+  for (auto &wallet : wallets)
+  {
+    if (*wallet.address == address)
+    {
+      return &wallet;
+    }
+  }
+
+  // the same address as would be generated by the token contract
+  ResourceAddress resource{ConstByteArray{"fetch.token.state."} + address.display()};
+  auto const      lane = static_cast<uint32_t>(resource.lane(shards.log2_size()));
+
+  if (!shards.bit(lane))
+  {
+    return nullptr;
+  }
+
+  assert(wallets.size() < wallets.capacity());
+  wallets.push_back(Wallet{&address, std::move(resource), lane});
+
+  auto &wallet = wallets.back();
+
+  auto const document = storage.Get(wallet.resource);
+  if (!document.failed)
+  {
+    serializers::ByteArrayBuffer buffer{document.document};
+    buffer >> wallet.record;
+
+    wallet.exists = true;
+  }
+
+  return &wallet;
+}
+
+void StoreWallet(StorageInterface &storage, Wallet const &wallet)
+{
+  serializers::ByteArrayBuffer buffer;
+  buffer << wallet.record;
+
+  storage.Set(wallet.resource, buffer.data());
+}
+
+bool IsTransferAuthorised(WalletRecord const &record, Transaction const &tx)
+{
+  return record.deed ? record.deed->Verify(tx, TRANSFER_NAME) : tx.IsSignedByFromAddress();
+}
+
 }  // namespace
 
 /**
  * Construct a Executor given a storage unit
  *
  * @param storage The storage unit to be used
+ * @param stake_updates The (optional) queue of stake updates
+ * @param prefetcher The (optional) prefetcher to look up transactions from
  */
-Executor::Executor(StorageUnitPtr storage, StakeUpdateInterface *stake_updates)
+Executor::Executor(StorageUnitPtr storage, StakeUpdateInterface *stake_updates,
+                   TxPrefetcherPtr prefetcher)
   : stake_updates_{stake_updates}
   , storage_{std::move(storage)}
+  , prefetcher_{std::move(prefetcher)}
   , token_contract_{std::make_shared<TokenContract>()}
 {}
 
@@ -135,31 +221,38 @@ Executor::Result Executor::Execute(Digest const &digest, BlockIndex block, Slice
     // update the charge rate
     result.charge_rate = current_tx_->charge();
 
-    // create the storage cache
-    storage_cache_ = std::make_shared<CachedStorageAdapter>(*storage_);
+    // transactions which only contain transfers are executed natively where possible
+    bool const executed =
+        transfer_fast_path_ && IsTransferOnly(*current_tx_) && ExecuteTransfers(result);
 
-    // follow the three step process for executing a transaction
-    //
-    // 0. Validation checks (does the originator have correct funds)
-    // 1. Execute the containing transaction
-    // 2. Execute any token transfers
-    // 3. Process the fees
-    //
-    bool const success =
-        ValidationChecks(result) && ExecuteTransactionContract(result) && ProcessTransfers(result);
-
-    if (!success)
+    if (!executed)
     {
-      // in addition to avoid indeterminate data being partially flushed. In the case of the when
-      // the transaction execution fails then we also clear all the cached data.
-      storage_cache_->Clear();
-    }
+      // create the storage cache
+      storage_cache_ = std::make_shared<CachedStorageAdapter>(*storage_);
+
+      // follow the three step process for executing a transaction
+      //
+      // 0. Validation checks (does the originator have correct funds)
+      // 1. Execute the containing transaction
+      // 2. Execute any token transfers
+      // 3. Process the fees
+      //
+      bool const success = ValidationChecks(result) && ExecuteTransactionContract(result) &&
+                           ProcessTransfers(result);
+
+      if (!success)
+      {
+        // in addition to avoid indeterminate data being partially flushed. In the case of the when
+        // the transaction execution fails then we also clear all the cached data.
+        storage_cache_->Clear();
+      }
 
-    // deduct the fees from the originator
-    DeductFees(result);
+      // deduct the fees from the originator
+      DeductFees(result);
 
-    // flush the storage so that all changes are now persistent
-    storage_cache_->Flush();
+      // flush the changes to the storage, which on a node is the block scoped state cache
+      storage_cache_->Flush();
+    }
   }
 
   // clean up any used resources
@@ -168,6 +261,16 @@ Executor::Result Executor::Execute(Digest const &digest, BlockIndex block, Slice
   return result;
 }
 
+/**
+ * Enable or disable the native execution of transactions which only contain transfers
+ *
+ * @param enable Whether the fast path should be used
+ */
+void Executor::EnableTransferFastPath(bool enable)
+{
+  transfer_fast_path_ = enable;
+}
+
 void Executor::SettleFees(Address const &miner, TokenAmount amount, uint32_t log2_num_lanes)
 {
   FETCH_LOG_DEBUG(LOGGING_NAME, "Settling fees");
@@ -199,8 +302,10 @@ bool Executor::RetrieveTransaction(Digest const &digest)
     // create a new transaction
     current_tx_ = std::make_unique<Transaction>();
 
-    // load the transaction from the store
-    success = storage_->GetTransaction(digest, *current_tx_);
+    // the transaction has normally been loaded ahead of execution, otherwise load the transaction
+    // from the store
+    success = (prefetcher_ && prefetcher_->Lookup(digest, *current_tx_)) ||
+              storage_->GetTransaction(digest, *current_tx_);
   }
   catch (std::exception const &ex)
   {
@@ -443,6 +548,146 @@ void Executor::DeductFees(Result &result)
   token_contract_->Detach();
 }
 
+/**
+ * Execute a transaction which only contains transfers without attaching the token contract. Each
+ * wallet is read and decoded once, the validation, transfers and fees are applied in memory and
+ * the updated wallets are then written once, grouped by lane.
+ *
+ * The outcome is identical to the generic path. Transactions which the fast path does not handle
+ * (an originator without a wallet, wallets outside of the allowed shards or undecodable records)
+ * are left untouched for the generic path.
+ *
+ * @param result The result to be populated
+ * @return true if the transaction was executed, otherwise false
+ */
+bool Executor::ExecuteTransfers(Result &result)
+{
+  auto const &tx        = *current_tx_;
+  auto const &transfers = tx.transfers();
+
+  Wallets wallets{};
+  wallets.reserve(transfers.size() + 1u);
+
+  Wallet *from{nullptr};
+
+  try
+  {
+    from = LoadWallet(wallets, *storage_, allowed_shards_, tx.from());
+    if ((from == nullptr) || !from->exists)
+    {
+      return false;
+    }
+
+    for (auto const &transfer : transfers)
+    {
+      if (LoadWallet(wallets, *storage_, allowed_shards_, transfer.to) == nullptr)
+      {
+        return false;
+      }
+    }
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Unable to load wallets natively: ", ex.what());
+    return false;
+  }
+
+  WalletRecord const original = from->record;
+
+  // CHECK: Determine if the transaction is valid for the given block and that the originator has
+  //        funds available for the transfers as well as the maximum fees
+  uint64_t const max_tokens_required = tx.GetTotalTransferAmount() + tx.charge_limit();
+  if (Transaction::Validity::VALID != tx.GetValidity(block_))
+  {
+    result.status = Status::TX_NOT_VALID_FOR_BLOCK;
+  }
+  else if (from->record.balance < max_tokens_required)
+  {
+    result.status = Status::INSUFFICIENT_AVAILABLE_FUNDS;
+  }
+  else if (!transfers.empty() && !IsTransferAuthorised(from->record, tx))
+  {
+    result.status = Status::TRANSFER_FAILURE;
+  }
+  else
+  {
+    result.status = Status::SUCCESS;
+
+    // make the transfers, in the same order and with the same checks as the token contract
+    for (auto const &transfer : transfers)
+    {
+      Wallet *to = LoadWallet(wallets, *storage_, allowed_shards_, transfer.to);
+
+      if (transfer.amount > from->record.balance)
+      {
+        result.status = Status::TRANSFER_FAILURE;
+        break;
+      }
+
+      from->record.balance -= transfer.amount;
+
+      if (transfer.amount > (std::numeric_limits<uint64_t>::max() - to->record.balance))
+      {
+        result.status = Status::TRANSFER_FAILURE;
+        break;
+      }
+
+      to->record.balance += transfer.amount;
+      result.charge += TRANSFER_CHARGE;
+    }
+  }
+
+  bool const success = (Status::SUCCESS == result.status);
+
+  // failed transactions only pay the fees
+  if (!success)
+  {
+    from->record = original;
+  }
+
+  TokenAmount const tx_fee =
+      success ? (result.charge * tx.charge()) : (tx.charge_limit() * tx.charge());
+
+  result.fee = std::min(from->record.balance, tx_fee);
+  from->record.balance -= result.fee;
+
+  // write the updated wallets grouped by lane, or only the originator's if the transaction failed
+  if (success)
+  {
+    std::sort(wallets.begin(), wallets.end(),
+              [](Wallet const &a, Wallet const &b) { return a.lane < b.lane; });
+  }
+  else
+  {
+    Wallets originator{*from};
+    wallets.swap(originator);
+  }
+
+  auto const num_shards = static_cast<uint32_t>(allowed_shards_.size());
+  for (uint32_t i = 0; i < num_shards; ++i)
+  {
+    if (allowed_shards_.bit(i))
+    {
+      storage_->Lock(i);
+    }
+  }
+
+  for (auto const &wallet : wallets)
+  {
+    StoreWallet(*storage_, wallet);
+  }
+
+  for (uint32_t i = 0; i < num_shards; ++i)
+  {
+    if (allowed_shards_.bit(i))
+    {
+      storage_->Unlock(i);
+    }
+  }
+
+  return true;
+}
+
 bool Executor::Cleanup()
 {
   return false;
@@ -0,0 +1,368 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/protocols/block_download_queue.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Construct the download queue
+ *
+ * @param config The configuration for the queue
+ */
+BlockDownloadQueue::BlockDownloadQueue(Config const &config)
+  : config_(config)
+{}
+
+/**
+ * Reset the queue to download a new section of the chain. Any requests which are still in flight
+ * are abandoned
+ *
+ * @param hashes The hashes of the blocks to be downloaded, ordered oldest first
+ */
+void BlockDownloadQueue::Reset(BlockHashes hashes)
+{
+  hashes_ = std::move(hashes);
+  windows_.clear();
+  next_delivery_ = 0;
+  peer_requests_.clear();
+  num_outstanding_ = 0;
+  failed_          = false;
+
+  std::size_t const window_size = std::max<std::size_t>(config_.window_size, 1u);
+
+  for (std::size_t offset = 0; offset < hashes_.size(); offset += window_size)
+  {
+    Window window{};
+    window.offset = offset;
+    window.size   = std::min(window_size, hashes_.size() - offset);
+
+    windows_.emplace_back(std::move(window));
+  }
+}
+
+/**
+ * Determine the next range request (if any) which should be made to the specified peer. Windows
+ * are always scheduled oldest first, skipping any which the peer has previously failed to deliver
+ *
+ * @param peer The peer to be considered
+ * @param now The current time
+ * @param request The output request
+ * @return true if a request should be made, otherwise false
+ */
+bool BlockDownloadQueue::NextRequest(Address const &peer, Timepoint const &now, Request &request)
+{
+  if (failed_ || (peer_requests_[peer] >= config_.max_requests_per_peer))
+  {
+    return false;
+  }
+
+  // limit how far ahead of the delivery point the download can run, this bounds the number of
+  // blocks which have to be buffered while waiting for a slow window
+  std::size_t const end = std::min(windows_.size(), next_delivery_ + config_.max_windows_ahead);
+
+  for (std::size_t index = next_delivery_; index < end; ++index)
+  {
+    Window &window = windows_[index];
+
+    if ((WindowState::PENDING != window.state) || (window.failed_peers.count(peer) > 0))
+    {
+      continue;
+    }
+
+    window.state      = WindowState::REQUESTED;
+    window.request_id = next_request_id_++;
+    window.peer       = peer;
+    window.deadline   = now + config_.timeout;
+    ++window.attempts;
+
+    ++peer_requests_[peer];
+    ++num_outstanding_;
+
+    // the range is requested from the most recent block backwards
+    request.id     = window.request_id;
+    request.window = index;
+    request.peer   = peer;
+    request.start  = hashes_[window.offset + window.size - 1u];
+    request.size   = window.size;
+
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Complete a request with the blocks returned by the peer. The blocks are only accepted if they
+ * exactly match the hashes which were expected for the window, otherwise the request is failed
+ *
+ * @param request The request being completed
+ * @param blocks The blocks returned by the peer (in any order)
+ * @return true if the blocks were accepted, otherwise false
+ */
+bool BlockDownloadQueue::Complete(Request const &request, Blocks blocks)
+{
+  Window *window = LookupRequest(request);
+  if (window == nullptr)
+  {
+    return false;
+  }
+
+  // index the returned blocks by (recomputed) hash
+  DigestMap<std::size_t> index{};
+  for (std::size_t i = 0; i < blocks.size(); ++i)
+  {
+    blocks[i].UpdateDigest();
+    index.emplace(blocks[i].body.hash, i);
+  }
+
+  // extract the expected blocks in chain order
+  Blocks ordered{};
+  ordered.reserve(window->size);
+
+  for (std::size_t i = 0; i < window->size; ++i)
+  {
+    auto it = index.find(hashes_[window->offset + i]);
+    if (it == index.end())
+    {
+      break;
+    }
+
+    ordered.emplace_back(std::move(blocks[it->second]));
+  }
+
+  if (ordered.size() != window->size)
+  {
+    Fail(request);
+    return false;
+  }
+
+  Release(*window);
+
+  window->state  = WindowState::DOWNLOADED;
+  window->blocks = std::move(ordered);
+
+  return true;
+}
+
+/**
+ * Fail a request, the window will be rescheduled with a different peer
+ *
+ * @param request The request which failed
+ */
+void BlockDownloadQueue::Fail(Request const &request)
+{
+  Window *window = LookupRequest(request);
+  if (window == nullptr)
+  {
+    return;
+  }
+
+  Release(*window);
+
+  window->failed_peers.insert(request.peer);
+
+  if (window->attempts >= config_.max_attempts)
+  {
+    failed_ = true;
+  }
+}
+
+/**
+ * Reject a request which the peer does not support, the window will be rescheduled with a
+ * different peer without the request counting as one of its attempts
+ *
+ * @param request The request which was rejected
+ */
+void BlockDownloadQueue::Reject(Request const &request)
+{
+  Window *window = LookupRequest(request);
+  if (window == nullptr)
+  {
+    return;
+  }
+
+  Release(*window);
+
+  window->failed_peers.insert(request.peer);
+
+  if (window->attempts > 0)
+  {
+    --window->attempts;
+  }
+}
+
+/**
+ * Fail all the requests which have passed their deadline
+ *
+ * @param now The current time
+ * @return The requests which have expired
+ */
+BlockDownloadQueue::Requests BlockDownloadQueue::Expire(Timepoint const &now)
+{
+  Requests expired{};
+
+  for (std::size_t index = next_delivery_; index < windows_.size(); ++index)
+  {
+    Window const &window = windows_[index];
+
+    if ((WindowState::REQUESTED == window.state) && (window.deadline <= now))
+    {
+      Request request{};
+      request.id     = window.request_id;
+      request.window = index;
+      request.peer   = window.peer;
+      request.start  = hashes_[window.offset + window.size - 1u];
+      request.size   = window.size;
+
+      expired.emplace_back(std::move(request));
+    }
+  }
+
+  for (auto const &request : expired)
+  {
+    Fail(request);
+  }
+
+  return expired;
+}
+
+/**
+ * Get the next downloaded window of blocks in chain order
+ *
+ * @param segment The output segment
+ * @return true if a segment was available, otherwise false
+ */
+bool BlockDownloadQueue::NextSegment(Segment &segment)
+{
+  if ((next_delivery_ >= windows_.size()) ||
+      (WindowState::DOWNLOADED != windows_[next_delivery_].state))
+  {
+    return false;
+  }
+
+  Window &window = windows_[next_delivery_++];
+
+  segment.peer   = window.peer;
+  segment.blocks = std::move(window.blocks);
+
+  window.state = WindowState::DELIVERED;
+  window.blocks.clear();
+
+  return true;
+}
+
+/**
+ * Determine if all of the windows have been delivered
+ *
+ * @return true if the download is complete, otherwise false
+ */
+bool BlockDownloadQueue::IsComplete() const
+{
+  return next_delivery_ >= windows_.size();
+}
+
+/**
+ * Determine if a window could not be downloaded from any peer
+ *
+ * @return true if the download has failed, otherwise false
+ */
+bool BlockDownloadQueue::HasFailed() const
+{
+  return failed_;
+}
+
+/**
+ * Get the number of requests which are currently in flight
+ *
+ * @return The number of outstanding requests
+ */
+std::size_t BlockDownloadQueue::num_outstanding() const
+{
+  return num_outstanding_;
+}
+
+/**
+ * Get the number of blocks which have yet to be delivered
+ *
+ * @return The number of blocks
+ */
+std::size_t BlockDownloadQueue::num_remaining_blocks() const
+{
+  std::size_t remaining{0};
+
+  if (next_delivery_ < windows_.size())
+  {
+    remaining = hashes_.size() - windows_[next_delivery_].offset;
+  }
+
+  return remaining;
+}
+
+/**
+ * Internal: Lookup the window for a request which is still in flight
+ *
+ * @param request The request to lookup
+ * @return The window if the request is current, otherwise a nullptr
+ */
+BlockDownloadQueue::Window *BlockDownloadQueue::LookupRequest(Request const &request)
+{
+  Window *window{nullptr};
+
+  if (request.window < windows_.size())
+  {
+    Window &candidate = windows_[request.window];
+
+    // stale requests (which have already expired or failed) are ignored
+    if ((WindowState::REQUESTED == candidate.state) && (request.id == candidate.request_id))
+    {
+      window = &candidate;
+    }
+  }
+
+  return window;
+}
+
+/**
+ * Internal: Release the request which is in flight for the window, returning it to the pending
+ * state
+ *
+ * @param window The window to release
+ */
+void BlockDownloadQueue::Release(Window &window)
+{
+  auto it = peer_requests_.find(window.peer);
+  if ((it != peer_requests_.end()) && (it->second > 0))
+  {
+    --it->second;
+  }
+
+  --num_outstanding_;
+
+  window.state      = WindowState::PENDING;
+  window.request_id = 0;
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -30,11 +30,20 @@
 #include "telemetry/counter.hpp"
 #include "telemetry/registry.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 
 static const uint32_t MAX_CHAIN_REQUEST_SIZE = 10000;
 static const uint64_t MAX_SUB_CHAIN_SIZE     = 1000;
+static const uint64_t MAX_CHAIN_HASHES       = 5000;
+static const uint64_t SYNC_WINDOW_SIZE       = 100;
+static const uint64_t MAX_REQUESTS_PER_PEER  = 2;
+static const uint64_t MAX_WINDOWS_AHEAD      = 16;
+static const uint64_t MAX_REQUEST_ATTEMPTS   = 4;
+static const uint64_t REQUEST_TIMEOUT_MS     = 15000;
 
 namespace fetch {
 namespace ledger {
@@ -72,6 +81,23 @@ State GetInitialState(Mode mode)
   return initial_state;
 }
 
+/**
+ * Build the configuration for the block download queue
+ *
+ * @return The download configuration
+ */
+BlockDownloadQueue::Config GetDownloadConfig()
+{
+  BlockDownloadQueue::Config config{};
+  config.window_size           = SYNC_WINDOW_SIZE;
+  config.max_requests_per_peer = MAX_REQUESTS_PER_PEER;
+  config.max_windows_ahead     = MAX_WINDOWS_AHEAD;
+  config.max_attempts          = MAX_REQUEST_ATTEMPTS;
+  config.timeout               = std::chrono::milliseconds{REQUEST_TIMEOUT_MS};
+
+  return config;
+}
+
 }  // namespace
 
 MainChainRpcService::MainChainRpcService(MuddleEndpoint &endpoint, MainChain &chain,
@@ -86,6 +112,7 @@ MainChainRpcService::MainChainRpcService(MuddleEndpoint &endpoint, MainChain &ch
   , rpc_client_("R:MChain", endpoint, SERVICE_MAIN_CHAIN, CHANNEL_RPC)
   , state_machine_{std::make_shared<StateMachine>("MainChain", GetInitialState(mode_),
                                                   [](State state) { return ToString(state); })}
+  , download_queue_{GetDownloadConfig()}
   , recv_block_count_{telemetry::Registry::Instance().CreateCounter(
         "ledger_mainchain_service_recv_block_total",
         "The number of received blocks from the network")}
@@ -113,9 +140,18 @@ MainChainRpcService::MainChainRpcService(MuddleEndpoint &endpoint, MainChain &ch
   , state_wait_response_{telemetry::Registry::Instance().CreateCounter(
         "ledger_mainchain_service_state_wait_response_total",
         "The number of times in the wait response state")}
+  , state_downloading_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_mainchain_service_state_downloading_total",
+        "The number of times in the downloading state")}
   , state_synchronised_{telemetry::Registry::Instance().CreateCounter(
         "ledger_mainchain_service_state_synchronised_total",
         "The number of times in the sychronised state")}
+  , sync_request_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_mainchain_service_sync_request_total",
+        "The total number of block range requests made to peers")}
+  , sync_request_failed_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_mainchain_service_sync_request_failed_total",
+        "The total number of block range requests which failed or timed out")}
 {
   // register the main chain protocol
   Add(RPC_MAIN_CHAIN, &main_chain_protocol_);
@@ -126,6 +162,7 @@ MainChainRpcService::MainChainRpcService(MuddleEndpoint &endpoint, MainChain &ch
   state_machine_->RegisterHandler(State::WAIT_FOR_HEAVIEST_CHAIN, this, &MainChainRpcService::OnWaitForHeaviestChain);
   state_machine_->RegisterHandler(State::SYNCHRONISING,           this, &MainChainRpcService::OnSynchronising);
   state_machine_->RegisterHandler(State::WAITING_FOR_RESPONSE,    this, &MainChainRpcService::OnWaitingForResponse);
+  state_machine_->RegisterHandler(State::DOWNLOADING,             this, &MainChainRpcService::OnDownloading);
   state_machine_->RegisterHandler(State::SYNCHRONISED,            this, &MainChainRpcService::OnSynchronised);
   // clang-format on
 
@@ -244,6 +281,9 @@ char const *MainChainRpcService::ToString(State state)
   case State::WAITING_FOR_RESPONSE:
     text = "Waiting for Sync Response";
     break;
+  case State::DOWNLOADING:
+    text = "Downloading";
+    break;
   case State::SYNCHRONISED:
     text = "Synchronised";
     break;
@@ -273,13 +313,27 @@ MainChainRpcService::Address MainChainRpcService::GetRandomTrustedPeer() const
 }
 
 void MainChainRpcService::HandleChainResponse(Address const &address, BlockList block_list)
+{
+  // the chain is returned most recent block first
+  std::reverse(block_list.begin(), block_list.end());
+
+  AddBlocks(address, block_list);
+}
+
+/**
+ * Add a sequence of blocks to the chain
+ *
+ * @param address The address of the peer which provided the blocks
+ * @param blocks The blocks to be added, ordered oldest first
+ */
+void MainChainRpcService::AddBlocks(Address const &address, BlockList &blocks)
 {
   std::size_t added{0};
   std::size_t loose{0};
   std::size_t duplicate{0};
   std::size_t invalid{0};
 
-  for (auto it = block_list.rbegin(), end = block_list.rend(); it != end; ++it)
+  for (auto it = blocks.begin(), end = blocks.end(); it != end; ++it)
   {
     // skip the geneis block
     if (it->body.previous_hash == GENESIS_DIGEST)
@@ -417,6 +471,21 @@ MainChainRpcService::State MainChainRpcService::OnSynchronising()
 
   State next_state{State::SYNCHRONISED};
 
+  auto const peers = endpoint_.GetDirectlyConnectedPeers();
+
+  // peers which have disconnected might return upgraded, so they are no longer excluded
+  for (auto it = unsupported_peers_.begin(); it != unsupported_peers_.end();)
+  {
+    if (std::find(peers.begin(), peers.end(), *it) == peers.end())
+    {
+      it = unsupported_peers_.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
   // get the next missing block
   auto const missing_blocks = chain_.GetMissingTips();
 
@@ -431,13 +500,24 @@ MainChainRpcService::State MainChainRpcService::OnSynchronising()
       return State::SYNCHRONISING;
     }
 
-    FETCH_LOG_INFO(LOGGING_NAME, "Requesting chain from muddle://", ToBase64(current_peer_address_),
-                   " for block ", ToBase64(current_missing_block_));
+    // peers running the previous release are asked for the chain itself
+    if (unsupported_peers_.count(current_peer_address_) > 0)
+    {
+      RequestCommonSubChain();
+
+      return State::WAITING_FOR_RESPONSE;
+    }
+
+    FETCH_LOG_INFO(LOGGING_NAME, "Requesting chain hashes from muddle://",
+                   ToBase64(current_peer_address_), " for block ",
+                   ToBase64(current_missing_block_));
 
-    // make the RPC call to the block source with a request for the chain
+    // make the RPC call to the block source with a request for the hashes of the chain, the blocks
+    // themselves are then downloaded from all of the available peers
     current_request_ = rpc_client_.CallSpecificAddress(
-        current_peer_address_, RPC_MAIN_CHAIN, MainChainProtocol::COMMON_SUB_CHAIN,
-        current_missing_block_, chain_.GetHeaviestBlockHash(), MAX_SUB_CHAIN_SIZE);
+        current_peer_address_, RPC_MAIN_CHAIN, MainChainProtocol::CHAIN_HASHES,
+        current_missing_block_, chain_.GetHeaviestBlockHash(), MAX_CHAIN_HASHES);
+    current_request_is_sub_chain_ = false;
 
     next_state = State::WAITING_FOR_RESPONSE;
   }
@@ -460,13 +540,40 @@ MainChainRpcService::State MainChainRpcService::OnWaitingForResponse()
     // determine the status of the request that is in flight
     auto const status = current_request_->GetState();
 
-    if (PromiseState::WAITING != status)
+    if ((PromiseState::WAITING != status) && (PromiseState::SUCCESS != status) &&
+        !current_request_is_sub_chain_)
     {
-      if (PromiseState::SUCCESS == status)
+      FETCH_LOG_INFO(LOGGING_NAME, "Chain hashes request to: ", ToBase64(current_peer_address_),
+                     " failed. Reason: ", service::ToString(status), ". Requesting the chain");
+
+      // peers running the previous release do not support the chain hashes request, in which case
+      // the chain itself is requested from the peer
+      if (PromiseState::FAILED == status)
+      {
+        unsupported_peers_.insert(current_peer_address_);
+      }
+
+      RequestCommonSubChain();
+    }
+    else if (PromiseState::WAITING != status)
+    {
+      next_state = State::SYNCHRONISED;
+
+      if ((PromiseState::SUCCESS == status) && current_request_is_sub_chain_)
       {
         // the request was successful, simply hand off the blocks to be added to the chain
         HandleChainResponse(current_peer_address_, current_request_->As<BlockList>());
       }
+      else if (PromiseState::SUCCESS == status)
+      {
+        // the request was successful, schedule the download of the blocks
+        StartDownload(current_request_->As<BlockHashList>());
+
+        if (!download_queue_.IsComplete())
+        {
+          next_state = State::DOWNLOADING;
+        }
+      }
       else
       {
         FETCH_LOG_INFO(LOGGING_NAME, "Chain request to: ", ToBase64(current_peer_address_),
@@ -476,13 +583,58 @@ MainChainRpcService::State MainChainRpcService::OnWaitingForResponse()
       // clear the state
       current_peer_address_  = Address{};
       current_missing_block_ = BlockHash{};
-      next_state             = State::SYNCHRONISED;
     }
   }
 
   return next_state;
 }
 
+MainChainRpcService::State MainChainRpcService::OnDownloading()
+{
+  state_downloading_->increment();
+
+  State next_state{State::DOWNLOADING};
+
+  auto const now = DownloadQueue::Clock::now();
+
+  // collect the responses from the peers
+  PollDownloadRequests(now);
+
+  // stream the blocks that are now available into the chain, in order
+  DownloadQueue::Segment segment{};
+  while (download_queue_.NextSegment(segment))
+  {
+    AddBlocks(segment.peer, segment.blocks);
+  }
+
+  if (download_queue_.IsComplete())
+  {
+    next_state = State::SYNCHRONISED;
+  }
+  else
+  {
+    // keep all of the available peers busy
+    IssueDownloadRequests(now);
+
+    // in the case where the remaining blocks can not be requested from any peer, abandon this
+    // download. The remaining missing blocks will be picked up again during synchronisation
+    if (download_queue_.HasFailed() || (0 == download_queue_.num_outstanding()))
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Abandoning block download. Remaining blocks: ",
+                     download_queue_.num_remaining_blocks());
+
+      next_state = State::SYNCHRONISED;
+    }
+  }
+
+  if (State::SYNCHRONISED == next_state)
+  {
+    download_requests_.clear();
+  }
+
+  return next_state;
+}
+
 MainChainRpcService::State MainChainRpcService::OnSynchronised(State current, State previous)
 {
   state_synchronised_->increment();
@@ -509,6 +661,147 @@ MainChainRpcService::State MainChainRpcService::OnSynchronised(State current, St
   return next_state;
 }
 
+/**
+ * Schedule the download of the blocks for the specified chain hashes
+ *
+ * @param hashes The hashes of the chain, most recent block first
+ */
+void MainChainRpcService::StartDownload(BlockHashList hashes)
+{
+  // the blocks must be added to the chain oldest first
+  std::reverse(hashes.begin(), hashes.end());
+
+  // the hashes will normally end at the common ancestor, which does not need to be downloaded
+  auto const first_missing = std::find_if(
+      hashes.begin(), hashes.end(),
+      [this](BlockHash const &hash) { return !static_cast<bool>(chain_.GetBlock(hash)); });
+  hashes.erase(hashes.begin(), first_missing);
+
+  FETCH_LOG_INFO(LOGGING_NAME, "Scheduling download of ", hashes.size(), " blocks");
+
+  download_requests_.clear();
+  download_queue_.Reset(std::move(hashes));
+}
+
+/**
+ * Check the range requests which are in flight, handing the responses to the download queue
+ *
+ * @param now The current time
+ */
+void MainChainRpcService::PollDownloadRequests(Timepoint const &now)
+{
+  auto it = download_requests_.begin();
+  while (it != download_requests_.end())
+  {
+    auto const status = it->promise->GetState();
+
+    if (PromiseState::WAITING == status)
+    {
+      ++it;
+      continue;
+    }
+
+    auto const &request = it->request;
+
+    if (PromiseState::SUCCESS == status)
+    {
+      if (!download_queue_.Complete(request, it->promise->As<BlockList>()))
+      {
+        FETCH_LOG_WARN(LOGGING_NAME, "Invalid block range from: muddle://",
+                       ToBase64(request.peer), " for block ", ToBase64(request.start));
+
+        sync_request_failed_count_->increment();
+        trust_.AddFeedback(request.peer, p2p::TrustSubject::BLOCK, p2p::TrustQuality::LIED);
+      }
+    }
+    else if (PromiseState::FAILED == status)
+    {
+      FETCH_LOG_INFO(LOGGING_NAME, "Block range request to: muddle://", ToBase64(request.peer),
+                     " failed. Excluding the peer from the download");
+
+      // peers running the previous release do not support the range request, the window is handed
+      // to another peer without counting against it
+      sync_request_failed_count_->increment();
+      unsupported_peers_.insert(request.peer);
+      download_queue_.Reject(request);
+    }
+    else
+    {
+      FETCH_LOG_INFO(LOGGING_NAME, "Block range request to: muddle://", ToBase64(request.peer),
+                     " failed. Reason: ", service::ToString(status));
+
+      sync_request_failed_count_->increment();
+      download_queue_.Fail(request);
+    }
+
+    it = download_requests_.erase(it);
+  }
+
+  // slow peers have their requests handed to another peer
+  for (auto const &request : download_queue_.Expire(now))
+  {
+    FETCH_LOG_INFO(LOGGING_NAME, "Block range request to: muddle://", ToBase64(request.peer),
+                   " timed out");
+
+    sync_request_failed_count_->increment();
+    trust_.AddFeedback(request.peer, p2p::TrustSubject::BLOCK,
+                       p2p::TrustQuality::BAD_CONNECTION);
+
+    download_requests_.erase(std::remove_if(download_requests_.begin(), download_requests_.end(),
+                                            [&request](DownloadRequest const &current) {
+                                              return current.request.id == request.id;
+                                            }),
+                             download_requests_.end());
+  }
+}
+
+/**
+ * Make range requests to all of the connected peers which have spare capacity
+ *
+ * @param now The current time
+ */
+void MainChainRpcService::IssueDownloadRequests(Timepoint const &now)
+{
+  for (auto const &peer : endpoint_.GetDirectlyConnectedPeers())
+  {
+    if (unsupported_peers_.count(peer) > 0)
+    {
+      continue;
+    }
+
+    DownloadQueue::Request request{};
+
+    while (download_queue_.NextRequest(peer, now, request))
+    {
+      FETCH_LOG_DEBUG(LOGGING_NAME, "Requesting ", request.size, " blocks from muddle://",
+                      ToBase64(request.peer), " for block ", ToBase64(request.start));
+
+      auto promise =
+          rpc_client_.CallSpecificAddress(request.peer, RPC_MAIN_CHAIN,
+                                          MainChainProtocol::CHAIN_SEGMENT, request.start,
+                                          request.size);
+
+      sync_request_count_->increment();
+      download_requests_.emplace_back(DownloadRequest{request, std::move(promise)});
+    }
+  }
+}
+
+/**
+ * Request the blocks of the missing section of the chain from the current peer, this is the only
+ * synchronisation request supported by peers running the previous release
+ */
+void MainChainRpcService::RequestCommonSubChain()
+{
+  FETCH_LOG_INFO(LOGGING_NAME, "Requesting chain from muddle://", ToBase64(current_peer_address_),
+                 " for block ", ToBase64(current_missing_block_));
+
+  current_request_ = rpc_client_.CallSpecificAddress(
+      current_peer_address_, RPC_MAIN_CHAIN, MainChainProtocol::COMMON_SUB_CHAIN,
+      current_missing_block_, chain_.GetHeaviestBlockHash(), MAX_SUB_CHAIN_SIZE);
+  current_request_is_sub_chain_ = true;
+}
+
 bool MainChainRpcService::IsBlockValid(Block &block) const
 {
   bool block_valid{false};
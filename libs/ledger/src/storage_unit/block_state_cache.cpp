@@ -0,0 +1,304 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chain/transaction.hpp"
+#include "ledger/storage_unit/block_state_cache.hpp"
+#include "telemetry/counter.hpp"
+#include "telemetry/registry.hpp"
+
+#include <cassert>
+#include <utility>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Construct the block state cache
+ *
+ * @param storage The underlying storage unit
+ * @param log2_num_lanes The log2 number of lanes
+ */
+BlockStateCache::BlockStateCache(StorageUnitPtr storage, uint32_t log2_num_lanes)
+  : storage_{std::move(storage)}
+  , log2_num_lanes_{log2_num_lanes}
+  , hit_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_block_state_cache_hit_total",
+        "Total number of state lookups served by the block state cache")}
+  , miss_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_block_state_cache_miss_total",
+        "Total number of state lookups forwarded to the storage unit by the block state cache")}
+  , flushed_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_block_state_cache_flushed_total",
+        "Total number of state writes flushed to the storage unit by the block state cache")}
+{
+  assert(static_cast<bool>(storage_));
+
+  partitions_.reserve(1u << log2_num_lanes_);
+  for (std::size_t i = 0, end = 1u << log2_num_lanes_; i < end; ++i)
+  {
+    partitions_.emplace_back(std::make_unique<Partition>());
+  }
+}
+
+/**
+ * Write all the modified values to the storage unit and empty the cache
+ */
+void BlockStateCache::Flush()
+{
+  for (auto &partition : partitions_)
+  {
+    FETCH_LOCK(partition->lock);
+
+    for (auto const &element : partition->entries)
+    {
+      if (element.second.dirty)
+      {
+        storage_->Set(element.first, element.second.document.document);
+        flushed_count_->increment();
+      }
+    }
+
+    partition->entries.clear();
+  }
+}
+
+/**
+ * Empty the cache, discarding any modified values
+ */
+void BlockStateCache::Discard()
+{
+  for (auto &partition : partitions_)
+  {
+    FETCH_LOCK(partition->lock);
+    partition->entries.clear();
+  }
+}
+
+/**
+ * Get a resource from the cache or the storage unit
+ *
+ * @param key The key to be accessed
+ * @return The document containing the result
+ */
+BlockStateCache::Document BlockStateCache::Get(ResourceAddress const &key)
+{
+  auto &partition = LookupPartition(key);
+  FETCH_LOCK(partition.lock);
+
+  auto it = partition.entries.find(key);
+  if (it != partition.entries.end())
+  {
+    hit_count_->increment();
+  }
+  else
+  {
+    miss_count_->increment();
+
+    // not in the cache, cache the value (or the fact there is no value) from the storage unit
+    it = partition.entries.emplace(key, Entry{storage_->Get(key), false}).first;
+  }
+
+  return it->second.document;
+}
+
+/**
+ * Get or create a resource in the cache or the storage unit
+ *
+ * @param key The key to be accessed
+ * @return The document containing the result
+ */
+BlockStateCache::Document BlockStateCache::GetOrCreate(ResourceAddress const &key)
+{
+  auto &partition = LookupPartition(key);
+  FETCH_LOCK(partition.lock);
+
+  auto it = partition.entries.find(key);
+  if ((it != partition.entries.end()) && !it->second.document.failed)
+  {
+    hit_count_->increment();
+  }
+  else
+  {
+    miss_count_->increment();
+
+    if (it == partition.entries.end())
+    {
+      it = partition.entries.emplace(key, Entry{}).first;
+    }
+
+    // the resource might need to be created by the storage unit
+    it->second = Entry{storage_->GetOrCreate(key), false};
+  }
+
+  return it->second.document;
+}
+
+/**
+ * Set the value of a resource in the cache, it will be written to the storage unit when the
+ * cache is flushed
+ *
+ * @param key The key of the value
+ * @param value The value being set
+ */
+void BlockStateCache::Set(ResourceAddress const &key, StateValue const &value)
+{
+  auto &partition = LookupPartition(key);
+  FETCH_LOCK(partition.lock);
+
+  auto it = partition.entries.find(key);
+  if (it == partition.entries.end())
+  {
+    it = partition.entries.emplace(key, Entry{}).first;
+  }
+  else if (!it->second.dirty && !it->second.document.failed &&
+           (it->second.document.document == value))
+  {
+    // avoid writing back values which have only been read
+    return;
+  }
+
+  Entry &entry = it->second;
+
+  entry.document.document    = value;
+  entry.document.failed      = false;
+  entry.document.was_created = false;
+  entry.dirty                = true;
+}
+
+/**
+ * Lock a resource on the storage unit
+ *
+ * @param index The shard index to be locked
+ * @return true if successful, otherwise false
+ */
+bool BlockStateCache::Lock(ShardIndex index)
+{
+  return storage_->Lock(index);
+}
+
+/**
+ * Unlock a resource on the storage unit
+ *
+ * @param index The shard index to be unlocked
+ * @return true if successful, otherwise false
+ */
+bool BlockStateCache::Unlock(ShardIndex index)
+{
+  return storage_->Unlock(index);
+}
+
+BlockStateCache::Keys BlockStateCache::KeyDump() const
+{
+  return storage_->KeyDump();
+}
+
+void BlockStateCache::Reset()
+{
+  Discard();
+  storage_->Reset();
+}
+
+void BlockStateCache::AddTransaction(Transaction const &tx)
+{
+  storage_->AddTransaction(tx);
+}
+
+bool BlockStateCache::GetTransaction(Digest const &digest, Transaction &tx)
+{
+  return storage_->GetTransaction(digest, tx);
+}
+
+BlockStateCache::Transactions BlockStateCache::GetTransactions(DigestSet const &digests)
+{
+  return storage_->GetTransactions(digests);
+}
+
+bool BlockStateCache::HasTransaction(Digest const &digest)
+{
+  return storage_->HasTransaction(digest);
+}
+
+void BlockStateCache::IssueCallForMissingTxs(DigestSet const &tx_set)
+{
+  storage_->IssueCallForMissingTxs(tx_set);
+}
+
+BlockStateCache::TxLayouts BlockStateCache::PollRecentTx(uint32_t max_to_poll)
+{
+  return storage_->PollRecentTx(max_to_poll);
+}
+
+/**
+ * Calculate the current state hash, writing out the cached values so that they are included
+ *
+ * @return The current state hash
+ */
+BlockStateCache::Hash BlockStateCache::CurrentHash()
+{
+  Flush();
+  return storage_->CurrentHash();
+}
+
+BlockStateCache::Hash BlockStateCache::LastCommitHash()
+{
+  return storage_->LastCommitHash();
+}
+
+/**
+ * Revert the state, discarding any cached values
+ *
+ * @param hash The state hash to revert to
+ * @param index The block index of the state
+ * @return true if successful, otherwise false
+ */
+bool BlockStateCache::RevertToHash(Hash const &hash, uint64_t index)
+{
+  Discard();
+  return storage_->RevertToHash(hash, index);
+}
+
+/**
+ * Commit the state, writing out the cached values so that they are included
+ *
+ * @param index The block index being committed
+ * @return The committed state hash
+ */
+BlockStateCache::Hash BlockStateCache::Commit(uint64_t index)
+{
+  Flush();
+  return storage_->Commit(index);
+}
+
+bool BlockStateCache::HashExists(Hash const &hash, uint64_t index)
+{
+  return storage_->HashExists(hash, index);
+}
+
+/**
+ * Lookup the partition for the lane of a given resource
+ *
+ * @param key The resource address
+ * @return The partition
+ */
+BlockStateCache::Partition &BlockStateCache::LookupPartition(ResourceAddress const &key)
+{
+  return *partitions_[key.lane(log2_num_lanes_)];
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -117,8 +117,10 @@ LaneService::LaneService(NetworkManager nm, ShardConfig config, bool sign_packet
   // TX Sync protocol
   external_rpc_server_->Add(RPC_TX_STORE_SYNC, tx_sync_protocol_.get());
 
-  // State DB
+  // State DB, with a single write ahead log shared by all of the lanes so that their commits are
+  // grouped into a single sync
   state_db_ = std::make_shared<StateDb>();
+  state_db_->SetWriteAheadLog(cfg_.storage_path + "_state.wal");
   switch (mode)
   {
   case Mode::CREATE_DATABASE:
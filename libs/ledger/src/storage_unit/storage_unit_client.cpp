@@ -407,6 +407,56 @@ bool StorageUnitClient::GetTransaction(byte_array::ConstByteArray const &digest,
   return success;
 }
 
+/**
+ * Lookup a set of transactions, making a single request to each of the lanes involved. The requests
+ * to the lanes are made concurrently.
+ *
+ * @param digests The digests of the transactions to be retrieved
+ * @return The transactions which were found
+ */
+StorageUnitClient::Transactions StorageUnitClient::GetTransactions(DigestSet const &digests)
+{
+  using ElementList = TxStoreProtocol::ElementList;
+  using ResourceIDs = TxStoreProtocol::ResourceIDs;
+
+  // group the requested transactions by lane
+  std::map<Address, ResourceIDs> lanes_of_interest;
+  for (auto const &digest : digests)
+  {
+    ResourceID resource{digest};
+    lanes_of_interest[LookupAddress(resource)].emplace_back(std::move(resource));
+  }
+
+  // issue all of the requests before waiting on any of them
+  std::vector<Promise> promises{};
+  promises.reserve(lanes_of_interest.size());
+  for (auto const &lane_resources : lanes_of_interest)
+  {
+    promises.emplace_back(rpc_client_->CallSpecificAddress(
+        lane_resources.first, RPC_TX_STORE, TxStoreProtocol::GET_BULK, lane_resources.second));
+  }
+
+  Transactions transactions{};
+  transactions.reserve(digests.size());
+
+  for (auto &promise : promises)
+  {
+    try
+    {
+      for (auto &element : promise->As<ElementList>())
+      {
+        transactions.emplace_back(std::move(element.value));
+      }
+    }
+    catch (std::exception const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to get transactions, because: ", e.what());
+    }
+  }
+
+  return transactions;
+}
+
 bool StorageUnitClient::HasTransaction(ConstByteArray const &digest)
 {
   bool present{false};
@@ -0,0 +1,284 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/logger.hpp"
+#include "ledger/storage_unit/transaction_prefetcher.hpp"
+#include "storage/resource_mapper.hpp"
+#include "telemetry/counter.hpp"
+#include "telemetry/registry.hpp"
+
+#include <chrono>
+#include <exception>
+#include <utility>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+constexpr char const *LOGGING_NAME = "TxPrefetcher";
+
+// the time a lookup will wait for the bulk load of its lane, after which the transaction is fetched
+// directly. Kept short so that a slow lane never holds up an executor longer than a direct fetch
+const std::chrono::milliseconds LOAD_TIMEOUT{100};
+
+}  // namespace
+
+/**
+ * Construct the transaction prefetcher
+ *
+ * @param storage The storage unit from which the transactions are loaded
+ * @param log2_num_lanes The log2 number of lanes
+ * @param max_size The maximum number of transactions to be cached (or being loaded)
+ */
+TransactionPrefetcher::TransactionPrefetcher(StorageUnitPtr storage, uint32_t log2_num_lanes,
+                                             std::size_t max_size)
+  : storage_{std::move(storage)}
+  , log2_num_lanes_{log2_num_lanes}
+  , max_size_{max_size}
+  , requested_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_tx_prefetcher_requested_total",
+        "The total number of transactions requested by the prefetcher")}
+  , hit_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_tx_prefetcher_hit_total",
+        "The total number of transaction lookups served by the prefetcher")}
+  , miss_count_{telemetry::Registry::Instance().CreateCounter(
+        "ledger_tx_prefetcher_miss_total",
+        "The total number of transaction lookups not served by the prefetcher")}
+  , threads_{std::size_t{1} << log2_num_lanes, "TxPrefetch"}
+{}
+
+/**
+ * Queue the loading of all the transactions of a block. Does not block.
+ *
+ * @param block The block whose transactions should be loaded
+ */
+void TransactionPrefetcher::Prefetch(Block::Body const &block)
+{
+  LaneDigests lanes(std::size_t{1} << log2_num_lanes_);
+  std::size_t count{0};
+  bool        evicted{false};
+
+  {
+    std::lock_guard<Mutex> guard{lock_};
+
+    uint64_t const index = next_block_++;
+    bool           full  = false;
+
+    for (auto slice = block.slices.begin(); (slice != block.slices.end()) && !full; ++slice)
+    {
+      for (auto const &layout : *slice)
+      {
+        auto const &digest = layout.digest();
+
+        if (block_index_.find(digest) != block_index_.end())
+        {
+          continue;
+        }
+
+        // when full, the oldest blocks are assumed to be those which will no longer be executed and
+        // their transactions are discarded first. The transactions of this block are never
+        // discarded to make room for the rest of it, instead the remainder is not prefetched
+        while (((cache_.size() + in_flight_.size()) >= max_size_) && !blocks_.empty() &&
+               (blocks_.begin()->first != index))
+        {
+          EvictOldestBlock();
+          evicted = true;
+        }
+
+        full = (cache_.size() + in_flight_.size()) >= max_size_;
+        if (full)
+        {
+          break;
+        }
+
+        in_flight_.insert(digest);
+        blocks_[index].insert(digest);
+        block_index_[digest] = index;
+        lanes[storage::ResourceID{digest}.lane(log2_num_lanes_)].insert(digest);
+        ++count;
+      }
+    }
+  }
+
+  // lookups waiting on the loads of an evicted block need not wait for them any longer
+  if (evicted)
+  {
+    loaded_.notify_all();
+  }
+
+  requested_count_->add(count);
+
+  // each lane is loaded independently so that a slow lane does not delay the others
+  for (auto &digests : lanes)
+  {
+    if (!digests.empty())
+    {
+      threads_.Dispatch([this, digests = std::move(digests)]() { Load(digests); });
+    }
+  }
+}
+
+/**
+ * Lookup a transaction from the cache, waiting briefly for it if it is currently being loaded. Once
+ * retrieved the transaction is removed from the cache.
+ *
+ * @param digest The digest of the transaction to be retrieved
+ * @param tx The output transaction to be populated
+ * @return true if successful, otherwise false if the transaction should be fetched directly
+ */
+bool TransactionPrefetcher::Lookup(Digest const &digest, Transaction &tx)
+{
+  std::unique_lock<Mutex> guard{lock_};
+
+  loaded_.wait_for(guard, LOAD_TIMEOUT,
+                   [this, &digest]() { return in_flight_.find(digest) == in_flight_.end(); });
+
+  auto it = cache_.find(digest);
+  if (it == cache_.end())
+  {
+    miss_count_->increment();
+    return false;
+  }
+
+  tx = std::move(it->second);
+  cache_.erase(it);
+  Untrack(digest);
+
+  hit_count_->increment();
+  return true;
+}
+
+/**
+ * Discard all the cached transactions
+ */
+void TransactionPrefetcher::Clear()
+{
+  std::lock_guard<Mutex> guard{lock_};
+
+  for (auto const &entry : cache_)
+  {
+    Untrack(entry.first);
+  }
+  cache_.clear();
+}
+
+/**
+ * Get the number of transactions which are currently cached
+ *
+ * @return The number of transactions
+ */
+std::size_t TransactionPrefetcher::size() const
+{
+  std::lock_guard<Mutex> guard{lock_};
+  return cache_.size();
+}
+
+/**
+ * Internal: Load a set of transactions (all belonging to the same lane) from the storage unit into
+ * the cache
+ *
+ * @param digests The digests of the transactions to be loaded
+ */
+void TransactionPrefetcher::Load(DigestSet const &digests)
+{
+  StorageUnitInterface::Transactions transactions{};
+
+  try
+  {
+    transactions = storage_->GetTransactions(digests);
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to prefetch transactions: ", ex.what());
+  }
+
+  {
+    std::lock_guard<Mutex> guard{lock_};
+
+    for (auto &tx : transactions)
+    {
+      // only transactions which are still expected are cached
+      if (in_flight_.find(tx.digest()) != in_flight_.end())
+      {
+        Digest const digest = tx.digest();
+        cache_[digest]      = std::move(tx);
+      }
+    }
+
+    for (auto const &digest : digests)
+    {
+      in_flight_.erase(digest);
+
+      // transactions which could not be loaded are no longer held
+      if (cache_.find(digest) == cache_.end())
+      {
+        Untrack(digest);
+      }
+    }
+  }
+
+  loaded_.notify_all();
+}
+
+/**
+ * Internal: Discard the cached and in flight transactions of the oldest prefetched block. Must be
+ * called with `lock_` held
+ */
+void TransactionPrefetcher::EvictOldestBlock()
+{
+  auto const oldest = blocks_.begin();
+
+  for (auto const &digest : oldest->second)
+  {
+    cache_.erase(digest);
+    in_flight_.erase(digest);
+    block_index_.erase(digest);
+  }
+
+  blocks_.erase(oldest);
+}
+
+/**
+ * Internal: Stop holding a transaction on behalf of its block, once it is neither cached nor in
+ * flight. Must be called with `lock_` held
+ *
+ * @param digest The digest of the transaction
+ */
+void TransactionPrefetcher::Untrack(Digest const &digest)
+{
+  auto const it = block_index_.find(digest);
+  if (it == block_index_.end())
+  {
+    return;
+  }
+
+  auto const block = blocks_.find(it->second);
+  if (block != blocks_.end())
+  {
+    block->second.erase(digest);
+    if (block->second.empty())
+    {
+      blocks_.erase(block);
+    }
+  }
+
+  block_index_.erase(it);
+}
+
+}  // namespace ledger
+}  // namespace fetch
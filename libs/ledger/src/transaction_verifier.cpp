@@ -24,12 +24,14 @@
 #include "core/logger.hpp"
 #include "core/string/to_lower.hpp"
 #include "core/threading.hpp"
+#include "crypto/ecdsa_batch_verifier.hpp"
 #include "ledger/chain/transaction.hpp"
 #include "ledger/storage_unit/transaction_sinks.hpp"
 #include "metrics/metrics.hpp"
 #include "network/generics/milli_timer.hpp"
 
 #include <chrono>
+#include <vector>
 
 static const std::chrono::milliseconds POP_TIMEOUT{300};
 
@@ -177,36 +179,56 @@ void TransactionVerifier::AddTransaction(TransactionPtr &&tx)
 }
 
 /**
- * Internal: Thread process for the verification of
+ * Internal: Thread process for the verification of transactions. Each time the thread is woken
+ * it drains as many transactions as are available (up to the batch size) from the unverified
+ * queue and verifies them together
  */
 void TransactionVerifier::Verifier()
 {
-  TransactionPtr tx;
+  crypto::ECDSABatchVerifier verifier{};
+
+  std::vector<TransactionPtr> batch;
+  batch.reserve(BATCH_SIZE);
 
   while (active_)
   {
     try
     {
+      batch.clear();
+
       // wait for a mutable transaction to be available
-      if (unverified_queue_.Pop(tx, POP_TIMEOUT))
+      TransactionPtr tx;
+      if (!unverified_queue_.Pop(tx, POP_TIMEOUT))
+      {
+        continue;
+      }
+
+      // collect any other transactions which are already waiting
+      do
       {
+        batch.emplace_back(std::move(tx));
         unverified_queue_length_->decrement();
+      } while ((batch.size() < BATCH_SIZE) && unverified_queue_.Pop(tx, std::chrono::seconds{0}));
 
-        FETCH_LOG_DEBUG(LOGGING_NAME, "Verifying TX: 0x", tx->digest().ToHex());
+      FETCH_LOG_DEBUG(LOGGING_NAME, "Verifying batch of ", batch.size(), " TXs");
 
-        // check the status
-        if (tx->Verify())
+      // check the status
+      Transaction::VerifyBatch(batch, verifier);
+
+      for (auto &verified_tx : batch)
+      {
+        if (verified_tx->IsVerified())
         {
-          FETCH_LOG_DEBUG(LOGGING_NAME, "TX Verify Complete: 0x", tx->digest().ToHex());
+          FETCH_LOG_DEBUG(LOGGING_NAME, "TX Verify Complete: 0x", verified_tx->digest().ToHex());
 
-          verified_queue_.Push(std::move(tx));
+          verified_queue_.Push(std::move(verified_tx));
           verified_queue_length_->increment();
           verified_tx_total_->increment();
         }
         else
         {
           FETCH_LOG_WARN(LOGGING_NAME, name_ + " Unable to verify transaction: 0x",
-                         tx->digest().ToHex());
+                         verified_tx->digest().ToHex());
 
           discarded_tx_total_->increment();
         }
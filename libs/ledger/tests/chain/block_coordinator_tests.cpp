@@ -285,6 +285,9 @@ TEST_F(BlockCoordinatorTests, CheckBasicInteraction)
     // pre block validation
     // none
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(genesis)));
+
     // schedule of the genesis block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(genesis)));
 
@@ -430,6 +433,9 @@ TEST_F(BlockCoordinatorTests, CheckLongBlockStartUp)
     // pre block validation
     // none
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(genesis)));
+
     // schedule of the genesis block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(genesis)));
 
@@ -448,6 +454,9 @@ TEST_F(BlockCoordinatorTests, CheckLongBlockStartUp)
     EXPECT_CALL(*storage_unit_, HashExists(_, 0));
     EXPECT_CALL(*storage_unit_, RevertToHash(_, 0));
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(b1)));
+
     // schedule of the next block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(b1)));
 
@@ -466,6 +475,9 @@ TEST_F(BlockCoordinatorTests, CheckLongBlockStartUp)
     EXPECT_CALL(*storage_unit_, HashExists(_, 1));
     EXPECT_CALL(*storage_unit_, RevertToHash(_, 1));
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(b2)));
+
     // schedule of the next block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(b2)));
 
@@ -484,6 +496,9 @@ TEST_F(BlockCoordinatorTests, CheckLongBlockStartUp)
     EXPECT_CALL(*storage_unit_, HashExists(_, 2));
     EXPECT_CALL(*storage_unit_, RevertToHash(_, 2));
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(b3)));
+
     // schedule of the next block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(b3)));
 
@@ -509,6 +524,9 @@ TEST_F(BlockCoordinatorTests, CheckLongBlockStartUp)
     EXPECT_CALL(*storage_unit_, HashExists(_, 3));
     EXPECT_CALL(*storage_unit_, RevertToHash(_, 3));
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(b4)));
+
     // schedule of the next block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(b4)));
 
@@ -534,6 +552,9 @@ TEST_F(BlockCoordinatorTests, CheckLongBlockStartUp)
     EXPECT_CALL(*storage_unit_, HashExists(_, 4));
     EXPECT_CALL(*storage_unit_, RevertToHash(_, 4));
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(b5)));
+
     // schedule of the next block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(b5)));
 
@@ -682,6 +703,9 @@ TEST_F(BlockCoordinatorTests, CheckInvalidBlockNumber)
     // pre block validation
     // none
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(genesis)));
+
     // schedule of the genesis block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(genesis)));
 
@@ -756,6 +780,9 @@ TEST_F(BlockCoordinatorTests, CheckInvalidNumLanes)
     // pre block validation
     // none
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(genesis)));
+
     // schedule of the genesis block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(genesis)));
 
@@ -848,6 +875,9 @@ TEST_F(BlockCoordinatorTests, CheckInvalidNumSlices)
     // pre block validation
     // none
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(genesis)));
+
     // schedule of the genesis block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(genesis)));
 
@@ -939,6 +969,9 @@ TEST_F(BlockCoordinatorTests, CheckBlockMining)
     // pre block validation
     // none
 
+    // transactions are available and start being loaded
+    EXPECT_CALL(*execution_manager_, PrefetchTransactions(IsBlock(genesis)));
+
     // schedule of the genesis block
     EXPECT_CALL(*execution_manager_, Execute(IsBlock(genesis)));
 
@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/hash.hpp"
+#include "crypto/sha256.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/block.hpp"
+#include "ledger/protocols/block_download_queue.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using fetch::ledger::Address;
+using fetch::ledger::Block;
+using fetch::ledger::BlockDownloadQueue;
+
+using Blocks    = BlockDownloadQueue::Blocks;
+using Request   = BlockDownloadQueue::Request;
+using Segment   = BlockDownloadQueue::Segment;
+using Timepoint = BlockDownloadQueue::Timepoint;
+
+constexpr std::size_t NUM_BLOCKS  = 10;
+constexpr std::size_t WINDOW_SIZE = 3;
+
+class BlockDownloadQueueTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // generate a simple chain of blocks
+    blocks_.clear();
+    for (std::size_t i = 0; i < NUM_BLOCKS; ++i)
+    {
+      Block block{};
+      block.body.block_number = i + 1;
+      block.body.miner        = Address{fetch::crypto::Hash<fetch::crypto::SHA256>("miner")};
+      if (!blocks_.empty())
+      {
+        block.body.previous_hash = blocks_.back().body.hash;
+      }
+      block.UpdateDigest();
+
+      blocks_.emplace_back(block);
+    }
+
+    BlockDownloadQueue::Config config{};
+    config.window_size           = WINDOW_SIZE;
+    config.max_requests_per_peer = 2;
+    config.max_windows_ahead     = 8;
+    config.max_attempts          = 2;
+    config.timeout               = std::chrono::seconds{10};
+
+    queue_ = std::make_unique<BlockDownloadQueue>(config);
+
+    BlockDownloadQueue::BlockHashes hashes{};
+    for (auto const &block : blocks_)
+    {
+      hashes.emplace_back(block.body.hash);
+    }
+
+    queue_->Reset(hashes);
+  }
+
+  /**
+   * Build the response that a peer would make to a range request (most recent block first)
+   */
+  Blocks Respond(Request const &request) const
+  {
+    auto const it = std::find_if(blocks_.begin(), blocks_.end(), [&request](Block const &block) {
+      return block.body.hash == request.start;
+    });
+
+    auto const last  = static_cast<std::size_t>(std::distance(blocks_.begin(), it));
+    auto const first = last + 1u - request.size;
+
+    Blocks response{};
+    for (std::size_t i = last + 1u; i > first; --i)
+    {
+      response.emplace_back(blocks_[i - 1u]);
+    }
+
+    return response;
+  }
+
+  Timepoint const                     now_{BlockDownloadQueue::Clock::now()};
+  Blocks                              blocks_;
+  std::unique_ptr<BlockDownloadQueue> queue_;
+};
+
+TEST_F(BlockDownloadQueueTests, CheckRequestsAreLimitedPerPeer)
+{
+  Request r1{};
+  Request r2{};
+  Request r3{};
+
+  ASSERT_TRUE(queue_->NextRequest("A", now_, r1));
+  ASSERT_TRUE(queue_->NextRequest("A", now_, r2));
+  EXPECT_FALSE(queue_->NextRequest("A", now_, r3));
+  ASSERT_TRUE(queue_->NextRequest("B", now_, r3));
+
+  // the windows are scheduled oldest first
+  EXPECT_EQ(r1.window, 0u);
+  EXPECT_EQ(r1.start, blocks_[WINDOW_SIZE - 1].body.hash);
+  EXPECT_EQ(r1.size, WINDOW_SIZE);
+  EXPECT_EQ(r2.window, 1u);
+  EXPECT_EQ(r3.window, 2u);
+  EXPECT_EQ(queue_->num_outstanding(), 3u);
+}
+
+TEST_F(BlockDownloadQueueTests, CheckBlocksAreDeliveredInOrder)
+{
+  std::vector<Request> requests(4);
+  ASSERT_TRUE(queue_->NextRequest("A", now_, requests[0]));
+  ASSERT_TRUE(queue_->NextRequest("B", now_, requests[1]));
+  ASSERT_TRUE(queue_->NextRequest("C", now_, requests[2]));
+  ASSERT_TRUE(queue_->NextRequest("D", now_, requests[3]));
+
+  // the final window is only partially filled
+  EXPECT_EQ(requests[3].size, NUM_BLOCKS % WINDOW_SIZE);
+
+  // complete the requests in reverse order
+  Segment segment{};
+  for (std::size_t i = requests.size(); i > 1; --i)
+  {
+    ASSERT_TRUE(queue_->Complete(requests[i - 1], Respond(requests[i - 1])));
+    EXPECT_FALSE(queue_->NextSegment(segment));
+  }
+
+  ASSERT_TRUE(queue_->Complete(requests[0], Respond(requests[0])));
+
+  Blocks delivered{};
+  while (queue_->NextSegment(segment))
+  {
+    delivered.insert(delivered.end(), segment.blocks.begin(), segment.blocks.end());
+  }
+
+  ASSERT_EQ(delivered.size(), NUM_BLOCKS);
+  for (std::size_t i = 0; i < NUM_BLOCKS; ++i)
+  {
+    EXPECT_EQ(delivered[i].body.hash, blocks_[i].body.hash);
+  }
+
+  EXPECT_TRUE(queue_->IsComplete());
+  EXPECT_EQ(queue_->num_outstanding(), 0u);
+}
+
+TEST_F(BlockDownloadQueueTests, CheckInvalidResponsesAreRetriedWithAnotherPeer)
+{
+  Request request{};
+  ASSERT_TRUE(queue_->NextRequest("A", now_, request));
+
+  // respond with the wrong blocks
+  Request wrong = request;
+  wrong.start   = blocks_[NUM_BLOCKS - 1].body.hash;
+  EXPECT_FALSE(queue_->Complete(request, Respond(wrong)));
+  EXPECT_EQ(queue_->num_outstanding(), 0u);
+
+  // the same window should not be requested from the same peer again
+  Request retry{};
+  ASSERT_TRUE(queue_->NextRequest("A", now_, retry));
+  EXPECT_NE(retry.window, request.window);
+
+  ASSERT_TRUE(queue_->NextRequest("B", now_, retry));
+  EXPECT_EQ(retry.window, request.window);
+  EXPECT_NE(retry.id, request.id);
+
+  // stale responses are ignored
+  EXPECT_FALSE(queue_->Complete(request, Respond(request)));
+  EXPECT_TRUE(queue_->Complete(retry, Respond(retry)));
+}
+
+TEST_F(BlockDownloadQueueTests, CheckSlowRequestsExpire)
+{
+  Request request{};
+  ASSERT_TRUE(queue_->NextRequest("A", now_, request));
+
+  EXPECT_TRUE(queue_->Expire(now_ + std::chrono::seconds{1}).empty());
+
+  auto const expired = queue_->Expire(now_ + std::chrono::seconds{11});
+  ASSERT_EQ(expired.size(), 1u);
+  EXPECT_EQ(expired[0].id, request.id);
+  EXPECT_EQ(queue_->num_outstanding(), 0u);
+
+  Request retry{};
+  ASSERT_TRUE(queue_->NextRequest("B", now_, retry));
+  EXPECT_EQ(retry.window, request.window);
+}
+
+TEST_F(BlockDownloadQueueTests, CheckRepeatedFailuresFailTheDownload)
+{
+  Request request{};
+
+  ASSERT_TRUE(queue_->NextRequest("A", now_, request));
+  queue_->Fail(request);
+  EXPECT_FALSE(queue_->HasFailed());
+
+  ASSERT_TRUE(queue_->NextRequest("B", now_, request));
+  queue_->Fail(request);
+  EXPECT_TRUE(queue_->HasFailed());
+
+  EXPECT_FALSE(queue_->NextRequest("C", now_, request));
+  EXPECT_FALSE(queue_->IsComplete());
+  EXPECT_EQ(queue_->num_remaining_blocks(), NUM_BLOCKS);
+}
+
+TEST_F(BlockDownloadQueueTests, CheckRejectedRequestsDoNotFailTheDownload)
+{
+  Request request{};
+
+  // peers which do not support the range request do not use up the attempts for the window
+  for (auto const &peer : {"A", "B", "C"})
+  {
+    ASSERT_TRUE(queue_->NextRequest(peer, now_, request));
+    EXPECT_EQ(request.window, 0u);
+    queue_->Reject(request);
+    EXPECT_FALSE(queue_->HasFailed());
+  }
+
+  // the rejecting peers are not asked for the window again
+  Request other{};
+  ASSERT_TRUE(queue_->NextRequest("A", now_, other));
+  EXPECT_EQ(other.window, 1u);
+
+  ASSERT_TRUE(queue_->NextRequest("D", now_, request));
+  EXPECT_EQ(request.window, 0u);
+  EXPECT_TRUE(queue_->Complete(request, Respond(request)));
+
+  Segment segment{};
+  ASSERT_TRUE(queue_->NextSegment(segment));
+  EXPECT_EQ(segment.peer, "D");
+}
+
+}  // namespace
@@ -0,0 +1,248 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/bitvector.hpp"
+#include "crypto/ecdsa.hpp"
+#include "crypto/hash.hpp"
+#include "crypto/sha256.hpp"
+#include "fake_storage_unit.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/block_prevalidator.hpp"
+#include "ledger/chain/consensus/dummy_miner.hpp"
+#include "ledger/chain/main_chain.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_builder.hpp"
+#include "ledger/chain/transaction_layout.hpp"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::ledger::Address;
+using fetch::ledger::Block;
+using fetch::ledger::BlockPrevalidator;
+using fetch::ledger::BlockStatus;
+using fetch::ledger::Digest;
+using fetch::ledger::MainChain;
+using fetch::ledger::TransactionBuilder;
+using fetch::ledger::TransactionLayout;
+using fetch::ledger::consensus::DummyMiner;
+
+using BlockPtr = std::shared_ptr<Block>;
+using Result   = BlockPrevalidator::Result;
+using Status   = BlockPrevalidator::Status;
+using Digests  = std::vector<Digest>;
+
+constexpr uint32_t    LOG2_NUM_LANES = 2;
+constexpr std::size_t NUM_LANES      = 1u << LOG2_NUM_LANES;
+constexpr std::size_t NUM_SLICES     = 2;
+
+class BlockPrevalidatorTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    chain_        = std::make_unique<MainChain>(false, MainChain::Mode::IN_MEMORY_DB);
+    prevalidator_ = std::make_unique<BlockPrevalidator>(
+        storage_, BlockPrevalidator::Config{NUM_LANES, NUM_SLICES, 2, 4});
+  }
+
+  void TearDown() override
+  {
+    prevalidator_.reset();
+    chain_.reset();
+  }
+
+  static Digest MakeDigest(std::string const &name)
+  {
+    return fetch::crypto::Hash<fetch::crypto::SHA256>(name);
+  }
+
+  /**
+   * Build a (mined) block following the specified block, the digests are spread over the slices
+   */
+  BlockPtr MakeBlock(BlockPtr const &previous, Digests const &digests)
+  {
+    auto block = std::make_shared<Block>();
+
+    block->body.previous_hash  = previous->body.hash;
+    block->body.block_number   = previous->body.block_number + 1u;
+    block->body.miner          = Address{MakeDigest("miner")};
+    block->body.log2_num_lanes = LOG2_NUM_LANES;
+    block->body.slices.resize(NUM_SLICES);
+
+    for (std::size_t i = 0; i < digests.size(); ++i)
+    {
+      block->body.slices[i % NUM_SLICES].emplace_back(digests[i], BitVector{NUM_LANES}, 0, 0, 0);
+    }
+
+    block->proof.SetTarget(std::size_t{0});
+    miner_.Mine(*block);
+
+    return block;
+  }
+
+  Result WaitForResult(Digest const &hash)
+  {
+    Result result{};
+
+    for (std::size_t i = 0; i < 1000u; ++i)
+    {
+      Status const status = prevalidator_->Query(hash, result);
+      EXPECT_NE(Status::UNKNOWN, status);
+
+      if (Status::PENDING != status)
+      {
+        break;
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+
+    return result;
+  }
+
+  BlockPtr Genesis() const
+  {
+    return std::make_shared<Block>(*chain_->GetHeaviestBlock());
+  }
+
+  FakeStorageUnit                    storage_;
+  DummyMiner                         miner_;
+  std::unique_ptr<MainChain>         chain_;
+  std::unique_ptr<BlockPrevalidator> prevalidator_;
+};
+
+TEST_F(BlockPrevalidatorTests, CheckValidBlock)
+{
+  auto const block = MakeBlock(Genesis(), {MakeDigest("tx1"), MakeDigest("tx2")});
+
+  ASSERT_TRUE(prevalidator_->Schedule(block));
+  EXPECT_FALSE(prevalidator_->Schedule(block));
+
+  auto const result = WaitForResult(block->body.hash);
+  EXPECT_TRUE(result.valid);
+  EXPECT_EQ(2u, result.missing_txs.size());
+  EXPECT_EQ(0u, prevalidator_->size());
+
+  Result unused{};
+  EXPECT_EQ(Status::UNKNOWN, prevalidator_->Query(block->body.hash, unused));
+}
+
+TEST_F(BlockPrevalidatorTests, CheckHashMismatch)
+{
+  auto block = MakeBlock(Genesis(), {MakeDigest("tx1"), MakeDigest("tx2")});
+
+  // replacing a transaction changes the merkle root and therefore the block hash
+  block->body.slices[0][0] = TransactionLayout{MakeDigest("tx3"), BitVector{NUM_LANES}, 0, 0, 0};
+
+  auto const result = prevalidator_->Validate(*block);
+  EXPECT_FALSE(result.valid);
+  EXPECT_STREQ("Block hash mismatch", result.reason);
+}
+
+TEST_F(BlockPrevalidatorTests, CheckInvalidProof)
+{
+  auto block = MakeBlock(Genesis(), {});
+
+  // find a nonce which does not satisfy the target
+  while (block->proof())
+  {
+    ++block->nonce;
+    block->UpdateDigest();
+  }
+
+  auto const result = prevalidator_->Validate(*block);
+  EXPECT_FALSE(result.valid);
+  EXPECT_STREQ("Invalid proof", result.reason);
+}
+
+TEST_F(BlockPrevalidatorTests, CheckDuplicatesAreNotRejected)
+{
+  // repeated transactions are left to the sequential checks, only the unique set is requested
+  auto const b1 = MakeBlock(Genesis(), {MakeDigest("tx1")});
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*b1));
+
+  auto const b2 = MakeBlock(b1, {MakeDigest("tx2"), MakeDigest("tx1"), MakeDigest("tx2")});
+
+  auto const result = prevalidator_->Validate(*b2);
+  EXPECT_TRUE(result.valid);
+  EXPECT_EQ(2u, result.missing_txs.size());
+}
+
+TEST_F(BlockPrevalidatorTests, CheckMissingTransactions)
+{
+  fetch::crypto::ECDSASigner signer;
+
+  auto const tx = TransactionBuilder()
+                      .From(Address{signer.identity()})
+                      .Signer(signer.identity())
+                      .Seal()
+                      .Sign(signer)
+                      .Build();
+  storage_.AddTransaction(*tx);
+
+  Digest const present = tx->digest();
+
+  auto const block = MakeBlock(Genesis(), {present, MakeDigest("tx1")});
+
+  auto const result = prevalidator_->Validate(*block);
+  EXPECT_TRUE(result.valid);
+  ASSERT_EQ(1u, result.missing_txs.size());
+  EXPECT_EQ(MakeDigest("tx1"), *result.missing_txs.begin());
+}
+
+TEST_F(BlockPrevalidatorTests, CheckPipelineLimitAndPrune)
+{
+  std::vector<BlockPtr> blocks{Genesis()};
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    blocks.emplace_back(MakeBlock(blocks.back(), {MakeDigest("tx" + std::to_string(i))}));
+  }
+
+  // the pipeline is limited to 4 blocks
+  for (std::size_t i = 1; i <= 4; ++i)
+  {
+    EXPECT_TRUE(prevalidator_->Schedule(blocks[i]));
+  }
+  EXPECT_FALSE(prevalidator_->Schedule(blocks[5]));
+
+  // blocks 1 and 2 are no longer needed
+  prevalidator_->Prune(3);
+  EXPECT_EQ(2u, prevalidator_->size());
+  EXPECT_TRUE(prevalidator_->Schedule(blocks[5]));
+
+  EXPECT_TRUE(WaitForResult(blocks[4]->body.hash).valid);
+  EXPECT_EQ(2u, prevalidator_->size());
+
+  prevalidator_->Reset();
+  EXPECT_EQ(0u, prevalidator_->size());
+}
+
+}  // namespace
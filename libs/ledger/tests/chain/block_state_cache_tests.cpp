@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/storage_unit/block_state_cache.hpp"
+#include "ledger/storage_unit/cached_storage_adapter.hpp"
+#include "mock_storage_unit.hpp"
+
+#include "gmock/gmock.h"
+
+#include <memory>
+
+namespace {
+
+using fetch::ledger::BlockStateCache;
+using fetch::ledger::CachedStorageAdapter;
+using fetch::storage::ResourceAddress;
+using ::testing::_;
+using ::testing::NiceMock;
+
+using MockStorageUnitPtr = std::shared_ptr<NiceMock<MockStorageUnit>>;
+using BlockStateCachePtr = std::unique_ptr<BlockStateCache>;
+
+class BlockStateCacheTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    storage_ = std::make_shared<NiceMock<MockStorageUnit>>();
+    cache_   = std::make_unique<BlockStateCache>(storage_, 2);
+  }
+
+  void TearDown() override
+  {
+    cache_.reset();
+    storage_.reset();
+  }
+
+  MockStorageUnitPtr storage_;
+  BlockStateCachePtr cache_;
+};
+
+TEST_F(BlockStateCacheTests, ReadsAreOnlyForwardedOnce)
+{
+  storage_->fake.Set(ResourceAddress{"key"}, "value");
+
+  EXPECT_CALL(*storage_, Get(_)).Times(1);
+  EXPECT_CALL(*storage_, Set(_, _)).Times(0);
+
+  for (int i = 0; i < 3; ++i)
+  {
+    auto const result = cache_->Get(ResourceAddress{"key"});
+    EXPECT_FALSE(result.failed);
+    EXPECT_EQ(result.document, "value");
+  }
+
+  // setting an unchanged value does not require a write
+  cache_->Set(ResourceAddress{"key"}, "value");
+  cache_->Flush();
+}
+
+TEST_F(BlockStateCacheTests, MissingValuesAreCached)
+{
+  EXPECT_CALL(*storage_, Get(_)).Times(1);
+  EXPECT_CALL(*storage_, GetOrCreate(_)).Times(1);
+
+  EXPECT_TRUE(cache_->Get(ResourceAddress{"key"}).failed);
+  EXPECT_TRUE(cache_->Get(ResourceAddress{"key"}).failed);
+
+  // the value must be created by the storage unit
+  auto const created = cache_->GetOrCreate(ResourceAddress{"key"});
+  EXPECT_FALSE(created.failed);
+  EXPECT_TRUE(created.was_created);
+
+  EXPECT_FALSE(cache_->Get(ResourceAddress{"key"}).failed);
+}
+
+TEST_F(BlockStateCacheTests, WritesAreFlushedWhenTheStateIsHashed)
+{
+  EXPECT_CALL(*storage_, Set(_, _)).Times(0);
+
+  // writes from consecutive transactions are visible to each other but not the storage unit
+  for (int i = 0; i < 3; ++i)
+  {
+    CachedStorageAdapter transaction{*cache_};
+
+    auto const value = transaction.Get(ResourceAddress{"balance"}).document;
+    transaction.Set(ResourceAddress{"balance"}, value + "x");
+    transaction.Flush();
+  }
+
+  EXPECT_EQ(cache_->Get(ResourceAddress{"balance"}).document, "xxx");
+  EXPECT_TRUE(storage_->fake.Get(ResourceAddress{"balance"}).failed);
+
+  ::testing::Mock::VerifyAndClearExpectations(storage_.get());
+  EXPECT_CALL(*storage_, Set(_, _)).Times(1);
+
+  cache_->CurrentHash();
+  EXPECT_EQ(storage_->fake.Get(ResourceAddress{"balance"}).document, "xxx");
+
+  // nothing further is written once the cache has been flushed
+  cache_->Commit(1);
+}
+
+TEST_F(BlockStateCacheTests, FailedTransactionsAreRolledBack)
+{
+  storage_->fake.Set(ResourceAddress{"balance"}, "100");
+
+  {
+    CachedStorageAdapter transaction{*cache_};
+    transaction.Set(ResourceAddress{"balance"}, "50");
+    transaction.Clear();
+    transaction.Flush();
+  }
+
+  EXPECT_EQ(cache_->Get(ResourceAddress{"balance"}).document, "100");
+}
+
+TEST_F(BlockStateCacheTests, RevertingDiscardsTheCachedWrites)
+{
+  auto const hash = cache_->Commit(0);
+
+  EXPECT_CALL(*storage_, Set(_, _)).Times(0);
+
+  cache_->Set(ResourceAddress{"key"}, "value");
+  EXPECT_TRUE(cache_->RevertToHash(hash, 0));
+
+  cache_->CurrentHash();
+  EXPECT_TRUE(cache_->Get(ResourceAddress{"key"}).failed);
+}
+
+}  // namespace
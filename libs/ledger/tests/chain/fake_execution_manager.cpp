@@ -49,6 +49,11 @@ FakeExecutionManager::ScheduleStatus FakeExecutionManager::Execute(Block::Body c
   return ScheduleStatus::SCHEDULED;
 }
 
+void FakeExecutionManager::PrefetchTransactions(Block::Body const &block)
+{
+  FETCH_UNUSED(block);
+}
+
 Digest FakeExecutionManager::LastProcessedBlock()
 {
   return last_processed_;
@@ -35,6 +35,7 @@ public:
   /// @name Execution Manager Interface
   /// @{
   ScheduleStatus Execute(Block::Body const &block) override;
+  void           PrefetchTransactions(Block::Body const &block) override;
   Digest         LastProcessedBlock() override;
   void           SetLastProcessedBlock(Digest hash) override;
   State          GetState() override;
@@ -94,6 +94,22 @@ bool FakeStorageUnit::GetTransaction(ConstByteArray const &digest, Transaction &
   return success;
 }
 
+FakeStorageUnit::Transactions FakeStorageUnit::GetTransactions(DigestSet const &digests)
+{
+  Transactions transactions{};
+
+  for (auto const &digest : digests)
+  {
+    auto it = transaction_store_.find(digest);
+    if (it != transaction_store_.end())
+    {
+      transactions.push_back(it->second);
+    }
+  }
+
+  return transactions;
+}
+
 bool FakeStorageUnit::HasTransaction(ConstByteArray const &digest)
 {
   return transaction_store_.find(digest) != transaction_store_.end();
@@ -46,10 +46,11 @@ public:
 
   /// @name Transaction Interface
   /// @{
-  void AddTransaction(Transaction const &tx) override;
-  bool GetTransaction(Digest const &digest, Transaction &tx) override;
-  bool HasTransaction(Digest const &digest) override;
-  void IssueCallForMissingTxs(DigestSet const &tx_set) override;
+  void         AddTransaction(Transaction const &tx) override;
+  bool         GetTransaction(Digest const &digest, Transaction &tx) override;
+  Transactions GetTransactions(DigestSet const &digests) override;
+  bool         HasTransaction(Digest const &digest) override;
+  void         IssueCallForMissingTxs(DigestSet const &tx_set) override;
   /// @}
 
   /// @name Transaction History Poll
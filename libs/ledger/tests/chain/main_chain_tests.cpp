@@ -16,11 +16,16 @@
 //
 //------------------------------------------------------------------------------
 
+#include "core/bitvector.hpp"
 #include "core/bloom_filter.hpp"
 #include "core/byte_array/byte_array.hpp"
 #include "core/containers/set_difference.hpp"
+#include "crypto/hash.hpp"
+#include "crypto/sha256.hpp"
 #include "ledger/chain/block.hpp"
+#include "ledger/chain/digest.hpp"
 #include "ledger/chain/main_chain.hpp"
+#include "ledger/chain/transaction_layout.hpp"
 #include "ledger/chain/transaction_layout_rpc_serializers.hpp"
 #include "ledger/chain/transaction_rpc_serializers.hpp"
 #include "ledger/testing/block_generator.hpp"
@@ -32,6 +37,7 @@
 #include <memory>
 #include <random>
 #include <sstream>
+#include <string>
 #include <vector>
 
 using namespace fetch;
@@ -41,6 +47,9 @@ using fetch::ledger::MainChain;
 using fetch::ledger::BlockStatus;
 using fetch::ledger::testing::BlockGenerator;
 using fetch::ledger::Address;
+using fetch::ledger::Digest;
+using fetch::ledger::DigestSet;
+using fetch::ledger::TransactionLayout;
 using fetch::byte_array::ToBase64;  // NOLINT - needed for debug messages
 
 using Rng               = std::mt19937_64;
@@ -74,6 +83,25 @@ auto Generate(BlockGeneratorPtr &gen, BlockPtr genesis, std::size_t amount)
   return retVal;
 }
 
+Digest TxDigest(std::size_t index)
+{
+  return crypto::Hash<crypto::SHA256>("transaction " + std::to_string(index));
+}
+
+BlockPtr GenerateWithTransaction(BlockGeneratorPtr &gen, BlockPtr const &from, Digest const &digest,
+                                 uint64_t weight)
+{
+  auto block = gen->Generate(from, weight);
+
+  BitVector mask{1};
+  mask.set(0, 1);
+
+  block->body.slices[0].emplace_back(digest, mask, 1, 0, 1000);
+  block->UpdateDigest();
+
+  return block;
+}
+
 std::ostream &Print(std::ostream &s, fetch::ledger::Digest const &hash)
 {
   s << '#' << std::hex;
@@ -872,6 +900,191 @@ TEST_P(MainChainTests, CheckResolvedLooseWeight)
   ASSERT_EQ(chain_->GetBlock(main5->body.hash)->total_weight, main5->total_weight);
 }
 
+TEST_P(MainChainTests, CheckDuplicateTransactionDetection)
+{
+  static constexpr std::size_t NUM_BLOCKS = 40;
+  static constexpr std::size_t FORK_POINT = 5;
+  static constexpr uint64_t    MAIN_WEIGHT = 2;
+  static constexpr uint64_t    FORK_WEIGHT = 1;
+
+  auto const genesis = generator_->Generate();
+
+  // block i of the main chain contains the transaction i
+  std::vector<BlockPtr> main{genesis};
+  for (std::size_t i = 1; i <= FORK_POINT * 2; ++i)
+  {
+    main.emplace_back(GenerateWithTransaction(generator_, main.back(), TxDigest(i), MAIN_WEIGHT));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main.back()));
+  }
+
+  // a lighter sibling of a main chain block containing a different transaction
+  auto const fork = GenerateWithTransaction(generator_, main[FORK_POINT - 1],
+                                            TxDigest(NUM_BLOCKS + 1), FORK_WEIGHT);
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*fork));
+
+  // only the transactions in the ancestors of the starting block are duplicates
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(
+                fork->body.hash, {TxDigest(1), TxDigest(FORK_POINT), TxDigest(NUM_BLOCKS + 1)}),
+            (DigestSet{TxDigest(1), TxDigest(NUM_BLOCKS + 1)}));
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(
+                main[FORK_POINT]->body.hash,
+                {TxDigest(FORK_POINT), TxDigest(FORK_POINT + 1), TxDigest(NUM_BLOCKS + 1)}),
+            (DigestSet{TxDigest(FORK_POINT)}));
+
+  // extend the main chain far enough for its early blocks to be written to the permanent store
+  for (std::size_t i = main.size(); i <= NUM_BLOCKS; ++i)
+  {
+    main.emplace_back(GenerateWithTransaction(generator_, main.back(), TxDigest(i), MAIN_WEIGHT));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main.back()));
+  }
+
+  DigestSet all{TxDigest(NUM_BLOCKS + 1), TxDigest(NUM_BLOCKS + 2)};
+  DigestSet expected{};
+  for (std::size_t i = 1; i <= NUM_BLOCKS; ++i)
+  {
+    all.insert(TxDigest(i));
+    expected.insert(TxDigest(i));
+  }
+
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(main.back()->body.hash, all), expected);
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(main[1]->body.hash, all),
+            (DigestSet{TxDigest(1)}));
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(main[NUM_BLOCKS / 2]->body.hash,
+                                                {TxDigest(NUM_BLOCKS / 2), TxDigest(NUM_BLOCKS)}),
+            (DigestSet{TxDigest(NUM_BLOCKS / 2)}));
+}
+
+TEST_P(MainChainTests, CheckDuplicateTransactionDetectionAfterStoredReorg)
+{
+  static constexpr std::size_t MAIN_LENGTH = 20;
+  static constexpr std::size_t FORK_POINT  = 5;
+  static constexpr std::size_t FORK_LENGTH = 20;
+  static constexpr std::size_t FORK_OFFSET = 100;
+  static constexpr std::size_t SHARED_TX   = 8;
+
+  auto const genesis = generator_->Generate();
+
+  // block i of the main chain contains the transaction i, the early blocks are written to the store
+  std::vector<BlockPtr> main{genesis};
+  for (std::size_t i = 1; i <= MAIN_LENGTH; ++i)
+  {
+    main.emplace_back(GenerateWithTransaction(generator_, main.back(), TxDigest(i), 1));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main.back()));
+  }
+
+  // a heavier fork replaces the stored part of the main chain above the fork point. Its first
+  // block also contains one of the transactions of the abandoned branch
+  std::vector<BlockPtr> fork{main[FORK_POINT]};
+  for (std::size_t i = 1; i <= FORK_LENGTH; ++i)
+  {
+    auto const digest = (i == 1) ? TxDigest(SHARED_TX) : TxDigest(FORK_OFFSET + i);
+    fork.emplace_back(GenerateWithTransaction(generator_, fork.back(), digest, 10));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*fork.back()));
+  }
+  ASSERT_EQ(chain_->GetHeaviestBlockHash(), fork.back()->body.hash);
+
+  DigestSet const query{TxDigest(1),          TxDigest(FORK_POINT),      TxDigest(FORK_POINT + 1),
+                        TxDigest(SHARED_TX),  TxDigest(MAIN_LENGTH / 2), TxDigest(FORK_OFFSET + 2),
+                        TxDigest(FORK_OFFSET + FORK_LENGTH)};
+
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(fork.back()->body.hash, query),
+            (DigestSet{TxDigest(1), TxDigest(FORK_POINT), TxDigest(SHARED_TX),
+                       TxDigest(FORK_OFFSET + 2), TxDigest(FORK_OFFSET + FORK_LENGTH)}));
+}
+
+TEST_P(MainChainTests, CheckDuplicateTransactionDetectionWithCachedStoredHead)
+{
+  static constexpr std::size_t MAIN_LENGTH = 20;
+  static constexpr std::size_t FORK_POINT  = 5;
+  static constexpr std::size_t FORK_LENGTH = 15;
+  static constexpr std::size_t FORK_OFFSET = 100;
+
+  auto const genesis = generator_->Generate();
+
+  // block i of the main chain contains the transaction i, the early blocks are written to the store
+  std::vector<BlockPtr> main{genesis};
+  for (std::size_t i = 1; i <= MAIN_LENGTH; ++i)
+  {
+    main.emplace_back(GenerateWithTransaction(generator_, main.back(), TxDigest(i), 2));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main.back()));
+  }
+
+  // a lighter fork which only becomes the heaviest chain with its last block. The stored head then
+  // moves over to the fork in a single write, leaving the new stored head (and the blocks below it
+  // on the fork, apart from the lowest) in the cache
+  std::vector<BlockPtr> fork{main[FORK_POINT]};
+  for (std::size_t i = 1; i <= FORK_LENGTH; ++i)
+  {
+    uint64_t const weight = (i == FORK_LENGTH) ? 100 : 1;
+    fork.emplace_back(
+        GenerateWithTransaction(generator_, fork.back(), TxDigest(FORK_OFFSET + i), weight));
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*fork.back()));
+  }
+  ASSERT_EQ(chain_->GetHeaviestBlockHash(), fork.back()->body.hash);
+
+  DigestSet const query{TxDigest(1),
+                        TxDigest(FORK_POINT),
+                        TxDigest(FORK_POINT + 1),
+                        TxDigest(MAIN_LENGTH),
+                        TxDigest(FORK_OFFSET + 1),
+                        TxDigest(FORK_OFFSET + 3),
+                        TxDigest(FORK_OFFSET + FORK_LENGTH),
+                        TxDigest(FORK_OFFSET + FORK_LENGTH + 1)};
+
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(fork.back()->body.hash, query),
+            (DigestSet{TxDigest(1), TxDigest(FORK_POINT), TxDigest(FORK_OFFSET + 1),
+                       TxDigest(FORK_OFFSET + 3), TxDigest(FORK_OFFSET + FORK_LENGTH)}));
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(fork[FORK_LENGTH - 1]->body.hash, query),
+            (DigestSet{TxDigest(1), TxDigest(FORK_POINT), TxDigest(FORK_OFFSET + 1),
+                       TxDigest(FORK_OFFSET + 3)}));
+}
+
+TEST_P(MainChainTests, CheckDuplicateTransactionDetectionInResolvedLooseBlocks)
+{
+  // the bloom filter must also cover the blocks which are attached to the chain after being loose
+  chain_.reset();
+  chain_ = std::make_unique<MainChain>(true, GetParam());
+
+  auto const genesis = generator_->Generate();
+  auto const parent  = GenerateWithTransaction(generator_, genesis, TxDigest(1), 1);
+  auto const child   = GenerateWithTransaction(generator_, parent, TxDigest(2), 1);
+
+  ASSERT_EQ(BlockStatus::LOOSE, chain_->AddBlock(*child));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*parent));
+  ASSERT_EQ(chain_->GetHeaviestBlockHash(), child->body.hash);
+
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(child->body.hash,
+                                                {TxDigest(1), TxDigest(2), TxDigest(3)}),
+            (DigestSet{TxDigest(1), TxDigest(2)}));
+}
+
+TEST(MainChainPersistenceTests, CheckDuplicateTransactionsAreDetectedAfterReload)
+{
+  static constexpr std::size_t NUM_BLOCKS = 40;
+
+  auto generator = std::make_unique<BlockGenerator>(1, 2);
+  auto chain     = std::make_unique<MainChain>(true, MainChain::Mode::CREATE_PERSISTENT_DB);
+
+  BlockPtr previous = generator->Generate();
+  for (std::size_t i = 1; i <= NUM_BLOCKS; ++i)
+  {
+    previous = GenerateWithTransaction(generator, previous, TxDigest(i), 1);
+    ASSERT_EQ(BlockStatus::ADDED, chain->AddBlock(*previous));
+  }
+
+  // restart the chain from the stored blocks (and bloom filter)
+  chain.reset();
+  chain = std::make_unique<MainChain>(true, MainChain::Mode::LOAD_PERSISTENT_DB);
+
+  auto const heaviest = chain->GetHeaviestBlock();
+  ASSERT_GT(heaviest->body.block_number, 1u);
+
+  auto const stored = heaviest->body.block_number;
+  EXPECT_EQ(chain->DetectDuplicateTransactions(
+                heaviest->body.hash, {TxDigest(1), TxDigest(stored), TxDigest(NUM_BLOCKS + 1)}),
+            (DigestSet{TxDigest(1), TxDigest(stored)}));
+}
+
 INSTANTIATE_TEST_CASE_P(ParamBased, MainChainTests,
                         ::testing::Values(MainChain::Mode::CREATE_PERSISTENT_DB,
                                           MainChain::Mode::IN_MEMORY_DB), );
@@ -35,6 +35,8 @@ public:
     using ::testing::Invoke;
 
     ON_CALL(*this, Execute(_)).WillByDefault(Invoke(&fake, &FakeExecutionManager::Execute));
+    ON_CALL(*this, PrefetchTransactions(_))
+        .WillByDefault(Invoke(&fake, &FakeExecutionManager::PrefetchTransactions));
     ON_CALL(*this, SetLastProcessedBlock(_))
         .WillByDefault(Invoke(&fake, &FakeExecutionManager::SetLastProcessedBlock));
     ON_CALL(*this, LastProcessedBlock())
@@ -44,6 +46,7 @@ public:
   }
 
   MOCK_METHOD1(Execute, ScheduleStatus(Block::Body const &));
+  MOCK_METHOD1(PrefetchTransactions, void(Block::Body const &));
   MOCK_METHOD1(SetLastProcessedBlock, void(Digest));
   MOCK_METHOD0(LastProcessedBlock, Digest());
   MOCK_METHOD0(GetState, State());
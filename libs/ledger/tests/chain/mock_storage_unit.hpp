@@ -43,6 +43,8 @@ public:
         .WillByDefault(Invoke(&fake, &FakeStorageUnit::AddTransaction));
     ON_CALL(*this, GetTransaction(_, _))
         .WillByDefault(Invoke(&fake, &FakeStorageUnit::GetTransaction));
+    ON_CALL(*this, GetTransactions(_))
+        .WillByDefault(Invoke(&fake, &FakeStorageUnit::GetTransactions));
     ON_CALL(*this, HasTransaction(_))
         .WillByDefault(Invoke(&fake, &FakeStorageUnit::HasTransaction));
 
@@ -63,6 +65,7 @@ public:
 
   MOCK_METHOD1(AddTransaction, void(Transaction const &));
   MOCK_METHOD2(GetTransaction, bool(Digest const &, Transaction &));
+  MOCK_METHOD1(GetTransactions, Transactions(DigestSet const &));
   MOCK_METHOD1(HasTransaction, bool(Digest const &));
   MOCK_METHOD1(IssueCallForMissingTxs, void(DigestSet const &));
 
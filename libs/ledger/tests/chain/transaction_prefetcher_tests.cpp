@@ -0,0 +1,301 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/bitvector.hpp"
+#include "crypto/ecdsa.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_builder.hpp"
+#include "ledger/chain/transaction_layout.hpp"
+#include "ledger/storage_unit/transaction_prefetcher.hpp"
+#include "mock_storage_unit.hpp"
+#include "storage/resource_mapper.hpp"
+
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::ledger::Address;
+using fetch::ledger::Block;
+using fetch::ledger::Digest;
+using fetch::ledger::DigestSet;
+using fetch::ledger::Transaction;
+using fetch::ledger::TransactionBuilder;
+using fetch::ledger::TransactionLayout;
+using fetch::ledger::TransactionPrefetcher;
+using fetch::storage::ResourceID;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+using MockStorageUnitPtr = std::shared_ptr<NiceMock<MockStorageUnit>>;
+using PrefetcherPtr      = std::unique_ptr<TransactionPrefetcher>;
+using Transactions       = std::vector<Transaction>;
+
+constexpr uint32_t LOG2_NUM_LANES = 2;
+
+class TransactionPrefetcherTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    storage_    = std::make_shared<NiceMock<MockStorageUnit>>();
+    prefetcher_ = std::make_unique<TransactionPrefetcher>(storage_, LOG2_NUM_LANES, 4);
+  }
+
+  void TearDown() override
+  {
+    prefetcher_.reset();
+    storage_.reset();
+  }
+
+  /**
+   * Create a series of (distinct) transactions which are added to the storage
+   */
+  Transactions CreateTransactions(std::size_t count)
+  {
+    Transactions transactions{};
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto const tx = TransactionBuilder()
+                          .From(Address{signer_.identity()})
+                          .ValidUntil(100u + i)
+                          .Signer(signer_.identity())
+                          .Seal()
+                          .Sign(signer_)
+                          .Build();
+
+      storage_->fake.AddTransaction(*tx);
+      transactions.emplace_back(*tx);
+    }
+
+    return transactions;
+  }
+
+  static Block::Body CreateBlock(Transactions const &transactions)
+  {
+    Block::Body body{};
+    body.slices.resize(1);
+
+    for (auto const &tx : transactions)
+    {
+      body.slices[0].emplace_back(tx.digest(), BitVector{}, 0, 0, 0);
+    }
+
+    return body;
+  }
+
+  static uint32_t LaneOf(Digest const &digest)
+  {
+    return ResourceID{digest}.lane(LOG2_NUM_LANES);
+  }
+
+  static std::size_t CountLanes(Transactions const &transactions)
+  {
+    std::set<uint32_t> lanes{};
+    for (auto const &tx : transactions)
+    {
+      lanes.insert(LaneOf(tx.digest()));
+    }
+
+    return lanes.size();
+  }
+
+  fetch::crypto::ECDSASigner signer_;
+  MockStorageUnitPtr         storage_;
+  PrefetcherPtr              prefetcher_;
+};
+
+TEST_F(TransactionPrefetcherTests, TransactionsAreLoadedInBulk)
+{
+  auto const transactions = CreateTransactions(3);
+
+  // a single request is made for each of the lanes involved
+  EXPECT_CALL(*storage_, GetTransactions(_)).Times(static_cast<int>(CountLanes(transactions)));
+  EXPECT_CALL(*storage_, GetTransaction(_, _)).Times(0);
+
+  prefetcher_->Prefetch(CreateBlock(transactions));
+
+  for (auto const &expected : transactions)
+  {
+    Transaction tx{};
+    ASSERT_TRUE(prefetcher_->Lookup(expected.digest(), tx));
+    EXPECT_EQ(expected.digest(), tx.digest());
+  }
+
+  // each of the transactions is only handed out once
+  EXPECT_EQ(0u, prefetcher_->size());
+
+  Transaction tx{};
+  EXPECT_FALSE(prefetcher_->Lookup(transactions.front().digest(), tx));
+}
+
+TEST_F(TransactionPrefetcherTests, RepeatedPrefetchIsIgnored)
+{
+  auto const transactions = CreateTransactions(2);
+
+  EXPECT_CALL(*storage_, GetTransactions(_)).Times(static_cast<int>(CountLanes(transactions)));
+
+  prefetcher_->Prefetch(CreateBlock(transactions));
+  prefetcher_->Prefetch(CreateBlock(transactions));
+
+  Transaction tx{};
+  for (auto const &expected : transactions)
+  {
+    EXPECT_TRUE(prefetcher_->Lookup(expected.digest(), tx));
+  }
+  EXPECT_EQ(0u, prefetcher_->size());
+}
+
+TEST_F(TransactionPrefetcherTests, MissingTransactionsAreNotCached)
+{
+  auto const transactions = CreateTransactions(2);
+
+  // the first transaction is not known to the storage
+  storage_->fake.Reset();
+  storage_->fake.AddTransaction(transactions.back());
+
+  prefetcher_->Prefetch(CreateBlock(transactions));
+
+  Transaction tx{};
+  EXPECT_FALSE(prefetcher_->Lookup(transactions.front().digest(), tx));
+  EXPECT_TRUE(prefetcher_->Lookup(transactions.back().digest(), tx));
+}
+
+TEST_F(TransactionPrefetcherTests, CacheIsBounded)
+{
+  auto const transactions = CreateTransactions(6);
+
+  Transactions const first{transactions.begin(), transactions.begin() + 4};
+  Transactions const second{transactions.begin() + 4, transactions.end()};
+
+  // a single lane so that each block is loaded by one request
+  prefetcher_ = std::make_unique<TransactionPrefetcher>(storage_, 0, 4);
+  prefetcher_->Prefetch(CreateBlock(first));
+
+  Transaction tx{};
+  ASSERT_TRUE(prefetcher_->Lookup(first.front().digest(), tx));
+  EXPECT_EQ(3u, prefetcher_->size());
+
+  // the remaining transactions of the first block are discarded to make room for the second
+  prefetcher_->Prefetch(CreateBlock(second));
+
+  for (auto const &expected : second)
+  {
+    EXPECT_TRUE(prefetcher_->Lookup(expected.digest(), tx));
+  }
+  EXPECT_EQ(0u, prefetcher_->size());
+}
+
+TEST_F(TransactionPrefetcherTests, OldestBlockIsEvictedFirst)
+{
+  auto const transactions = CreateTransactions(6);
+
+  Transactions const first{transactions.begin(), transactions.begin() + 2};
+  Transactions const second{transactions.begin() + 2, transactions.begin() + 4};
+  Transactions const third{transactions.begin() + 4, transactions.end()};
+
+  prefetcher_->Prefetch(CreateBlock(first));
+  prefetcher_->Prefetch(CreateBlock(second));
+
+  // only the transactions of the first block are discarded to make room for the third
+  prefetcher_->Prefetch(CreateBlock(third));
+
+  Transaction tx{};
+  for (auto const &expected : first)
+  {
+    EXPECT_FALSE(prefetcher_->Lookup(expected.digest(), tx));
+  }
+  for (auto const &expected : second)
+  {
+    EXPECT_TRUE(prefetcher_->Lookup(expected.digest(), tx));
+  }
+  for (auto const &expected : third)
+  {
+    EXPECT_TRUE(prefetcher_->Lookup(expected.digest(), tx));
+  }
+  EXPECT_EQ(0u, prefetcher_->size());
+}
+
+TEST_F(TransactionPrefetcherTests, BlockIsPrefetchedUpToTheLimit)
+{
+  auto const transactions = CreateTransactions(6);
+
+  prefetcher_->Prefetch(CreateBlock(transactions));
+
+  Transaction tx{};
+  for (std::size_t i = 0; i < transactions.size(); ++i)
+  {
+    EXPECT_EQ(i < 4, prefetcher_->Lookup(transactions[i].digest(), tx));
+  }
+  EXPECT_EQ(0u, prefetcher_->size());
+}
+
+TEST_F(TransactionPrefetcherTests, SlowLaneDoesNotDelayOtherLanes)
+{
+  // with enough transactions they are spread over more than one lane
+  auto const transactions = CreateTransactions(16);
+  ASSERT_GT(CountLanes(transactions), 1u);
+
+  auto const &slow = transactions.front();
+  auto const  fast = std::find_if(transactions.begin(), transactions.end(),
+                                 [&slow](Transaction const &tx) {
+                                   return LaneOf(tx.digest()) != LaneOf(slow.digest());
+                                 });
+  ASSERT_NE(transactions.end(), fast);
+
+  // the response from the lane of the first transaction is held back until the end of the test
+  Digest const             slow_digest = slow.digest();
+  std::promise<void>       release{};
+  std::shared_future<void> released{release.get_future().share()};
+
+  ON_CALL(*storage_, GetTransactions(_))
+      .WillByDefault(Invoke([this, slow_digest, released](DigestSet const &digests) {
+        if (digests.find(slow_digest) != digests.end())
+        {
+          released.wait();
+        }
+
+        return storage_->fake.GetTransactions(digests);
+      }));
+
+  prefetcher_ = std::make_unique<TransactionPrefetcher>(storage_, LOG2_NUM_LANES, 100);
+  prefetcher_->Prefetch(CreateBlock(transactions));
+
+  Transaction tx{};
+  EXPECT_TRUE(prefetcher_->Lookup(fast->digest(), tx));
+  EXPECT_EQ(fast->digest(), tx.digest());
+
+  // the lookup gives up on the slow lane rather than waiting for it
+  EXPECT_FALSE(prefetcher_->Lookup(slow.digest(), tx));
+
+  release.set_value();
+}
+
+}  // namespace
@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "crypto/ecdsa.hpp"
+#include "crypto/ecdsa_batch_verifier.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_builder.hpp"
+#include "ledger/chain/transaction_serializer.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::crypto::ECDSABatchVerifier;
+using fetch::crypto::ECDSASigner;
+using fetch::ledger::Address;
+using fetch::ledger::Transaction;
+using fetch::ledger::TransactionBuilder;
+using fetch::ledger::TransactionSerializer;
+
+using TransactionPtr  = std::shared_ptr<Transaction>;
+using TransactionList = std::vector<TransactionPtr>;
+
+class TransactionVerifyBatchTests : public ::testing::Test
+{
+protected:
+  TransactionPtr CreateTransaction(std::size_t index, std::size_t num_signers)
+  {
+    TransactionBuilder builder{};
+    builder.From(Address{signers_[index % signers_.size()].identity()})
+        .Transfer(Address{signers_[(index + 1) % signers_.size()].identity()}, index + 1);
+
+    for (std::size_t i = 0; i < num_signers; ++i)
+    {
+      builder.Signer(signers_[(index + i) % signers_.size()].identity());
+    }
+
+    auto sealer = builder.Seal();
+    for (std::size_t i = 0; i < num_signers; ++i)
+    {
+      sealer.Sign(signers_[(index + i) % signers_.size()]);
+    }
+
+    return sealer.Build();
+  }
+
+  /**
+   * Create a copy of the transaction where the final signature has been corrupted
+   */
+  static TransactionPtr Corrupt(Transaction const &tx)
+  {
+    TransactionSerializer serializer{};
+    serializer << tx;
+
+    ByteArray data = serializer.data().Copy();
+    data[data.size() - 1] ^= 0x01;
+
+    auto output = std::make_shared<Transaction>();
+
+    TransactionSerializer deserializer{data};
+    deserializer >> *output;
+
+    return output;
+  }
+
+  /**
+   * Create an unverified copy of the transaction
+   */
+  static TransactionPtr Copy(Transaction const &tx)
+  {
+    TransactionSerializer serializer{};
+    serializer << tx;
+
+    auto output = std::make_shared<Transaction>();
+    serializer >> *output;
+
+    return output;
+  }
+
+  std::vector<ECDSASigner> signers_{5};
+};
+
+TEST_F(TransactionVerifyBatchTests, ResultsMatchIndividualVerification)
+{
+  TransactionList batch{};
+  TransactionList individual{};
+
+  for (std::size_t i = 0; i < 20; ++i)
+  {
+    auto tx = CreateTransaction(i, 1u + (i % 3u));
+    ASSERT_TRUE(static_cast<bool>(tx));
+
+    if ((i % 4) == 0)
+    {
+      tx = Corrupt(*tx);
+    }
+
+    batch.emplace_back(Copy(*tx));
+    individual.emplace_back(Copy(*tx));
+  }
+
+  ECDSABatchVerifier verifier{};
+  Transaction::VerifyBatch(batch, verifier);
+
+  for (std::size_t i = 0; i < batch.size(); ++i)
+  {
+    EXPECT_EQ(batch[i]->IsVerified(), individual[i]->Verify());
+    EXPECT_EQ(batch[i]->IsVerified(), (i % 4) != 0);
+
+    // the cached result is used from now on
+    EXPECT_EQ(batch[i]->Verify(), batch[i]->IsVerified());
+  }
+}
+
+TEST_F(TransactionVerifyBatchTests, PreviouslyVerifiedTransactionsAreSkipped)
+{
+  auto const verified = CreateTransaction(0, 2);
+  auto const pending  = Copy(*verified);
+
+  ASSERT_TRUE(verified->Verify());
+
+  ECDSABatchVerifier verifier{};
+  Transaction::VerifyBatch({verified, pending}, verifier);
+
+  EXPECT_TRUE(verified->IsVerified());
+  EXPECT_TRUE(pending->IsVerified());
+  EXPECT_EQ(verifier.size(), 0u);
+}
+
+}  // namespace
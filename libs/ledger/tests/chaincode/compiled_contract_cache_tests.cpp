@@ -0,0 +1,209 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "ledger/chaincode/compiled_contract_cache.hpp"
+#include "vm/generator.hpp"
+#include "vm/module.hpp"
+#include "vm_modules/vm_factory.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace {
+
+using fetch::byte_array::ConstByteArray;
+using fetch::ledger::CompiledContractCache;
+using fetch::vm::Executable;
+using fetch::vm_modules::VMFactory;
+
+using ExecutablePtr = std::shared_ptr<Executable>;
+
+char const *CONTRACT_SOURCE = R"(
+  @action
+  function increment(value : Int32) : Int32
+    var result = value + 1i32;
+    if (result > 10i32)
+      printLn("big value: " + toString(result));
+    endif
+    return result;
+  endfunction
+
+  @query
+  function ratio() : Float64
+    return 1.5;
+  endfunction
+)";
+
+ExecutablePtr Compile(std::string const &source)
+{
+  auto module     = VMFactory::GetModule(VMFactory::USE_SMART_CONTRACTS);
+  auto executable = std::make_shared<Executable>();
+
+  auto const errors = VMFactory::Compile(module, source, *executable);
+  EXPECT_TRUE(errors.empty());
+
+  return executable;
+}
+
+TEST(CompiledContractCacheTests, CheckLookupAndEviction)
+{
+  auto const executable = Compile(CONTRACT_SOURCE);
+  auto const entry_size = CompiledContractCache::EstimateSize(*executable);
+
+  // allow room for two entries only
+  CompiledContractCache cache{(2 * entry_size) + 1};
+
+  ConstByteArray const a{"a"};
+  ConstByteArray const b{"b"};
+  ConstByteArray const c{"c"};
+
+  EXPECT_EQ(nullptr, cache.Lookup(a));
+  EXPECT_EQ(1u, cache.misses());
+
+  cache.Add(a, executable, nullptr);
+  cache.Add(b, executable, nullptr);
+  EXPECT_EQ(2u, cache.num_entries());
+
+  // touch the first entry so that the second one becomes the least recently used
+  ASSERT_NE(nullptr, cache.Lookup(a));
+  EXPECT_EQ(1u, cache.hits());
+
+  cache.Add(c, executable, nullptr);
+  EXPECT_EQ(2u, cache.num_entries());
+  EXPECT_NE(nullptr, cache.Lookup(a));
+  EXPECT_EQ(nullptr, cache.Lookup(b));
+  EXPECT_NE(nullptr, cache.Lookup(c));
+
+  // shrinking the cache should always retain the most recently used entry
+  cache.SetMaxSize(0);
+  EXPECT_EQ(1u, cache.num_entries());
+  EXPECT_NE(nullptr, cache.Lookup(c));
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.num_entries());
+  EXPECT_EQ(0u, cache.size());
+}
+
+TEST(CompiledContractCacheTests, CheckDuplicateAddReturnsExistingEntry)
+{
+  CompiledContractCache cache{};
+
+  ConstByteArray const digest{"digest"};
+
+  auto const first  = cache.Add(digest, Compile(CONTRACT_SOURCE), nullptr);
+  auto const second = cache.Add(digest, Compile(CONTRACT_SOURCE), nullptr);
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(1u, cache.num_entries());
+}
+
+TEST(CompiledContractCacheTests, CheckPersistenceRoundTrip)
+{
+  CompiledContractCache cache{};
+
+  ConstByteArray const digest{"\x01\x02\x03\x04"};
+  auto const           original = Compile(CONTRACT_SOURCE);
+
+  // persistence is disabled by default
+  EXPECT_FALSE(cache.StoreExecutable(digest, *original));
+
+  std::string const prefix = "compiled_contract_cache_tests_";
+  cache.EnablePersistence(prefix);
+
+  ASSERT_TRUE(cache.StoreExecutable(digest, *original));
+
+  Executable loaded{};
+  ASSERT_TRUE(cache.LoadExecutable(digest, loaded));
+
+  EXPECT_EQ(original->name, loaded.name);
+  EXPECT_EQ(original->strings, loaded.strings);
+  ASSERT_EQ(original->constants.size(), loaded.constants.size());
+  for (std::size_t i = 0; i < original->constants.size(); ++i)
+  {
+    EXPECT_EQ(original->constants[i].type_id, loaded.constants[i].type_id);
+    EXPECT_EQ(original->constants[i].primitive.ui64, loaded.constants[i].primitive.ui64);
+  }
+
+  ASSERT_EQ(original->types.size(), loaded.types.size());
+  for (std::size_t i = 0; i < original->types.size(); ++i)
+  {
+    EXPECT_EQ(original->types[i].name, loaded.types[i].name);
+    EXPECT_EQ(original->types[i].parameter_type_ids, loaded.types[i].parameter_type_ids);
+  }
+
+  ASSERT_EQ(original->functions.size(), loaded.functions.size());
+  for (std::size_t i = 0; i < original->functions.size(); ++i)
+  {
+    auto const &expected = original->functions[i];
+    auto const &actual   = loaded.functions[i];
+
+    EXPECT_EQ(expected.name, actual.name);
+    EXPECT_EQ(expected.annotations.size(), actual.annotations.size());
+    EXPECT_EQ(expected.num_variables, actual.num_variables);
+    EXPECT_EQ(expected.num_parameters, actual.num_parameters);
+    EXPECT_EQ(expected.return_type_id, actual.return_type_id);
+    EXPECT_EQ(expected.pc_to_line_map_, actual.pc_to_line_map_);
+
+    ASSERT_EQ(expected.instructions.size(), actual.instructions.size());
+    for (std::size_t pc = 0; pc < expected.instructions.size(); ++pc)
+    {
+      EXPECT_EQ(expected.instructions[pc].opcode, actual.instructions[pc].opcode);
+      EXPECT_EQ(expected.instructions[pc].type_id, actual.instructions[pc].type_id);
+      EXPECT_EQ(expected.instructions[pc].index, actual.instructions[pc].index);
+      EXPECT_EQ(expected.instructions[pc].data, actual.instructions[pc].data);
+    }
+
+    ASSERT_NE(nullptr, loaded.FindFunction(expected.name));
+  }
+
+  std::remove((prefix + std::string{digest.ToHex()} + ".etch.bin").c_str());
+}
+
+TEST(CompiledContractCacheTests, CheckNonPrimitiveConstantsAreNotPersisted)
+{
+  CompiledContractCache cache{};
+
+  std::string const prefix = "compiled_contract_cache_tests_object_";
+  cache.EnablePersistence(prefix);
+
+  // object constants can not be stored as raw values
+  auto executable = Compile(CONTRACT_SOURCE);
+  executable->constants.emplace_back(fetch::vm::Ptr<fetch::vm::Object>{},
+                                     fetch::vm::TypeIds::String);
+
+  ConstByteArray const digest{"\x05\x06\x07\x08"};
+  EXPECT_FALSE(cache.StoreExecutable(digest, *executable));
+
+  Executable loaded{};
+  EXPECT_FALSE(cache.LoadExecutable(digest, loaded));
+}
+
+TEST(CompiledContractCacheTests, CheckMissingExecutableIsNotLoaded)
+{
+  CompiledContractCache cache{};
+  cache.EnablePersistence("compiled_contract_cache_tests_missing_");
+
+  Executable executable{};
+  EXPECT_FALSE(cache.LoadExecutable(ConstByteArray{"unknown"}, executable));
+}
+
+}  // namespace
@@ -140,6 +140,23 @@ public:
     return success;
   }
 
+  Transactions GetTransactions(fetch::ledger::DigestSet const &digests) override
+  {
+    lock_guard_type lock(mutex_);
+    Transactions    transactions{};
+
+    for (auto const &digest : digests)
+    {
+      auto it = transactions_.find(digest);
+      if (it != transactions_.end())
+      {
+        transactions.push_back(it->second);
+      }
+    }
+
+    return transactions;
+  }
+
   bool HasTransaction(ConstByteArray const &digest) override
   {
     lock_guard_type lock(mutex_);
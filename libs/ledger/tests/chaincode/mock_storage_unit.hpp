@@ -47,6 +47,8 @@ public:
         .WillByDefault(Invoke(&fake_, &FakeStorageUnit::AddTransaction));
     ON_CALL(*this, GetTransaction(_, _))
         .WillByDefault(Invoke(&fake_, &FakeStorageUnit::GetTransaction));
+    ON_CALL(*this, GetTransactions(_))
+        .WillByDefault(Invoke(&fake_, &FakeStorageUnit::GetTransactions));
     ON_CALL(*this, PollRecentTx(_)).WillByDefault(Invoke(&fake_, &FakeStorageUnit::PollRecentTx));
   }
 
@@ -64,6 +66,7 @@ public:
 
   MOCK_METHOD1(AddTransaction, void(fetch::ledger::Transaction const &));
   MOCK_METHOD2(GetTransaction, bool(fetch::ledger::Digest const &, fetch::ledger::Transaction &));
+  MOCK_METHOD1(GetTransactions, Transactions(fetch::ledger::DigestSet const &));
   MOCK_METHOD1(HasTransaction, bool(fetch::byte_array::ConstByteArray const &));
   MOCK_METHOD1(IssueCallForMissingTxs, void(fetch::ledger::DigestSet const &));
 
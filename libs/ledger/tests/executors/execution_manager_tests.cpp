@@ -130,28 +130,33 @@ protected:
       return a.timestamp < b.timestamp;
     });
 
-    // Step 3. Check that the start time
+    // Step 3. Check that on every lane, the transactions were started in slice order. Transactions
+    //         which do not share lanes are free to be executed in any order
     if (!history.empty())
     {
-      std::size_t current_slice = 0;
+      std::vector<std::size_t> lane_slices(history.front().shards.size(), 0);
 
       success = true;
-      for (std::size_t i = 1; i < history.size(); ++i)
+      for (auto const &current : history)
       {
-        auto const &current = history[i];
-
-        if (current.slice == current_slice)
-        {
-          continue;  // same slice
-        }
-        else if (current.slice > current_slice)
+        for (std::size_t lane = 0; lane < lane_slices.size(); ++lane)
         {
-          current_slice = current.slice;
-          continue;  // next slice
+          if (!current.shards.bit(lane))
+          {
+            continue;
+          }
+
+          if (current.slice < lane_slices[lane])
+          {
+            success = false;
+            break;
+          }
+
+          lane_slices[lane] = current.slice;
         }
-        else
+
+        if (!success)
         {
-          success = false;
           break;
         }
       }
@@ -0,0 +1,241 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/bitvector.hpp"
+#include "crypto/ecdsa.hpp"
+#include "fake_storage_unit.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/transaction_builder.hpp"
+#include "ledger/chaincode/token_contract.hpp"
+#include "ledger/executor.hpp"
+#include "ledger/identifier.hpp"
+#include "ledger/state_sentinel_adapter.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::crypto::ECDSASigner;
+using fetch::ledger::Address;
+using fetch::ledger::Executor;
+using fetch::ledger::Identifier;
+using fetch::ledger::StateSentinelAdapter;
+using fetch::ledger::TokenContract;
+using fetch::ledger::Transaction;
+using fetch::ledger::TransactionBuilder;
+
+using TransactionPtr = TransactionBuilder::TransactionPtr;
+using Status         = Executor::Status;
+using Transfers      = std::vector<std::pair<Address, uint64_t>>;
+
+constexpr uint32_t LOG2_NUM_LANES = 2;
+constexpr uint64_t BLOCK_INDEX    = 10;
+
+struct Entity
+{
+  ECDSASigner signer{};
+  Address     address{signer.identity()};
+};
+
+/**
+ * A storage unit and executor pair, one of which uses the transfer fast path and one of which
+ * does not
+ */
+struct Node
+{
+  explicit Node(bool fast_path)
+  {
+    executor.EnableTransferFastPath(fast_path);
+  }
+
+  std::shared_ptr<FakeStorageUnit> storage{std::make_shared<FakeStorageUnit>()};
+  Executor                         executor{storage, nullptr};
+};
+
+class ExecutorTransferTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    shards_.SetAllOne();
+  }
+
+  void AddTokens(Address const &address, uint64_t amount)
+  {
+    for (auto *node : {&fast_, &generic_})
+    {
+      StateSentinelAdapter adapter{*node->storage, Identifier{"fetch.token"}, shards_};
+
+      TokenContract tokens{};
+      tokens.Attach(adapter);
+      tokens.AddTokens(address, amount);
+      tokens.Detach();
+    }
+  }
+
+  uint64_t GetBalance(FakeStorageUnit &storage, Address const &address)
+  {
+    StateSentinelAdapter adapter{storage, Identifier{"fetch.token"}, shards_};
+
+    TokenContract tokens{};
+    tokens.Attach(adapter);
+    uint64_t const balance = tokens.GetBalance(address);
+    tokens.Detach();
+
+    return balance;
+  }
+
+  static TransactionPtr CreateTransaction(Entity const &from, Transfers const &transfers,
+                                          Entity const &signer, uint64_t valid_until = 100)
+  {
+    TransactionBuilder builder{};
+    builder.From(from.address).ValidUntil(valid_until).ChargeRate(2).ChargeLimit(10);
+
+    for (auto const &transfer : transfers)
+    {
+      builder.Transfer(transfer.first, transfer.second);
+    }
+
+    return builder.Signer(signer.signer.identity()).Seal().Sign(signer.signer).Build();
+  }
+
+  /**
+   * Execute the transaction on both paths, checking that the result and the resulting state are
+   * identical
+   */
+  Status Execute(TransactionPtr const &tx)
+  {
+    fast_.storage->AddTransaction(*tx);
+    generic_.storage->AddTransaction(*tx);
+
+    auto const fast    = fast_.executor.Execute(tx->digest(), BLOCK_INDEX, 0, shards_);
+    auto const generic = generic_.executor.Execute(tx->digest(), BLOCK_INDEX, 0, shards_);
+
+    EXPECT_EQ(fast.status, generic.status);
+    EXPECT_EQ(fast.charge, generic.charge);
+    EXPECT_EQ(fast.charge_rate, generic.charge_rate);
+    EXPECT_EQ(fast.fee, generic.fee);
+
+    EXPECT_EQ(fast_.storage->KeyDump().size(), generic_.storage->KeyDump().size());
+    for (auto const &entity : entities_)
+    {
+      EXPECT_EQ(GetBalance(*fast_.storage, entity.address),
+                GetBalance(*generic_.storage, entity.address));
+    }
+
+    return fast.status;
+  }
+
+  std::vector<Entity> entities_{4};
+  BitVector           shards_{1u << LOG2_NUM_LANES};
+  Node                fast_{true};
+  Node                generic_{false};
+};
+
+TEST_F(ExecutorTransferTests, SingleTransfer)
+{
+  auto const &from = entities_[0];
+  AddTokens(from.address, 1000);
+
+  auto const tx = CreateTransaction(from, {{entities_[1].address, 200}}, from);
+
+  EXPECT_EQ(Execute(tx), Status::SUCCESS);
+  EXPECT_EQ(GetBalance(*fast_.storage, from.address), 1000u - 200u - 2u);
+  EXPECT_EQ(GetBalance(*fast_.storage, entities_[1].address), 200u);
+}
+
+TEST_F(ExecutorTransferTests, MultipleTransfersIncludingToSelf)
+{
+  auto const &from = entities_[0];
+  AddTokens(from.address, 1000);
+  AddTokens(entities_[2].address, 50);
+
+  auto const tx = CreateTransaction(from,
+                                    {{entities_[1].address, 100},
+                                     {from.address, 300},
+                                     {entities_[2].address, 25},
+                                     {entities_[1].address, 5}},
+                                    from);
+
+  EXPECT_EQ(Execute(tx), Status::SUCCESS);
+}
+
+TEST_F(ExecutorTransferTests, InsufficientFunds)
+{
+  auto const &from = entities_[0];
+  AddTokens(from.address, 205);
+
+  auto const tx = CreateTransaction(from, {{entities_[1].address, 200}}, from);
+
+  EXPECT_EQ(Execute(tx), Status::INSUFFICIENT_AVAILABLE_FUNDS);
+}
+
+TEST_F(ExecutorTransferTests, NotValidForBlock)
+{
+  auto const &from = entities_[0];
+  AddTokens(from.address, 1000);
+
+  auto const tx = CreateTransaction(from, {{entities_[1].address, 200}}, from, BLOCK_INDEX - 1);
+
+  EXPECT_EQ(Execute(tx), Status::TX_NOT_VALID_FOR_BLOCK);
+}
+
+TEST_F(ExecutorTransferTests, NotSignedByOriginator)
+{
+  auto const &from  = entities_[0];
+  auto const &other = entities_[3];
+  AddTokens(from.address, 1000);
+
+  auto const tx = CreateTransaction(from, {{entities_[1].address, 200}}, other);
+
+  EXPECT_EQ(Execute(tx), Status::TRANSFER_FAILURE);
+}
+
+TEST_F(ExecutorTransferTests, RecipientOverflow)
+{
+  auto const &from = entities_[0];
+  AddTokens(from.address, 1000);
+  AddTokens(entities_[1].address, std::numeric_limits<uint64_t>::max() - 10);
+
+  auto const tx =
+      CreateTransaction(from, {{entities_[2].address, 5}, {entities_[1].address, 20}}, from);
+
+  EXPECT_EQ(Execute(tx), Status::TRANSFER_FAILURE);
+}
+
+TEST_F(ExecutorTransferTests, ConsecutiveTransactions)
+{
+  auto const &from = entities_[0];
+  AddTokens(from.address, 1000);
+
+  for (uint64_t amount = 100; amount <= 500; amount += 100)
+  {
+    auto const tx = CreateTransaction(from, {{entities_[amount % 3 + 1].address, amount}}, from);
+
+    Execute(tx);
+  }
+}
+
+}  // namespace
@@ -100,7 +100,7 @@ struct TestBlock
             fetch::BitVector mask{num_lanes};
             for (std::size_t i = 0; i < consumed_lanes; ++i)
             {
-              mask.set(i, 1);
+              mask.set(lane_offset + i, 1);
             }
 
             // create the transaction summary
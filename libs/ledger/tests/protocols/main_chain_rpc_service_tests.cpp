@@ -0,0 +1,309 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/service_ids.hpp"
+#include "crypto/ecdsa.hpp"
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/consensus/dummy_miner.hpp"
+#include "ledger/chain/main_chain.hpp"
+#include "ledger/chain/transaction_layout_rpc_serializers.hpp"
+#include "ledger/protocols/main_chain_rpc_protocol.hpp"
+#include "ledger/protocols/main_chain_rpc_service.hpp"
+#include "ledger/testing/block_generator.hpp"
+#include "network/management/network_manager.hpp"
+#include "network/muddle/muddle.hpp"
+#include "network/muddle/rpc/server.hpp"
+#include "network/p2pservice/p2ptrust_bayrank.hpp"
+#include "network/service/protocol.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::CHANNEL_RPC;
+using fetch::RPC_MAIN_CHAIN;
+using fetch::SERVICE_MAIN_CHAIN;
+using fetch::ledger::Digest;
+using fetch::ledger::MainChain;
+using fetch::ledger::MainChainProtocol;
+using fetch::ledger::MainChainRpcService;
+using fetch::ledger::consensus::DummyMiner;
+using fetch::ledger::testing::BlockGenerator;
+using fetch::muddle::Muddle;
+using fetch::muddle::NetworkId;
+using fetch::network::NetworkManager;
+
+using std::this_thread::sleep_for;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+using Clock       = std::chrono::steady_clock;
+using BlockPtr    = BlockGenerator::BlockPtr;
+using Address     = MainChainRpcService::Address;
+using TrustSystem = fetch::p2p::P2PTrustBayRank<Address>;
+using RpcServer   = fetch::muddle::rpc::Server;
+
+/**
+ * The main chain protocol of the previous release, which lacks the calls for the chain hashes and
+ * chain segments
+ */
+class LegacyMainChainProtocol : public fetch::service::Protocol
+{
+public:
+  using Blocks = MainChainProtocol::Blocks;
+
+  explicit LegacyMainChainProtocol(MainChain &chain)
+    : chain_(chain)
+  {
+    Expose(MainChainProtocol::COMMON_SUB_CHAIN, this, &LegacyMainChainProtocol::GetCommonSubChain);
+  }
+
+  std::size_t sub_chain_requests() const
+  {
+    return sub_chain_requests_;
+  }
+
+private:
+  Blocks GetCommonSubChain(Digest const &start, Digest const &last_seen, uint64_t limit)
+  {
+    ++sub_chain_requests_;
+
+    MainChain::Blocks blocks;
+    if (!chain_.GetPathToCommonAncestor(blocks, start, last_seen, limit))
+    {
+      blocks.clear();
+    }
+
+    Blocks output{};
+    for (auto const &block : blocks)
+    {
+      output.emplace_back(*block);
+    }
+
+    return output;
+  }
+
+  MainChain &              chain_;
+  std::atomic<std::size_t> sub_chain_requests_{0};
+};
+
+class MainChainRpcServiceTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    manager_ = std::make_unique<NetworkManager>("NetMgr", 2);
+    manager_->Start();
+
+    legacy_network_ = std::make_shared<Muddle>(
+        NetworkId{"Test"}, std::make_unique<fetch::crypto::ECDSASigner>(), *manager_);
+    network_ = std::make_shared<Muddle>(
+        NetworkId{"Test"}, std::make_unique<fetch::crypto::ECDSASigner>(), *manager_);
+
+    // the listening ports are assigned by the operating system, so that the test does not collide
+    // with any others which are running at the same time
+    legacy_network_->Start({0});
+    network_->Start({0}, {LocalUri(*legacy_network_)});
+  }
+
+  void TearDown() override
+  {
+    for (auto &peer_network : peer_networks_)
+    {
+      peer_network->Stop();
+    }
+    network_->Stop();
+    legacy_network_->Stop();
+    manager_->Stop();
+  }
+
+  /**
+   * Build the URI for connecting to the (first) listening port of a local network
+   */
+  static Muddle::Uri LocalUri(Muddle const &network)
+  {
+    return Muddle::Uri{"tcp://127.0.0.1:" + std::to_string(network.GetListeningPorts().at(0))};
+  }
+
+  /**
+   * Start a further peer which connects to the network of the service
+   */
+  Muddle &AddPeerNetwork()
+  {
+    auto peer_network = std::make_shared<Muddle>(
+        NetworkId{"Test"}, std::make_unique<fetch::crypto::ECDSASigner>(), *manager_);
+    peer_network->Start({}, {LocalUri(*network_)});
+
+    peer_networks_.emplace_back(peer_network);
+
+    return *peer_network;
+  }
+
+  /**
+   * Generate a chain of (valid) blocks on top of the genesis block
+   */
+  static std::vector<BlockPtr> GenerateChain(std::size_t length)
+  {
+    BlockGenerator generator{1, 1};
+    DummyMiner     miner{};
+
+    std::vector<BlockPtr> blocks{generator()};
+    for (std::size_t i = 0; i < length; ++i)
+    {
+      auto block = generator(blocks.back());
+      block->proof.SetTarget(1);
+      miner.Mine(*block);
+
+      blocks.emplace_back(std::move(block));
+    }
+
+    return blocks;
+  }
+
+  /**
+   * Run the state machine of the service until the condition is met or the timeout expires
+   */
+  template <typename Condition>
+  static bool RunUntil(MainChainRpcService &service, Condition &&condition)
+  {
+    auto const state_machine = service.GetWeakRunnable().lock();
+    auto const deadline      = Clock::now() + seconds{30};
+
+    while (!condition())
+    {
+      if (Clock::now() >= deadline)
+      {
+        return false;
+      }
+
+      if (state_machine->IsReadyToExecute())
+      {
+        state_machine->Execute();
+      }
+
+      sleep_for(milliseconds{10});
+    }
+
+    return true;
+  }
+
+  std::unique_ptr<NetworkManager>      manager_;
+  std::shared_ptr<Muddle>              legacy_network_;
+  std::shared_ptr<Muddle>              network_;
+  std::vector<std::shared_ptr<Muddle>> peer_networks_;
+};
+
+TEST_F(MainChainRpcServiceTests, SynchronisesFromPeerOfThePreviousRelease)
+{
+  auto const blocks = GenerateChain(20);
+
+  // the peer running the previous release holds the full chain
+  MainChain               legacy_chain{};
+  LegacyMainChainProtocol legacy_protocol{legacy_chain};
+
+  RpcServer legacy_server{legacy_network_->AsEndpoint(), SERVICE_MAIN_CHAIN, CHANNEL_RPC};
+  legacy_server.Add(RPC_MAIN_CHAIN, &legacy_protocol);
+
+  for (std::size_t i = 1; i < blocks.size(); ++i)
+  {
+    ASSERT_EQ(fetch::ledger::BlockStatus::ADDED, legacy_chain.AddBlock(*blocks[i]));
+  }
+
+  MainChain   chain{};
+  TrustSystem trust{};
+  auto        service = std::make_shared<MainChainRpcService>(
+      network_->AsEndpoint(), chain, trust, MainChainRpcService::Mode::STANDALONE);
+
+  ASSERT_TRUE(RunUntil(*service, [this]() {
+    return !network_->AsEndpoint().GetDirectlyConnectedPeers().empty();
+  }));
+
+  // learning only of the most recent block leaves the rest of the chain to be synchronised
+  ASSERT_EQ(fetch::ledger::BlockStatus::LOOSE, chain.AddBlock(*blocks.back()));
+
+  // the request for the chain hashes fails, after which the chain itself is requested
+  EXPECT_TRUE(RunUntil(*service, [&chain, &blocks]() {
+    return chain.GetHeaviestBlockHash() == blocks.back()->body.hash;
+  }));
+  EXPECT_EQ(1u, legacy_protocol.sub_chain_requests());
+  EXPECT_FALSE(chain.HasMissingBlocks());
+}
+
+TEST_F(MainChainRpcServiceTests, DownloadsSegmentsAmongPeersOfThePreviousRelease)
+{
+  static constexpr std::size_t NUM_LEGACY_PEERS = 5;
+
+  // the chain spans several range requests
+  auto const blocks = GenerateChain(450);
+
+  // only the up to date peer holds the chain, so it can only be synchronised through the chain
+  // hashes and segment requests
+  MainChain         peer_chain{};
+  MainChainProtocol peer_protocol{peer_chain};
+
+  RpcServer peer_server{AddPeerNetwork().AsEndpoint(), SERVICE_MAIN_CHAIN, CHANNEL_RPC};
+  peer_server.Add(RPC_MAIN_CHAIN, &peer_protocol);
+
+  for (std::size_t i = 1; i < blocks.size(); ++i)
+  {
+    ASSERT_EQ(fetch::ledger::BlockStatus::ADDED, peer_chain.AddBlock(*blocks[i]));
+  }
+
+  // more peers of the previous release are connected than the attempts for each range request
+  std::vector<std::unique_ptr<MainChain>>               legacy_chains{};
+  std::vector<std::unique_ptr<LegacyMainChainProtocol>> legacy_protocols{};
+  std::vector<std::unique_ptr<RpcServer>>               legacy_servers{};
+  for (std::size_t i = 0; i < NUM_LEGACY_PEERS; ++i)
+  {
+    auto &legacy_network = (i == 0) ? *legacy_network_ : AddPeerNetwork();
+
+    legacy_chains.emplace_back(std::make_unique<MainChain>());
+    legacy_protocols.emplace_back(std::make_unique<LegacyMainChainProtocol>(*legacy_chains.back()));
+    legacy_servers.emplace_back(
+        std::make_unique<RpcServer>(legacy_network.AsEndpoint(), SERVICE_MAIN_CHAIN, CHANNEL_RPC));
+    legacy_servers.back()->Add(RPC_MAIN_CHAIN, legacy_protocols.back().get());
+  }
+
+  MainChain   chain{};
+  TrustSystem trust{};
+  auto        service = std::make_shared<MainChainRpcService>(
+      network_->AsEndpoint(), chain, trust, MainChainRpcService::Mode::STANDALONE);
+
+  ASSERT_TRUE(RunUntil(*service, [this]() {
+    return network_->AsEndpoint().GetDirectlyConnectedPeers().size() == NUM_LEGACY_PEERS + 1;
+  }));
+
+  ASSERT_EQ(fetch::ledger::BlockStatus::LOOSE, chain.AddBlock(*blocks.back()));
+
+  // the range requests which the peers of the previous release reject are handed to the up to
+  // date peer, rather than abandoning the download
+  EXPECT_TRUE(RunUntil(*service, [&chain, &blocks]() {
+    return chain.GetHeaviestBlockHash() == blocks.back()->body.hash;
+  }));
+  EXPECT_FALSE(chain.HasMissingBlocks());
+}
+
+}  // namespace
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/bitvector.hpp"
+#include "ledger/execution_item.hpp"
+#include "ledger/execution_ready_queue.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::ledger::ExecutionItem;
+using fetch::ledger::ExecutionReadyQueue;
+
+using ItemPtr  = std::unique_ptr<ExecutionItem>;
+using ItemList = std::vector<ItemPtr>;
+
+constexpr std::size_t LOG2_QUEUE_SIZE = 4;
+
+ItemList CreateItems(std::size_t count)
+{
+  ItemList items;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    items.emplace_back(std::make_unique<ExecutionItem>(fetch::ledger::Digest{}, 0, i, BitVector{}));
+  }
+  return items;
+}
+
+TEST(ExecutionReadyQueueTests, CheckPushAndPop)
+{
+  ExecutionReadyQueue queue{LOG2_QUEUE_SIZE};
+  ItemList            items = CreateItems(3);
+
+  ExecutionItem *item{nullptr};
+  EXPECT_FALSE(queue.Pop(item));
+
+  for (auto const &i : items)
+  {
+    queue.Push(i.get());
+  }
+
+  // the ring hands out items in order
+  for (auto const &i : items)
+  {
+    ASSERT_TRUE(queue.Pop(item));
+    EXPECT_EQ(item, i.get());
+  }
+
+  EXPECT_FALSE(queue.Pop(item));
+}
+
+TEST(ExecutionReadyQueueTests, CheckOverflow)
+{
+  ExecutionReadyQueue queue{LOG2_QUEUE_SIZE};
+  std::size_t const   ring_size = std::size_t{1} << LOG2_QUEUE_SIZE;
+  ItemList            items     = CreateItems(ring_size * 3);
+
+  for (auto const &i : items)
+  {
+    queue.Push(i.get());
+  }
+  EXPECT_EQ(queue.overflow_count(), ring_size * 2);
+
+  // every item is returned exactly once
+  std::set<ExecutionItem *> popped;
+  ExecutionItem *           item{nullptr};
+  while (queue.Pop(item))
+  {
+    EXPECT_TRUE(popped.insert(item).second);
+  }
+
+  EXPECT_EQ(popped.size(), items.size());
+  EXPECT_EQ(queue.overflow_count(), 0);
+}
+
+TEST(ExecutionReadyQueueTests, CheckConcurrentPushAndSteal)
+{
+  static constexpr std::size_t NUM_PRODUCERS = 2;
+  static constexpr std::size_t NUM_CONSUMERS = 3;
+  static constexpr std::size_t NUM_ITEMS     = 20000;
+
+  ExecutionReadyQueue queue{LOG2_QUEUE_SIZE};
+  ItemList            items = CreateItems(NUM_ITEMS);
+
+  std::vector<std::atomic<std::size_t>> seen(NUM_ITEMS);
+  for (auto &count : seen)
+  {
+    count = 0;
+  }
+
+  std::atomic<std::size_t> remaining{NUM_ITEMS};
+  std::vector<std::thread> threads;
+
+  for (std::size_t p = 0; p < NUM_PRODUCERS; ++p)
+  {
+    threads.emplace_back([&items, &queue, p]() {
+      for (std::size_t i = p; i < NUM_ITEMS; i += NUM_PRODUCERS)
+      {
+        queue.Push(items[i].get());
+      }
+    });
+  }
+
+  for (std::size_t c = 0; c < NUM_CONSUMERS; ++c)
+  {
+    threads.emplace_back([&queue, &seen, &remaining]() {
+      ExecutionItem *item{nullptr};
+      while (remaining > 0)
+      {
+        if (queue.Pop(item))
+        {
+          ++seen[item->slice()];
+          --remaining;
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  for (auto const &count : seen)
+  {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+}  // namespace
@@ -674,6 +674,39 @@ BENCHMARK_TEMPLATE(BM_TransposeDot, fetch::fixed_point::FixedPoint<16, 16>, 512,
 BENCHMARK_TEMPLATE(BM_TransposeDot, fetch::fixed_point::FixedPoint<32, 32>, 512, 512)
     ->Unit(benchmark::kMillisecond);
 
+// square matrix products over a range of sizes, reported as a throughput (GFLOP/s) so that the
+// efficiency of the packed GEMM engine can be compared as the operands outgrow the caches
+template <class T>
+void BM_DotThroughput(benchmark::State &state)
+{
+  using SizeType = fetch::math::SizeType;
+
+  auto const n = static_cast<SizeType>(state.range(0));
+
+  fetch::math::Tensor<T> a(std::vector<SizeType>{n, n});
+  fetch::math::Tensor<T> b(std::vector<SizeType>{n, n});
+  fetch::math::Tensor<T> ret(std::vector<SizeType>{n, n});
+  a.FillUniformRandom();
+  b.FillUniformRandom();
+
+  for (auto _ : state)
+  {
+    fetch::math::Dot(a, b, ret);
+  }
+
+  state.counters["GFLOP"] = benchmark::Counter(2.0e-9 * static_cast<double>(n * n * n),
+                                               benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_TEMPLATE(BM_DotThroughput, float)
+    ->RangeMultiplier(2)
+    ->Range(32, 2048)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_DotThroughput, double)
+    ->RangeMultiplier(2)
+    ->Range(32, 2048)
+    ->Unit(benchmark::kMillisecond);
+
 template <class T, int C, int H, int W>
 void BM_DynamicStitch(benchmark::State &state)
 {
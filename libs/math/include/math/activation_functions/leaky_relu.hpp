@@ -43,16 +43,17 @@ void LeakyRelu(ArrayType const &t, typename ArrayType::Type const &a, ArrayType
   auto rit = ret.begin();
   while (it.is_valid())
   {
-    *rit = fetch::math::Max(*it, typename ArrayType::Type(0));
-    if (*it >= static_cast<DataType>(0))
+    // the input is read once, ret may share its storage
+    DataType const x = *it;
+    if (x >= static_cast<DataType>(0))
     {
       // f(x)=x for x>=0
-      *rit = *it;
+      *rit = x;
     }
     else
     {
       // f(x)=a*x for x<0
-      Multiply(a, *it, *rit);
+      Multiply(a, x, *rit);
     }
     ++it;
     ++rit;
@@ -98,16 +99,16 @@ void LeakyRelu(ArrayType const &t, ArrayType const &a, ArrayType &ret)
 
     while (it.is_valid())
     {
-      *rit = fetch::math::Max(*it, typename ArrayType::Type(0));
-      if (*it >= static_cast<DataType>(0))
+      DataType const x = *it;
+      if (x >= static_cast<DataType>(0))
       {
         // f(x)=x for x>=0
-        *rit = *it;
+        *rit = x;
       }
       else
       {
         // f(x)=a*x for x<0
-        *rit = Multiply(*ait, *it);
+        *rit = Multiply(*ait, x);
       }
       ++it;
       ++rit;
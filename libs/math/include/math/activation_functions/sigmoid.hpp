@@ -18,7 +18,9 @@
 //------------------------------------------------------------------------------
 
 #include "math/fundamental_operators.hpp"  // add, subtract etc.
+#include "math/parallel.hpp"
 #include "math/standard_functions/exp.hpp"
+#include "vectorise/math.hpp"
 
 namespace fetch {
 namespace math {
@@ -30,7 +32,7 @@ namespace math {
  * @param ret
  */
 template <typename ArrayType>
-void Sigmoid(ArrayType const &t, ArrayType &ret)
+meta::IfIsMathNonFixedPointArray<ArrayType, void> Sigmoid(ArrayType const &t, ArrayType &ret)
 {
   using Type = typename ArrayType::Type;
 
@@ -59,6 +61,31 @@ void Sigmoid(ArrayType const &t, ArrayType &ret)
   }
 }
 
+/**
+ * The sigmoid function of fixed point arrays, the packed kernel evaluates the same numerically
+ * stable expressions as the elementwise implementation
+ * @tparam ArrayType
+ * @param t
+ * @param ret
+ */
+template <typename ArrayType>
+meta::IfIsMathFixedPointArray<ArrayType, void> Sigmoid(ArrayType const &t, ArrayType &ret)
+{
+  using Type               = typename ArrayType::Type;
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  details::ParallelVectorTransform(
+      t, ret, [](VectorRegisterType const &x) { return vectorize::sigmoid(x); },
+      [](Type const &x) {
+        if (x >= Type{0})
+        {
+          return Type(Type{1} / (Exp(Type{-1} * x) + Type{1}));
+        }
+        Type const e = Exp(x);
+        return Type(e / (e + Type{1}));
+      });
+}
+
 template <typename ArrayType>
 ArrayType Sigmoid(ArrayType const &t)
 {
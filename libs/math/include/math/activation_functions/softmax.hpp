@@ -21,7 +21,9 @@
 #include "math/fundamental_operators.hpp"
 #include "math/matrix_operations.hpp"
 #include "math/meta/math_type_traits.hpp"
+#include "math/parallel.hpp"
 #include "math/standard_functions/exp.hpp"
+#include "vectorise/math.hpp"
 
 #include <cassert>
 #include <cstddef>
@@ -38,7 +40,8 @@ namespace details {
  */
 
 template <typename ArrayType1, typename ArrayType2>
-void Softmax1DImplementation(ArrayType1 const &array, ArrayType2 &ret)
+meta::IfIsMathNonFixedPointArray<ArrayType1, void> Softmax1DImplementation(ArrayType1 const &array,
+                                                                           ArrayType2 &      ret)
 {
   using Type = typename ArrayType1::Type;
   assert(ret.size() == array.size());
@@ -66,6 +69,42 @@ void Softmax1DImplementation(ArrayType1 const &array, ArrayType2 &ret)
   }
 }
 
+/*
+ * The fixed point implementation evaluates the exponentials and the normalisation with the packed
+ * kernels, the sum is still accumulated in element order so the result is bit identical
+ */
+template <typename ArrayType>
+meta::IfIsMathFixedPointArray<ArrayType, void> Softmax1DImplementation(ArrayType const &array,
+                                                                       ArrayType &      ret)
+{
+  using Type               = typename ArrayType::Type;
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+  assert(ret.size() == array.size());
+
+  // subtract max for numerical stability
+  Type array_max = numeric_lowest<Type>();
+  Max(array, array_max);
+
+  VectorRegisterType const vector_max(array_max);
+  details::ParallelVectorTransform(
+      array, ret,
+      [&vector_max](VectorRegisterType const &x) { return vectorize::exp(x - vector_max); },
+      [&array_max](Type const &x) { return Exp(x - array_max); });
+
+  auto it  = ret.cbegin();
+  Type sum = Type(0);
+  while (it.is_valid())
+  {
+    sum += *it;
+    ++it;
+  }
+
+  VectorRegisterType const vector_sum(sum);
+  details::ParallelVectorTransform(
+      ret, ret, [&vector_sum](VectorRegisterType const &x) { return x / vector_sum; },
+      [&sum](Type const &x) { return x / sum; });
+}
+
 template <typename ArrayType>
 void Softmax2DImplementation(ArrayType const &array, ArrayType &ret,
                              typename ArrayType::SizeType axis)
@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "math/meta/math_type_traits.hpp"
+#include "math/parallel.hpp"
 #include "math/tensor_broadcast.hpp"
 
 #include <cassert>
@@ -294,14 +295,8 @@ template <typename T, typename ArrayType,
 meta::IfIsMathArray<ArrayType, void> Add(ArrayType const &array, T const &scalar, ArrayType &ret)
 {
   assert(array.shape() == ret.shape());
-  auto it1 = array.cbegin();
-  auto rit = ret.begin();
-  while (it1.is_valid())
-  {
-    *rit = (*it1) + scalar;
-    ++it1;
-    ++rit;
-  }
+  details::ParallelTransform(array, ret,
+                             [&scalar](typename ArrayType::Type const &x) { return x + scalar; });
 }
 
 /**
@@ -319,24 +314,14 @@ meta::IfIsMathArray<ArrayType, void> Add(ArrayType const &array1, ArrayType cons
   if (array1.shape() == array2.shape())
   {
     assert(array1.shape() == ret.shape());
-    auto it1 = array1.cbegin();
-    auto it2 = array2.cbegin();
-    auto rit = ret.begin();
-    while (it1.is_valid())
-    {
-      *rit = (*it1) + (*it2);
-      ++it1;
-      ++it2;
-      ++rit;
-    }
+    details::ParallelTransform(
+        array1, array2, ret,
+        [](typename ArrayType::Type const &x, typename ArrayType::Type const &y) { return x + y; });
   }
   else
   {
-    // TODO(issue 1257): Implement const version of Tensor::Broadcast
-    ArrayType a = array1.Copy();
-    ArrayType b = array2.Copy();
-    if (!(Broadcast([](typename ArrayType::Type x, typename ArrayType::Type y) { return x + y; }, a,
-                    b, ret)))
+    if (!(Broadcast([](typename ArrayType::Type x, typename ArrayType::Type y) { return x + y; },
+                    array1, array2, ret)))
     {
       throw std::runtime_error("arrays not broadcastable for InlineAdd!");
     }
@@ -363,14 +348,8 @@ meta::IfIsMathArray<ArrayType, void> Subtract(T const &scalar, ArrayType const &
 {
   assert(array.size() == ret.size());
   assert(array.shape() == ret.shape());
-  auto it1 = array.cbegin();
-  auto rit = ret.begin();
-  while (it1.is_valid())
-  {
-    *rit = scalar - *it1;
-    ++it1;
-    ++rit;
-  }
+  details::ParallelTransform(array, ret,
+                             [&scalar](typename ArrayType::Type const &x) { return scalar - x; });
 }
 
 /**
@@ -388,14 +367,8 @@ meta::IfIsMathArray<ArrayType, void> Subtract(ArrayType const &array, T const &s
                                               ArrayType &ret)
 {
   assert(array.size() == ret.size());
-  auto it1 = array.cbegin();
-  auto rit = ret.begin();
-  while (it1.is_valid())
-  {
-    *rit = *it1 - scalar;
-    ++it1;
-    ++rit;
-  }
+  details::ParallelTransform(array, ret,
+                             [&scalar](typename ArrayType::Type const &x) { return x - scalar; });
 }
 
 /**
@@ -413,53 +386,64 @@ meta::IfIsMathArray<ArrayType, void> Subtract(ArrayType const &array1, ArrayType
   if (array1.shape() == array2.shape())
   {
     assert(array1.shape() == ret.shape());
-    auto it1 = array1.cbegin();
-    auto it2 = array2.cbegin();
-    auto rit = ret.begin();
-    while (it1.is_valid())
-    {
-      *rit = (*it1) - (*it2);
-      ++it1;
-      ++it2;
-      ++rit;
-    }
+    details::ParallelTransform(
+        array1, array2, ret,
+        [](typename ArrayType::Type const &x, typename ArrayType::Type const &y) { return x - y; });
   }
   else
   {
-    // TODO(issue 1257): Implement const version of Tensor::Broadcast
-    ArrayType a = array1.Copy();
-    ArrayType b = array2.Copy();
-    if (!(Broadcast([](typename ArrayType::Type x, typename ArrayType::Type y) { return x - y; }, a,
-                    b, ret)))
+    if (!(Broadcast([](typename ArrayType::Type x, typename ArrayType::Type y) { return x - y; },
+                    array1, array2, ret)))
     {
       throw std::runtime_error("arrays not broadcastable for InlineAdd!");
     }
   }
 }
 
+/**
+ * Internal: elementwise product of two arrays of the same shape
+ */
+template <typename ArrayType>
+meta::IfIsMathNonFixedPointArray<ArrayType, void> MultiplyElementwise(ArrayType const &obj1,
+                                                                      ArrayType const &obj2,
+                                                                      ArrayType &      ret)
+{
+  details::ParallelTransform(
+      obj1, obj2, ret,
+      [](typename ArrayType::Type const &x, typename ArrayType::Type const &y) { return x * y; });
+}
+
+/**
+ * Internal: elementwise product of two fixed point arrays of the same shape, a register at a time.
+ * The packed multiplication rounds (towards negative infinity) and flags overflows exactly as the
+ * scalar one does.
+ */
+template <typename ArrayType>
+meta::IfIsMathFixedPointArray<ArrayType, void> MultiplyElementwise(ArrayType const &obj1,
+                                                                   ArrayType const &obj2,
+                                                                   ArrayType &      ret)
+{
+  using Type               = typename ArrayType::Type;
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  details::ParallelVectorTransform(
+      obj1, obj2, ret,
+      [](VectorRegisterType const &x, VectorRegisterType const &y) { return x * y; },
+      [](Type const &x, Type const &y) { return x * y; });
+}
+
 template <typename ArrayType>
 ::fetch::math::meta::IfIsMathArray<ArrayType, void> Multiply(ArrayType const &obj1,
                                                              ArrayType const &obj2, ArrayType &ret)
 {
   if (obj1.shape() == obj2.shape())
   {
-    auto it1 = obj1.cbegin();
-    auto it2 = obj2.cbegin();
-    auto rit = ret.begin();
-    while (it1.is_valid())
-    {
-      *rit = (*it1) * (*it2);
-      ++it1;
-      ++it2;
-      ++rit;
-    }
+    MultiplyElementwise(obj1, obj2, ret);
   }
   else
   {
-    ArrayType a = obj1.Copy();
-    ArrayType b = obj2.Copy();
-    if (!(Broadcast([](typename ArrayType::Type x, typename ArrayType::Type y) { return x * y; }, a,
-                    b, ret)))
+    if (!(Broadcast([](typename ArrayType::Type x, typename ArrayType::Type y) { return x * y; },
+                    obj1, obj2, ret)))
     {
       throw std::runtime_error("arrays not broadcastable for InlineAdd!");
     }
@@ -472,14 +456,8 @@ meta::IfIsMathArray<ArrayType, void> Multiply(ArrayType const &array, T const &s
                                               ArrayType &ret)
 {
   assert(array.size() == ret.size());
-  auto it1 = array.cbegin();
-  auto it2 = ret.begin();
-  while (it1.is_valid())
-  {
-    *it2 = scalar * (*it1);
-    ++it1;
-    ++it2;
-  }
+  details::ParallelTransform(array, ret,
+                             [&scalar](typename ArrayType::Type const &x) { return scalar * x; });
 }
 
 /**
@@ -495,24 +473,14 @@ void Divide(ArrayType const &array1, ArrayType const &array2, ArrayType &ret)
   if (array1.shape() == array2.shape())
   {
     assert(array1.shape() == ret.shape());
-    auto it1 = array1.cbegin();
-    auto it2 = array2.cbegin();
-    auto rit = ret.begin();
-    while (it1.is_valid())
-    {
-      *rit = (*it1) / (*it2);
-      ++it1;
-      ++it2;
-      ++rit;
-    }
+    details::ParallelTransform(
+        array1, array2, ret,
+        [](typename ArrayType::Type const &x, typename ArrayType::Type const &y) { return x / y; });
   }
   else
   {
-    // TODO(issue 1257): Implement const version of Tensor::Broadcast
-    ArrayType a = array1.Copy();
-    ArrayType b = array2.Copy();
-    if (!(Broadcast([](typename ArrayType::Type x, typename ArrayType::Type y) { return x / y; }, a,
-                    b, ret)))
+    if (!(Broadcast([](typename ArrayType::Type x, typename ArrayType::Type y) { return x / y; },
+                    array1, array2, ret)))
     {
       throw std::runtime_error("arrays not broadcastable for InlineAdd!");
     }
@@ -533,14 +501,8 @@ template <typename ArrayType, typename T,
 meta::IfIsMathArray<ArrayType, void> Divide(ArrayType const &array, T const &scalar, ArrayType &ret)
 {
   assert(array.shape() == ret.shape());
-  auto it1 = array.cbegin();
-  auto rit = ret.begin();
-  while (it1.is_valid())
-  {
-    *rit = (*it1) / scalar;
-    ++it1;
-    ++rit;
-  }
+  details::ParallelTransform(array, ret,
+                             [&scalar](typename ArrayType::Type const &x) { return x / scalar; });
 }
 
 /**
@@ -557,14 +519,8 @@ template <typename ArrayType, typename T,
 meta::IfIsMathArray<ArrayType, void> Divide(T const &scalar, ArrayType const &array, ArrayType &ret)
 {
   assert(array.shape() == ret.shape());
-  auto it  = array.begin();
-  auto it2 = ret.begin();
-  while (it.is_valid())
-  {
-    *it2 = scalar / *it;
-    ++it2;
-    ++it;
-  }
+  details::ParallelTransform(array, ret,
+                             [&scalar](typename ArrayType::Type const &x) { return scalar / x; });
 }
 
 }  // namespace implementations
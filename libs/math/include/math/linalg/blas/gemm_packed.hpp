@@ -0,0 +1,362 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+/* The class defined in this file implements a packed, cache blocked general matrix multiply
+ *
+ *   C = alpha * op(A) * op(B) + beta * C
+ *
+ * following the GotoBLAS / BLIS structure. The product is split into NC wide panels of op(B)
+ * (held in L3), KC deep slices of the inner dimension and MC high blocks of op(A) (held in L2).
+ * Each block of op(A) and panel of op(B) is packed into contiguous, zero padded strips of MR rows
+ * and NR columns respectively so that the MR x NR register micro-kernel streams both operands
+ * from L1 with aligned vector loads, independently of the layout (or transposition) of the
+ * original operands.
+ *
+ * Large products are split into independent tiles of C (each with its own packing buffers) which
+ * are computed in parallel on the compute pool.
+ */
+
+#include "math/base_types.hpp"
+#include "math/tensor_view.hpp"
+#include "vectorise/memory/shared_array.hpp"
+#include "vectorise/threading/compute_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace fetch {
+namespace math {
+namespace linalg {
+namespace details {
+
+template <typename T, typename VectorRegisterType>
+class GemmPacked
+{
+public:
+  using Type = T;
+
+  enum
+  {
+    VECTOR_SIZE = VectorRegisterType::E_BLOCK_COUNT,  ///< Elements per vector register
+    MR_VECTORS  = 2,                                  ///< Vector registers per micro-tile column
+    MR          = MR_VECTORS * VECTOR_SIZE,           ///< Rows of the micro-tile
+    NR          = 4,                                  ///< Columns of the micro-tile
+    KC          = 256,                                ///< Depth of the packed slices (L1)
+    MC          = ((128 + MR - 1) / MR) * MR,         ///< Rows of the packed op(A) block (L2)
+    NC          = ((2048 + NR - 1) / NR) * NR,        ///< Columns of the packed op(B) panel (L3)
+    MIN_VOLUME  = 1 << 21  ///< The minimum m * n * k for the product to be multi-threaded
+  };
+
+  template <bool TRANS_A, bool TRANS_B>
+  static void Apply(Type alpha, TensorView<Type> const &a, TensorView<Type> const &b, Type beta,
+                    TensorView<Type> &c);
+
+private:
+  using Buffer      = memory::SharedArray<Type>;
+  using ComputePool = threading::ComputePool;
+
+  template <bool TRANS_A, bool TRANS_B>
+  static void Compute(Type alpha, TensorView<Type> const &a, TensorView<Type> const &b,
+                      TensorView<Type> &c, SizeType row, SizeType rows, SizeType col,
+                      SizeType cols);
+
+  static void Scale(Type beta, TensorView<Type> &c);
+
+  template <bool TRANS>
+  static void PackA(Type alpha, TensorView<Type> const &a, SizeType row, SizeType rows,
+                    SizeType depth, SizeType depths, Type *packed);
+
+  template <bool TRANS>
+  static void PackB(TensorView<Type> const &b, SizeType depth, SizeType depths, SizeType col,
+                    SizeType cols, Type *packed);
+
+  static void MicroKernel(SizeType depths, Type const *a, Type const *b, Type *tile);
+};
+
+/**
+ * Compute C = alpha * op(A) * op(B) + beta * C
+ *
+ * @tparam TRANS_A Flag to signal that op(A) is the transpose of A
+ * @tparam TRANS_B Flag to signal that op(B) is the transpose of B
+ */
+template <typename T, typename V>
+template <bool TRANS_A, bool TRANS_B>
+void GemmPacked<T, V>::Apply(Type const alpha, TensorView<Type> const &a,
+                             TensorView<Type> const &b, Type const beta, TensorView<Type> &c)
+{
+  SizeType const m = c.height();
+  SizeType const n = c.width();
+  SizeType const k = TRANS_A ? a.height() : a.width();
+
+  Scale(beta, c);
+
+  if ((m == 0) || (n == 0) || (k == 0))
+  {
+    return;
+  }
+
+  auto &pool = ComputePool::Instance();
+
+  if ((pool.concurrency() == 1) || ((m * n * k) < SizeType(MIN_VOLUME)))
+  {
+    Compute<TRANS_A, TRANS_B>(alpha, a, b, c, 0, m, 0, n);
+    return;
+  }
+
+  // split C into tiles of (up to) MC rows by a multiple of NR columns, so that there are enough
+  // tiles to keep every thread busy
+  SizeType const chunks     = ComputePool::CHUNKS_PER_THREAD * pool.concurrency();
+  SizeType const row_tiles  = (m + MC - 1) / MC;
+  SizeType const col_splits =
+      std::min<SizeType>((n + NR - 1) / NR, (chunks + row_tiles - 1) / row_tiles);
+  SizeType const tile_width = ((((n + col_splits - 1) / col_splits) + NR - 1) / NR) * NR;
+  SizeType const col_tiles  = (n + tile_width - 1) / tile_width;
+
+  pool.ParallelFor(0, row_tiles * col_tiles, 1, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t tile = begin; tile < end; ++tile)
+    {
+      SizeType const row = (tile % row_tiles) * MC;
+      SizeType const col = (tile / row_tiles) * tile_width;
+
+      Compute<TRANS_A, TRANS_B>(alpha, a, b, c, row, std::min<SizeType>(MC, m - row), col,
+                                std::min<SizeType>(tile_width, n - col));
+    }
+  });
+}
+
+/**
+ * Internal: Compute the (rows x cols) block of C starting at (row, col), C having already been
+ * scaled by beta
+ */
+template <typename T, typename V>
+template <bool TRANS_A, bool TRANS_B>
+void GemmPacked<T, V>::Compute(Type const alpha, TensorView<Type> const &a,
+                               TensorView<Type> const &b, TensorView<Type> &c, SizeType const row,
+                               SizeType const rows, SizeType const col, SizeType const cols)
+{
+  SizeType const k = TRANS_A ? a.height() : a.width();
+
+  // the packing buffers are sized for the largest block (or the whole problem if smaller)
+  SizeType const kc_max = std::min<SizeType>(KC, k);
+  SizeType const mc_max = ((std::min<SizeType>(MC, rows) + MR - 1) / MR) * MR;
+  SizeType const nc_max = ((std::min<SizeType>(NC, cols) + NR - 1) / NR) * NR;
+
+  Buffer packed_a(mc_max * kc_max);
+  Buffer packed_b(kc_max * nc_max);
+
+  alignas(64) Type tile[MR * NR];
+
+  Type *const    c_ptr = c.data().pointer();
+  SizeType const ldc   = c.padded_height();
+
+  for (SizeType jc = 0; jc < cols; jc += NC)
+  {
+    SizeType const nc = std::min<SizeType>(NC, cols - jc);
+
+    for (SizeType pc = 0; pc < k; pc += KC)
+    {
+      SizeType const kc = std::min<SizeType>(KC, k - pc);
+
+      PackB<TRANS_B>(b, pc, kc, col + jc, nc, packed_b.pointer());
+
+      for (SizeType ic = 0; ic < rows; ic += MC)
+      {
+        SizeType const mc = std::min<SizeType>(MC, rows - ic);
+
+        PackA<TRANS_A>(alpha, a, row + ic, mc, pc, kc, packed_a.pointer());
+
+        for (SizeType jr = 0; jr < nc; jr += NR)
+        {
+          SizeType const nr      = std::min<SizeType>(NR, nc - jr);
+          Type const *   b_strip = packed_b.pointer() + (jr * kc);
+
+          for (SizeType ir = 0; ir < mc; ir += MR)
+          {
+            SizeType const mr      = std::min<SizeType>(MR, mc - ir);
+            Type const *   a_strip = packed_a.pointer() + (ir * kc);
+
+            MicroKernel(kc, a_strip, b_strip, tile);
+
+            // accumulate the (valid part of the) micro-tile into C
+            for (SizeType j = 0; j < nr; ++j)
+            {
+              Type *const       c_col    = c_ptr + ((col + jc + jr + j) * ldc) + row + ic + ir;
+              Type const *const tile_col = tile + (j * MR);
+
+              for (SizeType i = 0; i < mr; ++i)
+              {
+                c_col[i] += tile_col[i];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Internal: Scale C by beta (beta == 0 clears C, ignoring any NaN values present)
+ */
+template <typename T, typename V>
+void GemmPacked<T, V>::Scale(Type const beta, TensorView<Type> &c)
+{
+  if (beta == static_cast<Type>(1.0))
+  {
+    return;
+  }
+
+  for (SizeType j = 0; j < c.width(); ++j)
+  {
+    Type *const c_col = c.data().pointer() + (j * c.padded_height());
+
+    for (SizeType i = 0; i < c.height(); ++i)
+    {
+      c_col[i] = (beta == static_cast<Type>(0.0)) ? static_cast<Type>(0.0) : beta * c_col[i];
+    }
+  }
+}
+
+/**
+ * Internal: Pack a rows x depths block of alpha * op(A) into strips of MR rows. Within each strip
+ * the elements are stored depth major so that the micro-kernel loads one MR column per step. Rows
+ * beyond the end of the block are zero filled.
+ */
+template <typename T, typename V>
+template <bool TRANS>
+void GemmPacked<T, V>::PackA(Type const alpha, TensorView<Type> const &a, SizeType const row,
+                             SizeType const rows, SizeType const depth, SizeType const depths,
+                             Type *packed)
+{
+  Type const *const a_ptr = a.data().pointer();
+  SizeType const    lda   = a.padded_height();
+
+  for (SizeType ir = 0; ir < rows; ir += MR)
+  {
+    SizeType const mr = std::min<SizeType>(MR, rows - ir);
+
+    for (SizeType l = 0; l < depths; ++l)
+    {
+      for (SizeType i = 0; i < mr; ++i)
+      {
+        SizeType const r = row + ir + i;
+        SizeType const d = depth + l;
+
+        packed[i] = alpha * (TRANS ? a_ptr[(r * lda) + d] : a_ptr[(d * lda) + r]);
+      }
+
+      for (SizeType i = mr; i < MR; ++i)
+      {
+        packed[i] = static_cast<Type>(0.0);
+      }
+
+      packed += MR;
+    }
+  }
+}
+
+/**
+ * Internal: Pack a depths x cols panel of op(B) into strips of NR columns. Within each strip the
+ * elements are stored depth major so that the micro-kernel reads one NR row per step. Columns
+ * beyond the end of the panel are zero filled.
+ */
+template <typename T, typename V>
+template <bool TRANS>
+void GemmPacked<T, V>::PackB(TensorView<Type> const &b, SizeType const depth,
+                             SizeType const depths, SizeType const col, SizeType const cols,
+                             Type *packed)
+{
+  Type const *const b_ptr = b.data().pointer();
+  SizeType const    ldb   = b.padded_height();
+
+  for (SizeType jr = 0; jr < cols; jr += NR)
+  {
+    SizeType const nr = std::min<SizeType>(NR, cols - jr);
+
+    for (SizeType l = 0; l < depths; ++l)
+    {
+      for (SizeType j = 0; j < nr; ++j)
+      {
+        SizeType const c = col + jr + j;
+        SizeType const d = depth + l;
+
+        packed[j] = TRANS ? b_ptr[(d * ldb) + c] : b_ptr[(c * ldb) + d];
+      }
+
+      for (SizeType j = nr; j < NR; ++j)
+      {
+        packed[j] = static_cast<Type>(0.0);
+      }
+
+      packed += NR;
+    }
+  }
+}
+
+/**
+ * Internal: Compute the MR x NR product of a packed strip of op(A) and a packed strip of op(B),
+ * accumulated entirely in vector registers and written (column major) to the aligned tile
+ */
+template <typename T, typename V>
+void GemmPacked<T, V>::MicroKernel(SizeType const depths, Type const *a, Type const *b, Type *tile)
+{
+  V accumulators[MR_VECTORS][NR];
+  for (SizeType v = 0; v < MR_VECTORS; ++v)
+  {
+    for (SizeType j = 0; j < NR; ++j)
+    {
+      accumulators[v][j] = V(static_cast<Type>(0.0));
+    }
+  }
+
+  for (SizeType l = 0; l < depths; ++l)
+  {
+    V a_column[MR_VECTORS];
+    for (SizeType v = 0; v < MR_VECTORS; ++v)
+    {
+      a_column[v] = V(a + (v * VECTOR_SIZE));
+    }
+
+    for (SizeType j = 0; j < NR; ++j)
+    {
+      V const b_value(b[j]);
+
+      for (SizeType v = 0; v < MR_VECTORS; ++v)
+      {
+        accumulators[v][j] = accumulators[v][j] + (a_column[v] * b_value);
+      }
+    }
+
+    a += MR;
+    b += NR;
+  }
+
+  for (SizeType j = 0; j < NR; ++j)
+  {
+    for (SizeType v = 0; v < MR_VECTORS; ++v)
+    {
+      accumulators[v][j].Store(tile + (j * MR) + (v * VECTOR_SIZE));
+    }
+  }
+}
+
+}  // namespace details
+}  // namespace linalg
+}  // namespace math
+}  // namespace fetch
@@ -29,6 +29,7 @@
 #include "math/linalg/blas/gemm_tn_vector.hpp"
 #include "math/linalg/prototype.hpp"
 #include "math/meta/math_type_traits.hpp"
+#include "math/parallel.hpp"
 
 #include <cassert>
 #include <numeric>
@@ -240,14 +241,11 @@ T Product(std::vector<T> const &obj1)
 template <typename ArrayType>
 meta::IfIsMathArray<ArrayType, void> Max(ArrayType const &array, typename ArrayType::Type &ret)
 {
-  ret = numeric_lowest<typename ArrayType::Type>();
-  for (typename ArrayType::Type const &e : array)
-  {
-    if (e > ret)
-    {
-      ret = e;
-    }
-  }
+  using Type = typename ArrayType::Type;
+
+  auto const max = [](Type const &a, Type const &b) { return (b > a) ? b : a; };
+
+  ret = details::ParallelReduce(array, numeric_lowest<Type>(), max, max);
 }
 
 template <typename ArrayType>
@@ -360,14 +358,11 @@ T Max(std::vector<T> const &obj1)
 template <typename ArrayType>
 meta::IfIsMathArray<ArrayType, void> Min(ArrayType const &array, typename ArrayType::Type &ret)
 {
-  ret = numeric_max<typename ArrayType::Type>();
-  for (typename ArrayType::Type const &e : array)
-  {
-    if (e < ret)
-    {
-      ret = e;
-    }
-  }
+  using Type = typename ArrayType::Type;
+
+  auto const min = [](Type const &a, Type const &b) { return (b < a) ? b : a; };
+
+  ret = details::ParallelReduce(array, numeric_max<Type>(), min, min);
 }
 
 template <typename ArrayType>
@@ -498,11 +493,11 @@ meta::IfIsMathArray<ArrayType, ArrayType> Maximum(ArrayType const &array1, Array
 template <typename ArrayType, typename T, typename = std::enable_if_t<meta::IsArithmetic<T>>>
 meta::IfIsMathArray<ArrayType, void> Sum(ArrayType const &array1, T &ret)
 {
-  ret = typename ArrayType::Type(0);
-  for (auto &val : array1)
-  {
-    ret += val;
-  }
+  using Type = typename ArrayType::Type;
+
+  auto const add = [](Type const &a, Type const &b) { return a + b; };
+
+  ret = details::ParallelReduce(array1, Type(0), add, add);
 }
 
 template <typename ArrayType>
@@ -890,7 +885,12 @@ fetch::math::meta::IfIsMathArray<ArrayType, void> Dot(ArrayType const &A, ArrayT
     throw std::runtime_error("expected A width to equal and B height.");
   }
 
-  ret.Resize({aview.height(), bview.width()});
+  // with beta zero the product overwrites ret, so storage of the right shape is kept
+  SizeVector const ret_shape{aview.height(), bview.width()};
+  if (ret.shape() != ret_shape)
+  {
+    ret.Resize(ret_shape);
+  }
 
   using Type = typename ArrayType::Type;
   using namespace linalg;
@@ -937,7 +937,12 @@ fetch::math::meta::IfIsMathArray<ArrayType, void> DotTranspose(ArrayType const &
     throw std::runtime_error("expected A and B to have same width.");
   }
 
-  ret.Resize({aview.height(), bview.height()});
+  // with beta zero the product overwrites ret, so storage of the right shape is kept
+  SizeVector const ret_shape{aview.height(), bview.height()};
+  if (ret.shape() != ret_shape)
+  {
+    ret.Resize(ret_shape);
+  }
 
   using Type = typename ArrayType::Type;
   using namespace linalg;
@@ -985,7 +990,12 @@ fetch::math::meta::IfIsMathArray<ArrayType, void> TransposeDot(ArrayType const &
     throw std::runtime_error("expected A and B to have same height.");
   }
 
-  ret.Resize({aview.width(), bview.width()});
+  // with beta zero the product overwrites ret, so storage of the right shape is kept
+  SizeVector const ret_shape{aview.width(), bview.width()};
+  if (ret.shape() != ret_shape)
+  {
+    ret.Resize(ret_shape);
+  }
 
   using Type = typename ArrayType::Type;
   using namespace linalg;
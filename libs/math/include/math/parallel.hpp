@@ -0,0 +1,346 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/base_types.hpp"
+#include "meta/type_traits.hpp"
+#include "vectorise/threading/compute_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace math {
+namespace details {
+
+/**
+ * The minimum amount of work (in elements) which is handed to a thread of the compute pool. Below
+ * this the operations are executed on the calling thread.
+ */
+constexpr SizeType PARALLEL_GRAIN = 16384;
+
+/**
+ * Execute the function over the items [0, count) on the compute pool, function is called with
+ * disjoint (begin, end) sub ranges
+ *
+ * @param count The number of items
+ * @param cost The (approximate) number of elements processed for each item
+ * @param function The function to be called for each sub range
+ */
+template <typename F>
+void ParallelFor(SizeType count, SizeType cost, F &&function)
+{
+  SizeType const grain = std::max<SizeType>(PARALLEL_GRAIN / std::max<SizeType>(cost, 1), 1);
+
+  threading::ComputePool::Instance().ParallelFor(0, count, grain, std::forward<F>(function));
+}
+
+/**
+ * Execute the function, which computes elements of type T, over the items [0, count) on the
+ * compute pool as ParallelFor does. The fixed point state is per thread, so the state raised by
+ * each sub range is collected and raised on the calling thread once they have all completed.
+ *
+ * @param count The number of items
+ * @param cost The (approximate) number of elements processed for each item
+ * @param function The function to be called for each sub range
+ */
+template <typename T, typename F>
+fetch::meta::IfIsFixedPoint<T, void> ParallelCompute(SizeType count, SizeType cost, F &&function)
+{
+  std::atomic<uint32_t> state{T::STATE_OK};
+
+  ParallelFor(count, cost, [&state, &function](SizeType begin, SizeType end) {
+    // the calling thread runs sub ranges too, its own state is kept aside meanwhile
+    uint32_t const previous = T::fp_state;
+    T::fp_state             = T::STATE_OK;
+
+    function(begin, end);
+
+    state |= T::fp_state;
+    T::fp_state = previous;
+  });
+
+  T::fp_state |= state;
+}
+
+template <typename T, typename F>
+fetch::meta::IfIsNotFixedPoint<T, void> ParallelCompute(SizeType count, SizeType cost,
+                                                        F &&function)
+{
+  ParallelFor(count, cost, std::forward<F>(function));
+}
+
+/**
+ * Call the function for each contiguous run of elements (within a column) of the array which
+ * make up the logical (i.e. unpadded) element range [begin, end)
+ *
+ * @param array The array
+ * @param begin The first logical element
+ * @param end The end of the logical element range (exclusive)
+ * @param function The function to be called with the (padded) offset and length of each run
+ */
+template <typename ArrayType, typename F>
+void ForEachRun(ArrayType const &array, SizeType begin, SizeType end, F &&function)
+{
+  SizeType const height        = array.height();
+  SizeType const padded_height = array.padded_height();
+
+  for (SizeType index = begin; index < end;)
+  {
+    SizeType const column = index / height;
+    SizeType const row    = index % height;
+    SizeType const count  = std::min(height - row, end - index);
+
+    function((column * padded_height) + row, count);
+
+    index += count;
+  }
+}
+
+/**
+ * Compute ret = function(array) elementwise, in parallel for large arrays
+ *
+ * @param array The input array
+ * @param ret The output array (may alias the input)
+ * @param function The function to be applied to each element
+ */
+template <typename ArrayType, typename F>
+void ParallelTransform(ArrayType const &array, ArrayType &ret, F &&function)
+{
+  if (array.shape() != ret.shape())
+  {
+    // the element layouts differ, fall back to walking each array in turn
+    auto it  = array.cbegin();
+    auto rit = ret.begin();
+    while (it.is_valid())
+    {
+      *rit = function(*it);
+      ++it;
+      ++rit;
+    }
+
+    return;
+  }
+
+  auto const *input  = array.data().pointer();
+  auto *      output = ret.data().pointer();
+
+  ParallelCompute<typename ArrayType::Type>(ret.size(), 1, [&](SizeType begin, SizeType end) {
+    ForEachRun(ret, begin, end, [&](SizeType offset, SizeType count) {
+      for (SizeType i = offset; i < offset + count; ++i)
+      {
+        output[i] = function(input[i]);
+      }
+    });
+  });
+}
+
+/**
+ * Compute ret = function(array1, array2) elementwise, in parallel for large arrays
+ *
+ * @param array1 The first input array
+ * @param array2 The second input array (of the same shape as the first)
+ * @param ret The output array (may alias either input)
+ * @param function The function to be applied to each pair of elements
+ */
+template <typename ArrayType, typename F>
+void ParallelTransform(ArrayType const &array1, ArrayType const &array2, ArrayType &ret,
+                       F &&function)
+{
+  assert(array1.shape() == array2.shape());
+
+  if (array1.shape() != ret.shape())
+  {
+    // the element layouts differ, fall back to walking each array in turn
+    auto it1 = array1.cbegin();
+    auto it2 = array2.cbegin();
+    auto rit = ret.begin();
+    while (it1.is_valid())
+    {
+      *rit = function(*it1, *it2);
+      ++it1;
+      ++it2;
+      ++rit;
+    }
+
+    return;
+  }
+
+  auto const *input1 = array1.data().pointer();
+  auto const *input2 = array2.data().pointer();
+  auto *      output = ret.data().pointer();
+
+  ParallelCompute<typename ArrayType::Type>(ret.size(), 1, [&](SizeType begin, SizeType end) {
+    ForEachRun(ret, begin, end, [&](SizeType offset, SizeType count) {
+      for (SizeType i = offset; i < offset + count; ++i)
+      {
+        output[i] = function(input1[i], input2[i]);
+      }
+    });
+  });
+}
+
+/**
+ * Compute ret = function(array) elementwise, in parallel for large arrays, evaluating whole
+ * registers of each contiguous run with vector_function and the remaining elements with function.
+ * The registers are loaded from and stored to any element, as those of the fixed point types allow.
+ *
+ * @param array The input array
+ * @param ret The output array (may alias the input)
+ * @param vector_function The function to be applied to each register of elements
+ * @param function The function to be applied to each remaining element
+ */
+template <typename ArrayType, typename V, typename F>
+void ParallelVectorTransform(ArrayType const &array, ArrayType &ret, V &&vector_function,
+                             F &&function)
+{
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  if (array.shape() != ret.shape())
+  {
+    ParallelTransform(array, ret, std::forward<F>(function));
+    return;
+  }
+
+  auto const *input  = array.data().pointer();
+  auto *      output = ret.data().pointer();
+
+  ParallelCompute<typename ArrayType::Type>(ret.size(), 1, [&](SizeType begin, SizeType end) {
+    ForEachRun(ret, begin, end, [&](SizeType offset, SizeType count) {
+      SizeType const blocks =
+          offset + count - (count % SizeType(VectorRegisterType::E_BLOCK_COUNT));
+
+      SizeType i = offset;
+      for (; i < blocks; i += VectorRegisterType::E_BLOCK_COUNT)
+      {
+        vector_function(VectorRegisterType(input + i)).Store(output + i);
+      }
+      for (; i < offset + count; ++i)
+      {
+        output[i] = function(input[i]);
+      }
+    });
+  });
+}
+
+/**
+ * Compute ret = function(array1, array2) elementwise, in parallel for large arrays, evaluating
+ * whole registers of each contiguous run with vector_function and the remaining elements with
+ * function. The registers are loaded from and stored to any element, as those of the fixed point
+ * types allow.
+ *
+ * @param array1 The first input array
+ * @param array2 The second input array (of the same shape as the first)
+ * @param ret The output array (may alias either input)
+ * @param vector_function The function to be applied to each pair of registers of elements
+ * @param function The function to be applied to each remaining pair of elements
+ */
+template <typename ArrayType, typename V, typename F>
+void ParallelVectorTransform(ArrayType const &array1, ArrayType const &array2, ArrayType &ret,
+                             V &&vector_function, F &&function)
+{
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  assert(array1.shape() == array2.shape());
+
+  if (array1.shape() != ret.shape())
+  {
+    ParallelTransform(array1, array2, ret, std::forward<F>(function));
+    return;
+  }
+
+  auto const *input1 = array1.data().pointer();
+  auto const *input2 = array2.data().pointer();
+  auto *      output = ret.data().pointer();
+
+  ParallelCompute<typename ArrayType::Type>(ret.size(), 1, [&](SizeType begin, SizeType end) {
+    ForEachRun(ret, begin, end, [&](SizeType offset, SizeType count) {
+      SizeType const blocks =
+          offset + count - (count % SizeType(VectorRegisterType::E_BLOCK_COUNT));
+
+      SizeType i = offset;
+      for (; i < blocks; i += VectorRegisterType::E_BLOCK_COUNT)
+      {
+        vector_function(VectorRegisterType(input1 + i), VectorRegisterType(input2 + i))
+            .Store(output + i);
+      }
+      for (; i < offset + count; ++i)
+      {
+        output[i] = function(input1[i], input2[i]);
+      }
+    });
+  });
+}
+
+/**
+ * Reduce all the elements of the array, in parallel for large arrays. The elements are reduced in
+ * fixed size blocks which are then combined in order, so the result does not depend on the number
+ * of threads.
+ *
+ * @param array The array to be reduced
+ * @param initial The initial (identity) value of the reduction
+ * @param reduce The function combining an accumulated value and an element
+ * @param combine The function combining the accumulated values of two blocks
+ * @return The reduced value
+ */
+template <typename ArrayType, typename R, typename C>
+typename ArrayType::Type ParallelReduce(ArrayType const &array,
+                                        typename ArrayType::Type const &initial, R &&reduce,
+                                        C &&combine)
+{
+  using Type = typename ArrayType::Type;
+
+  SizeType const size   = array.size();
+  SizeType const blocks = (size + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN;
+  auto const *   input  = array.data().pointer();
+
+  std::vector<Type> partials(blocks, initial);
+
+  ParallelCompute<Type>(blocks, PARALLEL_GRAIN, [&](SizeType begin, SizeType end) {
+    for (SizeType block = begin; block < end; ++block)
+    {
+      Type accumulated = initial;
+
+      ForEachRun(array, block * PARALLEL_GRAIN, std::min(size, (block + 1) * PARALLEL_GRAIN),
+                 [&reduce, &accumulated, input](SizeType offset, SizeType count) {
+                   for (SizeType i = offset; i < offset + count; ++i)
+                   {
+                     accumulated = reduce(accumulated, input[i]);
+                   }
+                 });
+
+      partials[block] = accumulated;
+    }
+  });
+
+  Type ret = initial;
+  for (auto const &partial : partials)
+  {
+    ret = combine(ret, partial);
+  }
+
+  return ret;
+}
+
+}  // namespace details
+}  // namespace math
+}  // namespace fetch
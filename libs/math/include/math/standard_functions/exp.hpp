@@ -18,7 +18,9 @@
 //------------------------------------------------------------------------------
 
 #include "math/meta/math_type_traits.hpp"
+#include "math/parallel.hpp"
 #include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/math.hpp"
 
 #include <cassert>
 
@@ -61,7 +63,7 @@ meta::IfIsArithmetic<Type, Type> Exp(Type const &x)
 }
 
 template <typename ArrayType>
-meta::IfIsMathArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
+meta::IfIsMathNonFixedPointArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
 {
   assert(ret.shape() == array.shape());
   auto it1 = array.cbegin();
@@ -74,6 +76,22 @@ meta::IfIsMathArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
   }
 }
 
+/**
+ * The fixed point arrays are evaluated a register at a time, bit identical to the elementwise
+ * FixedPoint::Exp
+ */
+template <typename ArrayType>
+meta::IfIsMathFixedPointArray<ArrayType, void> Exp(ArrayType const &array, ArrayType &ret)
+{
+  using Type               = typename ArrayType::Type;
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  assert(ret.shape() == array.shape());
+  details::ParallelVectorTransform(
+      array, ret, [](VectorRegisterType const &x) { return vectorize::exp(x); },
+      [](Type const &x) { return Type::Exp(x); });
+}
+
 template <typename ArrayType>
 meta::IfIsMathArray<ArrayType, ArrayType> Exp(ArrayType const &array)
 {
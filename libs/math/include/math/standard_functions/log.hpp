@@ -18,6 +18,8 @@
 //------------------------------------------------------------------------------
 
 #include "math/meta/math_type_traits.hpp"
+#include "math/parallel.hpp"
+#include "vectorise/math.hpp"
 
 #include <cassert>
 
@@ -85,7 +87,7 @@ meta::IfIsArithmetic<Type, Type> Log(Type const &x)
 }
 
 template <typename ArrayType>
-meta::IfIsMathArray<ArrayType, void> Log(ArrayType const &array, ArrayType &ret)
+meta::IfIsMathNonFixedPointArray<ArrayType, void> Log(ArrayType const &array, ArrayType &ret)
 {
   assert(ret.shape() == array.shape());
   auto it1 = array.cbegin();
@@ -98,6 +100,21 @@ meta::IfIsMathArray<ArrayType, void> Log(ArrayType const &array, ArrayType &ret)
   }
 }
 
+/**
+ * Natural logarithm of a fixed point array, evaluated with the packed kernel a register at a time
+ */
+template <typename ArrayType>
+meta::IfIsMathFixedPointArray<ArrayType, void> Log(ArrayType const &array, ArrayType &ret)
+{
+  using Type               = typename ArrayType::Type;
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  assert(ret.shape() == array.shape());
+  details::ParallelVectorTransform(
+      array, ret, [](VectorRegisterType const &x) { return vectorize::log(x); },
+      [](Type const &x) { return Type::Log(x); });
+}
+
 template <typename ArrayType>
 meta::IfIsMathArray<ArrayType, ArrayType> Log(ArrayType const &array)
 {
@@ -124,6 +124,7 @@ public:
   Tensor(Tensor &&other)      = default;
   Tensor(Tensor const &other) = default;
   Tensor(SizeVector const &dims);
+  Tensor(ContainerType data, SizeVector const &shape);
   virtual ~Tensor() = default;
 
   Tensor &operator=(Tensor const &other) = default;
@@ -354,15 +355,37 @@ public:
   /// Serialization operations ///
   ////////////////////////////////
 
+  // tensors are serialized with every column padded to a multiple of this many rows, which was
+  // the fixed padding in memory before the padding followed the vector register width of the build.
+  // This keeps the bytes (and the hashes of any state holding them) the same on every build
+  static constexpr SizeType SERIALIZATION_PADDING = 4;
+
   template <typename S>
   friend void Serialize(S &serializer, Tensor const &t)
   {
     serializer << t.size_;
     serializer << t.shape_;
-    // TODO (private 870)
-    for (std::size_t i = 0; i < t.data().padded_size(); ++i)
+
+    SizeType const height        = t.shape_.empty() ? SizeType{0} : t.shape_[0];
+    SizeType const padded_height = SerializedPadValue(height);
+    Type const     padding(0);
+
+    // the iterator walks the rows of each column in turn
+    SizeType row = 0;
+    auto     it  = t.cbegin();
+    while (it.is_valid())
     {
-      serializer << t.data()[i];
+      serializer << *it;
+      ++it;
+
+      if (++row == height)
+      {
+        for (SizeType i = height; i < padded_height; ++i)
+        {
+          serializer << padding;
+        }
+        row = 0;
+      }
     }
   }
 
@@ -374,11 +397,32 @@ public:
     serializer >> size;
     serializer >> shape;
 
+    if (size != Tensor::SizeFromShape(shape))
+    {
+      throw std::runtime_error("serialized tensor size does not match its shape");
+    }
+
     t.Reshape(shape);
 
-    for (std::size_t i = 0; i < t.data().padded_size(); ++i)
+    SizeType const height        = shape.empty() ? SizeType{0} : shape[0];
+    SizeType const padded_height = SerializedPadValue(height);
+    Type           padding(0);
+
+    SizeType row = 0;
+    auto     it  = t.begin();
+    while (it.is_valid())
     {
-      serializer >> t.data()[i];
+      serializer >> *it;
+      ++it;
+
+      if (++row == height)
+      {
+        for (SizeType i = height; i < padded_height; ++i)
+        {
+          serializer >> padding;
+        }
+        row = 0;
+      }
     }
   }
 
@@ -432,6 +476,14 @@ public:
     return PADDING;
   }
 
+  /**
+   * returns the smallest multiple of SERIALIZATION_PADDING which is greater than or equal to size
+   */
+  static SizeType SerializedPadValue(SizeType size)
+  {
+    return ((size + SERIALIZATION_PADDING - 1) / SERIALIZATION_PADDING) * SERIALIZATION_PADDING;
+  }
+
   /* @breif returns the smallest number which is a multiple of PADDING and greater than or equal to
    a desired size.
    * @param size is the size to be padded.
@@ -764,6 +816,24 @@ Tensor<T, C>::Tensor(SizeVector const &dims)
   Resize(dims);
 }
 
+/**
+ * Constructor builds a Tensor of the given shape over existing storage, without allocating or
+ * initialising it. The container must hold exactly the padded size of the shape, it is shared
+ * rather than copied
+ * @param data the storage, e.g. a slice of a larger array
+ * @param shape vector of lengths for each dimension
+ */
+template <typename T, typename C>
+Tensor<T, C>::Tensor(ContainerType data, SizeVector const &shape)
+  : data_(std::move(data))
+  , size_(Tensor::SizeFromShape(shape))
+  , shape_(shape)
+  , padded_height_(shape.empty() ? SizeType{0} : PadValue(shape[0]))
+{
+  assert(data_.size() == Tensor::PaddedSizeFromShape(shape));
+  UpdateStrides();
+}
+
 /////////////////////////////////
 /// Tensor methods: iterators ///
 /////////////////////////////////
@@ -822,8 +892,9 @@ typename Tensor<T, C>::ViewType Tensor<T, C>::View()
 {
   assert(shape_.size() >= 1);
 
-  SizeType N     = shape_.size() - 1;
-  SizeType width = shape_[N] * stride_[N] / padded_height_;
+  SizeType N                = shape_.size() - 1;
+  SizeType dimension_length = (N == 0 ? padded_height_ : shape_[N]);
+  SizeType width            = dimension_length * stride_[N] / padded_height_;
   return TensorView<Type, ContainerType>(data_, height(), width);
 }
 
@@ -838,8 +909,9 @@ typename Tensor<T, C>::ViewType const Tensor<T, C>::View() const
 {
   assert(shape_.size() >= 1);
 
-  SizeType N     = shape_.size() - 1;
-  SizeType width = shape_[N] * stride_[N] / padded_height_;
+  SizeType N                = shape_.size() - 1;
+  SizeType dimension_length = (N == 0 ? padded_height_ : shape_[N]);
+  SizeType width            = dimension_length * stride_[N] / padded_height_;
   return TensorView<Type, ContainerType>(data_, height(), width);
 }
 
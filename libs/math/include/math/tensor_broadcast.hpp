@@ -85,8 +85,9 @@ inline bool ShapeFromBroadcast(SizeVector const &a, SizeVector const &b, SizeVec
   return true;
 }
 
-template <typename T, typename C>
-inline bool UpgradeIteratorFromBroadcast(SizeVector const &a, TensorSliceIterator<T, C> &iterator)
+template <typename T, typename C, typename TensorType>
+inline bool UpgradeIteratorFromBroadcast(SizeVector const &a,
+                                         TensorSliceIterator<T, C, TensorType> &iterator)
 {
   assert(iterator.counter() == 0);   // Only upgrade untouched iterators.
   iterator.counter_ = uint64_t(-1);  // Invalidating the iterator
@@ -125,13 +126,22 @@ inline bool UpgradeIteratorFromBroadcast(SizeVector const &a, TensorSliceIterato
   return true;
 }
 
-template <typename F, typename T, typename C>
-inline bool Broadcast(F function, Tensor<T, C> &a, Tensor<T, C> &b, Tensor<T, C> &c)
+namespace details {
+
+template <typename IteratorA, typename IteratorB, typename F, typename TensorA, typename TensorB,
+          typename T, typename C>
+inline bool Broadcast(F function, TensorA &a, TensorB &b, Tensor<T, C> &c)
 {
   SizeVector cshape;
 
   ShapeFromBroadcast(a.shape(), b.shape(), cshape);
-  c.Reshape(cshape);
+
+  // storage of the right shape is kept, so that broadcasting into an existing tensor does not
+  // allocate
+  if (c.shape() != cshape)
+  {
+    c.Reshape(cshape);
+  }
 
   std::vector<SizeVector> rangeA, rangeB, rangeC;
   for (auto &i : a.shape())
@@ -149,8 +159,8 @@ inline bool Broadcast(F function, Tensor<T, C> &a, Tensor<T, C> &b, Tensor<T, C>
     rangeC.push_back({0, i});
   }
 
-  TensorSliceIterator<T, C> it_a(a, rangeA);
-  TensorSliceIterator<T, C> it_b(b, rangeB);
+  IteratorA                 it_a(a, rangeA);
+  IteratorB                 it_b(b, rangeB);
   TensorSliceIterator<T, C> it_c(c, rangeC);
 
   if (!UpgradeIteratorFromBroadcast(cshape, it_a))
@@ -175,5 +185,29 @@ inline bool Broadcast(F function, Tensor<T, C> &a, Tensor<T, C> &b, Tensor<T, C>
   return true;
 }
 
+}  // namespace details
+
+template <typename F, typename T, typename C>
+inline bool Broadcast(F function, Tensor<T, C> &a, Tensor<T, C> &b, Tensor<T, C> &c)
+{
+  return details::Broadcast<TensorSliceIterator<T, C>, TensorSliceIterator<T, C>>(function, a, b,
+                                                                                  c);
+}
+
+template <typename F, typename T, typename C>
+inline bool Broadcast(F function, Tensor<T, C> const &a, Tensor<T, C> const &b, Tensor<T, C> &c)
+{
+  // the result may be resized, so inputs which are the result are copied first
+  if ((&a == &c) || (&b == &c))
+  {
+    Tensor<T, C> a_copy = a.Copy();
+    Tensor<T, C> b_copy = b.Copy();
+    return Broadcast(function, a_copy, b_copy, c);
+  }
+
+  return details::Broadcast<ConstTensorSliceIterator<T, C>, ConstTensorSliceIterator<T, C>>(
+      function, a, b, c);
+}
+
 }  // namespace math
 }  // namespace fetch
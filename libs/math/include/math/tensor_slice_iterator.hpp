@@ -270,9 +270,9 @@ public:
     return counter_;
   }
 
-  template <typename A, typename B>
+  template <typename A, typename B, typename D>
   friend bool UpgradeIteratorFromBroadcast(std::vector<SizeType> const &,
-                                           TensorSliceIterator<A, B> &);
+                                           TensorSliceIterator<A, B, D> &);
 
   /**
    * returns the n-dimensional index of the current position
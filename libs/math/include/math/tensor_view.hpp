@@ -19,7 +19,10 @@
 
 #include "math/base_types.hpp"
 #include "math/tensor_iterator.hpp"
+#include "meta/log2.hpp"
+#include "vectorise/platform.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <type_traits>
 #include <utility>
@@ -39,9 +42,12 @@ public:
   using VectorRegisterType         = typename ContainerType::VectorRegisterType;
   using VectorRegisterIteratorType = typename ContainerType::VectorRegisterIteratorType;
 
+  // columns are padded to (at least) a whole vector register, so that every column starts on a
+  // register boundary for the vectorised kernels
   enum
   {
-    LOG_PADDING = 2,
+    LOG_PADDING = std::max<SizeType>(
+        2, fetch::meta::Log2(SizeType(platform::VectorRegisterSize<T>::value / (8 * sizeof(T))))),
     PADDING     = static_cast<SizeType>(1) << LOG_PADDING
   };
 
@@ -19,6 +19,8 @@
 
 #include "math/kernels/trigonometry.hpp"
 #include "math/meta/math_type_traits.hpp"
+#include "math/parallel.hpp"
+#include "vectorise/math.hpp"
 
 #include <cassert>
 
@@ -245,7 +247,8 @@ fetch::math::meta::IfIsMathArray<ArrayType, ArrayType> CosH(ArrayType const &x)
  * @param x - array
  */
 template <typename ArrayType>
-fetch::math::meta::IfIsMathArray<ArrayType, void> TanH(ArrayType const &x, ArrayType &ret)
+fetch::math::meta::IfIsMathNonFixedPointArray<ArrayType, void> TanH(ArrayType const &x,
+                                                                    ArrayType &      ret)
 {
   assert(ret.size() == x.size());
   kernels::TanH s;
@@ -259,6 +262,23 @@ fetch::math::meta::IfIsMathArray<ArrayType, void> TanH(ArrayType const &x, Array
   }
 }
 
+/**
+ * maps every element of the fixed point array x to ret = TanH(x), a register at a time
+ * @param x - array
+ */
+template <typename ArrayType>
+fetch::math::meta::IfIsMathFixedPointArray<ArrayType, void> TanH(ArrayType const &x,
+                                                                 ArrayType &      ret)
+{
+  using Type               = typename ArrayType::Type;
+  using VectorRegisterType = typename ArrayType::VectorRegisterType;
+
+  assert(ret.size() == x.size());
+  details::ParallelVectorTransform(
+      x, ret, [](VectorRegisterType const &a) { return vectorize::tanh(a); },
+      [](Type const &a) { return Type::TanH(a); });
+}
+
 template <typename ArrayType>
 fetch::math::meta::IfIsMathArray<ArrayType, ArrayType> TanH(ArrayType const &x)
 {
@@ -19,6 +19,7 @@
 #include "math/linalg/blas/gemm_tn_vector.hpp"
 
 #include "math/linalg/blas/base.hpp"
+#include "math/linalg/blas/gemm_packed.hpp"
 #include "math/linalg/prototype.hpp"
 #include "math/tensor_view.hpp"
 
@@ -32,8 +33,6 @@ void Blas<S, Signature(_C <= _alpha, _A, _B, _beta, _C),
      operator()(Type const alpha, TensorView<Type> const a, TensorView<Type> const b, Type const beta,
            TensorView<Type> c) const
 {
-  std::size_t i;
-  std::size_t j;
   if ((c.height() == 0) ||
       ((c.width() == 0) || (((alpha == static_cast<Type>(0.0)) || (a.height() == 0)) &&
                             (beta == static_cast<Type>(1.0)))))
@@ -45,7 +44,7 @@ void Blas<S, Signature(_C <= _alpha, _A, _B, _beta, _C),
   {
     if (beta == static_cast<Type>(0.0))
     {
-      for (j = 0; j < c.width(); ++j)
+      for (std::size_t j = 0; j < c.width(); ++j)
       {
 
         VectorRegisterType fetch_vec_zero(static_cast<Type>(0.0));
@@ -58,7 +57,7 @@ void Blas<S, Signature(_C <= _alpha, _A, _B, _beta, _C),
     }
     else
     {
-      for (j = 0; j < c.width(); ++j)
+      for (std::size_t j = 0; j < c.width(); ++j)
       {
 
         VectorRegisterType fetch_vec_beta(beta);
@@ -78,33 +77,8 @@ void Blas<S, Signature(_C <= _alpha, _A, _B, _beta, _C),
     return;
   }
 
-  for (j = 0; j < c.width(); ++j)
-  {
-    for (i = 0; i < c.height(); ++i)
-    {
-      Type temp;
-      temp = static_cast<Type>(0.0);
-
-      auto slice_a_i = a.data().slice(a.padded_height() * std::size_t(i), a.padded_height());
-      auto slice_b_j = b.data().slice(b.padded_height() * std::size_t(j), b.padded_height());
-      memory::TrivialRange range(std::size_t(0), std::size_t(a.height()));
-      temp = slice_a_i.in_parallel().SumReduce(
-          range,
-          [](VectorRegisterType const &vr_a_i, VectorRegisterType const &vr_b_j) {
-            return vr_a_i * vr_b_j;
-          },
-          slice_b_j);
-      if (beta == static_cast<Type>(0.0))
-      {
-        c(i, j) = alpha * temp;
-      }
-      else
-      {
-        c(i, j) = alpha * temp + beta * c(i, j);
-      }
-    }
-  }
-  return;
+  // the product itself is computed by the packed, cache blocked engine
+  details::GemmPacked<Type, VectorRegisterType>::template Apply<true, false>(alpha, a, b, beta, c);
 }
 
 template class Blas<double, Signature(_C <= _alpha, _A, _B, _beta, _C),
@@ -19,6 +19,7 @@
 #include "math/linalg/blas/gemm_tt_vector.hpp"
 
 #include "math/linalg/blas/base.hpp"
+#include "math/linalg/blas/gemm_packed.hpp"
 #include "math/linalg/prototype.hpp"
 #include "math/tensor_view.hpp"
 
@@ -35,8 +36,6 @@ void Blas<S, Signature(_C <= _alpha, _A, _B, _beta, _C),
                                                             Type const             beta,
                                                             TensorView<Type>       c) const
 {
-  std::size_t i;
-  std::size_t j;
   if ((c.height() == 0) ||
       ((c.width() == 0) || (((alpha == static_cast<Type>(0.0)) || (a.height() == 0)) &&
                             (beta == static_cast<Type>(1.0)))))
@@ -48,7 +47,7 @@ void Blas<S, Signature(_C <= _alpha, _A, _B, _beta, _C),
   {
     if (beta == static_cast<Type>(0.0))
     {
-      for (j = 0; j < c.width(); ++j)
+      for (std::size_t j = 0; j < c.width(); ++j)
       {
 
         VectorRegisterType fetch_vec_zero(static_cast<Type>(0.0));
@@ -61,7 +60,7 @@ void Blas<S, Signature(_C <= _alpha, _A, _B, _beta, _C),
     }
     else
     {
-      for (j = 0; j < c.width(); ++j)
+      for (std::size_t j = 0; j < c.width(); ++j)
       {
 
         VectorRegisterType fetch_vec_beta(beta);
@@ -81,29 +80,8 @@ void Blas<S, Signature(_C <= _alpha, _A, _B, _beta, _C),
     return;
   }
 
-  for (j = 0; j < c.width(); ++j)
-  {
-    for (i = 0; i < c.height(); ++i)
-    {
-      Type        temp;
-      std::size_t l;
-      temp = static_cast<Type>(0.0);
-      for (l = 0; l < a.height(); ++l)
-      {
-        temp = temp + a(l, i) * b(j, l);
-      }
-
-      if (beta == static_cast<Type>(0.0))
-      {
-        c(i, j) = alpha * temp;
-      }
-      else
-      {
-        c(i, j) = alpha * temp + beta * c(i, j);
-      }
-    }
-  }
-  return;
+  // the product itself is computed by the packed, cache blocked engine
+  details::GemmPacked<Type, VectorRegisterType>::template Apply<true, true>(alpha, a, b, beta, c);
 }
 
 template class Blas<double, Signature(_C <= _alpha, _A, _B, _beta, _C),
@@ -0,0 +1,216 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/linalg/blas/base.hpp"
+#include "math/linalg/blas/gemm_nn_novector.hpp"
+#include "math/linalg/blas/gemm_nn_vector.hpp"
+#include "math/linalg/blas/gemm_nt_novector.hpp"
+#include "math/linalg/blas/gemm_nt_vector.hpp"
+#include "math/linalg/blas/gemm_tn_novector.hpp"
+#include "math/linalg/blas/gemm_tn_vector.hpp"
+#include "math/linalg/blas/gemm_tt_novector.hpp"
+#include "math/linalg/blas/gemm_tt_vector.hpp"
+#include "math/linalg/prototype.hpp"
+#include "math/tensor.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+
+using namespace fetch;
+using namespace fetch::math;
+using namespace fetch::math::linalg;
+
+namespace {
+
+template <typename T>
+class BlasGemmPackedTests : public ::testing::Test
+{
+};
+
+using FloatingTypes = ::testing::Types<float, double>;
+TYPED_TEST_CASE(BlasGemmPackedTests, FloatingTypes);
+
+// the sizes are chosen to be larger than the blocking sizes of the packed engine and to not be
+// multiples of the micro-tile dimensions, so that all the edge cases are exercised
+struct Dimensions
+{
+  SizeType m;
+  SizeType n;
+  SizeType k;
+};
+
+Dimensions const DIMENSIONS[] = {{1, 1, 1}, {7, 5, 3}, {33, 17, 9}, {300, 270, 517}};
+
+// the operands of the sub view cases are taken from the middle of larger tensors, with heights
+// which are not multiples of the register size
+Dimensions const SUB_VIEW_DIMENSIONS[] = {{5, 3, 7}, {33, 17, 9}, {131, 70, 259}};
+SizeType const   COLUMN_OFFSET         = 3;
+
+/**
+ * Create a view onto the columns [col, col + width) of a matrix
+ */
+template <typename Type>
+typename Tensor<Type>::ViewType ColumnView(Tensor<Type> &tensor, SizeType col, SizeType width)
+{
+  return typename Tensor<Type>::ViewType(tensor.data(), tensor.height(), width,
+                                         col * tensor.padded_height());
+}
+
+/**
+ * Compare the vectorised (packed) implementation against the reference (non vectorised) one for
+ * op(A) being m x k and op(B) being k x n
+ */
+template <typename Type, typename Vectorised, typename Reference>
+void CheckAgainstReference(bool trans_a, bool trans_b, Type alpha, Type beta)
+{
+  Vectorised vectorised;
+  Reference  reference;
+
+  for (auto const &dims : DIMENSIONS)
+  {
+    Tensor<Type> a(trans_a ? std::vector<SizeType>{dims.k, dims.m}
+                           : std::vector<SizeType>{dims.m, dims.k});
+    Tensor<Type> b(trans_b ? std::vector<SizeType>{dims.n, dims.k}
+                           : std::vector<SizeType>{dims.k, dims.n});
+    Tensor<Type> c({dims.m, dims.n});
+
+    a.FillUniformRandom();
+    b.FillUniformRandom();
+    c.FillUniformRandom();
+
+    Tensor<Type> expected = c.Copy();
+
+    reference(alpha, a.View(), b.View(), beta, expected.View());
+    vectorised(alpha, a.View(), b.View(), beta, c.View());
+
+    EXPECT_TRUE(expected.AllClose(c, Type(1e-4), Type(1e-4)))
+        << "m: " << dims.m << " n: " << dims.n << " k: " << dims.k;
+  }
+}
+
+/**
+ * Compare the vectorised (packed) implementation against the reference (non vectorised) one when
+ * A, B and C are views onto a range of columns of larger matrices, as is the case for slices of a
+ * tensor. The columns either side of the view of C must be left untouched.
+ */
+template <typename Type, typename Vectorised, typename Reference>
+void CheckSubViewsAgainstReference(bool trans_a, bool trans_b, Type alpha, Type beta)
+{
+  Vectorised vectorised;
+  Reference  reference;
+
+  for (auto const &dims : SUB_VIEW_DIMENSIONS)
+  {
+    SizeType const a_height = trans_a ? dims.k : dims.m;
+    SizeType const a_width  = trans_a ? dims.m : dims.k;
+    SizeType const b_height = trans_b ? dims.n : dims.k;
+    SizeType const b_width  = trans_b ? dims.k : dims.n;
+
+    Tensor<Type> a({a_height, a_width + 2 * COLUMN_OFFSET});
+    Tensor<Type> b({b_height, b_width + 2 * COLUMN_OFFSET});
+    Tensor<Type> c({dims.m, dims.n + 2 * COLUMN_OFFSET});
+
+    a.FillUniformRandom();
+    b.FillUniformRandom();
+    c.FillUniformRandom();
+
+    Tensor<Type> expected = c.Copy();
+
+    auto a_view        = ColumnView(a, COLUMN_OFFSET, a_width);
+    auto b_view        = ColumnView(b, COLUMN_OFFSET, b_width);
+    auto c_view        = ColumnView(c, COLUMN_OFFSET, dims.n);
+    auto expected_view = ColumnView(expected, COLUMN_OFFSET, dims.n);
+
+    reference(alpha, a_view, b_view, beta, expected_view);
+    vectorised(alpha, a_view, b_view, beta, c_view);
+
+    EXPECT_TRUE(expected.AllClose(c, Type(1e-4), Type(1e-4)))
+        << "m: " << dims.m << " n: " << dims.n << " k: " << dims.k;
+  }
+}
+
+TYPED_TEST(BlasGemmPackedTests, gemm_nn_matches_reference)
+{
+  using Type = TypeParam;
+
+  using Vectorised = Blas<Type, Signature(_C <= _alpha, _A, _B, _beta, _C),
+                          Computes(_C <= _alpha * _A * _B + _beta * _C),
+                          platform::Parallelisation::VECTORISE>;
+  using Reference  = Blas<Type, Signature(_C <= _alpha, _A, _B, _beta, _C),
+                         Computes(_C <= _alpha * _A * _B + _beta * _C),
+                         platform::Parallelisation::NOT_PARALLEL>;
+
+  CheckAgainstReference<Type, Vectorised, Reference>(false, false, Type(1), Type(0));
+  CheckAgainstReference<Type, Vectorised, Reference>(false, false, Type(0.5), Type(-1.5));
+  CheckSubViewsAgainstReference<Type, Vectorised, Reference>(false, false, Type(1), Type(0));
+  CheckSubViewsAgainstReference<Type, Vectorised, Reference>(false, false, Type(0.5), Type(-1.5));
+}
+
+TYPED_TEST(BlasGemmPackedTests, gemm_nt_matches_reference)
+{
+  using Type = TypeParam;
+
+  using Vectorised = Blas<Type, Signature(_C <= _alpha, _A, _B, _beta, _C),
+                          Computes(_C <= _alpha * _A * T(_B) + _beta * _C),
+                          platform::Parallelisation::VECTORISE>;
+  using Reference  = Blas<Type, Signature(_C <= _alpha, _A, _B, _beta, _C),
+                         Computes(_C <= _alpha * _A * T(_B) + _beta * _C),
+                         platform::Parallelisation::NOT_PARALLEL>;
+
+  CheckAgainstReference<Type, Vectorised, Reference>(false, true, Type(1), Type(0));
+  CheckAgainstReference<Type, Vectorised, Reference>(false, true, Type(0.5), Type(-1.5));
+  CheckSubViewsAgainstReference<Type, Vectorised, Reference>(false, true, Type(1), Type(0));
+  CheckSubViewsAgainstReference<Type, Vectorised, Reference>(false, true, Type(0.5), Type(-1.5));
+}
+
+TYPED_TEST(BlasGemmPackedTests, gemm_tn_matches_reference)
+{
+  using Type = TypeParam;
+
+  using Vectorised = Blas<Type, Signature(_C <= _alpha, _A, _B, _beta, _C),
+                          Computes(_C <= _alpha * T(_A) * _B + _beta * _C),
+                          platform::Parallelisation::VECTORISE>;
+  using Reference  = Blas<Type, Signature(_C <= _alpha, _A, _B, _beta, _C),
+                         Computes(_C <= _alpha * T(_A) * _B + _beta * _C),
+                         platform::Parallelisation::NOT_PARALLEL>;
+
+  CheckAgainstReference<Type, Vectorised, Reference>(true, false, Type(1), Type(0));
+  CheckAgainstReference<Type, Vectorised, Reference>(true, false, Type(0.5), Type(-1.5));
+  CheckSubViewsAgainstReference<Type, Vectorised, Reference>(true, false, Type(1), Type(0));
+  CheckSubViewsAgainstReference<Type, Vectorised, Reference>(true, false, Type(0.5), Type(-1.5));
+}
+
+TYPED_TEST(BlasGemmPackedTests, gemm_tt_matches_reference)
+{
+  using Type = TypeParam;
+
+  using Vectorised = Blas<Type, Signature(_C <= _alpha, _A, _B, _beta, _C),
+                          Computes(_C <= _alpha * T(_A) * T(_B) + _beta * _C),
+                          platform::Parallelisation::VECTORISE>;
+  using Reference  = Blas<Type, Signature(_C <= _alpha, _A, _B, _beta, _C),
+                         Computes(_C <= _alpha * T(_A) * T(_B) + _beta * _C),
+                         platform::Parallelisation::NOT_PARALLEL>;
+
+  CheckAgainstReference<Type, Vectorised, Reference>(true, true, Type(1), Type(0));
+  CheckAgainstReference<Type, Vectorised, Reference>(true, true, Type(0.5), Type(-1.5));
+  CheckSubViewsAgainstReference<Type, Vectorised, Reference>(true, true, Type(1), Type(0));
+  CheckSubViewsAgainstReference<Type, Vectorised, Reference>(true, true, Type(0.5), Type(-1.5));
+}
+
+}  // namespace
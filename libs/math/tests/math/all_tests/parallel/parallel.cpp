@@ -0,0 +1,310 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/activation_functions/sigmoid.hpp"
+#include "math/activation_functions/softmax.hpp"
+#include "math/base_types.hpp"
+#include "math/fundamental_operators.hpp"
+#include "math/matrix_operations.hpp"
+#include "math/parallel.hpp"
+#include "math/standard_functions/exp.hpp"
+#include "math/standard_functions/log.hpp"
+#include "math/tensor.hpp"
+#include "math/trigonometry.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/threading/compute_pool.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using fetch::math::SizeType;
+using fetch::math::SizeVector;
+
+/**
+ * Run the parallel regions on several threads, however many cores the machine running the tests has
+ */
+class ComputePoolEnvironment : public ::testing::Environment
+{
+public:
+  void SetUp() override
+  {
+    fetch::threading::ComputePool::SetDefaultConcurrency(4);
+  }
+};
+
+::testing::Environment *const compute_pool_environment =
+    ::testing::AddGlobalTestEnvironment(new ComputePoolEnvironment);
+
+template <typename T>
+class ParallelTensorTest : public ::testing::Test
+{
+};
+
+using MyTypes = ::testing::Types<int64_t, double>;
+TYPED_TEST_CASE(ParallelTensorTest, MyTypes);
+
+// shapes which are well above the parallel grain, with heights which are not a multiple of the
+// padding so that the runs of elements do not line up with the columns
+std::vector<SizeVector> const SHAPES = {{100003}, {37, 1901}, {7, 13, 1013}};
+
+/**
+ * Fill the tensor with (small, exactly representable) values which depend on the element position
+ */
+template <typename TensorType>
+void Fill(TensorType &tensor, int64_t offset)
+{
+  using Type = typename TensorType::Type;
+
+  int64_t index = 0;
+  for (auto &value : tensor)
+  {
+    value = static_cast<Type>(((index * 7) + offset) % 101) - static_cast<Type>(50);
+    ++index;
+  }
+}
+
+TYPED_TEST(ParallelTensorTest, elementwise_operations_match_serial)
+{
+  using TensorType = fetch::math::Tensor<TypeParam>;
+
+  for (auto const &shape : SHAPES)
+  {
+    TensorType a{shape};
+    TensorType b{shape};
+    Fill(a, 3);
+    Fill(b, 11);
+
+    TensorType sum{shape};
+    TensorType product{shape};
+    TensorType scaled{shape};
+    fetch::math::Add(a, b, sum);
+    fetch::math::Multiply(a, b, product);
+    fetch::math::Multiply(a, TypeParam(3), scaled);
+
+    auto ait = a.cbegin();
+    auto bit = b.cbegin();
+    auto sit = sum.cbegin();
+    auto pit = product.cbegin();
+    auto cit = scaled.cbegin();
+    while (ait.is_valid())
+    {
+      ASSERT_EQ(*ait + *bit, *sit);
+      ASSERT_EQ(*ait * *bit, *pit);
+      ASSERT_EQ(TypeParam(3) * *ait, *cit);
+      ++ait;
+      ++bit;
+      ++sit;
+      ++pit;
+      ++cit;
+    }
+  }
+}
+
+TYPED_TEST(ParallelTensorTest, reductions_match_serial)
+{
+  using TensorType = fetch::math::Tensor<TypeParam>;
+
+  for (auto const &shape : SHAPES)
+  {
+    TensorType a{shape};
+    Fill(a, 5);
+
+    TypeParam expected_sum = 0;
+    TypeParam expected_max = fetch::math::numeric_lowest<TypeParam>();
+    TypeParam expected_min = fetch::math::numeric_max<TypeParam>();
+    for (auto const &value : a)
+    {
+      expected_sum += value;
+      expected_max = std::max(expected_max, value);
+      expected_min = std::min(expected_min, value);
+    }
+
+    EXPECT_EQ(expected_sum, fetch::math::Sum(a));
+    EXPECT_EQ(expected_max, fetch::math::Max(a));
+    EXPECT_EQ(expected_min, fetch::math::Min(a));
+  }
+}
+
+TYPED_TEST(ParallelTensorTest, runs_cover_every_element_once)
+{
+  using TensorType = fetch::math::Tensor<TypeParam>;
+
+  TensorType a{SizeVector{37, 1901}};
+
+  std::vector<uint32_t> visits(a.data().padded_size(), 0);
+  fetch::math::details::ForEachRun(a, 0, a.size(), [&visits](SizeType offset, SizeType count) {
+    for (SizeType i = offset; i < offset + count; ++i)
+    {
+      ++visits[i];
+    }
+  });
+
+  // every element is visited exactly once and the padding is never touched
+  for (SizeType i = 0; i < visits.size(); ++i)
+  {
+    SizeType const row = i % a.padded_height();
+    EXPECT_EQ(((row < a.height()) && (i < (a.padded_height() * 1901))) ? 1u : 0u, visits[i]);
+  }
+}
+
+template <typename T>
+class ParallelFixedPointTensorTest : public ::testing::Test
+{
+};
+
+using FixedPointTypes = ::testing::Types<fetch::fixed_point::fp32_t, fetch::fixed_point::fp64_t>;
+TYPED_TEST_CASE(ParallelFixedPointTensorTest, FixedPointTypes);
+
+/**
+ * Fill the tensor with values from -16 to 16 which depend on the element position, covering the
+ * domains of the packed kernels and beyond
+ */
+template <typename TensorType>
+void FillFixedPoint(TensorType &tensor, int64_t offset)
+{
+  using Type = typename TensorType::Type;
+
+  int64_t index = 0;
+  for (auto &value : tensor)
+  {
+    value = Type::FromBase(static_cast<typename Type::Type>(
+        ((((index * 7919) + offset) % 65537) - 32768) * (Type::ONE_MASK >> 11)));
+    ++index;
+  }
+}
+
+TYPED_TEST(ParallelFixedPointTensorTest, vectorised_functions_match_serial)
+{
+  using Type       = TypeParam;
+  using TensorType = fetch::math::Tensor<Type>;
+
+  for (auto const &shape : SHAPES)
+  {
+    TensorType a{shape};
+    TensorType b{shape};
+    FillFixedPoint(a, 3);
+    FillFixedPoint(b, 11);
+
+    TensorType product{shape};
+    fetch::math::Multiply(a, b, product);
+    TensorType const exp     = fetch::math::Exp(a);
+    TensorType const log     = fetch::math::Log(a);
+    TensorType const tanh    = fetch::math::TanH(a);
+    TensorType const sigmoid = fetch::math::Sigmoid(a);
+
+    auto ait = a.cbegin();
+    auto bit = b.cbegin();
+    auto pit = product.cbegin();
+    auto eit = exp.cbegin();
+    auto lit = log.cbegin();
+    auto tit = tanh.cbegin();
+    auto sit = sigmoid.cbegin();
+    while (ait.is_valid())
+    {
+      Type const e = Type::Exp(*ait);
+
+      ASSERT_EQ((*ait * *bit).Data(), (*pit).Data());
+      ASSERT_EQ(e.Data(), (*eit).Data());
+      ASSERT_EQ(Type::Log(*ait).Data(), (*lit).Data());
+      ASSERT_EQ(Type::TanH(*ait).Data(), (*tit).Data());
+      if (*ait >= Type{0})
+      {
+        ASSERT_EQ((Type{1} / (Type::Exp(Type{-1} * *ait) + Type{1})).Data(), (*sit).Data());
+      }
+      else
+      {
+        ASSERT_EQ((e / (e + Type{1})).Data(), (*sit).Data());
+      }
+      ++ait;
+      ++bit;
+      ++pit;
+      ++eit;
+      ++lit;
+      ++tit;
+      ++sit;
+    }
+  }
+}
+
+TYPED_TEST(ParallelFixedPointTensorTest, state_of_every_thread_is_raised)
+{
+  using Type       = TypeParam;
+  using TensorType = fetch::math::Tensor<Type>;
+
+  ASSERT_GT(fetch::threading::ComputePool::Instance().concurrency(), 1u);
+
+  TensorType a{SizeVector{100003}};
+  TensorType b{SizeVector{100003}};
+  FillFixedPoint(a, 3);
+  FillFixedPoint(b, 11);
+
+  TensorType ret{SizeVector{100003}};
+  Type::StateClear();
+  fetch::math::Add(a, b, ret);
+  fetch::math::Multiply(a, b, ret);
+  EXPECT_FALSE(Type::IsStateOverflow());
+
+  // a single overflowing element, the state must be raised whichever thread computes it
+  a.At(99999) = Type::FP_MAX;
+  b.At(99999) = Type::FP_MAX;
+
+  Type::StateClear();
+  fetch::math::Multiply(a, b, ret);
+  EXPECT_TRUE(Type::IsStateOverflow());
+
+  Type::StateClear();
+  fetch::math::Add(a, b, ret);
+  EXPECT_TRUE(Type::IsStateOverflow());
+
+  Type::StateClear();
+}
+
+TYPED_TEST(ParallelFixedPointTensorTest, vectorised_softmax_matches_serial)
+{
+  using Type       = TypeParam;
+  using TensorType = fetch::math::Tensor<Type>;
+
+  TensorType a{SizeVector{100003}};
+  FillFixedPoint(a, 7);
+
+  TensorType const softmax = fetch::math::Softmax(a);
+
+  Type const        max = fetch::math::Max(a);
+  std::vector<Type> expected;
+  Type              sum{0};
+  for (auto const &value : a)
+  {
+    expected.emplace_back(fetch::math::Exp(value - max));
+    sum += expected.back();
+  }
+
+  SizeType index = 0;
+  for (auto const &value : softmax)
+  {
+    ASSERT_EQ((expected[index] / sum).Data(), value.Data());
+    ++index;
+  }
+}
+
+}  // namespace
@@ -21,6 +21,9 @@
 
 #include "gtest/gtest.h"
 
+#include <stdexcept>
+#include <vector>
+
 template <typename T>
 class SerializersTest : public ::testing::Test
 {
@@ -29,6 +32,37 @@ class SerializersTest : public ::testing::Test
 using MyTypes = ::testing::Types<int, long, float, double>;
 TYPED_TEST_CASE(SerializersTest, MyTypes);
 
+/**
+ * The bytes of a tensor counting up from 0 in the serialized format: the element count, the shape
+ * and then every column padded to a multiple of 4 rows
+ */
+template <typename T>
+fetch::serializers::ByteArrayBuffer SerializePadded(fetch::math::SizeType height,
+                                                    fetch::math::SizeType width)
+{
+  using SizeType = fetch::math::SizeType;
+
+  fetch::serializers::ByteArrayBuffer b;
+  b << SizeType{height * width};
+  b << std::vector<SizeType>({height, width});
+
+  T value(0);
+  for (SizeType j = 0; j < width; ++j)
+  {
+    for (SizeType i = 0; i < height; ++i)
+    {
+      b << value;
+      value++;
+    }
+    for (SizeType i = height; i % 4 != 0; ++i)
+    {
+      b << T(0);
+    }
+  }
+
+  return b;
+}
+
 TYPED_TEST(SerializersTest, serialize_empty_tensor)
 {
   fetch::math::Tensor<TypeParam>      t1;
@@ -59,3 +93,56 @@ TYPED_TEST(SerializersTest, serialize_tensor)
 
   EXPECT_EQ(t1, t2);
 }
+
+TYPED_TEST(SerializersTest, serialized_bytes_do_not_depend_on_padding)
+{
+  // the height is not a multiple of 4, so every column is written with a row of padding
+  fetch::math::Tensor<TypeParam> t({3, 5});
+  TypeParam                      i(0);
+  for (auto &e : t)
+  {
+    e = i;
+    i++;
+  }
+  fetch::serializers::ByteArrayBuffer b;
+  b << t;
+
+  EXPECT_EQ(b.data(), SerializePadded<TypeParam>(3, 5).data());
+}
+
+TYPED_TEST(SerializersTest, deserialize_padded_tensor)
+{
+  auto b = SerializePadded<TypeParam>(3, 5);
+  b.seek(0);
+
+  fetch::math::Tensor<TypeParam> t;
+  b >> t;
+
+  fetch::math::Tensor<TypeParam> expected({3, 5});
+  TypeParam                      i(0);
+  for (auto &e : expected)
+  {
+    e = i;
+    i++;
+  }
+
+  EXPECT_EQ(t.shape(), expected.shape());
+  EXPECT_EQ(t, expected);
+  EXPECT_EQ(b.tell(), b.size());
+
+  // and it is written back to the same bytes
+  fetch::serializers::ByteArrayBuffer rewritten;
+  rewritten << t;
+  EXPECT_EQ(rewritten.data(), b.data());
+}
+
+TYPED_TEST(SerializersTest, deserialize_mismatched_size_throws)
+{
+  fetch::serializers::ByteArrayBuffer b;
+  b << fetch::math::SizeType{16};
+  b << std::vector<fetch::math::SizeType>({3, 5});
+  b.seek(0);
+
+  fetch::math::Tensor<TypeParam> t;
+  EXPECT_THROW(b >> t, std::runtime_error);
+}
@@ -23,9 +23,8 @@
 #include "ledger/chain/digest.hpp"
 #include "ledger/chain/transaction_layout.hpp"
 #include "meta/log2.hpp"
-#include "miner/transaction_layout_queue.hpp"
+#include "miner/transaction_pool.hpp"
 #include "telemetry/telemetry.hpp"
-#include "vectorise/threading/pool.hpp"
 
 #include <cstddef>
 #include <cstdint>
@@ -34,13 +33,12 @@ namespace fetch {
 namespace miner {
 
 /**
- * Simplistic greedy search algorithm for generating / packing blocks. Has rudimentary support to
- * parallelize the packing over a number of threads.
+ * Greedy search algorithm for generating / packing blocks.
  *
- * Internally the miner maintains 2 queues. One which is the pending queue which is populated when
- * a new transaction is added to the miner. When block generation begins, this pending queue is
- * transferred to the main queue when it is evaluated in order to generate new blocks. During this
- * operation the main queue is locked.
+ * Internally the miner maintains a transaction pool. New transactions are added to the pool's
+ * (sharded) ingestion queue. When block generation begins, the ingestion queue is flushed into the
+ * pool's fee ordered lane indices, from which each of the slices is populated in turn. During this
+ * operation the mining pool is locked.
  */
 class BasicMiner : public ledger::BlockPackerInterface
 {
@@ -71,36 +69,18 @@ public:
   BasicMiner &operator=(BasicMiner &&) = delete;
 
 private:
-  using Mutex      = mutex::Mutex;
-  using ThreadPool = threading::Pool;
-  using Queue      = TransactionLayoutQueue;
-
-  /// @name Packing Operations
-  /// @{
-  static void GenerateSlices(Queue &transactions, Block::Body &block, std::size_t offset,
-                             std::size_t interval, std::size_t num_lanes);
-  static void GenerateSlice(Queue &transactions, Block::Slice &slice, std::size_t slice_index,
-                            std::size_t num_lanes);
-  static bool SortByFee(TransactionLayout const &a, TransactionLayout const &b);
-  /// @}
+  using Mutex = mutex::Mutex;
+  using Pool  = TransactionPool;
 
   /// @name Configuration
   /// @{
-  uint32_t       log2_num_lanes_;   ///< The log2 of the number of lanes
-  uint32_t const max_num_threads_;  ///< The configured maximum number of threads
-  ThreadPool     thread_pool_;      ///< The thread pool used to dispatch work
-  /// @}
-
-  /// @name Pending Queue
-  /// @{
-  mutable Mutex pending_lock_{__LINE__, __FILE__};  ///< Pending queue lock (priority 1)
-  Queue         pending_;                           ///< The main mining queue for the node
+  uint32_t log2_num_lanes_;  ///< The log2 of the number of lanes
   /// @}
 
-  /// @name Central Mining Pool Queue
+  /// @name Central Mining Pool
   /// @{
-  mutable Mutex mining_pool_lock_{__LINE__, __FILE__};  ///< Mining pool lock (priority 0)
-  Queue         mining_pool_;                           ///< The main mining queue for the node
+  mutable Mutex mining_pool_lock_{__LINE__, __FILE__};  ///< Mining pool (index) lock
+  Pool          mining_pool_;                           ///< The main mining pool for the node
   /// @}
 
   /// @name Telemetry
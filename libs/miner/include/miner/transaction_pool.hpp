@@ -0,0 +1,137 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/mutex.hpp"
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/digest.hpp"
+#include "ledger/chain/transaction_layout.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace fetch {
+namespace miner {
+
+/**
+ * The pool of transactions (layouts) which are waiting to be packed into blocks.
+ *
+ * The pool is made up of two parts:
+ *
+ * - The ingestion queue. New transactions are added to one of a number of independently locked
+ *   shards (selected by digest) so that concurrent producers do not contend on a single lock.
+ *
+ * - The index. Once flushed from the ingestion queue, every transaction is held in a fee ordered
+ *   index for each of the lanes that it touches. Slices are then generated by repeatedly taking
+ *   the best transaction from the heads of the indices of the lanes which are still free, so that
+ *   neither a sort of the whole pool nor a scan over it is required. Insertion and removal by
+ *   digest are O(log n).
+ *
+ * Add() is thread safe, all the other operations must be externally synchronised.
+ */
+class TransactionPool
+{
+public:
+  using TransactionLayout = ledger::TransactionLayout;
+  using Digest            = ledger::Digest;
+  using DigestSet         = ledger::DigestSet;
+  using Slice             = ledger::Block::Slice;
+
+  static constexpr std::size_t NUM_SHARDS = 16;
+
+  // Construction / Destruction
+  explicit TransactionPool(uint32_t log2_num_lanes);
+  TransactionPool(TransactionPool const &) = delete;
+  TransactionPool(TransactionPool &&)      = delete;
+  ~TransactionPool()                       = default;
+
+  /// @name Ingestion
+  /// @{
+  bool        Add(TransactionLayout const &layout);
+  std::size_t pending_size() const;
+  /// @}
+
+  /// @name Index
+  /// @{
+  std::size_t      Flush();
+  bool             Remove(Digest const &digest);
+  std::size_t      Remove(DigestSet const &digests);
+  void             GenerateSlice(Slice &slice);
+  std::size_t      size() const;
+  bool             empty() const;
+  DigestSet const &digests() const;
+  /// @}
+
+  // Operators
+  TransactionPool &operator=(TransactionPool const &) = delete;
+  TransactionPool &operator=(TransactionPool &&) = delete;
+
+private:
+  using Mutex   = mutex::Mutex;
+  using Layouts = std::vector<TransactionLayout>;
+  using Lanes   = std::vector<std::size_t>;
+
+  struct Entry
+  {
+    TransactionLayout layout;    ///< The layout of the transaction
+    Lanes             lanes;     ///< The indices of the lanes used by the transaction
+    uint64_t          sequence;  ///< The order in which the transaction was added to the index
+  };
+
+  using EntryPtr = std::unique_ptr<Entry>;
+  using Entries  = ledger::DigestMap<EntryPtr>;
+
+  /**
+   * Orders the entries by decreasing fee, ties are broken by the order of arrival
+   */
+  struct ByFee
+  {
+    bool operator()(Entry const *a, Entry const *b) const;
+  };
+
+  using LaneIndex = std::set<Entry const *, ByFee>;
+  using Indices   = std::vector<LaneIndex>;
+
+  struct Shard
+  {
+    mutable Mutex lock{__LINE__, __FILE__};  ///< Lock protecting the shard
+    Layouts       layouts;                   ///< The layouts waiting to be indexed
+    DigestSet     digests;                   ///< The digests of the waiting layouts
+  };
+
+  using Shards = std::array<Shard, NUM_SHARDS>;
+
+  bool AddToIndex(TransactionLayout const &layout);
+  void RemoveFromIndex(Entries::iterator it);
+
+  std::size_t const        num_lanes_;         ///< The number of lanes
+  Shards                   shards_;            ///< The ingestion queue shards
+  std::atomic<std::size_t> pending_size_{0};   ///< The number of layouts waiting to be indexed
+  Entries                  entries_;           ///< The indexed layouts (by digest)
+  DigestSet                digests_;           ///< The digests of the indexed layouts
+  Indices                  indices_;           ///< Fee ordered index of the entries for each lane
+  uint64_t                 next_sequence_{0};  ///< The sequence number of the next entry
+};
+
+}  // namespace miner
+}  // namespace fetch
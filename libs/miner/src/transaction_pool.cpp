@@ -0,0 +1,333 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/bitvector.hpp"
+#include "miner/transaction_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace miner {
+
+constexpr std::size_t TransactionPool::NUM_SHARDS;
+
+/**
+ * Construct the transaction pool
+ *
+ * @param log2_num_lanes Log2 of the number of lanes
+ */
+TransactionPool::TransactionPool(uint32_t log2_num_lanes)
+  : num_lanes_{std::size_t{1} << log2_num_lanes}
+  , indices_(num_lanes_ + 1u)  // the final index holds the transactions which use no lanes
+{}
+
+/**
+ * Add a transaction layout to the ingestion queue. Thread safe.
+ *
+ * @param layout The layout to be added
+ * @return true if successful, otherwise false if the layout is already waiting to be indexed
+ */
+bool TransactionPool::Add(TransactionLayout const &layout)
+{
+  auto &shard = shards_[ledger::DigestHashAdapter{}(layout.digest()) % NUM_SHARDS];
+
+  FETCH_LOCK(shard.lock);
+
+  if (!shard.digests.insert(layout.digest()).second)
+  {
+    return false;
+  }
+
+  shard.layouts.emplace_back(layout);
+  ++pending_size_;
+
+  return true;
+}
+
+/**
+ * Get the number of layouts waiting to be indexed. Thread safe.
+ *
+ * @return The number of layouts
+ */
+std::size_t TransactionPool::pending_size() const
+{
+  return pending_size_;
+}
+
+/**
+ * Move the contents of the ingestion queue into the index
+ *
+ * @return The number of (non duplicate) layouts which were added to the index
+ */
+std::size_t TransactionPool::Flush()
+{
+  std::size_t count{0};
+
+  for (auto &shard : shards_)
+  {
+    Layouts layouts{};
+
+    // keep the shard locked for as short a time as possible
+    {
+      FETCH_LOCK(shard.lock);
+
+      std::swap(layouts, shard.layouts);
+      shard.digests.clear();
+      pending_size_ -= layouts.size();
+    }
+
+    for (auto const &layout : layouts)
+    {
+      if (AddToIndex(layout))
+      {
+        ++count;
+      }
+    }
+  }
+
+  return count;
+}
+
+/**
+ * Remove a transaction from the index
+ *
+ * @param digest The digest of the transaction to be removed
+ * @return true if successful, otherwise false
+ */
+bool TransactionPool::Remove(Digest const &digest)
+{
+  auto it = entries_.find(digest);
+  if (it == entries_.end())
+  {
+    return false;
+  }
+
+  RemoveFromIndex(it);
+  return true;
+}
+
+/**
+ * Remove a set of transactions from the index
+ *
+ * @param digests The digests of the transactions to be removed
+ * @return The number of transactions which were removed
+ */
+std::size_t TransactionPool::Remove(DigestSet const &digests)
+{
+  std::size_t count{0};
+
+  for (auto const &digest : digests)
+  {
+    if (Remove(digest))
+    {
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * Populate a slice with the highest fee transactions which do not share any lanes, removing them
+ * from the index
+ *
+ * @param slice The slice to be populated
+ */
+void TransactionPool::GenerateSlice(Slice &slice)
+{
+  using Cursor = std::pair<LaneIndex::const_iterator, std::size_t>;
+
+  // the cursor which points at the best remaining transaction is kept at the front of the heap
+  auto const worse = [](Cursor const &a, Cursor const &b) {
+    return ByFee{}(*b.first, *a.first);
+  };
+
+  std::vector<Cursor> cursors{};
+  for (std::size_t lane = 0; lane < indices_.size(); ++lane)
+  {
+    if (!indices_[lane].empty())
+    {
+      cursors.emplace_back(indices_[lane].begin(), lane);
+    }
+  }
+  std::make_heap(cursors.begin(), cursors.end(), worse);
+
+  BitVector   slice_state{num_lanes_};
+  std::size_t used_lanes{0};
+  DigestSet   selected{};
+
+  while (!cursors.empty() && (used_lanes < num_lanes_))
+  {
+    std::pop_heap(cursors.begin(), cursors.end(), worse);
+    Cursor &cursor = cursors.back();
+
+    std::size_t const lane = cursor.second;
+
+    // once a lane has been used there is nothing further to be gained from its index
+    if ((lane < num_lanes_) && slice_state.bit(lane))
+    {
+      cursors.pop_back();
+      continue;
+    }
+
+    Entry const &entry = **cursor.first;
+
+    // determine if there are collisions
+    bool const collision =
+        std::any_of(entry.lanes.begin(), entry.lanes.end(),
+                    [&slice_state](std::size_t l) { return slice_state.bit(l) != 0; });
+
+    if (!collision)
+    {
+      for (auto const l : entry.lanes)
+      {
+        slice_state.set(l, 1);
+      }
+      used_lanes += entry.lanes.size();
+
+      // insert the transaction into the slice
+      slice.push_back(entry.layout);
+      selected.insert(entry.layout.digest());
+    }
+
+    // advance on to the next transaction in this lane
+    if (++cursor.first == indices_[lane].end())
+    {
+      cursors.pop_back();
+    }
+    else
+    {
+      std::push_heap(cursors.begin(), cursors.end(), worse);
+    }
+  }
+
+  // the selected transactions can only be removed once all of the cursors have been discarded
+  Remove(selected);
+}
+
+/**
+ * Get the number of transactions in the index
+ *
+ * @return The number of transactions
+ */
+std::size_t TransactionPool::size() const
+{
+  return entries_.size();
+}
+
+/**
+ * Determine if the index is empty
+ *
+ * @return true if there are no transactions in the index, otherwise false
+ */
+bool TransactionPool::empty() const
+{
+  return entries_.empty();
+}
+
+/**
+ * Get the digests of all the transactions in the index
+ *
+ * @return The set of digests
+ */
+TransactionPool::DigestSet const &TransactionPool::digests() const
+{
+  return digests_;
+}
+
+bool TransactionPool::ByFee::operator()(Entry const *a, Entry const *b) const
+{
+  if (a->layout.charge() != b->layout.charge())
+  {
+    return a->layout.charge() > b->layout.charge();
+  }
+
+  return a->sequence < b->sequence;
+}
+
+/**
+ * Internal: Add a layout to the index
+ *
+ * @param layout The layout to be added
+ * @return true if successful, otherwise false if the layout is already present
+ */
+bool TransactionPool::AddToIndex(TransactionLayout const &layout)
+{
+  auto const &digest = layout.digest();
+
+  if (entries_.find(digest) != entries_.end())
+  {
+    return false;
+  }
+
+  auto entry = std::make_unique<Entry>(Entry{layout, {}, next_sequence_++});
+
+  auto const &mask = layout.mask();
+  for (std::size_t lane = 0; lane < num_lanes_; ++lane)
+  {
+    if (mask.bit(lane))
+    {
+      entry->lanes.push_back(lane);
+    }
+  }
+
+  if (entry->lanes.empty())
+  {
+    indices_[num_lanes_].insert(entry.get());
+  }
+
+  for (auto const lane : entry->lanes)
+  {
+    indices_[lane].insert(entry.get());
+  }
+
+  digests_.insert(digest);
+  entries_.emplace(digest, std::move(entry));
+
+  return true;
+}
+
+/**
+ * Internal: Remove an entry from the index
+ *
+ * @param it The iterator to the entry to be removed
+ */
+void TransactionPool::RemoveFromIndex(Entries::iterator it)
+{
+  Entry const *entry = it->second.get();
+
+  if (entry->lanes.empty())
+  {
+    indices_[num_lanes_].erase(entry);
+  }
+
+  for (auto const lane : entry->lanes)
+  {
+    indices_[lane].erase(entry);
+  }
+
+  digests_.erase(it->first);
+  entries_.erase(it);
+}
+
+}  // namespace miner
+}  // namespace fetch
@@ -0,0 +1,267 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/bitvector.hpp"
+#include "ledger/chain/block.hpp"
+#include "ledger/chain/digest.hpp"
+#include "ledger/chain/transaction_layout.hpp"
+#include "miner/transaction_pool.hpp"
+#include "tx_generator.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::ledger::Block;
+using fetch::ledger::DigestSet;
+using fetch::ledger::TransactionLayout;
+using fetch::miner::TransactionPool;
+using TransactionPoolPtr = std::unique_ptr<TransactionPool>;
+
+constexpr uint32_t LOG2_NUM_LANES = 2;
+constexpr uint32_t NUM_LANES      = 1u << LOG2_NUM_LANES;
+
+class TransactionPoolTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    pool_ = std::make_unique<TransactionPool>(LOG2_NUM_LANES);
+    generator_.Seed();
+  }
+
+  void TearDown() override
+  {
+    pool_.reset();
+  }
+
+  /**
+   * Create a layout with the specified charge which uses only the specified lanes
+   */
+  TransactionLayout Generate(std::vector<uint32_t> const &lanes, uint64_t charge)
+  {
+    BitVector mask{NUM_LANES};
+    for (auto const lane : lanes)
+    {
+      mask.set(lane, 1);
+    }
+
+    return {generator_(0).digest(), mask, charge, 1, 1000};
+  }
+
+  TransactionPoolPtr   pool_;
+  TransactionGenerator generator_{LOG2_NUM_LANES};
+};
+
+TEST_F(TransactionPoolTests, CheckAdditionsAreOnlyIndexedOnFlush)
+{
+  auto const tx1 = Generate({0}, 10);
+  auto const tx2 = Generate({1}, 10);
+
+  EXPECT_TRUE(pool_->Add(tx1));
+  EXPECT_TRUE(pool_->Add(tx2));
+  EXPECT_EQ(pool_->pending_size(), 2u);
+  EXPECT_TRUE(pool_->empty());
+
+  EXPECT_EQ(pool_->Flush(), 2u);
+  EXPECT_EQ(pool_->pending_size(), 0u);
+  EXPECT_EQ(pool_->size(), 2u);
+  EXPECT_EQ(pool_->digests().count(tx1.digest()), 1u);
+  EXPECT_EQ(pool_->digests().count(tx2.digest()), 1u);
+}
+
+TEST_F(TransactionPoolTests, CheckDuplicatesAreRejected)
+{
+  auto const tx = Generate({0}, 10);
+
+  // duplicates in the ingestion queue are rejected immediately
+  EXPECT_TRUE(pool_->Add(tx));
+  EXPECT_FALSE(pool_->Add(tx));
+  EXPECT_EQ(pool_->Flush(), 1u);
+
+  // duplicates of indexed transactions are rejected when flushed
+  EXPECT_TRUE(pool_->Add(tx));
+  EXPECT_EQ(pool_->Flush(), 0u);
+  EXPECT_EQ(pool_->size(), 1u);
+}
+
+TEST_F(TransactionPoolTests, CheckRemoval)
+{
+  auto const tx1 = Generate({0}, 10);
+  auto const tx2 = Generate({0, 1}, 20);
+  auto const tx3 = Generate({}, 30);
+
+  pool_->Add(tx1);
+  pool_->Add(tx2);
+  pool_->Add(tx3);
+  pool_->Flush();
+
+  EXPECT_TRUE(pool_->Remove(tx2.digest()));
+  EXPECT_FALSE(pool_->Remove(tx2.digest()));
+  EXPECT_EQ(pool_->Remove(DigestSet{tx1.digest(), tx2.digest(), tx3.digest()}), 2u);
+  EXPECT_TRUE(pool_->empty());
+  EXPECT_TRUE(pool_->digests().empty());
+
+  // removed transactions should never be packed
+  Block::Slice slice{};
+  pool_->GenerateSlice(slice);
+  EXPECT_TRUE(slice.empty());
+}
+
+TEST_F(TransactionPoolTests, CheckSlicesArePackedInFeeOrder)
+{
+  auto const low      = Generate({0, 1}, 10);
+  auto const high     = Generate({1, 2}, 30);
+  auto const medium   = Generate({0}, 20);
+  auto const filler   = Generate({3}, 5);
+  auto const conflict = Generate({2, 3}, 25);
+
+  for (auto const &tx : {low, high, medium, filler, conflict})
+  {
+    pool_->Add(tx);
+  }
+  pool_->Flush();
+
+  Block::Slice slice{};
+  pool_->GenerateSlice(slice);
+
+  // high is selected first, which then excludes both low and conflict
+  ASSERT_EQ(slice.size(), 3u);
+  EXPECT_EQ(slice[0].digest(), high.digest());
+  EXPECT_EQ(slice[1].digest(), medium.digest());
+  EXPECT_EQ(slice[2].digest(), filler.digest());
+  EXPECT_EQ(pool_->size(), 2u);
+
+  Block::Slice next_slice{};
+  pool_->GenerateSlice(next_slice);
+
+  ASSERT_EQ(next_slice.size(), 2u);
+  EXPECT_EQ(next_slice[0].digest(), conflict.digest());
+  EXPECT_EQ(next_slice[1].digest(), low.digest());
+  EXPECT_TRUE(pool_->empty());
+}
+
+TEST_F(TransactionPoolTests, CheckEqualFeesArePackedInArrivalOrder)
+{
+  auto const tx1 = Generate({0}, 10);
+  auto const tx2 = Generate({0}, 10);
+
+  pool_->Add(tx1);
+  pool_->Flush();
+  pool_->Add(tx2);
+  pool_->Flush();
+
+  Block::Slice slice{};
+  pool_->GenerateSlice(slice);
+
+  ASSERT_EQ(slice.size(), 1u);
+  EXPECT_EQ(slice[0].digest(), tx1.digest());
+}
+
+TEST_F(TransactionPoolTests, CheckTransactionsWithoutLanesArePacked)
+{
+  auto const tx1 = Generate({}, 10);
+  auto const tx2 = Generate({}, 20);
+  auto const tx3 = Generate({0}, 15);
+
+  pool_->Add(tx1);
+  pool_->Add(tx2);
+  pool_->Add(tx3);
+  pool_->Flush();
+
+  Block::Slice slice{};
+  pool_->GenerateSlice(slice);
+
+  ASSERT_EQ(slice.size(), 3u);
+  EXPECT_EQ(slice[0].digest(), tx2.digest());
+  EXPECT_EQ(slice[1].digest(), tx3.digest());
+  EXPECT_EQ(slice[2].digest(), tx1.digest());
+}
+
+TEST_F(TransactionPoolTests, CheckGeneratedSlicesNeverCollide)
+{
+  static constexpr std::size_t NUM_TRANSACTIONS = 500;
+
+  TransactionGenerator generator{LOG2_NUM_LANES};
+  for (std::size_t i = 0; i < NUM_TRANSACTIONS; ++i)
+  {
+    pool_->Add(generator(2));
+  }
+  EXPECT_EQ(pool_->Flush(), NUM_TRANSACTIONS);
+
+  std::size_t num_packed{0};
+  while (!pool_->empty())
+  {
+    Block::Slice slice{};
+    pool_->GenerateSlice(slice);
+    ASSERT_FALSE(slice.empty());
+
+    BitVector slice_state{NUM_LANES};
+    for (auto const &layout : slice)
+    {
+      EXPECT_EQ((slice_state & layout.mask()).PopCount(), 0u);
+      slice_state |= layout.mask();
+    }
+
+    num_packed += slice.size();
+  }
+
+  EXPECT_EQ(num_packed, NUM_TRANSACTIONS);
+}
+
+TEST_F(TransactionPoolTests, CheckConcurrentAdditions)
+{
+  static constexpr std::size_t NUM_THREADS       = 4;
+  static constexpr std::size_t NUM_TX_PER_THREAD = 250;
+  static constexpr std::size_t NUM_TRANSACTIONS  = NUM_THREADS * NUM_TX_PER_THREAD;
+
+  std::vector<TransactionLayout> layouts{};
+  for (std::size_t i = 0; i < NUM_TRANSACTIONS; ++i)
+  {
+    layouts.emplace_back(generator_(1));
+  }
+
+  std::vector<std::thread> threads{};
+  for (std::size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([this, &layouts, i]() {
+      for (std::size_t j = i; j < layouts.size(); j += NUM_THREADS)
+      {
+        pool_->Add(layouts[j]);
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(pool_->pending_size(), NUM_TRANSACTIONS);
+  EXPECT_EQ(pool_->Flush(), NUM_TRANSACTIONS);
+  EXPECT_EQ(pool_->size(), NUM_TRANSACTIONS);
+}
+
+}  // namespace
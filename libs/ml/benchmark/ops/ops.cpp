@@ -114,9 +114,15 @@ void BM_MatrixMultiply_Backward(benchmark::State &state)
   inputs.push_back(input_2);
   fetch::ml::ops::MatrixMultiply<fetch::math::Tensor<T>> matmul;
 
+  std::vector<fetch::math::Tensor<T>> output;
+  for (auto const &input : inputs)
+  {
+    output.emplace_back(input.get().shape());
+  }
+
   for (auto _ : state)
   {
-    matmul.Backward(inputs, err_sig);
+    matmul.Backward(inputs, err_sig, output);
   }
 }
 
@@ -223,9 +229,15 @@ void BM_SqrtBackward(benchmark::State &state)
   inputs.push_back(input);
   fetch::ml::ops::Sqrt<fetch::math::Tensor<T>> sqrt1;
 
+  std::vector<fetch::math::Tensor<T>> output;
+  for (auto const &input : inputs)
+  {
+    output.emplace_back(input.get().shape());
+  }
+
   for (auto _ : state)
   {
-    sqrt1.Backward(inputs, error_signal);
+    sqrt1.Backward(inputs, error_signal, output);
   }
 }
 
@@ -325,9 +337,15 @@ void BM_LogBackward(benchmark::State &state)
   inputs.push_back(input);
   fetch::ml::ops::Log<fetch::math::Tensor<T>> log1;
 
+  std::vector<fetch::math::Tensor<T>> output;
+  for (auto const &input : inputs)
+  {
+    output.emplace_back(input.get().shape());
+  }
+
   for (auto _ : state)
   {
-    log1.Backward(inputs, error_signal);
+    log1.Backward(inputs, error_signal, output);
   }
 }
 
@@ -421,9 +439,15 @@ void BM_ExpBackward(benchmark::State &state)
   inputs.push_back(input);
   fetch::ml::ops::Exp<fetch::math::Tensor<T>> exp1;
 
+  std::vector<fetch::math::Tensor<T>> output;
+  for (auto const &input : inputs)
+  {
+    output.emplace_back(input.get().shape());
+  }
+
   for (auto _ : state)
   {
-    exp1.Backward(inputs, error_signal);
+    exp1.Backward(inputs, error_signal, output);
   }
 }
 
@@ -533,9 +557,15 @@ void BM_DivideBackward(benchmark::State &state)
   inputs.push_back(input_2);
   fetch::ml::ops::Divide<fetch::math::Tensor<T>> div1;
 
+  std::vector<fetch::math::Tensor<T>> output;
+  for (auto const &input : inputs)
+  {
+    output.emplace_back(input.get().shape());
+  }
+
   for (auto _ : state)
   {
-    div1.Backward(inputs, error_signal);
+    div1.Backward(inputs, error_signal, output);
   }
 }
 
@@ -655,9 +685,15 @@ void BM_MultiplyBackward(benchmark::State &state)
   inputs.push_back(input_2);
   fetch::ml::ops::Multiply<fetch::math::Tensor<T>> mul1;
 
+  std::vector<fetch::math::Tensor<T>> output;
+  for (auto const &input : inputs)
+  {
+    output.emplace_back(input.get().shape());
+  }
+
   for (auto _ : state)
   {
-    mul1.Backward(inputs, error_signal);
+    mul1.Backward(inputs, error_signal, output);
   }
 }
 
@@ -769,9 +805,15 @@ void BM_AddBackward(benchmark::State &state)
   inputs.push_back(input_2);
   fetch::ml::ops::Add<fetch::math::Tensor<T>> add1;
 
+  std::vector<fetch::math::Tensor<T>> output;
+  for (auto const &input : inputs)
+  {
+    output.emplace_back(input.get().shape());
+  }
+
   for (auto _ : state)
   {
-    add1.Backward(inputs, error_signal);
+    add1.Backward(inputs, error_signal, output);
   }
 }
 
@@ -881,9 +923,15 @@ void BM_SubtractBackward(benchmark::State &state)
   inputs.push_back(input_2);
   fetch::ml::ops::Subtract<fetch::math::Tensor<T>> sub1;
 
+  std::vector<fetch::math::Tensor<T>> output;
+  for (auto const &input : inputs)
+  {
+    output.emplace_back(input.get().shape());
+  }
+
   for (auto _ : state)
   {
-    sub1.Backward(inputs, error_signal);
+    sub1.Backward(inputs, error_signal, output);
   }
 }
 
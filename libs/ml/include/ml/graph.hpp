@@ -17,6 +17,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "ml/memory_planner.hpp"
 #include "ml/meta/ml_type_traits.hpp"
 #include "ml/node.hpp"
 #include "ml/ops/weights.hpp"
@@ -24,10 +25,13 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <limits>
+#include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -43,7 +47,9 @@ class Graph
 public:
   using ArrayType          = T;
   using ArrayPtrType       = std::shared_ptr<ArrayType>;
+  using ContainerType      = typename ArrayType::ContainerType;
   using SizeType           = typename ArrayType::SizeType;
+  using SizeVector         = std::vector<SizeType>;
   using DataType           = typename ArrayType::Type;
   using NodePtrType        = typename std::shared_ptr<fetch::ml::NodeInterface<ArrayType>>;
   using TrainablePtrType   = typename std::shared_ptr<fetch::ml::ops::Trainable<ArrayType>>;
@@ -79,7 +85,58 @@ public:
 
   void ResetGradients();
 
+  void SetMemoryPlanning(bool enabled);
+
 private:
+  /**
+   * Storage assigned to the output of one node by a memory plan, and for training to the error
+   * signals the node passes to its inputs
+   */
+  struct PlannedOutput
+  {
+    NodePtrType            node;
+    ArrayType              output;
+    bool                   clear_before_forward;
+    std::vector<ArrayType> error_signals;
+  };
+
+  /**
+   * The arena for one evaluation of a node with a given set of input shapes, along with the views
+   * into it that the nodes of the evaluation write their outputs to
+   */
+  struct MemoryPlan
+  {
+    ContainerType              arena;
+    std::vector<PlannedOutput> outputs;
+    bool                       shares_memory = false;
+  };
+
+  /**
+   * The nodes a node depends on in the order Evaluate computes them, ending with the node itself,
+   * and the memory plans built for it keyed by the training flag and the shapes of its inputs
+   */
+  struct EvaluationSchedule
+  {
+    std::vector<NodePtrType>         nodes;
+    std::vector<PlaceholderPtrType>  inputs;
+    std::map<SizeVector, MemoryPlan> memory_plans;
+  };
+
+  // upper bound on the number of input shapes that arenas are kept for, per evaluated node
+  static constexpr SizeType MAX_MEMORY_PLANS = 8;
+
+  EvaluationSchedule &GetSchedule(std::string const &node_name);
+  void                AddToSchedule(NodePtrType const &node,
+                                    std::unordered_set<NodeInterface<ArrayType> const *> &visited,
+                                    EvaluationSchedule &schedule);
+  SizeVector          MemoryPlanKey(EvaluationSchedule const &schedule, bool is_training) const;
+  void BuildMemoryPlan(EvaluationSchedule &schedule, SizeVector const &key, bool is_training);
+  void AddBackwardSteps(NodePtrType const &                                                    node,
+                        std::unordered_map<NodeInterface<ArrayType> const *, SizeType> const &steps,
+                        std::vector<std::pair<SizeType, SizeType>> &backward_steps,
+                        SizeType &                                  step) const;
+  bool IsPlannable(NodePtrType const &node) const;
+
   void ApplyRegularisation();
 
   template <class OperationType>
@@ -101,6 +158,11 @@ protected:
   std::unordered_map<std::string, NodePtrType> nodes_;
   std::unordered_map<std::string, SizeType>    trainable_lookup_;
   std::vector<TrainablePtrType>                trainable_;
+
+private:
+  std::unordered_map<std::string, EvaluationSchedule>  schedules_;
+  std::unordered_set<NodeInterface<ArrayType> const *> unplanned_nodes_;
+  bool                                                 memory_planning_ = true;
 };
 
 /**
@@ -143,20 +205,84 @@ bool Graph<ArrayType>::SetRegularisation(std::string node_name, RegPtrType regul
 
 /**
  * Evaluates the output of a node (calling all necessary forward prop)
+ *
+ * The first evaluation for a set of input shapes runs with the nodes' own outputs, and the shapes
+ * it produces are used to plan a single arena for the outputs of every node involved. Later
+ * evaluations with the same input shapes write into that arena instead of allocating. For
+ * training the arena also holds the error signals of the backward pass that follows. Outside of
+ * training the outputs which are no longer needed share memory, and elementwise ops overwrite
+ * their input, after which the intermediate results are released
  * @param node_name name of node to evaluate for output
+ * @param is_training whether the evaluation is part of a training step
  * @return pointer to array containing node output
  */
 template <typename ArrayType>
 ArrayType Graph<ArrayType>::Evaluate(std::string const &node_name, bool is_training)
 {
-  if (nodes_[node_name])
+  NodePtrType node = nodes_[node_name];
+
+  if (!node)
   {
-    return nodes_[node_name]->Evaluate(is_training);
+    throw std::runtime_error("Cannot evaluate: node [" + node_name + "] not in graph");
   }
-  else
+
+  if (!memory_planning_)
   {
-    throw std::runtime_error("Cannot evaluate: node [" + node_name + "] not in graph");
+    return node->Evaluate(is_training);
+  }
+
+  EvaluationSchedule &schedule = GetSchedule(node_name);
+  SizeVector const    key      = MemoryPlanKey(schedule, is_training);
+
+  auto plan_it = schedule.memory_plans.find(key);
+  if (plan_it == schedule.memory_plans.end())
+  {
+    ArrayType ret = node->Evaluate(is_training);
+    BuildMemoryPlan(schedule, key, is_training);
+    return ret;
+  }
+
+  MemoryPlan &plan = plan_it->second;
+  for (auto &planned : plan.outputs)
+  {
+    planned.node->SetOutputStorage(planned.output, planned.clear_before_forward);
+    if (!planned.error_signals.empty())
+    {
+      planned.node->SetErrorSignalStorage(planned.error_signals);
+    }
+  }
+
+  ArrayType ret = node->Evaluate(is_training);
+
+  // ops which replace their output tensor rather than writing to it can not be planned
+  bool plan_followed = true;
+  for (auto const &planned : plan.outputs)
+  {
+    if (planned.node->GetCachedOutput().data().pointer() != planned.output.data().pointer())
+    {
+      unplanned_nodes_.insert(planned.node.get());
+      plan_followed = false;
+    }
   }
+
+  // the memory of intermediate results is reused, so they must be recomputed if needed again
+  if (plan.shares_memory)
+  {
+    for (auto const &planned : plan.outputs)
+    {
+      if (planned.node != node)
+      {
+        planned.node->SetOutputStorage(ArrayType{}, false);
+      }
+    }
+  }
+
+  if (!plan_followed)
+  {
+    schedules_.clear();
+  }
+
+  return ret;
 }
 
 /**
@@ -228,6 +354,9 @@ std::string Graph<ArrayType>::AddNode(std::string const &             node_name,
   auto op      = std::make_shared<Node<ArrayType, OperationType>>(name, params...);
   nodes_[name] = op;
 
+  // the evaluation order and memory plans of nodes may change
+  schedules_.clear();
+
   // assign inputs and outputs
   for (auto const &i : inputs)
   {
@@ -363,6 +492,18 @@ void Graph<ArrayType>::ResetGradients()
   }
 }
 
+/**
+ * Turns planning of the memory for node outputs on or off. When off, every node keeps its own
+ * output tensor, as it does for the first evaluation of each input shape
+ * @param enabled whether Evaluate should use memory plans
+ */
+template <typename ArrayType>
+void Graph<ArrayType>::SetMemoryPlanning(bool enabled)
+{
+  memory_planning_ = enabled;
+  schedules_.clear();
+}
+
 /**
  * Add gradient values to weight for each trainable
  * @param grad vector of gradient values for each trainable stored in ArrayType
@@ -378,6 +519,261 @@ void Graph<ArrayType>::ApplyGradients(std::vector<ArrayType> &grad)
   }
 }
 
+/**
+ * Returns the order in which evaluating a node computes the nodes it depends on, building it on
+ * first use
+ * @param node_name name of the node to be evaluated
+ * @return the schedule of the node
+ */
+template <typename ArrayType>
+typename Graph<ArrayType>::EvaluationSchedule &Graph<ArrayType>::GetSchedule(
+    std::string const &node_name)
+{
+  auto it = schedules_.find(node_name);
+  if (it != schedules_.end())
+  {
+    return it->second;
+  }
+
+  EvaluationSchedule &                                 schedule = schedules_[node_name];
+  std::unordered_set<NodeInterface<ArrayType> const *> visited;
+  AddToSchedule(nodes_.at(node_name), visited, schedule);
+
+  return schedule;
+}
+
+/**
+ * Internal: appends a node to a schedule after its inputs, in the same depth first order as
+ * Node::Evaluate gathers them
+ */
+template <typename ArrayType>
+void Graph<ArrayType>::AddToSchedule(NodePtrType const &                                   node,
+                                     std::unordered_set<NodeInterface<ArrayType> const *> &visited,
+                                     EvaluationSchedule &schedule)
+{
+  if (!visited.insert(node.get()).second)
+  {
+    return;
+  }
+
+  for (auto const &input : node->GetInputs())
+  {
+    AddToSchedule(input, visited, schedule);
+  }
+
+  schedule.nodes.emplace_back(node);
+
+  PlaceholderPtrType placeholder = std::dynamic_pointer_cast<PlaceholderType>(node);
+  if (placeholder)
+  {
+    schedule.inputs.emplace_back(placeholder);
+  }
+}
+
+/**
+ * Internal: the memory plan of a schedule depends on the training flag and on the shapes of the
+ * placeholders and weights it reads
+ */
+template <typename ArrayType>
+typename Graph<ArrayType>::SizeVector Graph<ArrayType>::MemoryPlanKey(
+    EvaluationSchedule const &schedule, bool is_training) const
+{
+  SizeVector key{static_cast<SizeType>(is_training)};
+
+  for (auto const &input : schedule.inputs)
+  {
+    SizeVector const shape = input->ComputeOutputShape({});
+    key.emplace_back(shape.size());
+    key.insert(key.end(), shape.begin(), shape.end());
+  }
+
+  return key;
+}
+
+/**
+ * Internal: placeholders and weights hand out the tensors they hold, and nodes found replacing
+ * their output tensor rather than writing to it, keep their own outputs
+ */
+template <typename ArrayType>
+bool Graph<ArrayType>::IsPlannable(NodePtrType const &node) const
+{
+  return !std::dynamic_pointer_cast<PlaceholderType>(node) &&
+         (unplanned_nodes_.find(node.get()) == unplanned_nodes_.end());
+}
+
+/**
+ * Plans the memory for the outputs of a schedule from the shapes of the last evaluation.
+ *
+ * For training every output stays alive for backpropagation, which is planned as the steps after
+ * the forward pass. The error signals a node passes to its inputs are needed while the backward
+ * pass visits the node and its inputs, so those of nodes visited one after another share memory.
+ * Otherwise an output is only kept until the last node reading it has been computed, the
+ * evaluated node is kept apart from all others, and an elementwise op whose input dies with it
+ * writes over that input
+ * @param schedule the schedule to plan for
+ * @param key the training flag and input shapes the plan is used for
+ * @param is_training whether the plan is for training
+ */
+template <typename ArrayType>
+void Graph<ArrayType>::BuildMemoryPlan(EvaluationSchedule &schedule, SizeVector const &key,
+                                       bool is_training)
+{
+  static constexpr SizeType NO_BUFFER = std::numeric_limits<SizeType>::max();
+
+  std::vector<NodePtrType> const &nodes = schedule.nodes;
+  SizeType const                  last  = nodes.size() - 1;
+
+  std::unordered_map<NodeInterface<ArrayType> const *, SizeType> steps;
+  for (SizeType i = 0; i < nodes.size(); ++i)
+  {
+    steps[nodes[i].get()] = i;
+  }
+
+  // the first and last step of the backward pass at which the error signals of each node are used
+  std::vector<std::pair<SizeType, SizeType>> backward_steps(nodes.size(), {NO_BUFFER, 0});
+  SizeType                                   last_step = last;
+  if (is_training)
+  {
+    ++last_step;
+    AddBackwardSteps(nodes[last], steps, backward_steps, last_step);
+  }
+
+  // the last step at which every output is read
+  std::vector<SizeType> last_use(nodes.size());
+  for (SizeType i = 0; i < nodes.size(); ++i)
+  {
+    last_use[i] = is_training ? last_step : i;
+    for (auto const &input : nodes[i]->GetInputs())
+    {
+      SizeType &input_last_use = last_use[steps.at(input.get())];
+      input_last_use           = std::max(input_last_use, i);
+    }
+  }
+
+  // columns of the views must start on register boundaries just as for separate tensors
+  MemoryPlanner planner(std::max<SizeType>(ArrayType::PADDING, 64 / sizeof(DataType)));
+
+  std::vector<SizeType> buffers(nodes.size(), NO_BUFFER);
+  std::vector<bool>     in_place(nodes.size(), false);
+
+  for (SizeType i = 0; i < nodes.size(); ++i)
+  {
+    NodePtrType const &node = nodes[i];
+
+    if (!IsPlannable(node))
+    {
+      continue;
+    }
+
+    SizeVector const &shape = node->GetCachedOutput().shape();
+
+    // the outputs were served from the cache, so their shapes can not be relied on
+    if (node->GetCachedOutput().size() == 0)
+    {
+      return;
+    }
+
+    if (!is_training && (i != last) && node->CanRunInPlace() && (node->GetInputs().size() == 1))
+    {
+      SizeType const input = steps.at(node->GetInputs().front().get());
+
+      if ((buffers[input] != NO_BUFFER) && (last_use[input] == i) &&
+          (nodes[input]->GetCachedOutput().shape() == shape))
+      {
+        buffers[i]  = buffers[input];
+        in_place[i] = true;
+        planner.ExtendLifetime(buffers[i], last_use[i]);
+        continue;
+      }
+    }
+
+    SizeType const first_use = (i == last) ? 0 : i;
+    buffers[i] = planner.AddBuffer(ArrayType::PaddedSizeFromShape(shape), first_use, last_use[i]);
+  }
+
+  std::vector<SizeVector> error_buffers(nodes.size());
+  if (is_training)
+  {
+    for (SizeType i = 0; i < nodes.size(); ++i)
+    {
+      if (buffers[i] == NO_BUFFER)
+      {
+        continue;
+      }
+
+      assert(backward_steps[i].first != NO_BUFFER);
+      for (auto const &input : nodes[i]->GetInputs())
+      {
+        SizeVector const &input_shape = input->GetCachedOutput().shape();
+        error_buffers[i].emplace_back(planner.AddBuffer(ArrayType::PaddedSizeFromShape(input_shape),
+                                                        backward_steps[i].first,
+                                                        backward_steps[i].second));
+      }
+    }
+  }
+
+  MemoryPlan plan;
+  plan.arena = ContainerType(planner.Plan());
+  plan.arena.SetAllZero();
+  plan.shares_memory = !is_training;
+
+  for (SizeType i = 0; i < nodes.size(); ++i)
+  {
+    if (buffers[i] == NO_BUFFER)
+    {
+      continue;
+    }
+
+    ContainerType storage(plan.arena, planner.Offset(buffers[i]), planner.Size(buffers[i]));
+    bool const    clear = plan.shares_memory && (i != last) && !in_place[i];
+
+    std::vector<ArrayType> error_signals;
+    auto                   input_it = nodes[i]->GetInputs().begin();
+    for (SizeType const buffer : error_buffers[i])
+    {
+      ContainerType error_storage(plan.arena, planner.Offset(buffer), planner.Size(buffer));
+      error_signals.emplace_back(error_storage, (*input_it)->GetCachedOutput().shape());
+      ++input_it;
+    }
+
+    plan.outputs.emplace_back(PlannedOutput{nodes[i],
+                                            ArrayType(storage, nodes[i]->GetCachedOutput().shape()),
+                                            clear, std::move(error_signals)});
+  }
+
+  if (schedule.memory_plans.size() >= MAX_MEMORY_PLANS)
+  {
+    schedule.memory_plans.clear();
+  }
+  schedule.memory_plans.emplace(key, std::move(plan));
+}
+
+/**
+ * Internal: numbers the steps of a backward pass from a node in the order the nodes visit their
+ * inputs, widening the range of steps at which each node is visited
+ * @param node the node being visited
+ * @param steps the positions of the nodes in the schedule
+ * @param backward_steps the first and last step at which each node of the schedule is visited
+ * @param step the step at which the node is visited, advanced past the visit of its inputs
+ */
+template <typename ArrayType>
+void Graph<ArrayType>::AddBackwardSteps(
+    NodePtrType const &                                                    node,
+    std::unordered_map<NodeInterface<ArrayType> const *, SizeType> const &steps,
+    std::vector<std::pair<SizeType, SizeType>> &backward_steps, SizeType &step) const
+{
+  std::pair<SizeType, SizeType> &range = backward_steps[steps.at(node.get())];
+  range.first                          = std::min(range.first, step);
+
+  for (auto const &input : node->GetInputs())
+  {
+    ++step;
+    AddBackwardSteps(input, steps, backward_steps, step);
+  }
+
+  range.second = std::max(range.second, step);
+}
+
 /**
  * Appends op to map of trainable nodes. Called by AddNode if the node is for a trainable op
  * @tparam OperationType template class of operation
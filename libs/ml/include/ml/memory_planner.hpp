@@ -0,0 +1,232 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace fetch {
+namespace ml {
+
+/**
+ * Assigns buffers with known lifetimes to offsets in a single arena, such that no two buffers
+ * which are alive at the same step overlap in memory. Lifetimes are inclusive ranges of steps in
+ * an execution schedule, offsets and the arena size are in elements.
+ *
+ * Buffers are placed greedily from the largest down, each one into the smallest gap left between
+ * the already placed buffers whose lifetimes intersect its own.
+ */
+class MemoryPlanner
+{
+public:
+  using SizeType = std::uint64_t;
+
+  explicit MemoryPlanner(SizeType alignment = 1);
+
+  SizeType AddBuffer(SizeType size, SizeType first_step, SizeType last_step);
+  void     ExtendLifetime(SizeType buffer, SizeType last_step);
+  SizeType Plan();
+
+  SizeType Offset(SizeType buffer) const;
+  SizeType Size(SizeType buffer) const;
+  SizeType ArenaSize() const;
+  SizeType BufferCount() const;
+
+private:
+  struct Buffer
+  {
+    SizeType size;
+    SizeType first_step;
+    SizeType last_step;
+    SizeType offset;
+  };
+
+  SizeType Align(SizeType value) const;
+  bool     Overlaps(Buffer const &a, Buffer const &b) const;
+
+  SizeType            alignment_;
+  std::vector<Buffer> buffers_;
+  SizeType            arena_size_ = 0;
+  bool                planned_    = false;
+};
+
+/**
+ * @param alignment every offset is a multiple of this number of elements
+ */
+inline MemoryPlanner::MemoryPlanner(SizeType alignment)
+  : alignment_(std::max(alignment, SizeType{1}))
+{}
+
+/**
+ * Registers a buffer which is written at first_step and last read at last_step
+ * @param size number of elements in the buffer
+ * @param first_step step at which the buffer is produced
+ * @param last_step last step at which the buffer is consumed
+ * @return the id of the buffer
+ */
+inline MemoryPlanner::SizeType MemoryPlanner::AddBuffer(SizeType size, SizeType first_step,
+                                                        SizeType last_step)
+{
+  assert(first_step <= last_step);
+  buffers_.push_back(Buffer{size, first_step, last_step, 0});
+  planned_ = false;
+  return buffers_.size() - 1;
+}
+
+/**
+ * Keeps a buffer alive until at least last_step, used when a later step takes the buffer over
+ * to write its own output in place
+ * @param buffer the id of the buffer
+ * @param last_step the new last step
+ */
+inline void MemoryPlanner::ExtendLifetime(SizeType buffer, SizeType last_step)
+{
+  assert(buffer < buffers_.size());
+  buffers_[buffer].last_step = std::max(buffers_[buffer].last_step, last_step);
+  planned_                   = false;
+}
+
+/**
+ * Assigns an offset to every buffer
+ * @return the number of elements the arena needs
+ */
+inline MemoryPlanner::SizeType MemoryPlanner::Plan()
+{
+  std::vector<SizeType> order(buffers_.size());
+  for (SizeType i = 0; i < order.size(); ++i)
+  {
+    order[i] = i;
+  }
+
+  // largest first, ties broken by the schedule so that the plan is deterministic
+  std::stable_sort(order.begin(), order.end(), [this](SizeType a, SizeType b) {
+    if (buffers_[a].size != buffers_[b].size)
+    {
+      return buffers_[a].size > buffers_[b].size;
+    }
+    return buffers_[a].first_step < buffers_[b].first_step;
+  });
+
+  arena_size_ = 0;
+  std::vector<SizeType> placed;
+  std::vector<SizeType> conflicts;
+
+  for (SizeType const id : order)
+  {
+    Buffer &buffer = buffers_[id];
+
+    conflicts.clear();
+    for (SizeType const other : placed)
+    {
+      if (Overlaps(buffer, buffers_[other]))
+      {
+        conflicts.push_back(other);
+      }
+    }
+
+    std::sort(conflicts.begin(), conflicts.end(), [this](SizeType a, SizeType b) {
+      return buffers_[a].offset < buffers_[b].offset;
+    });
+
+    // find the smallest gap between live buffers that fits, otherwise go past all of them
+    SizeType const size      = Align(buffer.size);
+    SizeType       best      = 0;
+    SizeType       best_gap  = 0;
+    bool           found     = false;
+    SizeType       candidate = 0;
+
+    for (SizeType const other : conflicts)
+    {
+      Buffer const &o = buffers_[other];
+      if (o.offset >= candidate)
+      {
+        SizeType const gap = o.offset - candidate;
+        if ((gap >= size) && (!found || (gap < best_gap)))
+        {
+          best     = candidate;
+          best_gap = gap;
+          found    = true;
+        }
+      }
+      candidate = std::max(candidate, Align(o.offset + o.size));
+    }
+
+    buffer.offset = found ? best : candidate;
+    arena_size_   = std::max(arena_size_, buffer.offset + buffer.size);
+    placed.push_back(id);
+  }
+
+  planned_ = true;
+  return arena_size_;
+}
+
+/**
+ * @param buffer the id of the buffer
+ * @return the offset of the buffer in the arena
+ */
+inline MemoryPlanner::SizeType MemoryPlanner::Offset(SizeType buffer) const
+{
+  assert(planned_);
+  assert(buffer < buffers_.size());
+  return buffers_[buffer].offset;
+}
+
+/**
+ * @param buffer the id of the buffer
+ * @return the number of elements in the buffer
+ */
+inline MemoryPlanner::SizeType MemoryPlanner::Size(SizeType buffer) const
+{
+  assert(buffer < buffers_.size());
+  return buffers_[buffer].size;
+}
+
+/**
+ * @return the number of elements the arena needs, valid after Plan
+ */
+inline MemoryPlanner::SizeType MemoryPlanner::ArenaSize() const
+{
+  assert(planned_);
+  return arena_size_;
+}
+
+inline MemoryPlanner::SizeType MemoryPlanner::BufferCount() const
+{
+  return buffers_.size();
+}
+
+/**
+ * Internal: rounds up to the next multiple of the alignment
+ */
+inline MemoryPlanner::SizeType MemoryPlanner::Align(SizeType value) const
+{
+  return ((value + alignment_ - 1) / alignment_) * alignment_;
+}
+
+/**
+ * Internal: whether two buffers are alive at the same time
+ */
+inline bool MemoryPlanner::Overlaps(Buffer const &a, Buffer const &b) const
+{
+  return (a.first_step <= b.last_step) && (b.first_step <= a.last_step);
+}
+
+}  // namespace ml
+}  // namespace fetch
@@ -37,13 +37,17 @@ public:
   using ArrayType   = T;
   using NodePtrType = std::shared_ptr<NodeInterface<T>>;
 
-  virtual ArrayType &                                           Evaluate(bool is_training)      = 0;
-  virtual void                                                  AddInput(NodePtrType const &i)  = 0;
-  virtual void                                                  AddOutput(NodePtrType const &i) = 0;
-  virtual std::vector<std::pair<NodeInterface<T> *, ArrayType>> BackPropagateSignal(
-      ArrayType const &error_signal)                                          = 0;
-  virtual void                            ResetCache(bool input_size_changed) = 0;
-  virtual std::vector<NodePtrType> const &GetOutputs() const                  = 0;
+  virtual ArrayType &                     Evaluate(bool is_training)                         = 0;
+  virtual void                            AddInput(NodePtrType const &i)                     = 0;
+  virtual void                            AddOutput(NodePtrType const &i)                    = 0;
+  virtual void                            BackPropagateSignal(ArrayType const &error_signal) = 0;
+  virtual void                            ResetCache(bool input_size_changed)                = 0;
+  virtual std::vector<NodePtrType> const &GetInputs() const                                  = 0;
+  virtual std::vector<NodePtrType> const &GetOutputs() const                                 = 0;
+  virtual ArrayType const &               GetCachedOutput() const                            = 0;
+  virtual void SetOutputStorage(ArrayType const &output, bool clear_before_forward) = 0;
+  virtual void SetErrorSignalStorage(std::vector<ArrayType> const &error_signals)   = 0;
+  virtual bool CanRunInPlace() const                                                = 0;
 };
 
 template <class T, class O>
@@ -70,15 +74,19 @@ public:
 
   virtual ~Node() = default;
 
-  std::vector<std::reference_wrapper<const ArrayType>>          GatherInputs() const;
-  virtual ArrayType &                                           Evaluate(bool is_training);
-  virtual std::vector<std::pair<NodeInterface<T> *, ArrayType>> BackPropagateSignal(
-      ArrayType const &error_signal);
+  std::vector<std::reference_wrapper<const ArrayType>> GatherInputs() const;
+  virtual ArrayType &                                  Evaluate(bool is_training);
+  virtual void BackPropagateSignal(ArrayType const &error_signal);
 
   void                                    AddInput(NodePtrType const &i);
   void                                    AddOutput(NodePtrType const &o);
+  virtual std::vector<NodePtrType> const &GetInputs() const;
   virtual std::vector<NodePtrType> const &GetOutputs() const;
   virtual void                            ResetCache(bool input_size_changed);
+  virtual ArrayType const &               GetCachedOutput() const;
+  virtual void SetOutputStorage(ArrayType const &output, bool clear_before_forward);
+  virtual void SetErrorSignalStorage(std::vector<ArrayType> const &error_signals);
+  virtual bool CanRunInPlace() const;
 
 private:
   std::vector<NodePtrType> input_nodes_;
@@ -86,6 +94,8 @@ private:
   std::string              name_;
   ArrayType                cached_output_;
   CachedOutputState        cached_output_status_;
+  bool                     clear_output_ = false;
+  std::vector<ArrayType>   error_signals_;
 };
 
 /**
@@ -133,6 +143,12 @@ T &Node<T, O>::Evaluate(bool is_training)
         cached_output_.Reshape(output_shape);
       }
     }
+
+    if (clear_output_)
+    {
+      cached_output_.data().SetAllZero();
+    }
+
     this->Forward(inputs, cached_output_);
     cached_output_status_ = CachedOutputState::VALID_CACHE;
   }
@@ -141,42 +157,35 @@ T &Node<T, O>::Evaluate(bool is_training)
 }
 
 /**
- * Recursively backpropagates errorsignal through this node to all input nodes
+ * Recursively backpropagates errorsignal through this node to all input nodes.
+ * The error signals for the inputs are written to tensors kept by the node, which are only
+ * replaced when the shapes of the inputs change or the graph assigns planned storage to them
  * @tparam T the tensor type
  * @tparam O the operation class
  * @param error_signal the error signal to backpropagate
- * @return
  */
 template <typename T, class O>
-std::vector<std::pair<NodeInterface<T> *, T>> Node<T, O>::BackPropagateSignal(
-    ArrayType const &error_signal)
+void Node<T, O>::BackPropagateSignal(ArrayType const &error_signal)
 {
   std::vector<std::reference_wrapper<const ArrayType>> inputs = GatherInputs();
-  std::vector<ArrayType> back_propagated_error_signals = this->Backward(inputs, error_signal);
-  std::vector<std::pair<NodeInterface<T> *, ArrayType>> non_back_propagated_error_signals;
-  assert(back_propagated_error_signals.size() == inputs.size() || inputs.empty());
 
-  auto bp_it = back_propagated_error_signals.begin();
-  for (auto &i : input_nodes_)
+  error_signals_.resize(inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i)
   {
-    auto ret = i->BackPropagateSignal(*bp_it);
-    non_back_propagated_error_signals.insert(non_back_propagated_error_signals.end(), ret.begin(),
-                                             ret.end());
-    ++bp_it;
+    if (error_signals_[i].shape() != inputs[i].get().shape())
+    {
+      error_signals_[i] = ArrayType(inputs[i].get().shape());
+    }
   }
 
-  // If no input to backprop to, return gradient to caller
-  // This is used to propagate outside of a SubGraph
-  // The SubGraph has no knowledge of the rest of the network,
-  // so it sends its unpropagated gradient to its wrapper node that will forward them out
-  if (input_nodes_.empty())
+  this->Backward(inputs, error_signal, error_signals_);
+
+  auto bp_it = error_signals_.cbegin();
+  for (auto &i : input_nodes_)
   {
-    for (auto g : back_propagated_error_signals)
-    {
-      non_back_propagated_error_signals.push_back(std::make_pair(this, g));
-    }
+    i->BackPropagateSignal(*bp_it);
+    ++bp_it;
   }
-  return non_back_propagated_error_signals;
 }
 
 /**
@@ -203,6 +212,18 @@ void Node<T, O>::AddOutput(NodePtrType const &o)
   outputs_.push_back(o);
 }
 
+/**
+ * gets all registered inputs of this node
+ * @tparam T tensor type
+ * @tparam O operation class
+ * @return vector of pointers to input nodes
+ */
+template <typename T, class O>
+std::vector<typename Node<T, O>::NodePtrType> const &Node<T, O>::GetInputs() const
+{
+  return input_nodes_;
+}
+
 /**
  * gets all registered outputs of this node
  * @tparam T tensor type
@@ -224,8 +245,86 @@ std::vector<typename Node<T, O>::NodePtrType> const &Node<T, O>::GetOutputs() co
 template <typename T, class O>
 void Node<T, O>::ResetCache(bool input_size_changed)
 {
-  cached_output_status_ =
-      input_size_changed ? CachedOutputState::CHANGED_SIZE : CachedOutputState::CHANGED_CONTENT;
+  // a pending size change must survive a later content only change
+  if (input_size_changed)
+  {
+    cached_output_status_ = CachedOutputState::CHANGED_SIZE;
+  }
+  else if (cached_output_status_ == CachedOutputState::VALID_CACHE)
+  {
+    cached_output_status_ = CachedOutputState::CHANGED_CONTENT;
+  }
+}
+
+/**
+ * Returns the output of the last forward pass without evaluating, regardless of whether it is
+ * still valid
+ * @tparam T tensor type
+ * @tparam O operation class
+ * @return the cached output tensor
+ */
+template <typename T, class O>
+T const &Node<T, O>::GetCachedOutput() const
+{
+  return cached_output_;
+}
+
+/**
+ * Makes the node write its output to the given tensor, which usually is a view into an arena
+ * assigned by the graph memory planner. The cache is invalidated if the storage changes
+ * @tparam T tensor type
+ * @tparam O operation class
+ * @param output the tensor to evaluate into, shaped as the next output
+ * @param clear_before_forward whether to zero the storage before each forward pass, for storage
+ * which other nodes write to in between
+ */
+template <typename T, class O>
+void Node<T, O>::SetOutputStorage(ArrayType const &output, bool clear_before_forward)
+{
+  clear_output_ = clear_before_forward;
+
+  bool const same_shape = output.shape() == cached_output_.shape();
+
+  if (same_shape && (output.data().pointer() == cached_output_.data().pointer()))
+  {
+    return;
+  }
+
+  if (!same_shape)
+  {
+    cached_output_status_ = CachedOutputState::CHANGED_SIZE;
+  }
+  else if (cached_output_status_ == CachedOutputState::VALID_CACHE)
+  {
+    cached_output_status_ = CachedOutputState::CHANGED_CONTENT;
+  }
+
+  cached_output_ = output;
+}
+
+/**
+ * Makes the node write the error signals for its inputs to the given tensors, which usually are
+ * views into an arena assigned by the graph memory planner
+ * @tparam T tensor type
+ * @tparam O operation class
+ * @param error_signals one tensor per input, shaped as the output of that input
+ */
+template <typename T, class O>
+void Node<T, O>::SetErrorSignalStorage(std::vector<ArrayType> const &error_signals)
+{
+  assert(error_signals.size() == input_nodes_.size());
+  error_signals_ = error_signals;
+}
+
+/**
+ * whether the operation can write its output over its input
+ * @tparam T tensor type
+ * @tparam O operation class
+ */
+template <typename T, class O>
+bool Node<T, O>::CanRunInPlace() const
+{
+  return O::CanRunInPlace();
 }
 
 }  // namespace ml
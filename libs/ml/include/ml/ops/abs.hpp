@@ -54,17 +54,15 @@ public:
    * elementwise absolute value gradient is:
    * f'(input0)=sign(input0)*error_signal
    */
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     assert(inputs.size() == 1);
     assert(error_signal.size() == inputs.at(0).get().size());
 
-    ArrayType return_signal(inputs.at(0).get().shape());
-
     auto a_it   = inputs.at(0).get().cbegin();
     auto err_it = error_signal.cbegin();
-    auto r_it   = return_signal.begin();
+    auto r_it   = output.at(0).begin();
     while (a_it.is_valid())
     {
       if (*a_it > 0)
@@ -80,8 +78,6 @@ public:
       ++err_it;
       ++r_it;
     }
-
-    return {return_signal};
   }
 
   virtual std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -89,6 +85,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  virtual bool CanRunInPlace() const
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "Abs";
 };
 
@@ -87,8 +87,8 @@ public:
     }
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     FETCH_UNUSED(inputs);
     assert(inputs.size() == 1);
@@ -96,14 +96,10 @@ public:
     assert(drop_values_.shape() == inputs.front().get().shape());
     assert(this->is_training_);
 
-    ArrayType return_signal{error_signal.shape()};
-
     // gradient of dropout is 1.0/keep_prob for enabled neurons and 0.0 for disabled
     // multiply by error_signal (chain rule)
 
-    fetch::math::Multiply(error_signal, drop_values_, return_signal);
-
-    return {return_signal};
+    fetch::math::Multiply(error_signal, drop_values_, output.at(0));
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -50,11 +50,12 @@ public:
     fetch::math::Elu(inputs.front().get(), a_, output);
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs, ArrayType const &error_signal)
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output)
   {
     assert(inputs.size() == 1);
     assert(inputs.front().get().shape() == error_signal.shape());
-    ArrayType ret{error_signal.shape()};
+    ArrayType &ret = output.at(0);
 
     DataType zero{0};
     DataType one{1};
@@ -81,8 +82,6 @@ public:
 
     // multiply by error_signal (chain rule)
     fetch::math::Multiply(error_signal, ret, ret);
-
-    return {ret};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -90,6 +89,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  bool CanRunInPlace() const
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "Elu";
 
 private:
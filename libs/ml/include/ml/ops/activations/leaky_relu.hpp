@@ -49,24 +49,22 @@ public:
     fetch::math::LeakyRelu(inputs.front().get(), a_, output);
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(inputs.front().get().shape() == error_signal.shape());
-    DataType  zero{0};
-    DataType  one{1};
-    ArrayType ret{error_signal.shape()};
-    ArrayType t{inputs.front().get().shape()};
+    DataType   zero{0};
+    DataType   one{1};
+    ArrayType &ret = output.at(0);
 
     // gradient of leaky relu function is a where x<0; and 1.0 where x>=0
-    this->Forward(inputs, t);
+    this->Forward(inputs, ret);
 
-    auto it  = t.cbegin();
     auto rit = ret.begin();
-    while (it.is_valid())
+    while (rit.is_valid())
     {
-      if (*it >= zero)
+      if (*rit >= zero)
       {
         // f'(x)=1 for x>=0
         *rit = one;
@@ -76,14 +74,11 @@ public:
         // f'(x)=a for x<0
         *rit = a_;
       }
-      ++it;
       ++rit;
     }
 
     // multiply by error_signal (chain rule)
     fetch::math::Multiply(error_signal, ret, ret);
-
-    return {ret};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -91,6 +86,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  bool CanRunInPlace() const override
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "LeakyRelu";
 
 private:
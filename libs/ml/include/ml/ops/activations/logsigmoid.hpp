@@ -58,22 +58,20 @@ public:
     }
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(inputs.front().get().shape() == error_signal.shape());
-    ArrayType return_signal{error_signal.shape()};
+    ArrayType &return_signal = output.at(0);
 
     // gradient of log-sigmoid function is 1/(e^x + 1))
-    fetch::math::Add(fetch::math::Exp(inputs.front().get()), static_cast<DataType>(1),
-                     return_signal);
+    fetch::math::Exp(inputs.front().get(), return_signal);
+    fetch::math::Add(return_signal, static_cast<DataType>(1), return_signal);
     fetch::math::Divide(static_cast<DataType>(1), return_signal, return_signal);
 
     // multiply by error_signal (chain rule)
     fetch::math::Multiply(error_signal, return_signal, return_signal);
-
-    return {return_signal};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -81,6 +79,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  bool CanRunInPlace() const override
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "LogSigmoid";
 
 private:
@@ -52,13 +52,14 @@ public:
     fetch::math::Log(output, output);
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(inputs.front().get().shape() == error_signal.shape());
 
-    ArrayType return_signal = error_signal.Copy();
+    ArrayType &return_signal = output.at(0);
+    return_signal.Assign(error_signal);
     ArrayType t(error_signal.shape());
     fetch::math::Softmax(inputs.front().get(), t, axis_);
 
@@ -83,7 +84,6 @@ public:
     }
 
     return_signal.InlineSubtract(t);
-    return {return_signal};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
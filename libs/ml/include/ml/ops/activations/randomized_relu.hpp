@@ -65,26 +65,24 @@ public:
     fetch::math::LeakyRelu(inputs.front().get(), alpha, output);
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(inputs.front().get().shape() == error_signal.shape());
-    DataType  zero{0};
-    DataType  one{1};
-    ArrayType ret{error_signal.shape()};
-    ArrayType t{inputs.front().get().shape()};
+    DataType   zero{0};
+    DataType   one{1};
+    ArrayType &ret = output.at(0);
 
     DataType alpha = this->is_training_ ? random_value_ : bounds_mean_;
 
     // gradient of randomized-relu function is for x<0 = alpha, x>=0 = 1.0
-    this->Forward(inputs, t);
+    this->Forward(inputs, ret);
 
-    auto it  = t.cbegin();
     auto rit = ret.begin();
-    while (it.is_valid())
+    while (rit.is_valid())
     {
-      if (*it >= zero)
+      if (*rit >= zero)
       {
         // f'(x)=1 for x>=0
         *rit = one;
@@ -94,14 +92,11 @@ public:
         // f'(x)=a for x<0
         *rit = alpha;
       }
-      ++it;
       ++rit;
     }
 
     // multiply by error_signal (chain rule)
     fetch::math::Multiply(error_signal, ret, ret);
-
-    return {ret};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -56,17 +56,16 @@ public:
    * @param error_signal
    * @return
    */
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(inputs.at(0).get().shape() == error_signal.shape());
 
     ArrayType const &input = inputs.front().get();
-    ArrayType        return_signal{error_signal.shape()};
 
     auto it1    = input.begin();
-    auto it2    = return_signal.begin();
+    auto it2    = output.at(0).begin();
     auto err_it = error_signal.cbegin();
 
     while (it1.is_valid())
@@ -83,8 +82,6 @@ public:
       ++it2;
       ++err_it;
     }
-
-    return {return_signal};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -92,6 +89,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  bool CanRunInPlace() const override
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "Relu";
 };
 
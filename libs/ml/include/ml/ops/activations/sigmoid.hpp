@@ -52,23 +52,25 @@ public:
     fetch::math::Clamp(epsilon_, static_cast<DataType>(1) - epsilon_, output);
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(inputs.front().get().shape() == error_signal.shape());
-    ArrayType return_signal{error_signal.shape()};
-    ArrayType t{inputs.front().get().shape()};
+    ArrayType &return_signal = output.at(0);
 
     // gradient of sigmoid function is s(x)(1 - s(x))
-    Forward(inputs, t);
-    fetch::math::Subtract(static_cast<DataType>(1), t, return_signal);
-    fetch::math::Multiply(t, return_signal, return_signal);
+    Forward(inputs, return_signal);
 
-    // multiply by error_signal (chain rule)
-    fetch::math::Multiply(error_signal, return_signal, return_signal);
-
-    return {return_signal};
+    auto rit    = return_signal.begin();
+    auto err_it = error_signal.cbegin();
+    while (rit.is_valid())
+    {
+      // multiply by error_signal (chain rule)
+      *rit = (*rit) * (static_cast<DataType>(1) - (*rit)) * (*err_it);
+      ++rit;
+      ++err_it;
+    }
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -76,6 +78,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  bool CanRunInPlace() const override
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "Sigmoid";
 
 private:
@@ -50,13 +50,14 @@ public:
     fetch::math::Softmax(inputs.at(0).get(), output, axis_);
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(inputs.front().get().shape() == error_signal.shape());
 
-    ArrayType return_signal = error_signal.Copy();
+    ArrayType &return_signal = output.at(0);
+    return_signal.Assign(error_signal);
     ArrayType t(error_signal.shape());
     this->Forward(inputs, t);
     return_signal.InlineMultiply(t);
@@ -81,7 +82,6 @@ public:
     }
 
     return_signal.InlineSubtract(t);
-    return {return_signal};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
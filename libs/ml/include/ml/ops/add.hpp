@@ -42,7 +42,8 @@ public:
     fetch::math::Add(inputs.at(0).get(), inputs.at(1).get(), output);
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs, ArrayType const &error_signal)
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output)
   {
     assert(inputs.size() == 2);
     assert(inputs.at(0).get().shape().size() == inputs.at(1).get().shape().size());
@@ -56,14 +57,16 @@ public:
       assert(inputs.at(0).get().shape().at(i) == inputs.at(1).get().shape().at(i));
     }
 
+    output.at(0).Assign(error_signal);
+
     if (inputs.at(0).get().shape() == inputs.at(1).get().shape())
     {
-      return {error_signal, error_signal};
+      output.at(1).Assign(error_signal);
     }
     else
     {
       SizeType batch_dimension = inputs.at(0).get().shape().size() - 1;
-      return {error_signal, fetch::math::ReduceSum(error_signal, batch_dimension)};
+      fetch::math::ReduceSum(error_signal, batch_dimension, output.at(1));
     }
   }
 
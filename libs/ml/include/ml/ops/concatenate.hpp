@@ -58,10 +58,10 @@ public:
    * Splits up the gradients to feed back to the inputs
    * @param inputs
    * @param error_signal
-   * @return
+   * @param output
    */
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     concat_points_.resize(inputs.size());
     auto c_it = concat_points_.begin();
@@ -70,7 +70,12 @@ public:
       *c_it = e.get().shape()[axis_];
       ++c_it;
     }
-    return ArrayType::Split(error_signal, concat_points_, axis_);
+
+    std::vector<ArrayType> split = ArrayType::Split(error_signal, concat_points_, axis_);
+    for (SizeType i{0}; i < split.size(); ++i)
+    {
+      output.at(i).Assign(split.at(i));
+    }
   }
 
   virtual std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
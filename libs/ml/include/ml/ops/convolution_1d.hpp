@@ -49,8 +49,8 @@ public:
 
   void Forward(VecTensorType const &inputs, ArrayType &output) override;
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override;
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override;
 
   static constexpr char const *DESCRIPTOR = "Convolution1D";
 
@@ -143,12 +143,12 @@ void Convolution1D<ArrayType>::Forward(VecTensorType const &inputs, ArrayType &o
  * kernel_height x batch_position]
  * @param error_signal tensor of size [output_channels x number_of_stride_sized_steps x
  * batch_position]
- * @return: output vector of tensors with back propagated error signal
+ * @param output vector of tensors for the back propagated error signal
  * output[0]=input_error[inputs[0].shape], output[1]=kernel_error[inputs[1].shape]
  */
 template <class ArrayType>
-std::vector<ArrayType> Convolution1D<ArrayType>::Backward(VecTensorType const &inputs,
-                                                          ArrayType const &    error_signal)
+void Convolution1D<ArrayType>::Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                                        std::vector<ArrayType> &output)
 {
   assert(inputs.size() == 2);
   // Input should be a 2D tensor [C x H x N]
@@ -162,12 +162,16 @@ std::vector<ArrayType> Convolution1D<ArrayType>::Backward(VecTensorType const &i
   ArrayType input   = inputs.at(0).get();
   ArrayType kernels = inputs.at(1).get();
 
-  SizeType  input_channels  = input.shape().at(0);
-  SizeType  batch_size      = input.shape().at(2);
-  SizeType  output_channels = kernels.shape().at(0);
-  SizeType  kernel_height   = kernels.shape().at(2);
-  ArrayType input_error(input.shape());
-  ArrayType kernel_error(kernels.shape());
+  SizeType input_channels  = input.shape().at(0);
+  SizeType batch_size      = input.shape().at(2);
+  SizeType output_channels = kernels.shape().at(0);
+  SizeType kernel_height   = kernels.shape().at(2);
+
+  // the reversed im2col adds up the error signals
+  ArrayType &input_error  = output.at(0);
+  ArrayType &kernel_error = output.at(1);
+  input_error.Fill(DataType{0});
+  kernel_error.Fill(DataType{0});
 
   SizeType horizontal_stride_width  = kernel_height * input_channels;
   SizeType horizontal_stride_height = output_height * batch_size;
@@ -199,8 +203,6 @@ std::vector<ArrayType> Convolution1D<ArrayType>::Backward(VecTensorType const &i
 
   // Reshape vertical stride to kernel data error_signal - reversed im2col
   ReverseFillVerticalStride(kernel_error, error2, output_channels, input_channels, kernel_height);
-
-  return {input_error, kernel_error};
 }
 
 template <class ArrayType>
@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------------
 
 #include "math/matrix_operations.hpp"
+#include "math/parallel.hpp"
 #include "ml/ops/ops.hpp"
 
 #include <cassert>
@@ -46,8 +47,8 @@ public:
 
   void Forward(VecTensorType const &inputs, ArrayType &output) override;
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override;
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override;
 
   std::vector<typename ArrayType::SizeType> ComputeOutputShape(
       VecTensorType const &inputs) const override;
@@ -148,12 +149,12 @@ void Convolution2D<ArrayType>::Forward(VecTensorType const &inputs, ArrayType &o
  * @param error_signal tensor of size [output_channels x
  * number_of_stride_sized_steps_over_input_height x number_of_stride_sized_steps_over_input_width x
  * batch_position]
- * @return: output vector of tensors with back propagated error signal
+ * @param output vector of tensors for the back propagated error signal
  * output[0]=input_error[inputs[0].shape], output[1]=kernel_error[inputs[1].shape]
  */
 template <class ArrayType>
-std::vector<ArrayType> Convolution2D<ArrayType>::Backward(VecTensorType const &inputs,
-                                                          ArrayType const &    error_signal)
+void Convolution2D<ArrayType>::Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                                        std::vector<ArrayType> &output)
 {
   assert(inputs.size() == 2);
   // Input should be a 4D tensor [C x H x W x N]
@@ -171,13 +172,17 @@ std::vector<ArrayType> Convolution2D<ArrayType>::Backward(VecTensorType const &i
   ArrayType input   = inputs.at(0).get();
   ArrayType kernels = inputs.at(1).get();
 
-  SizeType  input_channels  = input.shape().at(0);
-  SizeType  batch_size      = input.shape().at(3);
-  SizeType  output_channels = kernels.shape().at(0);
-  SizeType  kernel_height   = kernels.shape().at(2);
-  SizeType  kernel_width    = kernels.shape().at(3);
-  ArrayType input_error(input.shape());
-  ArrayType kernel_error(kernels.shape());
+  SizeType input_channels  = input.shape().at(0);
+  SizeType batch_size      = input.shape().at(3);
+  SizeType output_channels = kernels.shape().at(0);
+  SizeType kernel_height   = kernels.shape().at(2);
+  SizeType kernel_width    = kernels.shape().at(3);
+
+  // the reversed im2col adds up the error signals
+  ArrayType &input_error  = output.at(0);
+  ArrayType &kernel_error = output.at(1);
+  input_error.Fill(DataType{0});
+  kernel_error.Fill(DataType{0});
 
   SizeType horizontal_stride_width  = kernel_width * kernel_height * input_channels;
   SizeType horizontal_stride_height = output_height * output_width * batch_size;
@@ -211,8 +216,6 @@ std::vector<ArrayType> Convolution2D<ArrayType>::Backward(VecTensorType const &i
   // Reshape vertical stride to kernel data error_signal - reversed im2col
   ReverseFillVerticalStride(kernel_error, error2, output_channels, input_channels, kernel_height,
                             kernel_width);
-
-  return {input_error, kernel_error};
 }
 
 template <class ArrayType>
@@ -255,23 +258,30 @@ void Convolution2D<ArrayType>::FillVerticalStride(ArrayType &input, ArrayType &v
                                                   SizeType const kernel_height,
                                                   SizeType const kernel_width)
 {
-  SizeType j_s;                                           // stride height iterator
-  for (SizeType i_oc{0}; i_oc < output_channels; ++i_oc)  // Iterate over output channels
-  {
-    j_s = 0;
-    for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)  // Iterate over input channels
-    {
+  SizeType const stride_width = input_channels * kernel_height * kernel_width;
 
-      for (SizeType i_k(0); i_k < kernel_height; i_k++)  // Iterate over kernel height
+  // each output channel fills a separate row of the stride, so they can be filled in parallel
+  auto const fill = [&](SizeType begin, SizeType end) {
+    SizeType j_s;                                   // stride height iterator
+    for (SizeType i_oc{begin}; i_oc < end; ++i_oc)  // Iterate over output channels
+    {
+      j_s = 0;
+      for (SizeType i_ic{0}; i_ic < input_channels; ++i_ic)  // Iterate over input channels
       {
-        for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
+
+        for (SizeType i_k(0); i_k < kernel_height; i_k++)  // Iterate over kernel height
         {
-          vertical_stride(i_oc, j_s) = input.At(i_oc, i_ic, i_k, j_k, 0);
-          ++j_s;
+          for (SizeType j_k(0); j_k < kernel_width; j_k++)  // Iterate over kernel width
+          {
+            vertical_stride(i_oc, j_s) = input.At(i_oc, i_ic, i_k, j_k, 0);
+            ++j_s;
+          }
         }
       }
     }
-  }
+  };
+
+  fetch::math::details::ParallelFor(output_channels, stride_width, fill);
 }
 
 // TODO(issue 943): Make im2col efficient using iterators
@@ -327,14 +337,20 @@ void Convolution2D<ArrayType>::FillHorizontalStride(
     SizeType const output_width, SizeType const input_channels, SizeType const kernel_height,
     SizeType const kernel_width, SizeType const batch_size)
 {
-  SizeType i_s;  // stride width index
-  SizeType j_s;  // stride height index
+  SizeType const row_size = output_width * input_channels * kernel_height * kernel_width;
 
-  j_s = 0;
-  for (SizeType i_b{0}; i_b < batch_size; ++i_b)  // Iterate over batch
-  {
-    for (SizeType i_o{0}; i_o < output_height; ++i_o)  // Iterate over output height
+  // each output row (of each batch) fills a separate range of columns of the stride, so they can
+  // be filled in parallel
+  auto const fill = [&](SizeType begin, SizeType end) {
+    SizeType i_s;  // stride width index
+    SizeType j_s;  // stride height index
+
+    j_s = begin * output_width;
+    for (SizeType i_r{begin}; i_r < end; ++i_r)  // Iterate over batch and output height
     {
+      SizeType const i_b = i_r / output_height;
+      SizeType const i_o = i_r % output_height;
+
       for (SizeType j_o{0}; j_o < output_width; ++j_o)  // Iterate over output width
       {
         i_s = 0;
@@ -354,7 +370,9 @@ void Convolution2D<ArrayType>::FillHorizontalStride(
         ++j_s;
       }
     }
-  }
+  };
+
+  fetch::math::details::ParallelFor(batch_size * output_height, row_size, fill);
 }
 
 // TODO(issue 943): Make im2col efficient using iterators
@@ -61,17 +61,14 @@ public:
    * f'(a)=(1/b)*err
    * f'(b)=-(a/(b^2))*err
    */
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
-    ArrayType return_signal_1(inputs.at(0).get().shape());
-    ArrayType return_signal_2(inputs.at(1).get().shape());
-
     auto a_it   = inputs.at(0).get().cbegin();
     auto b_it   = inputs.at(1).get().cbegin();
     auto err_it = error_signal.cbegin();
-    auto r_1_it = return_signal_1.begin();
-    auto r_2_it = return_signal_2.begin();
+    auto r_1_it = output.at(0).begin();
+    auto r_2_it = output.at(1).begin();
     if (inputs.at(0).get().shape() == inputs.at(1).get().shape())
     {  // array / array same shape
       while (a_it.is_valid())
@@ -88,6 +85,7 @@ public:
     }
     else if (inputs.at(1).get().size() == 1)
     {  // array / scalar
+      *r_2_it = DataType{0};
       while (a_it.is_valid())
       {
         *r_1_it = (*err_it) / (*b_it);
@@ -103,7 +101,6 @@ public:
        // TODO (#1380) Write backpropagation for array array division of different shapes
       throw std::runtime_error("array array division of different shapes is not yet handled");
     }
-    return {return_signal_1, return_signal_2};
   }
 
   virtual std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -94,8 +94,8 @@ public:
     output = *this->embeddings_output_;
   }
 
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal) override
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(inputs.front().get().shape().size() == 2);
@@ -127,7 +127,8 @@ public:
       }
     }
 
-    return {ArrayType(error_signal.shape())};
+    // the indices are not differentiable
+    output.at(0).Fill(DataType{0});
   }
 
   virtual void Step(typename T::Type learning_rate) override
@@ -52,17 +52,14 @@ public:
    * elementwise exp gradient is:
    * f'(input0)= e^x * error_signal
    */
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     assert(inputs.size() == 1);
     assert(error_signal.shape() == this->ComputeOutputShape(inputs));
 
-    ArrayType ret_error_signal(inputs.at(0).get().shape());
-    fetch::math::Exp(inputs.at(0).get(), ret_error_signal);
-    fetch::math::Multiply(error_signal, ret_error_signal, ret_error_signal);
-
-    return {ret_error_signal};
+    fetch::math::Exp(inputs.at(0).get(), output.at(0));
+    fetch::math::Multiply(error_signal, output.at(0), output.at(0));
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -70,6 +67,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  bool CanRunInPlace() const
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "Exp";
 };
 
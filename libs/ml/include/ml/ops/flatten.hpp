@@ -47,18 +47,16 @@ public:
     output.Assign(inputs.front().get().View());
   }
 
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     FETCH_UNUSED(inputs);
     assert(inputs.size() == 1);
-    ArrayType ret(input_shape_);
+    assert(output.at(0).shape() == input_shape_);
 
-    assert(ret.shape().at(ret.shape().size() - 1) ==
+    assert(output.at(0).shape().at(output.at(0).shape().size() - 1) ==
            error_signal.shape().at(error_signal.shape().size() - 1));
-    ret.Assign(error_signal.View());
-
-    return {ret};
+    output.at(0).Assign(error_signal.View());
   }
 
   virtual std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -57,8 +57,8 @@ public:
   //    x>=0 f'(x)=1, x<0 f'(x)=alpha
   // Gradient of input.at(1)=alpha is:
   //    f'(alpha)=-Relu(-x)=min(0,x); x>=0 f'(alpha)=0, x<0 f'(alpha)=x
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 2);
     assert(inputs.at(0).get().size() == error_signal.size());
@@ -66,14 +66,11 @@ public:
     // Test if batch dimension for alpha is 1
     assert(inputs.at(1).get().shape().at(inputs.at(1).get().shape().size() - 1) == 1);
 
-    ArrayType return_signal_1{inputs.at(0).get().shape()};
+    ArrayType &return_signal_1 = output.at(0);
+    ArrayType &return_signal_2 = output.at(1);
 
-    SizeType a_size{1};
-    for (SizeType i{0}; i < inputs.at(0).get().shape().size() - 1; i++)
-    {
-      a_size *= inputs.at(0).get().shape().at(i);
-    }
-    ArrayType return_signal_2({a_size, 1});
+    // the error signal for alpha is summed over the batch
+    return_signal_2.Fill(DataType{0});
 
     SizeType t_batch_dimension = inputs.at(0).get().shape().size() - 1;
     SizeType batch_size        = inputs.at(0).get().shape().at(t_batch_dimension);
@@ -110,8 +107,6 @@ public:
         ++error_it;
       }
     }
-
-    return {return_signal_1, return_signal_2};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
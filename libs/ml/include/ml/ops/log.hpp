@@ -53,16 +53,13 @@ public:
    * elementwise log gradient is 1/x * error:
    * f'(input0)= error_signal/input0
    */
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     assert(inputs.size() == 1);
     assert(error_signal.shape() == this->ComputeOutputShape(inputs));
 
-    ArrayType ret_error_signal(inputs.at(0).get().shape());
-    fetch::math::Divide(error_signal, inputs.at(0).get(), ret_error_signal);
-
-    return {ret_error_signal};
+    fetch::math::Divide(error_signal, inputs.at(0).get(), output.at(0));
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -70,6 +67,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  bool CanRunInPlace() const
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "Log";
 };
 
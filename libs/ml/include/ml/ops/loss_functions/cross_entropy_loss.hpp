@@ -51,8 +51,8 @@ public:
     output(0, 0) = fetch::math::CrossEntropyLoss(inputs.at(0).get(), inputs.at(1).get());
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     FETCH_UNUSED(error_signal);
 
@@ -60,7 +60,7 @@ public:
     assert(inputs.at(0).get().size() == inputs.at(1).get().size());
     assert(inputs.at(0).get().shape().size() == 2);
 
-    ArrayType ret({inputs.at(0).get().shape()});
+    ArrayType &ret = output.at(0);
     if (inputs.at(0).get().shape().at(0) == 1)  // not one-hot
     {
       // (Sigmoid(x)-y)*x
@@ -106,7 +106,7 @@ public:
       }
     }
 
-    return {ret, ret};
+    output.at(1).Assign(ret);
   }
 
   std::vector<typename T::SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
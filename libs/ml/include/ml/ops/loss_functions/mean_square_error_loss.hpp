@@ -136,15 +136,15 @@ public:
    * layer the calling function is required to set this to a tensor of size 1 and value 1
    * @return
    */
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     FETCH_UNUSED(error_signal);
 
     assert(inputs.size() == 2);
     assert(inputs.at(0).get().shape() == inputs.at(1).get().shape());
 
-    ArrayType return_signal(inputs.front().get().shape());
+    ArrayType &return_signal = output.at(0);
 
     SizeType data_size = inputs.at(0).get().shape(inputs.at(0).get().shape().size() - 1);
     auto     count     = static_cast<DataType>(data_size);
@@ -222,7 +222,7 @@ public:
       }
     }
 
-    return {return_signal, return_signal};
+    output.at(1).Assign(return_signal);
   }
 
   std::vector<typename T::SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -59,19 +59,19 @@ public:
         fetch::math::CrossEntropyLoss(fetch::math::Softmax(inputs.at(0).get()), inputs.at(1).get());
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     FETCH_UNUSED(error_signal);
 
     assert(inputs.size() == 2);
     assert(inputs.at(0).get().size() == inputs.at(1).get().size());
 
-    ArrayType ret({inputs.at(0).get().shape()});
+    ArrayType &ret = output.at(0);
     fetch::math::Softmax(inputs.at(0).get(), ret);
     fetch::math::Subtract(ret, inputs.at(1).get(), ret);
 
-    return {ret, ret};
+    output.at(1).Assign(ret);
   }
 
   std::vector<typename T::SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -41,17 +41,15 @@ public:
   MatrixMultiply()           = default;
   ~MatrixMultiply() override = default;
 
-  void                   Forward(VecTensorType const &inputs, ArrayType &output) override;
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override;
-  std::vector<SizeType>  ComputeOutputShape(VecTensorType const &inputs) const override;
+  void                  Forward(VecTensorType const &inputs, ArrayType &output) override;
+  void                  Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                                 std::vector<ArrayType> &output) override;
+  std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override;
 
   static constexpr char const *DESCRIPTOR = "MatrixMultiply";
 
 private:
   // caching tensors and shapes
-  ArrayType error_signal_1_;
-  ArrayType error_signal_2_;
 
   // forward pass
   SizeVector fwd_input_shape_1_{};
@@ -141,8 +139,8 @@ void MatrixMultiply<T>::Forward(VecTensorType const &inputs, ArrayType &output)
 }
 
 template <class T>
-std::vector<T> MatrixMultiply<T>::Backward(VecTensorType const &inputs,
-                                           ArrayType const &    error_signal)
+void MatrixMultiply<T>::Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                                 std::vector<ArrayType> &output)
 {
   assert(inputs.size() == 2);
 
@@ -152,8 +150,8 @@ std::vector<T> MatrixMultiply<T>::Backward(VecTensorType const &inputs,
   // Normal MatMul 2D @ 2D
   if (inputs.at(0).get().shape().size() == 2 && inputs.at(1).get().shape().size() == 2)
   {
-    fetch::math::DotTranspose(error_signal, inputs.at(1).get(), error_signal_1_);
-    fetch::math::TransposeDot(inputs.at(0).get(), error_signal, error_signal_2_);
+    fetch::math::DotTranspose(error_signal, inputs.at(1).get(), output.at(0));
+    fetch::math::TransposeDot(inputs.at(0).get(), error_signal, output.at(1));
   }
   // Batchwise 3D @ 3D or broadcast matmul 2D @ 3D, 3D @ 2D
   else
@@ -172,6 +170,16 @@ std::vector<T> MatrixMultiply<T>::Backward(VecTensorType const &inputs,
       batch_size = inputs.at(1).get().shape().at(2);
     }
 
+    // the error signal of a 2D input is summed over the batch
+    if (inputs.at(0).get().shape().size() == 2)
+    {
+      output.at(0).Fill(typename ArrayType::Type{0});
+    }
+    if (inputs.at(1).get().shape().size() == 2)
+    {
+      output.at(1).Fill(typename ArrayType::Type{0});
+    }
+
     // Iterate over batch
     for (SizeType i{0}; i < batch_size; i++)
     {
@@ -218,31 +226,29 @@ std::vector<T> MatrixMultiply<T>::Backward(VecTensorType const &inputs,
       // 3D @ ? case
       if (inputs.at(0).get().shape().size() == 3)
       {
-        auto err1_view = error_signal_1_.View(i);
+        auto err1_view = output.at(0).View(i);
         err1_view.Assign(err1_);
       }
       // 2D @ 3D case
       else
       {
-        fetch::math::Add(error_signal_1_, err1_, error_signal_1_);
+        fetch::math::Add(output.at(0), err1_, output.at(0));
       }
 
       // Copy data to original array
       // ? @ 3D case
       if (inputs.at(1).get().shape().size() == 3)
       {
-        auto err2_view = error_signal_2_.View(i);
+        auto err2_view = output.at(1).View(i);
         err2_view.Assign(err2_);
       }
       // 3D @ 2D case
       else
       {
-        fetch::math::Add(error_signal_2_, err2_, error_signal_2_);
+        fetch::math::Add(output.at(1), err2_, output.at(1));
       }
     }
   }
-
-  return {error_signal_1_, error_signal_2_};
 }
 
 template <class T>
@@ -312,10 +318,9 @@ void MatrixMultiply<T>::UpdateContainersBackward(VecTensorType const &inputs,
     back_in2_view_tensor_ =
         ArrayType({inputs.at(1).get().shape().at(0), inputs.at(1).get().shape().at(1)});
 
-    err1_                = ArrayType(error_signal_1_.shape());
-    err2_                = ArrayType(error_signal_2_.shape());
-    error_signal_1_      = ArrayType(back_input_shape_1_);
-    error_signal_2_      = ArrayType(back_input_shape_2_);
+    err1_ = ArrayType({inputs.at(0).get().shape().at(0), inputs.at(0).get().shape().at(1)});
+    err2_ = ArrayType({inputs.at(1).get().shape().at(0), inputs.at(1).get().shape().at(1)});
+
     err_sig_view_tensor_ = ArrayType({error_signal.shape().at(0), error_signal.shape().at(1)});
   }
 }
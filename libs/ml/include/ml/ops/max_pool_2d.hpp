@@ -111,12 +111,13 @@ public:
    * @return: output vector of tensors with back propagated error signal
    * output[0]=input_error[inputs[0].shape]
    */
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(error_signal.shape() == ComputeOutputShape(inputs));
-    ArrayType return_signal{inputs.at(0).get().shape()};
+    ArrayType &return_signal = output.at(0);
+    return_signal.Fill(DataType{0});
 
     SizeType iterh;
     SizeType iterw;
@@ -166,8 +167,6 @@ public:
         }
       }
     }
-
-    return {return_signal};
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -29,6 +29,7 @@ class Maximum : public fetch::ml::Ops<T>
 {
 public:
   using ArrayType     = T;
+  using DataType      = typename ArrayType::Type;
   using SizeType      = typename ArrayType::SizeType;
   using ArrayPtrType  = std::shared_ptr<ArrayType>;
   using VecTensorType = typename Ops<T>::VecTensorType;
@@ -55,29 +56,28 @@ public:
    * f'(input0)=if(input0>input1)=error_signal
    * f'(input1)=if(input0<=input1)=error_signal
    */
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     assert(inputs.size() == 2);
     assert(inputs.at(0).get().size() == inputs.at(1).get().size());
     assert(error_signal.size() == inputs.at(1).get().size());
 
-    ArrayType return_signal_1(inputs.at(0).get().shape());
-    ArrayType return_signal_2(inputs.at(1).get().shape());
-
     auto a_it   = inputs.at(0).get().cbegin();
     auto b_it   = inputs.at(1).get().cbegin();
     auto err_it = error_signal.cbegin();
-    auto r_1_it = return_signal_1.begin();
-    auto r_2_it = return_signal_2.begin();
+    auto r_1_it = output.at(0).begin();
+    auto r_2_it = output.at(1).begin();
     while (a_it.is_valid())
     {
       if ((*a_it) > (*b_it))
       {
         *r_1_it = *err_it;
+        *r_2_it = DataType{0};
       }
       else
       {
+        *r_1_it = DataType{0};
         *r_2_it = *err_it;
       }
 
@@ -87,8 +87,6 @@ public:
       ++r_1_it;
       ++r_2_it;
     }
-
-    return {return_signal_1, return_signal_2};
   }
 
   virtual std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -55,20 +55,15 @@ public:
    * f'(input0)=input1*error_signal
    * f'(input1)=input0*error_signal
    */
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     assert(inputs.size() == 2);
     assert(inputs.at(0).get().size() == inputs.at(1).get().size());
     assert(error_signal.size() == inputs.at(1).get().size());
 
-    ArrayType error_signal_1(inputs.at(0).get().shape());
-    ArrayType error_signal_2(inputs.at(1).get().shape());
-
-    fetch::math::Multiply(inputs.at(1).get(), error_signal, error_signal_1);
-    fetch::math::Multiply(inputs.at(0).get(), error_signal, error_signal_2);
-
-    return {error_signal_1, error_signal_2};
+    fetch::math::Multiply(inputs.at(1).get(), error_signal, output.at(0));
+    fetch::math::Multiply(inputs.at(0).get(), error_signal, output.at(1));
   }
 
   virtual std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -39,15 +39,30 @@ public:
 
   virtual ~Ops() = default;
 
-  virtual void                   Forward(VecTensorType const &inputs, ArrayType &output) = 0;
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)                 = 0;
+  virtual void Forward(VecTensorType const &inputs, ArrayType &output) = 0;
+  /*
+   * Backward writes the error signal for each input to the tensor at the same position in output,
+   * which is shaped as that input and holds arbitrary values beforehand. The tensors may be views
+   * into memory planned by the graph, so they must be written to and never replaced
+   */
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output) = 0;
   /*
    * ComputeOutputShape is usually expensive function and should be used only for initialization or
    * in ASSERT. On Forward you can use output.shape() and on Backward there is error_signal.shape()
    */
   virtual std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const = 0;
 
+  /*
+   * Whether Forward may write its output over its single input, i.e. each output element only
+   * depends on the input element at the same position. The graph memory planner uses this to
+   * compute the op in place when the input is not needed afterwards
+   */
+  virtual bool CanRunInPlace() const
+  {
+    return false;
+  }
+
   void SetTraining(bool is_training)
   {
     is_training_ = is_training;
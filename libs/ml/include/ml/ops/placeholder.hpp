@@ -43,12 +43,27 @@ public:
     output = *(this->output_);
   }
 
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     FETCH_UNUSED(inputs);
+    FETCH_UNUSED(output);
     assert(inputs.empty());
-    return {error_signal};
+
+    if (error_signal_sink_.size() > 0)
+    {
+      error_signal_sink_.InlineAdd(error_signal);
+    }
+  }
+
+  /**
+   * Makes Backward add the error signals reaching this placeholder to the given tensor, which is
+   * how a SubGraph hands the error signals for its inputs back to the enclosing graph
+   * @param sink the tensor to accumulate into, shaped as the data
+   */
+  void SetErrorSignalSink(ArrayType const &sink)
+  {
+    error_signal_sink_ = sink;
   }
 
   virtual bool SetData(ArrayType const &data)
@@ -72,6 +87,9 @@ public:
 
 protected:
   ArrayPtrType output_;
+
+private:
+  ArrayType error_signal_sink_;
 };
 
 }  // namespace ops
@@ -49,12 +49,13 @@ public:
     output.Assign(inputs.front().get());
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs, ArrayType const &error_signal)
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output)
   {
+    FETCH_UNUSED(inputs);
     assert(inputs.size() == 1);
-    ArrayType ret(inputs.front().get().shape());
-    ret.Assign(error_signal);
-    return {ret};
+    assert(output.at(0).shape() == inputs.front().get().shape());
+    output.at(0).Assign(error_signal);
   }
 
   // Output shape
@@ -55,19 +55,15 @@ public:
    * elementwise square root gradient is:
    * f'(input0)= 0.5 * (input0 ^ -0.5) * error_signal
    */
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     assert(inputs.size() == 1);
     assert(error_signal.shape() == this->ComputeOutputShape(inputs));
 
-    ArrayType ret_error_signal(inputs.at(0).get().shape());
-
-    fetch::math::Sqrt(inputs.at(0).get(), ret_error_signal);
-    fetch::math::Divide(static_cast<DataType>(0.5), ret_error_signal, ret_error_signal);
-    fetch::math::Multiply(error_signal, ret_error_signal, ret_error_signal);
-
-    return {ret_error_signal};
+    fetch::math::Sqrt(inputs.at(0).get(), output.at(0));
+    fetch::math::Divide(static_cast<DataType>(0.5), output.at(0), output.at(0));
+    fetch::math::Multiply(error_signal, output.at(0), output.at(0));
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
@@ -75,6 +71,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  bool CanRunInPlace() const override
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "Sqrt";
 };
 
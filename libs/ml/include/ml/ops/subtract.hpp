@@ -48,15 +48,16 @@ public:
     fetch::math::Subtract(inputs[0].get(), inputs[1].get(), output);
   }
 
-  std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                  ArrayType const &    error_signal) override
+  void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                std::vector<ArrayType> &output) override
   {
     FETCH_UNUSED(inputs);
     assert(inputs.size() == 2);
     assert(inputs.at(0).get().size() == inputs.at(1).get().size());
     assert(error_signal.size() == inputs.at(1).get().size());
 
-    return {error_signal, fetch::math::Multiply(error_signal, DataType{-1})};
+    output.at(0).Assign(error_signal);
+    fetch::math::Multiply(error_signal, DataType{-1}, output.at(1));
   }
 
   std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const override
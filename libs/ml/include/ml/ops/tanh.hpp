@@ -53,16 +53,14 @@ public:
     }
   }
 
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     assert(inputs.size() == 1);
 
     assert(inputs.front().get().shape() == error_signal.shape());
 
-    ArrayType return_signal = error_signal.Copy();
-
-    ArrayType t(this->ComputeOutputShape(inputs));
+    ArrayType &t = output.at(0);
     Forward(inputs, t);
 
     // gradient of tanh: 1 - tanh(x)^2
@@ -70,9 +68,7 @@ public:
     fetch::math::Subtract(static_cast<DataType>(1), t, t);
 
     // apply chain rule
-    fetch::math::Multiply(error_signal, t, return_signal);
-
-    return {return_signal};
+    fetch::math::Multiply(error_signal, t, t);
   }
 
   virtual std::vector<SizeType> ComputeOutputShape(VecTensorType const &inputs) const
@@ -80,6 +76,11 @@ public:
     return inputs.front().get().shape();
   }
 
+  virtual bool CanRunInPlace() const
+  {
+    return true;
+  }
+
   static constexpr char const *DESCRIPTOR = "TanH";
 
 private:
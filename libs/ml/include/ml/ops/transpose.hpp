@@ -53,8 +53,8 @@ public:
     }
   }
 
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     FETCH_UNUSED(inputs);
     assert(inputs.size() == 1);
@@ -62,11 +62,11 @@ public:
 
     if (error_signal.shape().size() == 2)
     {
-      return {error_signal.Transpose()};
+      output.at(0).Assign(error_signal.Transpose());
     }
     else
     {
-      return {error_signal.Transpose(transpose_vector_)};
+      output.at(0).Assign(error_signal.Transpose(transpose_vector_));
     }
   }
 
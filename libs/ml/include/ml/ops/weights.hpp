@@ -92,13 +92,13 @@ public:
   Weights()          = default;
   virtual ~Weights() = default;
 
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal)
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output)
   {
     FETCH_UNUSED(inputs);
+    FETCH_UNUSED(output);
     assert(inputs.empty());
     gradient_accumulation_->InlineAdd(error_signal);
-    return {};
   }
 
   virtual bool SetData(ArrayType const &data)
@@ -37,12 +37,13 @@ template <class T>
 class SubGraph : public Graph<T>, public Ops<T>
 {
 public:
-  using ArrayType     = T;
-  using VecTensorType = std::vector<std::reference_wrapper<ArrayType const>>;
+  using ArrayType          = T;
+  using VecTensorType      = std::vector<std::reference_wrapper<ArrayType const>>;
+  using PlaceholderPtrType = typename Graph<T>::PlaceholderPtrType;
 
-  virtual void                   Forward(VecTensorType const &inputs, ArrayType &output);
-  virtual std::vector<ArrayType> Backward(VecTensorType const &inputs,
-                                          ArrayType const &    error_signal);
+  virtual void Forward(VecTensorType const &inputs, ArrayType &output);
+  virtual void Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                        std::vector<ArrayType> &output);
 
 protected:
   void AddInputNode(std::string const &node_name);
@@ -53,6 +54,8 @@ protected:
 
 private:
   std::vector<std::string>          input_nodes_;
+  std::vector<PlaceholderPtrType>   input_placeholders_;
+  std::string                       output_node_name_;
   std::shared_ptr<NodeInterface<T>> output_node_;
 };
 
@@ -71,42 +74,47 @@ void SubGraph<T>::Forward(VecTensorType const &inputs, ArrayType &output)
   {
     this->SetInput(input_nodes_[i], inputs.at(i));
   }
-  output = output_node_->Evaluate(this->is_training_);
+  output = this->Evaluate(output_node_name_, this->is_training_);
 }
 
+/**
+ * Backpropagates the error signal through the nodes of the SubGraph, summing up the error signals
+ * which reach each input placeholder into the output for that input
+ * @tparam T
+ * @param inputs
+ * @param error_signal
+ * @param output
+ */
 template <typename T>
-std::vector<T> SubGraph<T>::Backward(VecTensorType const &inputs, ArrayType const &error_signal)
+void SubGraph<T>::Backward(VecTensorType const &inputs, ArrayType const &error_signal,
+                           std::vector<ArrayType> &output)
 {
   assert(inputs.size() == this->input_nodes_.size());
   FETCH_UNUSED(inputs);
-  std::vector<std::pair<NodeInterface<T> *, ArrayType>> non_back_prop_err_signal =
-      this->output_node_->BackPropagateSignal(error_signal);
-  std::vector<ArrayType> back_prop_err_signal;
 
-  for (std::string const &s : input_nodes_)
+  for (uint64_t i(0); i < input_placeholders_.size(); ++i)
   {
-    std::shared_ptr<NodeInterface<T>> node = this->nodes_[s];
-    for (auto const &grad : non_back_prop_err_signal)
-    {
-      if (grad.first == node.get())
-      {
-        back_prop_err_signal.emplace_back(grad.second);
-      }
-    }
+    output.at(i).Fill(typename ArrayType::Type{0});
+    input_placeholders_.at(i)->SetErrorSignalSink(output.at(i));
   }
-  return back_prop_err_signal;
+
+  this->output_node_->BackPropagateSignal(error_signal);
 }
 
 template <typename T>
 void SubGraph<T>::AddInputNode(std::string const &node_name)
 {
   input_nodes_.push_back(node_name);
+  input_placeholders_.push_back(
+      std::dynamic_pointer_cast<typename Graph<T>::PlaceholderType>(this->nodes_.at(node_name)));
+  assert(input_placeholders_.back());
 }
 
 template <typename T>
 void SubGraph<T>::SetOutputNode(std::string const &node_name)
 {
-  output_node_ = this->nodes_[node_name];
+  output_node_name_ = node_name;
+  output_node_      = this->nodes_[node_name];
 }
 
 }  // namespace ml
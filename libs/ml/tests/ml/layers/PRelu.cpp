@@ -76,7 +76,8 @@ TYPED_TEST(PReluTest, ops_backward_test)  // Use the class as an Ops
   fc.Forward({input_data}, output);
   TypeParam error_signal(std::vector<typename TypeParam::SizeType>({50, 2}));
 
-  std::vector<TypeParam> bp_err = fc.Backward({input_data}, error_signal);
+  std::vector<TypeParam> bp_err{TypeParam(input_data.shape())};
+  fc.Backward({input_data}, error_signal, bp_err);
   ASSERT_EQ(bp_err.size(), 1);
   ASSERT_EQ(bp_err[0].shape().size(), 3);
   ASSERT_EQ(bp_err[0].shape()[0], 5);
@@ -116,13 +117,14 @@ TYPED_TEST(PReluTest, node_backward_test)  // Use the class as a Node
   TypeParam prediction = fc.Evaluate(true);
 
   TypeParam error_signal(std::vector<typename TypeParam::SizeType>({5, 10, 2}));
-  auto      bp_err = fc.BackPropagateSignal(error_signal);
-
-  ASSERT_EQ(bp_err.size(), 1);
-  ASSERT_EQ(bp_err[0].second.shape().size(), 3);
-  ASSERT_EQ(bp_err[0].second.shape()[0], 5);
-  ASSERT_EQ(bp_err[0].second.shape()[1], 10);
-  ASSERT_EQ(bp_err[0].second.shape()[2], 2);
+  TypeParam input_error(data.shape());
+  placeholder->SetErrorSignalSink(input_error);
+  fc.BackPropagateSignal(error_signal);
+
+  ASSERT_EQ(input_error.shape().size(), 3);
+  ASSERT_EQ(input_error.shape()[0], 5);
+  ASSERT_EQ(input_error.shape()[1], 10);
+  ASSERT_EQ(input_error.shape()[2], 2);
 }
 
 TYPED_TEST(PReluTest, graph_forward_test)  // Use the class as a Node
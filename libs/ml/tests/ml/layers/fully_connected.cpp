@@ -71,7 +71,8 @@ TYPED_TEST(FullyConnectedTest, ops_backward_test)  // Use the class as an Ops
 
   TypeParam error_signal(std::vector<typename TypeParam::SizeType>({10, 2}));
 
-  std::vector<TypeParam> backprop_error = fc.Backward({input_data}, error_signal);
+  std::vector<TypeParam> backprop_error{TypeParam(input_data.shape())};
+  fc.Backward({input_data}, error_signal, backprop_error);
   ASSERT_EQ(backprop_error.size(), 1);
   ASSERT_EQ(backprop_error[0].shape().size(), 3);
   ASSERT_EQ(backprop_error[0].shape()[0], 5);
@@ -111,13 +112,14 @@ TYPED_TEST(FullyConnectedTest, node_backward_test)  // Use the class as a Node
   TypeParam prediction = fc.Evaluate(true);
 
   TypeParam error_signal(std::vector<typename TypeParam::SizeType>({42, 2}));
-  auto      backprop_error = fc.BackPropagateSignal(error_signal);
-
-  ASSERT_EQ(backprop_error.size(), 1);
-  ASSERT_EQ(backprop_error[0].second.shape().size(), 3);
-  ASSERT_EQ(backprop_error[0].second.shape()[0], 5);
-  ASSERT_EQ(backprop_error[0].second.shape()[1], 10);
-  ASSERT_EQ(backprop_error[0].second.shape()[2], 2);
+  TypeParam input_error(data.shape());
+  placeholder->SetErrorSignalSink(input_error);
+  fc.BackPropagateSignal(error_signal);
+
+  ASSERT_EQ(input_error.shape().size(), 3);
+  ASSERT_EQ(input_error.shape()[0], 5);
+  ASSERT_EQ(input_error.shape()[1], 10);
+  ASSERT_EQ(input_error.shape()[2], 2);
 }
 
 TYPED_TEST(FullyConnectedTest, graph_forward_test)  // Use the class as a Node
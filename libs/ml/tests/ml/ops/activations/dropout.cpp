@@ -126,7 +126,8 @@ TYPED_TEST(DropoutTest, backward_test)
   ArrayType output(op.ComputeOutputShape({data}));
   op.Forward(VecTensorType({data}), output);
 
-  std::vector<ArrayType> prediction = op.Backward({data}, error);
+  std::vector<ArrayType> prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   EXPECT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -137,7 +138,7 @@ TYPED_TEST(DropoutTest, backward_test)
 
   gt = ArrayType::FromString(R"(0, 0, 0, 0, 1, 0, 0, 0)");
   fetch::math::Multiply(gt, DataType{1} / prob, gt);
-  prediction = op.Backward({data}, error);
+  op.Backward({data}, error, prediction);
 
   // test correct values
   EXPECT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -178,7 +179,8 @@ TYPED_TEST(DropoutTest, backward_3d_tensor_test)
   ArrayType output(op.ComputeOutputShape({data}));
   op.Forward(VecTensorType({data}), output);
 
-  std::vector<ArrayType> prediction = op.Backward({data}, error);
+  std::vector<ArrayType> prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   EXPECT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -95,7 +95,8 @@ TYPED_TEST(EluTest, backward_test)
   ArrayType gt    = ArrayType::FromString(R"(0, 0, 0, 0.0183156133, 1, 0.0049575567, 0, 0)");
 
   fetch::ml::ops::Elu<ArrayType> op(DataType{2.0});
-  std::vector<ArrayType>         prediction = op.Backward({data}, error);
+  std::vector<ArrayType>         prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -128,7 +129,8 @@ TYPED_TEST(EluTest, backward_3d_tensor_test)
   }
 
   fetch::ml::ops::Elu<ArrayType> op(DataType{2.0});
-  std::vector<ArrayType>         prediction = op.Backward({data}, error);
+  std::vector<ArrayType>         prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
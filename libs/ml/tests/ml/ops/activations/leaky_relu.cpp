@@ -92,7 +92,8 @@ TYPED_TEST(LeakyReluTest, backward_test)
   ArrayType gt    = ArrayType::FromString(R"(0, 0, 0, 0.005, 1, 0.01, 0, 0)");
 
   fetch::ml::ops::LeakyRelu<ArrayType> op(DataType{0.01f});
-  std::vector<ArrayType>               prediction = op.Backward({data}, error);
+  std::vector<ArrayType>               prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -125,7 +126,8 @@ TYPED_TEST(LeakyReluTest, backward_3d_tensor_test)
   }
 
   fetch::ml::ops::LeakyRelu<ArrayType> op(DataType{0.01f});
-  std::vector<ArrayType>               prediction = op.Backward({data}, error);
+  std::vector<ArrayType>               prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
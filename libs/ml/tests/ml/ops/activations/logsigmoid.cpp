@@ -93,7 +93,8 @@ TYPED_TEST(LogSigmoidTest, backward_test)
   ArrayType gt    = ArrayType::FromString(R"(0, 0, 0, 0.4910068810, 0.006692850, 0.997527, 0, 0)");
 
   fetch::ml::ops::LogSigmoid<ArrayType> op;
-  std::vector<ArrayType>                prediction = op.Backward({data}, error);
+  std::vector<ArrayType>                prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -126,7 +127,8 @@ TYPED_TEST(LogSigmoidTest, backward_3d_tensor_test)
   }
 
   fetch::ml::ops::LogSigmoid<ArrayType> op;
-  std::vector<ArrayType>                prediction = op.Backward({data}, error);
+  std::vector<ArrayType>                prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
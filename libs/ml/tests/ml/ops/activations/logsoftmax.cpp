@@ -90,7 +90,8 @@ TYPED_TEST(LogSoftmaxTest, backward_test)
       R"(-6.4312e-03, -3.2019e-04, -4.7521e-02,  9.9996e-01,  6.4887e-01, 9.9999e-01, -2.59454, -7.9368e-07)");
 
   fetch::ml::ops::LogSoftmax<ArrayType> op;
-  std::vector<ArrayType>                prediction = op.Backward({data}, error);
+  std::vector<ArrayType>                prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -119,7 +120,8 @@ TYPED_TEST(LogSoftmaxTest, backward_2d_tensor_axis_0_test)
     }
   }
   fetch::ml::ops::LogSoftmax<ArrayType> op{0};
-  std::vector<ArrayType>                prediction = op.Backward({data}, error);
+  std::vector<ArrayType>                prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -136,7 +136,8 @@ TYPED_TEST(RandomizedReluTest, backward_test)
     gt.Set(i, static_cast<DataType>(gt_input[i]));
   }
   fetch::ml::ops::RandomizedRelu<ArrayType> op(DataType{0.03f}, DataType{0.08f}, 12345);
-  std::vector<ArrayType>                    prediction = op.Backward({data}, error);
+  std::vector<ArrayType>                    prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -151,7 +152,7 @@ TYPED_TEST(RandomizedReluTest, backward_test)
   {
     gt.Set(i, static_cast<DataType>(gt_input[i]));
   }
-  prediction = op.Backward({data}, error);
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -164,7 +165,7 @@ TYPED_TEST(RandomizedReluTest, backward_test)
   {
     gt.Set(i, static_cast<DataType>(gt_input[i]));
   }
-  prediction = op.Backward({data}, error);
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -197,7 +198,8 @@ TYPED_TEST(RandomizedReluTest, backward_3d_tensor_test)
   }
 
   fetch::ml::ops::RandomizedRelu<ArrayType> op(DataType{0.03f}, DataType{0.08f}, 12345);
-  std::vector<ArrayType>                    prediction = op.Backward({data}, error);
+  std::vector<ArrayType>                    prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -121,7 +121,8 @@ TYPED_TEST(ReluTest, backward_mixed_test)
   ArrayType gt    = ArrayType::FromString(R"(-1, 0, 3, 0, -8, 0, -21, 0)");
 
   fetch::ml::ops::Relu<ArrayType> op;
-  std::vector<ArrayType>          prediction = op.Backward({data}, error);
+  std::vector<ArrayType>          prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt));
@@ -154,7 +155,8 @@ TYPED_TEST(ReluTest, backward_3d_tensor_test)
   }
 
   fetch::ml::ops::Relu<ArrayType> op;
-  std::vector<ArrayType>          prediction = op.Backward({data}, error);
+  std::vector<ArrayType>          prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, static_cast<DataType>(1e-5), static_cast<DataType>(1e-5)));
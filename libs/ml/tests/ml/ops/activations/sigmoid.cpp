@@ -91,7 +91,8 @@ TYPED_TEST(SigmoidTest, backward_test)
   ArrayType gt    = ArrayType::FromString(R"(0, 0, 0, 0.00883135, 0.00664803, 0.00246651, 0, 0)");
 
   fetch::ml::ops::Sigmoid<ArrayType> op;
-  std::vector<ArrayType>             prediction = op.Backward({data}, error);
+  std::vector<ArrayType>             prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -124,7 +125,8 @@ TYPED_TEST(SigmoidTest, backward_3d_tensor_test)
   }
 
   fetch::ml::ops::Sigmoid<ArrayType> op;
-  std::vector<ArrayType>             prediction = op.Backward({data}, error);
+  std::vector<ArrayType>             prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
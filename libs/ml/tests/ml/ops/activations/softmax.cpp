@@ -88,7 +88,8 @@ TYPED_TEST(SoftmaxTest, backward_test)
       R"(-2.5091e-04, -1.2492e-05, -1.8540e-03, -1.6906e-06, 1.0335e-01, -2.2880e-07, -1.0123e-01, -3.0965e-08)");
 
   fetch::ml::ops::Softmax<ArrayType> op(0);
-  std::vector<ArrayType>             prediction = op.Backward({data}, error);
+  std::vector<ArrayType>             prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -117,7 +118,8 @@ TYPED_TEST(SoftmaxTest, backward_2d_tensor_axis_0_test)
   }
 
   fetch::ml::ops::Softmax<ArrayType> op{0};
-  std::vector<ArrayType>             prediction = op.Backward({data}, error);
+  std::vector<ArrayType>             prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -58,7 +58,8 @@ TYPED_TEST(ConcatenateTest, backward_test)
   op.Forward({data1, data2}, prediction);
 
   TypeParam              error_signal(prediction.shape());
-  std::vector<TypeParam> gradients = op.Backward({data1, data2}, error_signal);
+  std::vector<TypeParam> gradients{TypeParam(data1.shape()), TypeParam(data2.shape())};
+  op.Backward({data1, data2}, error_signal, gradients);
 
   ASSERT_EQ(gradients.size(), 2);
   ASSERT_EQ(gradients[0].shape(), std::vector<typename TypeParam::SizeType>({8, 8}));
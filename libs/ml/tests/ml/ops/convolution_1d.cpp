@@ -273,7 +273,9 @@ TYPED_TEST(Convolution1DTest, backward_3x3x2_5x3x3x2)
   }
 
   fetch::ml::ops::Convolution1D<ArrayType> op;
-  std::vector<ArrayType>                   prediction = op.Backward({input, kernels}, error);
+  std::vector<ArrayType>                   prediction{ArrayType(input.shape()),
+                                                      ArrayType(kernels.shape())};
+  op.Backward({input, kernels}, error, prediction);
 
   // Test correct gradient shape
   ASSERT_EQ(prediction.at(0).shape(), input.shape());
@@ -127,7 +127,8 @@ TYPED_TEST(EmbeddingsTest, backward)
     }
   }
 
-  e.Backward({input}, error_signal);
+  std::vector<ArrayType> input_error{ArrayType(input.shape())};
+  e.Backward({input}, error_signal, input_error);
 
   ArrayType grad = e.get_gradients();
   fetch::math::Multiply(grad, DataType{-1}, grad);
@@ -79,7 +79,8 @@ TYPED_TEST(ExpTest, backward_test)
       "5, -5, 6, -6, 7, -7, 8, -8");
 
   fetch::ml::ops::Exp<ArrayType> op;
-  std::vector<ArrayType>         prediction = op.Backward({data}, error);
+  std::vector<ArrayType>         prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, fetch::math::function_tolerance<DataType>(),
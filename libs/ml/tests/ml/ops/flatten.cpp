@@ -100,7 +100,8 @@ TYPED_TEST(FlattenTest, backward_test)
   TypeParam prediction(op.ComputeOutputShape({data}));
   op.Forward({data}, prediction);
 
-  std::vector<TypeParam> gradients = op.Backward({data}, error_signal);
+  std::vector<TypeParam> gradients{TypeParam(data.shape())};
+  op.Backward({data}, error_signal, gradients);
 
   // test correct values
   ASSERT_EQ(gradients.size(), 1);
@@ -19,13 +19,30 @@
 #include "math/tensor.hpp"
 #include "ml/graph.hpp"
 #include "ml/layers/self_attention.hpp"
+#include "ml/ops/abs.hpp"
+#include "ml/ops/activations/elu.hpp"
+#include "ml/ops/activations/leaky_relu.hpp"
+#include "ml/ops/activations/logsigmoid.hpp"
 #include "ml/ops/activations/relu.hpp"
+#include "ml/ops/activations/sigmoid.hpp"
+#include "ml/ops/add.hpp"
+#include "ml/ops/exp.hpp"
+#include "ml/ops/log.hpp"
+#include "ml/ops/matrix_multiply.hpp"
 #include "ml/ops/multiply.hpp"
 #include "ml/ops/placeholder.hpp"
+#include "ml/ops/sqrt.hpp"
 #include "ml/ops/subtract.hpp"
+#include "ml/ops/tanh.hpp"
+#include "ml/ops/weights.hpp"
+#include "vectorise/memory/shared_array.hpp"
 
 #include "gtest/gtest.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 template <typename T>
 class GraphTest : public ::testing::Test
 {
@@ -314,3 +331,341 @@ TYPED_TEST(GraphTest, diamond_graph_getStateDict)
   ASSERT_NE(sd.dict_["Diamond_Weight2"].weights_, nullptr);
   EXPECT_EQ(sd.dict_["Diamond_Weight2"].weights_->shape(), data2.shape());
 }
+
+namespace {
+
+/**
+ * Builds output = W2 . tanh(relu(W1 . input) * sigmoid(relu(W1 . input))), which has elementwise
+ * ops that can and can not run in place
+ */
+template <typename ArrayType>
+void BuildPlannerGraph(fetch::ml::Graph<ArrayType> &g)
+{
+  using DataType = typename ArrayType::Type;
+
+  g.template AddNode<fetch::ml::ops::PlaceHolder<ArrayType>>("Input", {});
+  g.template AddNode<fetch::ml::ops::Weights<ArrayType>>("W1", {});
+  g.template AddNode<fetch::ml::ops::Weights<ArrayType>>("W2", {});
+  g.template AddNode<fetch::ml::ops::MatrixMultiply<ArrayType>>("Hidden", {"W1", "Input"});
+  g.template AddNode<fetch::ml::ops::Relu<ArrayType>>("Relu", {"Hidden"});
+  g.template AddNode<fetch::ml::ops::Sigmoid<ArrayType>>("Sigmoid", {"Relu"});
+  g.template AddNode<fetch::ml::ops::Multiply<ArrayType>>("Gate", {"Relu", "Sigmoid"});
+  g.template AddNode<fetch::ml::ops::TanH<ArrayType>>("TanH", {"Gate"});
+  g.template AddNode<fetch::ml::ops::MatrixMultiply<ArrayType>>("Output", {"W2", "TanH"});
+
+  ArrayType w1({6, 4});
+  ArrayType w2({3, 6});
+  for (std::uint64_t i = 0; i < w1.size(); ++i)
+  {
+    w1[i] = DataType(static_cast<double>(i % 7) / 4.0 - 0.7);
+  }
+  for (std::uint64_t i = 0; i < w2.size(); ++i)
+  {
+    w2[i] = DataType(static_cast<double>(i % 5) / 3.0 - 0.6);
+  }
+  g.SetInput("W1", w1);
+  g.SetInput("W2", w2);
+}
+
+template <typename ArrayType>
+ArrayType PlannerGraphInput(std::uint64_t batch_size, std::uint64_t seed)
+{
+  using DataType = typename ArrayType::Type;
+
+  ArrayType input({4, batch_size});
+  for (std::uint64_t i = 0; i < input.size(); ++i)
+  {
+    input[i] = DataType(static_cast<double>((i * 7 + seed * 3) % 11) / 5.0 - 1.0);
+  }
+  return input;
+}
+
+/**
+ * Shared array which counts how often it allocates storage
+ */
+template <typename T>
+class CountingArray : public fetch::memory::SharedArray<T>
+{
+public:
+  using SharedArrayType = fetch::memory::SharedArray<T>;
+
+  static std::uint64_t allocations;
+
+  CountingArray() = default;
+
+  explicit CountingArray(std::size_t n)
+    : SharedArrayType(n)
+  {
+    if (n > 0)
+    {
+      ++allocations;
+    }
+  }
+
+  CountingArray(CountingArray const &other, std::uint64_t offset, std::uint64_t size)
+    : SharedArrayType(other, offset, size)
+  {}
+
+  CountingArray Copy() const
+  {
+    CountingArray ret(this->size());
+    for (std::size_t i = 0; i < this->size(); ++i)
+    {
+      ret[i] = this->At(i);
+    }
+    return ret;
+  }
+};
+
+template <typename T>
+std::uint64_t CountingArray<T>::allocations = 0;
+
+/**
+ * Evaluates output = op(W * input) + bias for inference with and without memory planning. The op
+ * overwrites the output of W * input in the planned graph, so a kernel which reads its input after
+ * writing to the output gives different results
+ */
+template <typename OpType, typename... Params>
+void ExpectInPlaceMatchesUnplanned(bool positive_inputs, Params... params)
+{
+  using ArrayType = typename OpType::ArrayType;
+  using DataType  = typename ArrayType::Type;
+
+  auto build = [&params...](fetch::ml::Graph<ArrayType> &g) {
+    g.template AddNode<fetch::ml::ops::PlaceHolder<ArrayType>>("Input", {});
+    g.template AddNode<fetch::ml::ops::Weights<ArrayType>>("W", {});
+    g.template AddNode<fetch::ml::ops::Weights<ArrayType>>("Bias", {});
+    g.template AddNode<fetch::ml::ops::Multiply<ArrayType>>("Hidden", {"W", "Input"});
+    g.template AddNode<OpType>("InPlace", {"Hidden"}, params...);
+    g.template AddNode<fetch::ml::ops::Add<ArrayType>>("Output", {"InPlace", "Bias"});
+
+    ArrayType w({4, 6});
+    w.Fill(DataType{1});
+    ArrayType bias({4, 1});
+    bias.Fill(DataType{1} / DataType{4});
+    g.SetInput("W", w);
+    g.SetInput("Bias", bias);
+  };
+
+  fetch::ml::Graph<ArrayType> planned;
+  fetch::ml::Graph<ArrayType> unplanned;
+  build(planned);
+  build(unplanned);
+  unplanned.SetMemoryPlanning(false);
+
+  // the first pass records the shapes, the later ones run in the planned arena
+  for (std::uint64_t seed = 0; seed < 3; ++seed)
+  {
+    ArrayType input({4, 6});
+    for (std::uint64_t i = 0; i < input.size(); ++i)
+    {
+      double const value = static_cast<double>((i * 7 + seed * 3) % 11) / 5.0 - 1.0;
+      input[i]           = DataType(positive_inputs ? value + 1.5 : value);
+    }
+    planned.SetInput("Input", input);
+    unplanned.SetInput("Input", input);
+
+    ArrayType expected = unplanned.Evaluate("Output", false).Copy();
+    ArrayType output   = planned.Evaluate("Output", false).Copy();
+    ASSERT_EQ(output, expected) << std::string{OpType::DESCRIPTOR};
+  }
+}
+
+}  // namespace
+
+TYPED_TEST(GraphTest, memory_plan_matches_unplanned_evaluation)
+{
+  using ArrayType = TypeParam;
+
+  fetch::ml::Graph<ArrayType> planned;
+  fetch::ml::Graph<ArrayType> unplanned;
+  BuildPlannerGraph(planned);
+  BuildPlannerGraph(unplanned);
+  unplanned.SetMemoryPlanning(false);
+
+  // switch between batch shapes and between training and inference, so that every plan is built
+  // and then used more than once
+  std::vector<std::uint64_t> const batch_sizes{5, 7, 5, 1, 7, 5, 1};
+
+  std::uint64_t seed = 0;
+  for (std::uint64_t round = 0; round < 3; ++round)
+  {
+    for (std::uint64_t batch_size : batch_sizes)
+    {
+      for (bool is_training : {false, true})
+      {
+        ArrayType input = PlannerGraphInput<ArrayType>(batch_size, seed++);
+        planned.SetInput("Input", input);
+        unplanned.SetInput("Input", input);
+
+        ArrayType expected = unplanned.Evaluate("Output", is_training).Copy();
+        ArrayType output   = planned.Evaluate("Output", is_training).Copy();
+        ASSERT_EQ(output.shape(), expected.shape());
+        ASSERT_EQ(output, expected);
+
+        // evaluating again without new input is served from the cache
+        ASSERT_EQ(planned.Evaluate("Output", is_training), expected);
+
+        // intermediate results are recomputed when asked for after an inference pass
+        ASSERT_EQ(planned.Evaluate("Gate", is_training), unplanned.Evaluate("Gate", is_training));
+      }
+    }
+  }
+}
+
+TYPED_TEST(GraphTest, memory_plan_matches_unplanned_backpropagation)
+{
+  using ArrayType = TypeParam;
+
+  fetch::ml::Graph<ArrayType> planned;
+  fetch::ml::Graph<ArrayType> unplanned;
+  BuildPlannerGraph(planned);
+  BuildPlannerGraph(unplanned);
+  unplanned.SetMemoryPlanning(false);
+
+  std::uint64_t seed = 0;
+  for (std::uint64_t batch_size : {3, 3, 8, 3, 8, 8})
+  {
+    ArrayType input = PlannerGraphInput<ArrayType>(batch_size, seed++);
+    planned.SetInput("Input", input);
+    unplanned.SetInput("Input", input);
+
+    // an inference pass in between must not disturb the training pass
+    planned.Evaluate("Output", false);
+    planned.SetInput("Input", input);
+
+    ArrayType output = planned.Evaluate("Output");
+    ASSERT_EQ(output, unplanned.Evaluate("Output"));
+
+    ArrayType error_signal = output.Copy();
+    planned.BackPropagateSignal("Output", error_signal);
+    unplanned.BackPropagateSignal("Output", error_signal);
+
+    std::vector<ArrayType> planned_gradients   = planned.GetGradients();
+    std::vector<ArrayType> unplanned_gradients = unplanned.GetGradients();
+    ASSERT_EQ(planned_gradients.size(), unplanned_gradients.size());
+    for (std::uint64_t i = 0; i < planned_gradients.size(); ++i)
+    {
+      ASSERT_EQ(planned_gradients[i], unplanned_gradients[i]);
+    }
+  }
+}
+
+TYPED_TEST(GraphTest, memory_plan_reuses_storage_across_steps)
+{
+  using ArrayType = TypeParam;
+
+  fetch::ml::Graph<ArrayType> g;
+  BuildPlannerGraph(g);
+
+  auto storage = [&g](std::string const &name) {
+    return g.GetNode(name)->GetCachedOutput().data().pointer();
+  };
+
+  // the first training step for each batch shape plans the arena, later ones write into it
+  g.SetInput("Input", PlannerGraphInput<ArrayType>(5, 0));
+  g.Evaluate("Output");
+  g.SetInput("Input", PlannerGraphInput<ArrayType>(9, 0));
+  g.Evaluate("Output");
+
+  g.SetInput("Input", PlannerGraphInput<ArrayType>(5, 1));
+  g.Evaluate("Output");
+  auto const hidden_5 = storage("Hidden");
+  auto const output_5 = storage("Output");
+
+  g.SetInput("Input", PlannerGraphInput<ArrayType>(9, 1));
+  g.Evaluate("Output");
+  auto const hidden_9 = storage("Hidden");
+
+  for (std::uint64_t step = 2; step < 5; ++step)
+  {
+    g.SetInput("Input", PlannerGraphInput<ArrayType>(5, step));
+    g.Evaluate("Output");
+    EXPECT_EQ(storage("Hidden"), hidden_5);
+    EXPECT_EQ(storage("Output"), output_5);
+
+    g.SetInput("Input", PlannerGraphInput<ArrayType>(9, step));
+    g.Evaluate("Output");
+    EXPECT_EQ(storage("Hidden"), hidden_9);
+  }
+
+  // outside of training the intermediate results are released after the pass
+  g.Evaluate("Output", false);
+  g.SetInput("Input", PlannerGraphInput<ArrayType>(9, 0));
+  ArrayType output = g.Evaluate("Output", false);
+  EXPECT_EQ(g.GetNode("Hidden")->GetCachedOutput().size(), 0);
+  EXPECT_EQ(g.GetNode("Relu")->GetCachedOutput().size(), 0);
+  EXPECT_EQ(g.GetNode("Output")->GetCachedOutput().data().pointer(), output.data().pointer());
+}
+
+TYPED_TEST(GraphTest, memory_plan_training_steps_do_not_allocate)
+{
+  using DataType  = typename TypeParam::Type;
+  using ArrayType = fetch::math::Tensor<DataType, CountingArray<DataType>>;
+
+  // the blas kernels only take the default container, so the graph is made of elementwise ops:
+  // output = tanh(relu(W * input) * sigmoid(relu(W * input))) + bias
+  fetch::ml::Graph<ArrayType> g;
+  g.template AddNode<fetch::ml::ops::PlaceHolder<ArrayType>>("Input", {});
+  g.template AddNode<fetch::ml::ops::Weights<ArrayType>>("W", {});
+  g.template AddNode<fetch::ml::ops::Weights<ArrayType>>("Bias", {});
+  g.template AddNode<fetch::ml::ops::Multiply<ArrayType>>("Hidden", {"W", "Input"});
+  g.template AddNode<fetch::ml::ops::Relu<ArrayType>>("Relu", {"Hidden"});
+  g.template AddNode<fetch::ml::ops::Sigmoid<ArrayType>>("Sigmoid", {"Relu"});
+  g.template AddNode<fetch::ml::ops::Multiply<ArrayType>>("Gate", {"Relu", "Sigmoid"});
+  g.template AddNode<fetch::ml::ops::TanH<ArrayType>>("TanH", {"Gate"});
+  g.template AddNode<fetch::ml::ops::Add<ArrayType>>("Output", {"TanH", "Bias"});
+
+  ArrayType bias({4, 1});
+  bias.Fill(DataType{1} / DataType{4});
+  g.SetInput("W", PlannerGraphInput<ArrayType>(7, 1));
+  g.SetInput("Bias", bias);
+
+  std::vector<ArrayType> inputs;
+  for (std::uint64_t step = 0; step < 4; ++step)
+  {
+    inputs.emplace_back(PlannerGraphInput<ArrayType>(7, step));
+  }
+  ArrayType error_signal({4, 7});
+  error_signal.Fill(DataType{1} / DataType{10});
+
+  auto train = [&g, &error_signal](ArrayType const &input) {
+    g.SetInput("Input", input);
+    g.Evaluate("Output");
+    g.BackPropagateSignal("Output", error_signal);
+
+    std::vector<ArrayType> gradients = g.GetGradients();
+    g.ApplyGradients(gradients);
+  };
+
+  // the first step plans the arena for the batch shape and the second one moves into it
+  train(inputs[0]);
+  train(inputs[1]);
+
+  CountingArray<DataType>::allocations = 0;
+  for (std::uint64_t round = 0; round < 3; ++round)
+  {
+    for (auto const &input : inputs)
+    {
+      train(input);
+    }
+  }
+  EXPECT_EQ(CountingArray<DataType>::allocations, 0);
+}
+
+TYPED_TEST(GraphTest, memory_plan_in_place_ops_match_unplanned_evaluation)
+{
+  using ArrayType = TypeParam;
+  using DataType  = typename ArrayType::Type;
+
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::LeakyRelu<ArrayType>>(false, DataType(0.2));
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::Elu<ArrayType>>(false, DataType(0.5));
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::Relu<ArrayType>>(false);
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::Sigmoid<ArrayType>>(false);
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::LogSigmoid<ArrayType>>(false);
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::TanH<ArrayType>>(false);
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::Abs<ArrayType>>(false);
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::Exp<ArrayType>>(false);
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::Log<ArrayType>>(true);
+  ExpectInPlaceMatchesUnplanned<fetch::ml::ops::Sqrt<ArrayType>>(true);
+}
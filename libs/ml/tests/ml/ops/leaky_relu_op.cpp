@@ -85,7 +85,9 @@ TYPED_TEST(LeakyReluOpTest, backward_test)
                         .Transpose();
 
   fetch::ml::ops::LeakyReluOp<ArrayType> op;
-  std::vector<ArrayType>                 prediction = op.Backward({data, alpha}, error);
+  std::vector<ArrayType>                 prediction{ArrayType(data.shape()),
+                                                    ArrayType(alpha.shape())};
+  op.Backward({data, alpha}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType(1e-5), DataType(1e-5)));
@@ -124,7 +124,8 @@ TYPED_TEST(LogBothTest, backward_test)
 
   fetch::ml::ops::Log<TypeParam> op;
 
-  std::vector<ArrayType> prediction = op.Backward({data}, error);
+  std::vector<ArrayType> prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   ASSERT_TRUE(prediction.at(0).AllClose(gt, fetch::math::function_tolerance<DataType>(),
                                         fetch::math::function_tolerance<DataType>()));
@@ -22,6 +22,8 @@
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 template <typename T>
 class CrossEntropyTest : public ::testing::Test
 {
@@ -185,9 +187,10 @@ TYPED_TEST(CrossEntropyTest, trivial_one_dimensional_backward_test)
   error_signal(0, 0) = DataType{1};
 
   fetch::ml::ops::CrossEntropyLoss<TypeParam> op;
-  EXPECT_TRUE(op.Backward({data1, data2}, error_signal)
-                  .at(0)
-                  .AllClose(gt, typename TypeParam::Type(1e-5), typename TypeParam::Type(1e-5)));
+  std::vector<TypeParam> gradients{TypeParam(data1.shape()), TypeParam(data2.shape())};
+  op.Backward({data1, data2}, error_signal, gradients);
+  EXPECT_TRUE(gradients.at(0).AllClose(gt, typename TypeParam::Type(1e-5),
+                                       typename TypeParam::Type(1e-5)));
 }
 
 TYPED_TEST(CrossEntropyTest, one_dimensional_backward_test)
@@ -239,9 +242,10 @@ TYPED_TEST(CrossEntropyTest, one_dimensional_backward_test)
   error_signal(0, 0) = DataType{1};
 
   fetch::ml::ops::CrossEntropyLoss<TypeParam> op;
-  EXPECT_TRUE(op.Backward({data1, data2}, error_signal)
-                  .at(0)
-                  .AllClose(gt, typename TypeParam::Type(1e-5), typename TypeParam::Type(1e-5)));
+  std::vector<TypeParam> gradients{TypeParam(data1.shape()), TypeParam(data2.shape())};
+  op.Backward({data1, data2}, error_signal, gradients);
+  EXPECT_TRUE(gradients.at(0).AllClose(gt, typename TypeParam::Type(1e-5),
+                                       typename TypeParam::Type(1e-5)));
 }
 
 TYPED_TEST(CrossEntropyTest, non_one_hot_dimensional_backward_test)
@@ -273,7 +277,8 @@ TYPED_TEST(CrossEntropyTest, non_one_hot_dimensional_backward_test)
   error_signal(0, 0) = typename TypeParam::Type{1};
 
   fetch::ml::ops::CrossEntropyLoss<TypeParam> op;
-  EXPECT_TRUE(op.Backward({data1, data2}, error_signal)
-                  .at(0)
-                  .AllClose(gt, typename TypeParam::Type(1e-5), typename TypeParam::Type(1e-5)));
+  std::vector<TypeParam> gradients{TypeParam(data1.shape()), TypeParam(data2.shape())};
+  op.Backward({data1, data2}, error_signal, gradients);
+  EXPECT_TRUE(gradients.at(0).AllClose(gt, typename TypeParam::Type(1e-5),
+                                       typename TypeParam::Type(1e-5)));
 }
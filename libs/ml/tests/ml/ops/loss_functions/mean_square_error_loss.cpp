@@ -83,7 +83,9 @@ TYPED_TEST(MeanSquareErrorTest, one_by_eight_dimensional_backward_test)
   error_signal(0, 0) = DataType{1};
 
   fetch::ml::ops::MeanSquareErrorLoss<TypeParam> op;
-  std::vector<TypeParam> gradients = op.Backward({data1_transpose, data2_transpose}, error_signal);
+  std::vector<TypeParam> gradients{TypeParam(data1_transpose.shape()),
+                                   TypeParam(data2_transpose.shape())};
+  op.Backward({data1_transpose, data2_transpose}, error_signal, gradients);
   EXPECT_TRUE(
       gradients.at(0).AllClose(gt, fetch::math::function_tolerance<typename TypeParam::Type>(),
                                fetch::math::function_tolerance<typename TypeParam::Type>()));
@@ -111,7 +113,8 @@ TYPED_TEST(MeanSquareErrorTest, two_dimensional_backward_test_with_weighting)
   TypeParam gt           = TypeParam::FromString("0.0, -2.2, -1.1, -1.375; 0.0, 0.0, 0.0, 0.0");
 
   fetch::ml::ops::MeanSquareErrorLoss<TypeParam> op(weightings);
-  std::vector<TypeParam> gradients = op.Backward({data1, data2}, error_signal);
+  std::vector<TypeParam> gradients{TypeParam(data1.shape()), TypeParam(data2.shape())};
+  op.Backward({data1, data2}, error_signal, gradients);
 
   EXPECT_TRUE(
       gradients.at(0).AllClose(gt, fetch::math::function_tolerance<typename TypeParam::Type>() * 4,
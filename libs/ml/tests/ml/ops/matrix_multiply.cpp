@@ -61,7 +61,9 @@ TYPED_TEST(MatrixMultiplyTest, backward_test)
       R"(1, 2, 3, -4; 2, 4, 6, -8; -3, -6, -9, 12; 4, 8, 12, -16; 5, 10, 15, -20)");
 
   fetch::ml::ops::MatrixMultiply<TypeParam> op;
-  std::vector<TypeParam>                    backpropagated_signals = op.Backward({a, b}, error);
+  std::vector<TypeParam>                    backpropagated_signals{TypeParam(a.shape()),
+                                                                   TypeParam(b.shape())};
+  op.Backward({a, b}, error, backpropagated_signals);
 
   // test correct shapes
   ASSERT_EQ(backpropagated_signals.size(), 2);
@@ -99,7 +101,9 @@ TYPED_TEST(MatrixMultiplyTest, backward_batch_test)
   TypeParam gradient_b({4, 3, 2});
 
   fetch::ml::ops::MatrixMultiply<TypeParam> op;
-  std::vector<TypeParam>                    backpropagated_signals = op.Backward({a, b}, error);
+  std::vector<TypeParam>                    backpropagated_signals{TypeParam(a.shape()),
+                                                                   TypeParam(b.shape())};
+  op.Backward({a, b}, error, backpropagated_signals);
 
   // test correct shapes
   ASSERT_EQ(backpropagated_signals.size(), 2);
@@ -97,7 +97,8 @@ TYPED_TEST(MaxPool1DTest, backward_test)
   }
 
   fetch::ml::ops::MaxPool1D<ArrayType> op(3, 2);
-  std::vector<ArrayType>               prediction = op.Backward({data}, error);
+  std::vector<ArrayType>               prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -134,7 +135,8 @@ TYPED_TEST(MaxPool1DTest, backward_test_2_channels)
   }
 
   fetch::ml::ops::MaxPool1D<ArrayType> op(4, 1);
-  std::vector<ArrayType>               prediction = op.Backward({data}, error);
+  std::vector<ArrayType>               prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
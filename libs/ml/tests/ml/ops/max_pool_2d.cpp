@@ -165,7 +165,8 @@ TYPED_TEST(MaxPool2DTest, backward_test)
   gt(0, 4, 4, 0) = DataType{3};
 
   fetch::ml::ops::MaxPool2D<ArrayType> op(3, 2);
-  std::vector<ArrayType>               prediction = op.Backward({data}, error);
+  std::vector<ArrayType>               prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
@@ -221,7 +222,8 @@ TYPED_TEST(MaxPool2DTest, backward_2_channels_test)
   gt(1, 4, 4, 0) = DataType{6};
 
   fetch::ml::ops::MaxPool2D<ArrayType> op(3, 2);
-  std::vector<ArrayType>               prediction = op.Backward({data}, error);
+  std::vector<ArrayType>               prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt, DataType{1e-5f}, DataType{1e-5f}));
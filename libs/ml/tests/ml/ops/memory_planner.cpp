@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ml/memory_planner.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+using fetch::ml::MemoryPlanner;
+using SizeType = MemoryPlanner::SizeType;
+
+TEST(memory_planner_test, chain_reuses_memory)
+{
+  MemoryPlanner planner;
+
+  // a -> b -> c -> d, each buffer read only by the next step
+  SizeType a = planner.AddBuffer(10, 0, 1);
+  SizeType b = planner.AddBuffer(10, 1, 2);
+  SizeType c = planner.AddBuffer(10, 2, 3);
+  SizeType d = planner.AddBuffer(10, 3, 3);
+
+  EXPECT_EQ(planner.Plan(), 20);
+  EXPECT_NE(planner.Offset(a), planner.Offset(b));
+  EXPECT_NE(planner.Offset(b), planner.Offset(c));
+  EXPECT_NE(planner.Offset(c), planner.Offset(d));
+  EXPECT_EQ(planner.Offset(a), planner.Offset(c));
+  EXPECT_EQ(planner.Offset(b), planner.Offset(d));
+}
+
+TEST(memory_planner_test, live_buffers_do_not_share)
+{
+  MemoryPlanner planner;
+
+  planner.AddBuffer(10, 0, 3);
+  planner.AddBuffer(20, 1, 3);
+  planner.AddBuffer(30, 2, 3);
+
+  EXPECT_EQ(planner.Plan(), 60);
+}
+
+TEST(memory_planner_test, extended_lifetime)
+{
+  MemoryPlanner planner;
+
+  SizeType a = planner.AddBuffer(10, 0, 1);
+  SizeType b = planner.AddBuffer(10, 2, 2);
+  EXPECT_EQ(planner.Plan(), 10);
+  EXPECT_EQ(planner.Offset(a), planner.Offset(b));
+
+  planner.ExtendLifetime(a, 2);
+  EXPECT_EQ(planner.Plan(), 20);
+  EXPECT_NE(planner.Offset(a), planner.Offset(b));
+}
+
+TEST(memory_planner_test, smallest_fitting_gap)
+{
+  MemoryPlanner planner;
+
+  // two long lived buffers placed around a short lived one leave a gap of 38 behind it
+  planner.AddBuffer(40, 0, 4);
+  SizeType gap = planner.AddBuffer(38, 0, 1);
+  planner.AddBuffer(35, 0, 4);
+
+  // a later buffer goes into the gap rather than growing the arena
+  SizeType late = planner.AddBuffer(25, 2, 4);
+
+  EXPECT_EQ(planner.Plan(), 113);
+  EXPECT_EQ(planner.Offset(late), planner.Offset(gap));
+}
+
+TEST(memory_planner_test, alignment)
+{
+  MemoryPlanner planner(8);
+
+  SizeType a = planner.AddBuffer(3, 0, 2);
+  SizeType b = planner.AddBuffer(5, 0, 2);
+  SizeType c = planner.AddBuffer(9, 0, 2);
+
+  planner.Plan();
+  EXPECT_EQ(planner.Offset(a) % 8, 0);
+  EXPECT_EQ(planner.Offset(b) % 8, 0);
+  EXPECT_EQ(planner.Offset(c) % 8, 0);
+  EXPECT_EQ(planner.ArenaSize(), 16 + 8 + 3);
+}
+
+TEST(memory_planner_test, random_lifetimes_never_overlap)
+{
+  struct Lifetime
+  {
+    SizeType size;
+    SizeType first;
+    SizeType last;
+  };
+
+  std::mt19937 rng(42);
+
+  for (SizeType trial = 0; trial < 100; ++trial)
+  {
+    MemoryPlanner         planner(4);
+    std::vector<Lifetime> lifetimes;
+
+    SizeType const steps = 1 + rng() % 30;
+    SizeType const count = 1 + rng() % 40;
+    SizeType       total = 0;
+
+    for (SizeType i = 0; i < count; ++i)
+    {
+      SizeType const first = rng() % steps;
+      SizeType const last  = first + rng() % (steps - first);
+      SizeType const size  = rng() % 100;
+
+      lifetimes.push_back({size, first, last});
+      planner.AddBuffer(size, first, last);
+      total += ((size + 3) / 4) * 4;
+    }
+
+    SizeType const arena_size = planner.Plan();
+    EXPECT_LE(arena_size, total);
+
+    for (SizeType i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(planner.Offset(i) % 4, 0);
+      EXPECT_LE(planner.Offset(i) + lifetimes[i].size, arena_size);
+
+      for (SizeType j = i + 1; j < count; ++j)
+      {
+        bool const same_time =
+            (lifetimes[i].first <= lifetimes[j].last) && (lifetimes[j].first <= lifetimes[i].last);
+        bool const same_memory =
+            (planner.Offset(i) < planner.Offset(j) + lifetimes[j].size) &&
+            (planner.Offset(j) < planner.Offset(i) + lifetimes[i].size);
+
+        EXPECT_FALSE(same_time && same_memory);
+      }
+    }
+  }
+}
@@ -87,7 +87,9 @@ TYPED_TEST(MultiplyTest, backward_test)
       "5, -5, 6, -6, 7, -7, 8, -8");
 
   fetch::ml::ops::Multiply<ArrayType> op;
-  std::vector<ArrayType>              prediction = op.Backward({data_1, data_2}, error);
+  std::vector<ArrayType>              prediction{ArrayType(data_1.shape()),
+                                                 ArrayType(data_2.shape())};
+  op.Backward({data_1, data_2}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(prediction[0].AllClose(gt_1, fetch::math::function_tolerance<DataType>(),
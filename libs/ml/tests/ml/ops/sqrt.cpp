@@ -84,7 +84,8 @@ TYPED_TEST(SqrtBothTest, backward_all_positive_test)
 
   fetch::ml::ops::Sqrt<TypeParam> op;
 
-  std::vector<ArrayType> prediction = op.Backward({data}, error);
+  std::vector<ArrayType> prediction{ArrayType(data.shape())};
+  op.Backward({data}, error, prediction);
 
   ASSERT_TRUE(prediction.at(0).AllClose(gt, fetch::math::function_tolerance<DataType>(),
                                         fetch::math::function_tolerance<DataType>()));
@@ -136,7 +137,8 @@ TYPED_TEST(SqrtFloatTest, backward_all_negative_test)
 
   fetch::ml::ops::Sqrt<TypeParam> op;
 
-  std::vector<ArrayType> pred = op.Backward({data}, error);
+  std::vector<ArrayType> pred{ArrayType(data.shape())};
+  op.Backward({data}, error, pred);
   // gives NaN because sqrt of a negative number is undefined
   for (auto p_it : pred.at(0))
   {
@@ -153,7 +155,8 @@ TYPED_TEST(SqrtFixedTest, backward_all_negative_test)
 
   fetch::ml::ops::Sqrt<TypeParam> op;
 
-  std::vector<ArrayType> pred = op.Backward({data}, error);
+  std::vector<ArrayType> pred{ArrayType(data.shape())};
+  op.Backward({data}, error, pred);
   // gives NaN because sqrt of a negative number is undefined
   for (auto p_it : pred.at(0))
   {
@@ -170,7 +173,8 @@ TYPED_TEST(SqrtFloatTest, backward_zero_test)
 
   fetch::ml::ops::Sqrt<TypeParam> op;
 
-  std::vector<ArrayType> pred = op.Backward({data}, error);
+  std::vector<ArrayType> pred{ArrayType(data.shape())};
+  op.Backward({data}, error, pred);
   // gives NaN because of division by zero
   for (auto p_it : pred.at(0))
   {
@@ -187,7 +191,8 @@ TYPED_TEST(SqrtFixedTest, backward_zero_test)
 
   fetch::ml::ops::Sqrt<TypeParam> op;
 
-  std::vector<ArrayType> pred = op.Backward({data}, error);
+  std::vector<ArrayType> pred{ArrayType(data.shape())};
+  op.Backward({data}, error, pred);
   // gives NaN because of division by zero
   for (auto p_it : pred.at(0))
   {
@@ -104,7 +104,8 @@ TYPED_TEST(TanhTest, backward_all_positive_test)
     gt.Set(i, typename TypeParam::Type(gtInput[i]));
   }
   fetch::ml::ops::TanH<TypeParam> op;
-  std::vector<TypeParam>          prediction = op.Backward({data}, error);
+  std::vector<TypeParam>          prediction{TypeParam(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(
@@ -128,7 +129,8 @@ TYPED_TEST(TanhTest, backward_all_negative_test)
     gt.Set(i, typename TypeParam::Type(gtInput[i]));
   }
   fetch::ml::ops::TanH<TypeParam> op;
-  std::vector<TypeParam>          prediction = op.Backward({data}, error);
+  std::vector<TypeParam>          prediction{TypeParam(data.shape())};
+  op.Backward({data}, error, prediction);
 
   // test correct values
   ASSERT_TRUE(
@@ -67,7 +67,8 @@ TYPED_TEST(WeightsTest, gradient_step_test)
   w.Forward({}, prediction);
 
   EXPECT_EQ(prediction, data);
-  std::vector<ArrayType> error_signal = w.Backward({}, error);
+  std::vector<ArrayType> error_signal;
+  w.Backward({}, error, error_signal);
 
   ArrayType grad = w.get_gradients();
   fetch::math::Multiply(grad, DataType{-1}, grad);
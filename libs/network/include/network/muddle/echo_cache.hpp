@@ -0,0 +1,106 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace fetch {
+namespace muddle {
+
+/**
+ * A lock free set of the (broadcast) echo ids which have been seen recently.
+ *
+ * The set is split into a ring of time buckets, each of which is a fixed size open addressed hash
+ * table of atomic slots. Ids are always inserted into the current bucket and looked up in all of
+ * them. Periodically the ring is advanced, clearing the oldest bucket, so that ids expire after
+ * between (NUM_BUCKETS - 1) and NUM_BUCKETS bucket periods.
+ *
+ * When all the slots an id can occupy are taken, the id is stored in a mutex protected overflow
+ * set of the bucket instead. This slow path is only taken for ids which map onto a full region of
+ * the table, so that a burst of broadcasts never causes echos to go undetected.
+ *
+ * Lookups and inserts may be called concurrently from any thread. Advancing the ring is
+ * serialised internally, an id which is being looked up in the bucket as it is cleared might not
+ * be detected as an echo.
+ */
+class EchoCache
+{
+public:
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+  using Duration  = Clock::duration;
+
+  static constexpr std::size_t NUM_BUCKETS = 4;
+  static constexpr std::size_t MAX_PROBES  = 32;
+
+  // Construction / Destruction
+  EchoCache(std::size_t log2_bucket_size, Duration const &period);
+  EchoCache(EchoCache const &) = delete;
+  EchoCache(EchoCache &&)      = delete;
+  ~EchoCache()                 = default;
+
+  bool Update(uint64_t id);
+  bool Contains(uint64_t id) const;
+  void Advance(Timepoint const &now = Clock::now());
+
+  uint64_t overflow_count() const;
+
+  // Operators
+  EchoCache &operator=(EchoCache const &) = delete;
+  EchoCache &operator=(EchoCache &&) = delete;
+
+private:
+  using Slot        = std::atomic<uint64_t>;
+  using Slots       = std::unique_ptr<Slot[]>;
+  using Mutex       = std::mutex;
+  using OverflowSet = std::unordered_set<uint64_t>;
+
+  struct Bucket
+  {
+    Slots         slots;
+    mutable Mutex overflow_lock;
+
+    /// The ids which did not fit in the slots (protected by overflow_lock)
+    OverflowSet overflow;
+  };
+
+  using Buckets = std::array<Bucket, NUM_BUCKETS>;
+
+  bool Find(Bucket const &bucket, uint64_t value) const;
+  bool Insert(Bucket &bucket, uint64_t value);
+
+  std::size_t const mask_;    ///< The mask used to map an id onto a slot of a bucket
+  Duration const    period_;  ///< The period covered by each bucket
+  Buckets           buckets_;
+
+  std::atomic<uint64_t> generation_{0};  ///< The generation of the current bucket
+  std::atomic<uint64_t> overflow_{0};    ///< The number of ids stored in the overflow sets
+
+  Mutex     advance_lock_;
+  Timepoint last_advance_;  ///< The time the ring was last advanced (protected by advance_lock_)
+};
+
+}  // namespace muddle
+}  // namespace fetch
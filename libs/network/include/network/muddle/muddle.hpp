@@ -169,6 +169,8 @@ public:
 
   Identity const &identity() const;
 
+  PortList GetListeningPorts() const;
+
   MuddleEndpoint &AsEndpoint();
 
   ConnectionMap GetConnections(bool direct_only = false);
@@ -20,6 +20,7 @@
 #include "core/byte_array/const_byte_array.hpp"
 #include "core/mutex.hpp"
 #include "network/management/abstract_connection_register.hpp"
+#include "network/message.hpp"
 
 #include <functional>
 #include <memory>
@@ -44,6 +45,7 @@ public:
   using ConnectionMap         = std::unordered_map<ConnectionHandle, ConnectionPtr>;
   using ConnectionMapCallback = std::function<void(ConnectionMap const &)>;
   using ConstByteArray        = byte_array::ConstByteArray;
+  using Buffer                = network::message_type;
   using Mutex                 = mutex::Mutex;
 
   static constexpr char const *LOGGING_NAME = "MuddleReg";
@@ -63,7 +65,7 @@ public:
   void VisitConnectionMap(ConnectionMapCallback const &cb);
   /// @}
 
-  void          Broadcast(ConstByteArray const &data) const;
+  void          Broadcast(Buffer const &data) const;
   ConnectionPtr LookupConnection(ConnectionHandle handle) const;
 
 protected:
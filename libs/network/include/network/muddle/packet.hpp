@@ -19,7 +19,9 @@
 
 #include "core/byte_array/byte_array.hpp"
 #include "core/byte_array/const_byte_array.hpp"
+#include "core/serializers/byte_array.hpp"
 #include "core/serializers/byte_array_buffer.hpp"
+#include "core/serializers/stl_types.hpp"
 #include "crypto/prover.hpp"
 #include "crypto/verifier.hpp"
 
@@ -77,6 +79,7 @@ public:
   using Address    = byte_array::ConstByteArray;
   using Payload    = byte_array::ConstByteArray;
   using Stamp      = byte_array::ConstByteArray;
+  using Buffer     = byte_array::ByteArray;
 
   struct RoutingHeader
   {
@@ -150,10 +153,17 @@ public:
   void Sign(crypto::Prover &prover);
   bool Verify() const;
 
+  /// @name Wire Format
+  /// @{
+  void   Decode(Buffer const &buffer);
+  Buffer Encode();
+  /// @}
+
 private:
   RoutingHeader header_;   ///< The header containing primarily routing information
   Payload       payload_;  ///< The payload of the message
   Stamp         stamp_;    ///< Signature when stamped
+  Buffer        encoded_;  ///< The encoded packet (shared with the payload when decoded)
 
   ///< Cached versions of the addresses
   mutable Address target_;
@@ -352,6 +362,9 @@ inline void Packet::SetPayload(Payload const &payload)
 inline void Packet::SetStamped(bool set) noexcept
 {
   header_.stamped = set;
+
+  // any change other than the TTL invalidates the encoded packet
+  encoded_ = Buffer{};
 }
 
 inline Packet::BinaryHeader Packet::StaticHeader() const noexcept
@@ -409,6 +422,52 @@ void Deserialize(T &serializer, Packet &packet)
   }
 }
 
+/**
+ * Populate the packet from its wire format.
+ *
+ * The decoded buffer is retained (the payload and stamp already reference it) so that a packet
+ * being relayed can be sent on without being serialized again.
+ *
+ * @param buffer The buffer containing the encoded packet
+ */
+inline void Packet::Decode(Buffer const &buffer)
+{
+  serializers::ByteArrayBuffer serializer{buffer};
+  serializer >> *this;
+
+  // the buffer can only be reused if it contains exactly this packet
+  if (serializer.tell() == serializer.data().size())
+  {
+    encoded_ = serializer.data();
+  }
+}
+
+/**
+ * Generate the wire format of the packet.
+ *
+ * The result is cached so that a packet sent to many connections shares a single buffer. For a
+ * decoded packet the header is patched in place to reflect any updated TTL, therefore the TTL must
+ * not be changed once the encoded packet has been handed to a connection.
+ *
+ * @return The encoded packet
+ */
+inline Packet::Buffer Packet::Encode()
+{
+  if (encoded_.empty())
+  {
+    serializers::ByteArrayBuffer serializer;
+    serializer << *this;
+
+    encoded_ = serializer.data();
+  }
+  else if (std::memcmp(encoded_.pointer(), &header_, HEADER_SIZE) != 0)
+  {
+    std::memcpy(encoded_.pointer(), &header_, HEADER_SIZE);
+  }
+
+  return encoded_;
+}
+
 }  // namespace muddle
 }  // namespace fetch
 
@@ -22,11 +22,13 @@
 #include "network/details/thread_pool.hpp"
 #include "network/management/abstract_connection.hpp"
 #include "network/muddle/blacklist.hpp"
+#include "network/muddle/echo_cache.hpp"
 #include "network/muddle/muddle_endpoint.hpp"
 #include "network/muddle/network_id.hpp"
 #include "network/muddle/packet.hpp"
 #include "network/muddle/subscription_registrar.hpp"
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -168,13 +170,26 @@ public:
 private:
   using HandleMap  = std::unordered_map<Handle, std::unordered_set<Packet::RawAddress>>;
   using Mutex      = mutex::Mutex;
-  using Clock      = std::chrono::steady_clock;
-  using Timepoint  = Clock::time_point;
-  using EchoCache  = std::unordered_map<std::size_t, Timepoint>;
   using RawAddress = Packet::RawAddress;
   using BlackList  = fetch::muddle::Blacklist;
 
-  static constexpr std::size_t NUMBER_OF_ROUTER_THREADS = 10;
+  static constexpr std::size_t NUMBER_OF_ROUTER_THREADS  = 10;
+  static constexpr std::size_t NUMBER_OF_ROUTING_STRIPES = 16;
+
+  /**
+   * A partition of the routing table, addresses are assigned to a stripe by their hash so that
+   * lookups for different addresses do not contend on a single lock
+   */
+  struct RoutingStripe
+  {
+    mutable Mutex lock{__LINE__, __FILE__};
+    RoutingTable  table;  ///< The partition of the routing table (protected by lock)
+  };
+
+  using RoutingStripes = std::array<RoutingStripe, NUMBER_OF_ROUTING_STRIPES>;
+
+  RoutingStripe &      LookupStripe(Packet::RawAddress const &address);
+  RoutingStripe const &LookupStripe(Packet::RawAddress const &address) const;
 
   bool AssociateHandleWithAddress(Handle handle, Packet::RawAddress const &address, bool direct);
 
@@ -204,19 +219,18 @@ private:
   Prover *              prover_          = nullptr;
   bool                  sign_broadcasts_ = false;
 
-  mutable Mutex routing_table_lock_{__LINE__, __FILE__};
-  RoutingTable  routing_table_;  ///< The map routing table from address to handle (Protected by
-                                 ///< routing_table_lock_)
-  HandleMap
-      routing_table_handles_;  ///< The map of handles to address (Protected by routing_table_lock_)
+  RoutingStripes routing_table_;  ///< The routing table from address to handle
 
-  mutable Mutex echo_cache_lock_{__LINE__, __FILE__};
-  EchoCache     echo_cache_;
+  /// @name Handle Maps (protected by handle_map_lock_, acquired after any routing stripe lock)
+  /// @{
+  mutable Mutex       handle_map_lock_{__LINE__, __FILE__};
+  HandleMap           routing_table_handles_;  ///< The map of handles to addresses
+  HandleDirectAddrMap direct_address_map_;     ///< The map of handles to direct address
+  /// @}
 
-  ThreadPool dispatch_thread_pool_;
+  EchoCache echo_cache_;
 
-  HandleDirectAddrMap direct_address_map_;  ///< Map of handles to direct address
-  ///< (Protected by routing_table_lock)
+  ThreadPool dispatch_thread_pool_;
 };
 
 }  // namespace muddle
@@ -25,6 +25,7 @@
 #include "network/management/client_manager.hpp"
 #include "network/management/network_manager.hpp"
 #include "network/message.hpp"
+#include "network/tcp/write_batch.hpp"
 
 #include "network/fetch_asio.hpp"
 #include <atomic>
@@ -129,6 +130,7 @@ public:
     {
       std::lock_guard<mutex_type> lock(queue_mutex_);
       write_queue_.push_back(msg);
+      write_counters_.RecordQueueDepth(write_queue_.size());
     }
 
     std::weak_ptr<AbstractConnection> self   = shared_from_this();
@@ -177,6 +179,11 @@ public:
     // state DISCONNECTED->CONNECTED->DROPPED
   }
 
+  WriteCounters const &write_counters() const
+  {
+    return write_counters_;
+  }
+
 private:
   std::atomic<bool>                         shutting_down_{false};
   std::weak_ptr<asio::ip::tcp::tcp::socket> socket_;
@@ -189,9 +196,9 @@ private:
   std::weak_ptr<Strand> strand_;
 
   message_queue_type write_queue_;
-  mutable mutex_type can_write_mutex_;
-  bool               can_write_{true};
+  bool               writing_{false};  ///< Write in flight (protected by queue_mutex_)
   mutable mutex_type queue_mutex_;
+  WriteCounters      write_counters_;
 
   // TODO(issue 17): put this in shared class
   static const uint64_t networkMagic_ = 0xFE7C80A1FE7C80A1;
@@ -303,65 +310,46 @@ private:
     asio::async_read(*socket_ptr, asio::buffer(message.pointer(), message.size()), cb);
   }
 
-  static void SetHeader(byte_array::ByteArray &header, uint64_t bufSize)
-  {
-    header.Resize(16);
-
-    for (std::size_t i = 0; i < 8; ++i)
-    {
-      header[i] = uint8_t((networkMagic_ >> i * 8) & 0xff);
-    }
-
-    for (std::size_t i = 0; i < 8; ++i)
-    {
-      header[i + 8] = uint8_t((bufSize >> i * 8) & 0xff);
-    }
-  }
-
   // Always executed in a run(), in a strand
-  void WriteNext(shared_self_type selfLock)
+  void WriteNext(shared_self_type selfLock, bool continuation = false)
   {
-    // Only one thread can get past here at a time. Effectively a try_lock
-    // except that we can't unlock a mutex in the callback (undefined behaviour)
+    // Drain as much of the queue as possible into a single vectored write. The queue and the
+    // writing flag share a lock so that each batch only requires a single lock handoff
+    auto batch = std::make_shared<WriteBatch>();
     {
-      std::lock_guard<mutex_type> lock(can_write_mutex_);
-      if (can_write_)
-      {
-        can_write_ = false;
-      }
-      else
+      std::lock_guard<mutex_type> lock(queue_mutex_);
+
+      // Only one write can be in flight at a time, the completion of which continues the writing
+      if (writing_ && !continuation)
       {
         return;
       }
-    }
 
-    message_type buffer;
-    {
-      std::lock_guard<mutex_type> lock(queue_mutex_);
-      if (write_queue_.empty())
+      writing_ = (batch->Fill(write_queue_) > 0);
+      if (!writing_)
       {
-        std::lock_guard<mutex_type> lock(can_write_mutex_);
-        can_write_ = true;
         return;
       }
-      buffer = write_queue_.front();
-      write_queue_.pop_front();
-    }
 
-    byte_array::ByteArray header;
-    SetHeader(header, buffer.size());
-
-    std::vector<asio::const_buffer> buffers{asio::buffer(header.pointer(), header.size()),
-                                            asio::buffer(buffer.pointer(), buffer.size())};
+      write_counters_.RecordBatch(*batch, write_queue_.size());
+    }
 
     auto socket = socket_.lock();
 
-    auto cb = [this, selfLock, socket, buffer, header](std::error_code ec, std::size_t len) {
+    auto cb = [this, selfLock, socket, batch](std::error_code ec, std::size_t len) {
       FETCH_UNUSED(len);
 
+      // TODO(issue 16): this strand should be unnecessary
+      auto strandLock = strand_.lock();
+      if (!ec && strandLock)
+      {
+        WriteNext(selfLock, true);
+        return;
+      }
+
       {
-        std::lock_guard<mutex_type> lock(can_write_mutex_);
-        can_write_ = true;
+        std::lock_guard<mutex_type> lock(queue_mutex_);
+        writing_ = false;
       }
 
       if (ec)
@@ -369,15 +357,6 @@ private:
         FETCH_LOG_ERROR(LOGGING_NAME, "Error writing to socket, closing.");
         SignalLeave();
       }
-      else
-      {
-        // TODO(issue 16): this strand should be unnecessary
-        auto strandLock = strand_.lock();
-        if (strandLock)
-        {
-          WriteNext(selfLock);
-        }
-      }
     };
 
     auto strand = strand_.lock();
@@ -385,10 +364,15 @@ private:
     if (socket && strand)
     {
       assert(strand->running_in_this_thread());
-      asio::async_write(*socket, buffers, strand->wrap(cb));
+      asio::async_write(*socket, batch->buffers(), strand->wrap(cb));
     }
     else
     {
+      {
+        std::lock_guard<mutex_type> lock(queue_mutex_);
+        writing_ = false;
+      }
+
       FETCH_LOG_ERROR(LOGGING_NAME, "Failed to lock socket in WriteNext!");
       SignalLeave();
     }
@@ -24,6 +24,7 @@
 #include "network/message.hpp"
 #include "network/tcp/abstract_server.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <deque>
 #include <memory>
@@ -88,7 +89,9 @@ public:
     connection_register_ = reg;
   }
 
-  uint16_t port()
+  /// The port on which connections are accepted. When the server is created for port 0 this is
+  /// the port assigned by the operating system, once the server has been started
+  uint16_t port() const
   {
     return port_;
   };
@@ -99,7 +102,7 @@ private:
   void Accept(std::shared_ptr<asio::ip::tcp::tcp::acceptor> acceptor);
 
   network_manager_type                      network_manager_;
-  uint16_t                                  port_;
+  std::atomic<uint16_t>                     port_;
   std::deque<Request>                       requests_;
   mutex_type                                request_mutex_;
   std::weak_ptr<AbstractConnectionRegister> connection_register_;
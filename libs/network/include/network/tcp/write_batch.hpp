@@ -0,0 +1,92 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "network/fetch_asio.hpp"
+#include "network/message.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fetch {
+namespace network {
+
+/**
+ * A batch of queued messages, each framed with the network header, which can be written to a
+ * socket with a single scatter-gather write.
+ *
+ * The batch owns the headers and (references to) the messages so that the buffers remain valid
+ * until the write completes.
+ */
+class WriteBatch
+{
+public:
+  using Buffers = std::vector<asio::const_buffer>;
+
+  static constexpr uint64_t    NETWORK_MAGIC           = 0xFE7C80A1FE7C80A1;
+  static constexpr std::size_t HEADER_SIZE             = 2 * sizeof(uint64_t);
+  static constexpr std::size_t MAX_BATCH_SIZE          = 32;  // 64 buffers, one writev in asio
+  static constexpr std::size_t MAX_BATCH_SIZE_IN_BYTES = 256 * 1024;
+
+  // Construction / Destruction
+  WriteBatch()                   = default;
+  WriteBatch(WriteBatch const &) = delete;
+  WriteBatch(WriteBatch &&)      = delete;
+  ~WriteBatch()                  = default;
+
+  std::size_t Fill(message_queue_type &queue, std::size_t max_bytes = MAX_BATCH_SIZE_IN_BYTES);
+
+  Buffers const &buffers() const;
+  std::size_t    size() const;
+  std::size_t    size_in_bytes() const;
+  bool           empty() const;
+
+  // Operators
+  WriteBatch &operator=(WriteBatch const &) = delete;
+  WriteBatch &operator=(WriteBatch &&) = delete;
+
+private:
+  using Messages = std::vector<message_type>;
+
+  byte_array::ByteArray headers_;
+  Messages              messages_;
+  Buffers               buffers_;
+  std::size_t           size_in_bytes_{0};
+};
+
+/**
+ * Per connection counters describing how the write queue is being drained
+ */
+struct WriteCounters
+{
+  std::atomic<uint64_t> num_batches{0};      ///< The number of (vectored) writes issued
+  std::atomic<uint64_t> num_messages{0};     ///< The number of messages written
+  std::atomic<uint64_t> num_bytes{0};        ///< The number of bytes written (including headers)
+  std::atomic<uint64_t> max_batch_size{0};   ///< The largest number of messages in a single write
+  std::atomic<uint64_t> queue_depth{0};      ///< The current length of the write queue
+  std::atomic<uint64_t> max_queue_depth{0};  ///< The longest the write queue has been
+
+  void RecordQueueDepth(std::size_t depth);
+  void RecordBatch(WriteBatch const &batch, std::size_t remaining_depth);
+};
+
+}  // namespace network
+}  // namespace fetch
@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "network/muddle/echo_cache.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace fetch {
+namespace muddle {
+namespace {
+
+constexpr uint64_t EMPTY_SLOT = 0;
+
+/**
+ * Internal: Map an id onto a value which can be stored in a slot (zero marks an empty slot)
+ *
+ * @param id The input id
+ * @return The stored value
+ */
+uint64_t ToSlotValue(uint64_t id)
+{
+  return (EMPTY_SLOT == id) ? 1u : id;
+}
+
+}  // namespace
+
+constexpr std::size_t EchoCache::NUM_BUCKETS;
+constexpr std::size_t EchoCache::MAX_PROBES;
+
+/**
+ * Construct the echo cache
+ *
+ * @param log2_bucket_size The log2 of the number of slots in each bucket
+ * @param period The period of time covered by each bucket
+ */
+EchoCache::EchoCache(std::size_t log2_bucket_size, Duration const &period)
+  : mask_{(std::size_t{1} << log2_bucket_size) - 1u}
+  , period_{period}
+  , last_advance_{Clock::now()}
+{
+  assert(log2_bucket_size > 0);
+
+  for (auto &bucket : buckets_)
+  {
+    bucket.slots = std::make_unique<Slot[]>(mask_ + 1u);
+
+    for (std::size_t i = 0; i <= mask_; ++i)
+    {
+      bucket.slots[i].store(EMPTY_SLOT, std::memory_order_relaxed);
+    }
+  }
+}
+
+/**
+ * Check if the specified id has been seen recently and if not add it to the cache
+ *
+ * @param id The id to be checked
+ * @return true if the id has been seen before (i.e. is an echo), otherwise false
+ */
+bool EchoCache::Update(uint64_t id)
+{
+  uint64_t const value      = ToSlotValue(id);
+  uint64_t const generation = generation_.load(std::memory_order_acquire);
+
+  // check the previous buckets
+  for (std::size_t i = 1; i < NUM_BUCKETS; ++i)
+  {
+    if (Find(buckets_[(generation - i) % NUM_BUCKETS], value))
+    {
+      return true;
+    }
+  }
+
+  return !Insert(buckets_[generation % NUM_BUCKETS], value);
+}
+
+/**
+ * Check if the specified id has been seen recently (without adding it to the cache)
+ *
+ * @param id The id to be checked
+ * @return true if the id has been seen before, otherwise false
+ */
+bool EchoCache::Contains(uint64_t id) const
+{
+  uint64_t const value = ToSlotValue(id);
+
+  return std::any_of(buckets_.begin(), buckets_.end(),
+                     [this, value](Bucket const &bucket) { return Find(bucket, value); });
+}
+
+/**
+ * Advance the ring of buckets by the number of periods which have elapsed since it was last
+ * advanced, clearing the expired buckets
+ *
+ * @param now The current time
+ */
+void EchoCache::Advance(Timepoint const &now)
+{
+  std::lock_guard<Mutex> guard(advance_lock_);
+
+  uint64_t generation = generation_.load(std::memory_order_relaxed);
+
+  for (std::size_t i = 0; (i < NUM_BUCKETS) && ((now - last_advance_) >= period_); ++i)
+  {
+    // the next bucket is the oldest, clear it before it becomes the current bucket
+    auto &bucket = buckets_[(generation + 1u) % NUM_BUCKETS];
+    for (std::size_t j = 0; j <= mask_; ++j)
+    {
+      bucket.slots[j].store(EMPTY_SLOT, std::memory_order_relaxed);
+    }
+
+    {
+      std::lock_guard<Mutex> overflow_guard(bucket.overflow_lock);
+      bucket.overflow.clear();
+    }
+
+    generation_.store(++generation, std::memory_order_release);
+    last_advance_ += period_;
+  }
+
+  // after a long pause there is no need to catch up on the missed periods
+  if ((now - last_advance_) >= period_)
+  {
+    last_advance_ = now;
+  }
+}
+
+/**
+ * Get the number of ids which have been stored in the overflow sets because the slots of the
+ * current bucket were full
+ *
+ * @return The number of ids
+ */
+uint64_t EchoCache::overflow_count() const
+{
+  return overflow_.load(std::memory_order_relaxed);
+}
+
+/**
+ * Internal: Search the bucket for the specified value
+ *
+ * @param bucket The bucket to be searched
+ * @param value The value to search for
+ * @return true if the value was found, otherwise false
+ */
+bool EchoCache::Find(Bucket const &bucket, uint64_t value) const
+{
+  for (std::size_t i = 0; i < MAX_PROBES; ++i)
+  {
+    uint64_t const current = bucket.slots[(value + i) & mask_].load(std::memory_order_acquire);
+
+    if (current == value)
+    {
+      return true;
+    }
+
+    // slots are only ever filled, so the value can not have been moved to the overflow set
+    if (current == EMPTY_SLOT)
+    {
+      return false;
+    }
+  }
+
+  std::lock_guard<Mutex> guard(bucket.overflow_lock);
+  return bucket.overflow.find(value) != bucket.overflow.end();
+}
+
+/**
+ * Internal: Insert the specified value into the bucket
+ *
+ * @param bucket The bucket to be updated
+ * @param value The value to insert
+ * @return false if the value was already present, otherwise true
+ */
+bool EchoCache::Insert(Bucket &bucket, uint64_t value)
+{
+  for (std::size_t i = 0; i < MAX_PROBES; ++i)
+  {
+    auto &slot = bucket.slots[(value + i) & mask_];
+
+    uint64_t current = slot.load(std::memory_order_acquire);
+    if ((current == EMPTY_SLOT) &&
+        slot.compare_exchange_strong(current, value, std::memory_order_acq_rel))
+    {
+      return true;
+    }
+
+    // either the slot was already occupied or another thread has just claimed it
+    if (current == value)
+    {
+      return false;
+    }
+  }
+
+  // the slots are full around this value, fall back to the overflow set of the bucket
+  std::lock_guard<Mutex> guard(bucket.overflow_lock);
+  if (!bucket.overflow.insert(value).second)
+  {
+    return false;
+  }
+
+  overflow_.fetch_add(1, std::memory_order_relaxed);
+
+  return true;
+}
+
+}  // namespace muddle
+}  // namespace fetch
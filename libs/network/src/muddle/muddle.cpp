@@ -292,6 +292,27 @@ void Muddle::CreateTcpServer(uint16_t port)
   servers_.emplace_back(std::static_pointer_cast<network::AbstractNetworkServer>(server));
 }
 
+/**
+ * Get the ports on which the node is accepting connections. For the servers which were started on
+ * port 0 this is the port which has been assigned by the operating system
+ *
+ * @return The list of ports
+ */
+Muddle::PortList Muddle::GetListeningPorts() const
+{
+  PortList ports{};
+  for (auto const &server : servers_)
+  {
+    auto const tcp_server = std::dynamic_pointer_cast<network::TCPServer>(server);
+    if (tcp_server)
+    {
+      ports.push_back(tcp_server->port());
+    }
+  }
+
+  return ports;
+}
+
 /**
  * Create a new TCP client connection to the specified peer
  *
@@ -340,10 +361,8 @@ void Muddle::CreateTcpClient(Uri const &peer)
     try
     {
       // un-marshall the data
-      serializers::ByteArrayBuffer buffer(msg);
-
       auto packet = std::make_shared<Packet>();
-      buffer >> *packet;
+      packet->Decode(msg);
 
       // dispatch the message to router
       router_.Route(conn_handle, packet);
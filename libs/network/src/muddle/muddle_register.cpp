@@ -45,11 +45,12 @@ void MuddleRegister::VisitConnectionMap(MuddleRegister::ConnectionMapCallback co
 }
 
 /**
- * Broadcast data to all active connections
+ * Broadcast data to all active connections. The buffer is shared (not copied) between all the
+ * connections, therefore it must not be modified after this call.
  *
  * @param data The data to be broadcast
  */
-void MuddleRegister::Broadcast(ConstByteArray const &data) const
+void MuddleRegister::Broadcast(Buffer const &data) const
 {
   LOG_STACK_TRACE_POINT;
   FETCH_LOCK(connection_map_lock_);
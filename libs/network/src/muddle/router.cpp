@@ -41,7 +41,9 @@
 #include <stdexcept>
 #include <utility>
 
-static constexpr uint8_t DEFAULT_TTL = 40;
+static constexpr uint8_t     DEFAULT_TTL                 = 40;
+static constexpr std::size_t ECHO_CACHE_LOG2_BUCKET_SIZE = 17;
+static constexpr auto        ECHO_CACHE_PERIOD           = std::chrono::seconds{200};
 
 using fetch::byte_array::ToBase64;
 using fetch::byte_array::ByteArray;
@@ -227,6 +229,7 @@ Router::Router(NetworkId network_id, Address address, MuddleRegister const &reg,
   , network_id_(std::move(network_id))
   , prover_(prover)
   , sign_broadcasts_(prover && sign_broadcasts)
+  , echo_cache_(ECHO_CACHE_LOG2_BUCKET_SIZE, ECHO_CACHE_PERIOD)
   , dispatch_thread_pool_(network::MakeThreadPool(NUMBER_OF_ROUTER_THREADS, "Router"))
 {}
 
@@ -422,8 +425,15 @@ void Router::Broadcast(uint16_t service, uint16_t channel, Payload const &payloa
  */
 Router::RoutingTable Router::GetRoutingTable() const
 {
-  FETCH_LOCK(routing_table_lock_);
-  return routing_table_;
+  RoutingTable table{};
+
+  for (auto const &stripe : routing_table_)
+  {
+    FETCH_LOCK(stripe.lock);
+    table.insert(stripe.table.begin(), stripe.table.end());
+  }
+
+  return table;
 }
 
 /**
@@ -433,7 +443,7 @@ Router::RoutingTable Router::GetRoutingTable() const
  */
 bool Router::HandleToDirectAddress(const Router::Handle &handle, Router::Address &address) const
 {
-  FETCH_LOCK(routing_table_lock_);
+  FETCH_LOCK(handle_map_lock_);
   auto address_it = direct_address_map_.find(handle);
   if (address_it != direct_address_map_.end())
   {
@@ -449,20 +459,22 @@ bool Router::HandleToDirectAddress(const Router::Handle &handle, Router::Address
  */
 void Router::Debug(std::string const &prefix) const
 {
-  FETCH_LOCK(routing_table_lock_);
-  FETCH_LOG_WARN(LOGGING_NAME, prefix,
-                 "direct_address_map_: --------------------------------------");
-  for (auto const &routing : direct_address_map_)
   {
-    auto output = ToBase64(routing.second);
-    FETCH_LOG_WARN(LOGGING_NAME, prefix, static_cast<std::string>(output),
-                   " -> handle=", std::to_string(routing.first), " direct=by definition");
+    FETCH_LOCK(handle_map_lock_);
+    FETCH_LOG_WARN(LOGGING_NAME, prefix,
+                   "direct_address_map_: --------------------------------------");
+    for (auto const &routing : direct_address_map_)
+    {
+      auto output = ToBase64(routing.second);
+      FETCH_LOG_WARN(LOGGING_NAME, prefix, static_cast<std::string>(output),
+                     " -> handle=", std::to_string(routing.first), " direct=by definition");
+    }
+    FETCH_LOG_WARN(LOGGING_NAME, prefix,
+                   "direct_address_map_: --------------------------------------");
   }
-  FETCH_LOG_WARN(LOGGING_NAME, prefix,
-                 "direct_address_map_: --------------------------------------");
 
   FETCH_LOG_WARN(LOGGING_NAME, prefix, "routing_table_: --------------------------------------");
-  for (auto const &routing : routing_table_)
+  for (auto const &routing : GetRoutingTable())
   {
     ByteArray output(routing.first.size());
     std::copy(routing.first.begin(), routing.first.end(), output.pointer());
@@ -547,17 +559,20 @@ MuddleEndpoint::AddressList Router::GetDirectlyConnectedPeers() const
 {
   AddressList addresses{};
 
-  FETCH_LOCK(routing_table_lock_);
-  for (auto const &entry : routing_table_)
+  for (auto const &stripe : routing_table_)
   {
-    if (entry.second.direct)
+    FETCH_LOCK(stripe.lock);
+    for (auto const &entry : stripe.table)
     {
-      // lookup the connection
-      auto connection = register_.LookupConnection(entry.second.handle).lock();
-
-      if (connection && connection->is_alive())
+      if (entry.second.direct)
       {
-        addresses.emplace_back(ConvertAddress(entry.first));
+        // lookup the connection
+        auto connection = register_.LookupConnection(entry.second.handle).lock();
+
+        if (connection && connection->is_alive())
+        {
+          addresses.emplace_back(ConvertAddress(entry.first));
+        }
       }
     }
   }
@@ -574,13 +589,15 @@ MuddleEndpoint::AddressList Router::GetDirectlyConnectedPeers() const
 bool Router::IsConnected(Address const &target) const
 {
   LOG_STACK_TRACE_POINT;
-  FETCH_LOCK(routing_table_lock_);
+  auto const raw_address = ConvertAddress(target);
+  auto const &stripe     = LookupStripe(raw_address);
+
+  FETCH_LOCK(stripe.lock);
 
-  auto raw_address = ConvertAddress(target);
-  auto iter        = routing_table_.find(raw_address);
-  bool connected   = false;
+  auto iter      = stripe.table.find(raw_address);
+  bool connected = false;
 
-  if (iter != routing_table_.end())
+  if (iter != stripe.table.end())
   {
     auto conn = register_.LookupConnection(iter->second.handle).lock();
     if (conn)
@@ -618,10 +635,11 @@ bool Router::AssociateHandleWithAddress(Handle handle, Packet::RawAddress const
   // never allow the current node address to be added to the routing table
   if (address != address_raw_)
   {
-    FETCH_LOCK(routing_table_lock_);
+    auto &stripe = LookupStripe(address);
+    FETCH_LOCK(stripe.lock);
 
     // lookup (or create) the routing table entry
-    auto &routing_data = routing_table_[address];
+    auto &routing_data = stripe.table[address];
 
     bool const is_empty = (routing_data.handle == 0);
 
@@ -639,6 +657,8 @@ bool Router::AssociateHandleWithAddress(Handle handle, Packet::RawAddress const
       routing_data.handle = handle;
       routing_data.direct = direct;
 
+      FETCH_LOCK(handle_map_lock_);
+
       // remove association of the previous handle with the address (if required)
       if (prev_handle)
       {
@@ -673,6 +693,22 @@ bool Router::AssociateHandleWithAddress(Handle handle, Packet::RawAddress const
   return update_complete;
 }
 
+/**
+ * Internal: Determine the stripe of the routing table which contains the specified address
+ *
+ * @param address The address to lookup
+ * @return The reference to the routing table stripe
+ */
+Router::RoutingStripe &Router::LookupStripe(Packet::RawAddress const &address)
+{
+  return routing_table_[std::hash<RawAddress>{}(address) % NUMBER_OF_ROUTING_STRIPES];
+}
+
+Router::RoutingStripe const &Router::LookupStripe(Packet::RawAddress const &address) const
+{
+  return routing_table_[std::hash<RawAddress>{}(address) % NUMBER_OF_ROUTING_STRIPES];
+}
+
 /**
  * Internal: Looks up the specified connection handle from a given address
  *
@@ -697,10 +733,11 @@ Router::Handle Router::LookupHandle(Packet::RawAddress const &address) const
   Handle handle = 0;
 
   {
-    FETCH_LOCK(routing_table_lock_);
+    auto const &stripe = LookupStripe(address);
+    FETCH_LOCK(stripe.lock);
 
-    auto address_it = routing_table_.find(address);
-    if (address_it != routing_table_.end())
+    auto address_it = stripe.table.find(address);
+    if (address_it != stripe.table.end())
     {
       auto const &routing_data = address_it->second;
 
@@ -718,25 +755,40 @@ Router::Handle Router::LookupHandle(Packet::RawAddress const &address) const
  */
 Router::Handle Router::LookupRandomHandle(Packet::RawAddress const & /*address*/) const
 {
-  static std::random_device rd;
-  static std::mt19937       rng(rd());
+  static thread_local std::mt19937 rng{std::random_device{}()};
 
+  std::size_t size = 0;
+  for (auto const &stripe : routing_table_)
   {
-    FETCH_LOCK(routing_table_lock_);
+    FETCH_LOCK(stripe.lock);
+    size += stripe.table.size();
+  }
 
-    if (!routing_table_.empty())
-    {
-      // decide the random index to access
-      std::uniform_int_distribution<decltype(routing_table_)::size_type> distro(
-          0, routing_table_.size() - 1);
-      std::size_t const element = distro(rng);
+  if (size == 0)
+  {
+    return 0;
+  }
+
+  // decide the random index to access
+  std::uniform_int_distribution<std::size_t> distro(0, size - 1);
+  std::size_t element = distro(rng);
 
+  // locate the element, the table might have changed since it was sized in which case the search
+  // can fail
+  for (auto const &stripe : routing_table_)
+  {
+    FETCH_LOCK(stripe.lock);
+
+    if (element < stripe.table.size())
+    {
       // advance the iterator to the correct offset
-      auto it = routing_table_.cbegin();
+      auto it = stripe.table.cbegin();
       std::advance(it, static_cast<std::ptrdiff_t>(element));
 
       return it->second.handle;
     }
+
+    element -= stripe.table.size();
   }
 
   return 0;
@@ -753,9 +805,15 @@ void Router::KillConnection(Handle handle, Address const &peer)
   auto conn = register_.LookupConnection(handle).lock();
   if (conn)
   {
-    FETCH_LOCK(routing_table_lock_);
     conn->Close();
-    routing_table_.erase(ConvertAddress(peer));
+
+    auto const raw_address = ConvertAddress(peer);
+    auto &     stripe      = LookupStripe(raw_address);
+
+    FETCH_LOCK(stripe.lock);
+    stripe.table.erase(raw_address);
+
+    FETCH_LOCK(handle_map_lock_);
     direct_address_map_.erase(handle);
   }
   else
@@ -773,7 +831,7 @@ void Router::KillConnection(Handle handle)
   LOG_STACK_TRACE_POINT;
   Address address;
   {
-    FETCH_LOCK(routing_table_lock_);
+    FETCH_LOCK(handle_map_lock_);
     auto it = direct_address_map_.find(handle);
     if (it != direct_address_map_.end())
     {
@@ -816,14 +874,10 @@ void Router::SendToConnection(Handle handle, PacketPtr packet)
                                 packet->GetMessageNum());
     }
 
-    // serialize the packet to the buffer
-    serializers::ByteArrayBuffer buffer;
-    buffer << *packet;
-
     FETCH_LOG_DEBUG(LOGGING_NAME, "Sending out: ", DescribePacket(*packet));
 
-    // dispatch to the connection object
-    conn->Send(buffer.data());
+    // dispatch to the connection object (relayed packets reuse the buffer they arrived in)
+    conn->Send(packet->Encode());
   }
   else
   {
@@ -871,12 +925,8 @@ void Router::RoutePacket(PacketPtr packet, bool external)
       DispatchPacket(packet, address_);
     }
 
-    // serialize the packet to the buffer
-    serializers::ByteArrayBuffer buffer;
-    buffer << *packet;
-
-    // broadcast the data across the network
-    register_.Broadcast(buffer.data());
+    // broadcast the data across the network, all the connections share the same encoded buffer
+    register_.Broadcast(packet->Encode());
   }
   else
   {
@@ -978,29 +1028,12 @@ void Router::DispatchPacket(PacketPtr packet, Address transmitter)
 bool Router::IsEcho(Packet const &packet, bool register_echo)
 {
   LOG_STACK_TRACE_POINT;
-  bool is_echo = true;
 
   // combine the 3 fields together into a single index
   std::size_t const index = GenerateEchoId(packet);
 
-  {
-    FETCH_LOCK(echo_cache_lock_);
-
-    // lookup if the echo is in the cache
-    auto it = echo_cache_.find(index);
-    if (it == echo_cache_.end())
-    {
-      // register the echo (in needed)
-      if (register_echo)
-      {
-        echo_cache_[index] = Clock::now();
-      }
-
-      is_echo = false;
-    }
-  }
-
-  return is_echo;
+  // lookup if the echo is in the cache, registering the echo (if needed)
+  return (register_echo) ? echo_cache_.Update(index) : echo_cache_.Contains(index);
 }
 
 /**
@@ -1009,27 +1042,7 @@ bool Router::IsEcho(Packet const &packet, bool register_echo)
 void Router::CleanEchoCache()
 {
   LOG_STACK_TRACE_POINT;
-  FETCH_LOCK(echo_cache_lock_);
-
-  auto const now = Clock::now();
-
-  auto it = echo_cache_.begin();
-  while (it != echo_cache_.end())
-  {
-    // calculate the time delta
-    auto const delta = now - it->second;
-
-    if (delta > std::chrono::seconds{600})
-    {
-      // remove the element
-      it = echo_cache_.erase(it);
-    }
-    else
-    {
-      // move on to the next element in the cache
-      ++it;
-    }
-  }
+  echo_cache_.Advance();
 }
 
 void Router::Blacklist(Address const &target)
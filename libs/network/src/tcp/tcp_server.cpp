@@ -87,6 +87,7 @@ void TCPServer::Start()
             asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port_));
 
         acceptor_ = acceptor;
+        port_     = acceptor->local_endpoint().port();
 
         FETCH_LOG_DEBUG(LOGGING_NAME, "Starting TCP server acceptor loop");
         acceptor_ = acceptor;
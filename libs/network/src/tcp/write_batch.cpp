@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "network/tcp/write_batch.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace fetch {
+namespace network {
+namespace {
+
+/**
+ * Update an atomic maximum. The writers are serialised by the connection's queue lock so a simple
+ * load / store is sufficient.
+ */
+void UpdateMax(std::atomic<uint64_t> &current, uint64_t value)
+{
+  if (value > current.load(std::memory_order_relaxed))
+  {
+    current.store(value, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * Write a 64-bit value in little endian form
+ */
+void WriteValue(uint8_t *output, uint64_t value)
+{
+  for (std::size_t i = 0; i < sizeof(uint64_t); ++i)
+  {
+    output[i] = uint8_t((value >> (i * 8)) & 0xff);
+  }
+}
+
+}  // namespace
+
+constexpr uint64_t    WriteBatch::NETWORK_MAGIC;
+constexpr std::size_t WriteBatch::HEADER_SIZE;
+constexpr std::size_t WriteBatch::MAX_BATCH_SIZE;
+constexpr std::size_t WriteBatch::MAX_BATCH_SIZE_IN_BYTES;
+
+/**
+ * Populate an empty batch with messages from the front of the queue. At least one message is
+ * always taken (if available) regardless of its size, after that messages are taken until either
+ * the byte budget or the maximum batch size would be exceeded.
+ *
+ * @param queue The write queue to drain (must be locked by the caller)
+ * @param max_bytes The byte budget for the batch (including the headers)
+ * @return The number of messages added to the batch
+ */
+std::size_t WriteBatch::Fill(message_queue_type &queue, std::size_t max_bytes)
+{
+  assert(empty());
+
+  while (!queue.empty() && (messages_.size() < MAX_BATCH_SIZE))
+  {
+    std::size_t const message_size = HEADER_SIZE + queue.front().size();
+
+    if (!messages_.empty() && (size_in_bytes_ + message_size > max_bytes))
+    {
+      break;
+    }
+
+    messages_.push_back(queue.front());
+    queue.pop_front();
+    size_in_bytes_ += message_size;
+  }
+
+  // all the headers are held in a single allocation which is not modified once referenced
+  headers_.Resize(messages_.size() * HEADER_SIZE);
+  buffers_.reserve(messages_.size() * 2u);
+
+  for (std::size_t i = 0; i < messages_.size(); ++i)
+  {
+    uint8_t *header = headers_.pointer() + (i * HEADER_SIZE);
+
+    WriteValue(header, NETWORK_MAGIC);
+    WriteValue(header + sizeof(uint64_t), messages_[i].size());
+
+    buffers_.emplace_back(asio::buffer(header, HEADER_SIZE));
+    buffers_.emplace_back(asio::buffer(messages_[i].pointer(), messages_[i].size()));
+  }
+
+  return messages_.size();
+}
+
+/**
+ * Get the scatter-gather buffers for the batch
+ *
+ * @return The buffers, alternating between header and message
+ */
+WriteBatch::Buffers const &WriteBatch::buffers() const
+{
+  return buffers_;
+}
+
+/**
+ * Get the number of messages in the batch
+ *
+ * @return The number of messages
+ */
+std::size_t WriteBatch::size() const
+{
+  return messages_.size();
+}
+
+/**
+ * Get the total number of bytes to be written for the batch
+ *
+ * @return The number of bytes (including headers)
+ */
+std::size_t WriteBatch::size_in_bytes() const
+{
+  return size_in_bytes_;
+}
+
+/**
+ * Determine if the batch is empty
+ *
+ * @return true if there are no messages in the batch, otherwise false
+ */
+bool WriteBatch::empty() const
+{
+  return messages_.empty();
+}
+
+/**
+ * Record the length of the write queue after a message has been added to it
+ *
+ * @param depth The length of the write queue
+ */
+void WriteCounters::RecordQueueDepth(std::size_t depth)
+{
+  queue_depth.store(depth, std::memory_order_relaxed);
+  UpdateMax(max_queue_depth, depth);
+}
+
+/**
+ * Record a batch which is about to be written
+ *
+ * @param batch The batch being written
+ * @param remaining_depth The length of the write queue once the batch has been removed from it
+ */
+void WriteCounters::RecordBatch(WriteBatch const &batch, std::size_t remaining_depth)
+{
+  num_batches.fetch_add(1, std::memory_order_relaxed);
+  num_messages.fetch_add(batch.size(), std::memory_order_relaxed);
+  num_bytes.fetch_add(batch.size_in_bytes(), std::memory_order_relaxed);
+  queue_depth.store(remaining_depth, std::memory_order_relaxed);
+  UpdateMax(max_batch_size, batch.size());
+}
+
+}  // namespace network
+}  // namespace fetch
@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "network/muddle/echo_cache.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::muddle::EchoCache;
+
+constexpr std::size_t LOG2_BUCKET_SIZE = 10;
+constexpr auto        PERIOD           = std::chrono::seconds{10};
+
+TEST(EchoCacheTests, CheckEchoDetection)
+{
+  EchoCache cache{LOG2_BUCKET_SIZE, PERIOD};
+
+  EXPECT_FALSE(cache.Contains(42));
+  EXPECT_FALSE(cache.Update(42));
+  EXPECT_TRUE(cache.Contains(42));
+  EXPECT_TRUE(cache.Update(42));
+
+  // zero is a valid id
+  EXPECT_FALSE(cache.Update(0));
+  EXPECT_TRUE(cache.Update(0));
+
+  // lookups do not register the id
+  EXPECT_FALSE(cache.Contains(7));
+  EXPECT_FALSE(cache.Update(7));
+}
+
+TEST(EchoCacheTests, CheckExpiry)
+{
+  EchoCache  cache{LOG2_BUCKET_SIZE, PERIOD};
+  auto const start = EchoCache::Clock::now();
+
+  EXPECT_FALSE(cache.Update(42));
+
+  // the id is retained until its bucket is recycled
+  for (std::size_t i = 1; i < EchoCache::NUM_BUCKETS; ++i)
+  {
+    cache.Advance(start + (PERIOD * i));
+    EXPECT_TRUE(cache.Contains(42));
+  }
+
+  cache.Advance(start + (PERIOD * EchoCache::NUM_BUCKETS));
+  EXPECT_FALSE(cache.Contains(42));
+  EXPECT_FALSE(cache.Update(42));
+}
+
+TEST(EchoCacheTests, CheckLongPauseClearsCache)
+{
+  EchoCache  cache{LOG2_BUCKET_SIZE, PERIOD};
+  auto const start = EchoCache::Clock::now();
+
+  EXPECT_FALSE(cache.Update(1));
+  cache.Advance(start + (PERIOD * 100));
+  EXPECT_FALSE(cache.Contains(1));
+
+  // the next period starts from the time of the last advance
+  EXPECT_FALSE(cache.Update(2));
+  cache.Advance(start + (PERIOD * 100) + (PERIOD / 2));
+  EXPECT_TRUE(cache.Contains(2));
+}
+
+TEST(EchoCacheTests, CheckOverflow)
+{
+  static constexpr uint64_t NUM_IDS = 1000;
+
+  // a bucket of only 4 slots
+  EchoCache  cache{2, PERIOD};
+  auto const start = EchoCache::Clock::now();
+
+  for (uint64_t id = 1; id <= 4; ++id)
+  {
+    EXPECT_FALSE(cache.Update(id));
+  }
+  EXPECT_EQ(0u, cache.overflow_count());
+
+  // ids which can not be stored in the full bucket are still detected as echos
+  for (uint64_t id = 5; id <= NUM_IDS; ++id)
+  {
+    EXPECT_FALSE(cache.Update(id));
+  }
+  EXPECT_EQ(NUM_IDS - 4u, cache.overflow_count());
+
+  for (uint64_t id = 1; id <= NUM_IDS; ++id)
+  {
+    EXPECT_TRUE(cache.Contains(id));
+    EXPECT_TRUE(cache.Update(id));
+  }
+  EXPECT_EQ(NUM_IDS - 4u, cache.overflow_count());
+
+  // and expire along with their bucket
+  cache.Advance(start + (PERIOD * EchoCache::NUM_BUCKETS));
+  EXPECT_FALSE(cache.Contains(NUM_IDS));
+  EXPECT_FALSE(cache.Update(NUM_IDS));
+}
+
+TEST(EchoCacheTests, CheckConcurrentUpdates)
+{
+  static constexpr std::size_t NUM_THREADS = 8;
+  static constexpr uint64_t    NUM_IDS     = 256;
+
+  EchoCache             cache{LOG2_BUCKET_SIZE, PERIOD};
+  std::atomic<uint64_t> num_new{0};
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([&cache, &num_new]() {
+      for (uint64_t id = 0; id < NUM_IDS; ++id)
+      {
+        if (!cache.Update(id * 0x9E3779B97F4A7C15ull))
+        {
+          ++num_new;
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  // each of the ids is only ever reported as new once
+  EXPECT_EQ(NUM_IDS, num_new.load());
+}
+
+}  // namespace
@@ -146,3 +146,42 @@ TEST_F(PacketTests, CheckIndifference)
   EXPECT_TRUE(packet_->IsStamped());
   EXPECT_TRUE(packet_->Verify());
 }
+
+TEST_F(PacketTests, CheckRelayReusesEncoding)
+{
+  packet_->SetTTL(40);
+  packet_->Sign(*prover_);
+
+  Packet relayed{};
+  relayed.Decode(packet_->Encode());
+  relayed.SetTTL(39);
+
+  // the relayed packet is sent from the buffer it was decoded from
+  auto const encoded = relayed.Encode();
+  auto const payload = relayed.GetPayload();
+  EXPECT_GT(payload.pointer(), encoded.pointer());
+  EXPECT_LT(payload.pointer(), encoded.pointer() + encoded.size());
+  EXPECT_EQ(encoded.pointer(), relayed.Encode().pointer());
+
+  // only the TTL has been updated
+  Packet received{};
+  received.Decode(encoded);
+  EXPECT_EQ(39, received.GetTTL());
+  EXPECT_EQ(response_, received.GetPayload());
+  EXPECT_TRUE(received.Verify());
+}
+
+TEST_F(PacketTests, CheckEncodingInvalidation)
+{
+  auto const original = packet_->Encode();
+  EXPECT_EQ(original.pointer(), packet_->Encode().pointer());
+
+  packet_->SetService(42);
+
+  auto const updated = packet_->Encode();
+  EXPECT_NE(original.pointer(), updated.pointer());
+
+  Packet received{};
+  received.Decode(updated);
+  EXPECT_EQ(42, received.GetService());
+}
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "network/message.hpp"
+#include "network/tcp/write_batch.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::network::WriteBatch;
+using fetch::network::WriteCounters;
+using fetch::network::message_queue_type;
+using fetch::network::message_type;
+
+message_type CreateMessage(std::size_t size)
+{
+  message_type message;
+  message.Resize(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    message[i] = static_cast<uint8_t>(i);
+  }
+
+  return message;
+}
+
+uint64_t ReadValue(asio::const_buffer const &buffer, std::size_t offset)
+{
+  uint64_t value{0};
+  std::memcpy(&value, static_cast<uint8_t const *>(buffer.data()) + offset, sizeof(value));
+  return value;
+}
+
+TEST(WriteBatchTests, CheckEmptyQueue)
+{
+  message_queue_type queue{};
+
+  WriteBatch batch{};
+  EXPECT_EQ(batch.Fill(queue), 0u);
+  EXPECT_TRUE(batch.empty());
+  EXPECT_TRUE(batch.buffers().empty());
+}
+
+TEST(WriteBatchTests, CheckAllSmallMessagesAreBatched)
+{
+  message_queue_type queue{};
+  for (std::size_t i = 1; i <= 10; ++i)
+  {
+    queue.push_back(CreateMessage(i));
+  }
+
+  WriteBatch batch{};
+  EXPECT_EQ(batch.Fill(queue), 10u);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(batch.size_in_bytes(), (10u * WriteBatch::HEADER_SIZE) + 55u);
+
+  // each message is preceded by its framing header
+  auto const &buffers = batch.buffers();
+  ASSERT_EQ(buffers.size(), 20u);
+  for (std::size_t i = 0; i < 10; ++i)
+  {
+    auto const &header  = buffers[2 * i];
+    auto const &payload = buffers[(2 * i) + 1];
+
+    ASSERT_EQ(header.size(), WriteBatch::HEADER_SIZE);
+    EXPECT_EQ(ReadValue(header, 0), WriteBatch::NETWORK_MAGIC);
+    EXPECT_EQ(ReadValue(header, sizeof(uint64_t)), i + 1);
+    EXPECT_EQ(payload.size(), i + 1);
+  }
+}
+
+TEST(WriteBatchTests, CheckBatchSizeIsLimited)
+{
+  message_queue_type queue{};
+  for (std::size_t i = 0; i < WriteBatch::MAX_BATCH_SIZE + 5; ++i)
+  {
+    queue.push_back(CreateMessage(4));
+  }
+
+  WriteBatch batch{};
+  EXPECT_EQ(batch.Fill(queue), WriteBatch::MAX_BATCH_SIZE);
+  EXPECT_EQ(queue.size(), 5u);
+}
+
+TEST(WriteBatchTests, CheckByteBudgetIsRespected)
+{
+  message_queue_type queue{};
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    queue.push_back(CreateMessage(100));
+  }
+
+  WriteBatch batch{};
+  EXPECT_EQ(batch.Fill(queue, 2 * (100 + WriteBatch::HEADER_SIZE)), 2u);
+  EXPECT_EQ(queue.size(), 2u);
+}
+
+TEST(WriteBatchTests, CheckOversizedMessageIsStillWritten)
+{
+  message_queue_type queue{};
+  queue.push_back(CreateMessage(1000));
+  queue.push_back(CreateMessage(10));
+
+  WriteBatch batch{};
+  EXPECT_EQ(batch.Fill(queue, 100), 1u);
+  EXPECT_EQ(batch.size_in_bytes(), 1000u + WriteBatch::HEADER_SIZE);
+  EXPECT_EQ(queue.size(), 1u);
+}
+
+TEST(WriteBatchTests, CheckCounters)
+{
+  message_queue_type queue{};
+  WriteCounters      counters{};
+
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    queue.push_back(CreateMessage(8));
+    counters.RecordQueueDepth(queue.size());
+  }
+
+  WriteBatch batch{};
+  batch.Fill(queue);
+  counters.RecordBatch(batch, queue.size());
+
+  EXPECT_EQ(counters.num_batches, 1u);
+  EXPECT_EQ(counters.num_messages, 3u);
+  EXPECT_EQ(counters.num_bytes, 3u * (8u + WriteBatch::HEADER_SIZE));
+  EXPECT_EQ(counters.max_batch_size, 3u);
+  EXPECT_EQ(counters.queue_depth, 0u);
+  EXPECT_EQ(counters.max_queue_depth, 3u);
+}
+
+}  // namespace
@@ -19,6 +19,7 @@
 
 #include "core/byte_array/byte_array.hpp"
 #include "storage/file_object.hpp"
+#include "storage/journalled_file.hpp"
 #include "storage/key_value_index.hpp"
 #include "storage/resource_mapper.hpp"
 
@@ -186,6 +187,38 @@ public:
     std::lock_guard<mutex::Mutex> lock(mutex_);
     file_object_.Flush(lazy);
     key_index_.Flush(lazy);
+
+    // a full flush is the point at which the changes are made durable
+    if (!lazy && (journal_ != nullptr))
+    {
+      journal_->Commit();
+    }
+  }
+
+  /**
+   * Stage the writes to both underlying stacks in a journal, which is committed on each non-lazy
+   * flush. See NewVersionedRandomAccessStack::SetJournal
+   *
+   * @param journal The journal, which must outlive the store
+   */
+  void SetJournal(Journal *journal)
+  {
+    std::lock_guard<mutex::Mutex> lock(mutex_);
+    journal_ = journal;
+    key_index_.underlying_stack().SetJournal(journal);
+    file_object_.underlying_stack().SetJournal(journal);
+  }
+
+  /**
+   * Defer rehashing the key index until the state hash is next required, see
+   * KeyValueIndex::SetDeferredRehash
+   *
+   * @param deferred Whether the rehash should be deferred
+   */
+  void SetDeferredRehash(bool deferred)
+  {
+    std::lock_guard<mutex::Mutex> lock(mutex_);
+    key_index_.SetDeferredRehash(deferred);
   }
 
   std::size_t size() const
@@ -344,6 +377,7 @@ protected:
   mutex::Mutex         mutex_{__LINE__, __FILE__};
   key_value_index_type key_index_;
   file_object_type     file_object_;
+  Journal *            journal_{nullptr};
 };
 
 }  // namespace storage
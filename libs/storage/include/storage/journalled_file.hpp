@@ -0,0 +1,141 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "storage/write_ahead_log.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace fetch {
+namespace storage {
+
+class Journal;
+
+/**
+ * The JournalledFile provides the subset of the std::fstream interface used by the stacks. On its
+ * own it simply forwards to the underlying stream.
+ *
+ * Once attached to a Journal, writes are instead staged in memory (in pages) and are only written
+ * to the file when the journal is committed, after they have been made durable in the write ahead
+ * log. Reads see the staged writes, so the file behaves as if it had been written to directly.
+ */
+class JournalledFile
+{
+public:
+  static constexpr std::ios_base::seekdir beg = std::ios_base::beg;
+  static constexpr std::ios_base::seekdir cur = std::ios_base::cur;
+  static constexpr std::ios_base::seekdir end = std::ios_base::end;
+
+  static constexpr std::size_t PAGE_SIZE = 4096;
+
+  // Construction / Destruction
+  JournalledFile() = default;
+  JournalledFile(std::string filename, std::ios_base::openmode mode);
+  JournalledFile(JournalledFile const &) = delete;
+  JournalledFile(JournalledFile &&other) noexcept;
+  ~JournalledFile();
+
+  /// @name Stream Interface
+  /// @{
+  JournalledFile &seekg(int64_t position);
+  JournalledFile &seekg(int64_t offset, std::ios_base::seekdir direction);
+  int64_t         tellg();
+  JournalledFile &read(char *data, std::streamsize size);
+  JournalledFile &write(char const *data, std::streamsize size);
+  JournalledFile &flush();
+  void            close();
+  bool            is_open() const;
+
+  explicit operator bool() const;
+  bool     operator!() const;
+  /// @}
+
+  // Operators
+  JournalledFile &operator=(JournalledFile const &) = delete;
+  JournalledFile &operator=(JournalledFile &&other) noexcept;
+
+private:
+  struct Page
+  {
+    uint32_t                    begin{PAGE_SIZE};  ///< The start of the modified region
+    uint32_t                    end{0};            ///< The end of the modified region
+    std::array<char, PAGE_SIZE> data;
+  };
+
+  using Pages = std::map<uint64_t, Page>;
+
+  void  Stage(Journal *journal);
+  void  Unstage();
+  void  AddToRecord(WriteAheadLog::Record &record) const;
+  void  WriteBack();
+  Page &StagePage(uint64_t index);
+  void  ReadFile(int64_t position, char *data, std::size_t size);
+
+  std::fstream stream_;
+  std::string  filename_;
+  Journal *    journal_{nullptr};
+  Pages        pages_;          ///< The pages written since the last commit
+  int64_t      position_{0};    ///< The current position while attached
+  int64_t      size_{0};        ///< The size of the file including the staged pages
+  int64_t      file_size_{0};   ///< The size of the file on disk
+  bool         failed_{false};  ///< Whether a read has failed while attached
+
+  friend class Journal;
+};
+
+/**
+ * A Journal groups the files making up a store, and commits all of their staged writes to a write
+ * ahead log as a single record.
+ */
+class Journal
+{
+public:
+  using LogPtr = WriteAheadLog::LogPtr;
+
+  // Construction / Destruction
+  explicit Journal(LogPtr log);
+  Journal(Journal const &) = delete;
+  Journal(Journal &&)      = delete;
+  ~Journal();
+
+  void Attach(JournalledFile &file);
+  void Detach(JournalledFile &file);
+  void Commit();
+
+  WriteAheadLog &log();
+
+  // Operators
+  Journal &operator=(Journal const &) = delete;
+  Journal &operator=(Journal &&) = delete;
+
+private:
+  using Files = std::vector<JournalledFile *>;
+
+  LogPtr log_;
+  Files  files_;
+};
+
+}  // namespace storage
+}  // namespace fetch
@@ -57,6 +57,7 @@
 // (256), this represents that the node is a leaf. The nodes can contain additional information
 
 #include "crypto/sha256.hpp"
+#include "crypto/sha256_multi_buffer.hpp"
 #include "storage/cached_random_access_stack.hpp"
 #include "storage/key.hpp"
 #include "storage/new_versioned_random_access_stack.hpp"
@@ -66,8 +67,10 @@
 
 #include <cstring>
 #include <deque>
-#include <queue>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace fetch {
 namespace storage {
@@ -135,12 +138,8 @@ struct KeyValuePair
 
   bool UpdateNode(KeyValuePair const &left, KeyValuePair const &right)
   {
-    HashFunction hasher;
-    hasher.Reset();
-
-    hasher.Update(right.hash, N);
-    hasher.Update(left.hash, N);
-    hasher.Final(hash);
+    crypto::SHA256DigestPair const pair{right.hash, left.hash, hash};
+    crypto::HashDigestPairs(&pair, 1);
 
     return true;
   }
@@ -160,24 +159,6 @@ struct KeyValuePair
 template <typename KV = KeyValuePair<>, typename D = VersionedRandomAccessStack<KV>>
 class KeyValueIndex
 {
-  /**
-   * Used to keep track of the ordering of task priority, in this usage writing to the stack.
-   */
-  struct UpdateTask
-  {
-    uint64_t priority;
-    uint64_t element;
-
-    bool operator==(UpdateTask const &other) const
-    {
-      return (priority == other.priority) && (other.element == element);
-    }
-    bool operator<(UpdateTask const &other) const
-    {
-      return priority < other.priority;
-    }
-  };
-
 public:
   using self_type      = KeyValueIndex<KV, D>;
   using stack_type     = D;
@@ -204,6 +185,7 @@ public:
   {
     stack_.New(std::forward<Args>(args)...);
     root_ = 0;
+    schedule_update_.clear();
   }
 
   template <typename... Args>
@@ -220,74 +202,27 @@ public:
     }
 
     stack_.SetExtraHeader(root_);
+    RehashScheduledNodes();
+  }
 
-    std::unordered_map<uint64_t, uint64_t> depths;
-    std::unordered_map<uint64_t, uint64_t> parents;
-    std::priority_queue<UpdateTask>        q;
-
-    for (auto &k : schedule_update_)
-    {
-      auto &         kv   = k.second;
-      uint64_t       last = k.first;
-      uint64_t       pid  = kv.parent;
-      key_value_pair parent;
-      uint64_t       depth = 1;
-
-      while (pid != uint64_t(-1))
-      {
-        if (parents.find(last) != parents.end())
-        {
-          depth += depths[last];
-          break;
-        }
-        parents[last] = pid;
-
-        stack_.Get(pid, parent);
-        last = pid;
-        pid  = parent.parent;
-        ++depth;
-      }
-
-      // Adding root
-      if (pid == uint64_t(-1))
-      {
-        parents[last] = pid;
-      }
-
-      last = k.first;
-      while (parents.find(last) != parents.end())
-      {
-        if (depths.find(last) != depths.end())
-        {
-          break;
-        }
-        depths[last] = depth;
-        q.push({depth, last});
-        --depth;
-        last = parents[last];
-      }
-    }
-
-    UpdateTask task;
-    while (!q.empty())
+  /**
+   * Control whether the Merkle tree is rehashed on every Set or deferred until the tree hash is
+   * next required (Hash, Commit, Flush or iteration). Stacks which cache their writes always defer
+   * the rehash, enabling this extends the same behaviour to stacks which write directly to disk.
+   *
+   * Deferring means that ancestors shared between the updated nodes are rehashed once, rather than
+   * once per write, and that each level of the trie is hashed as a single batch.
+   *
+   * @param: deferred Whether the rehash should be deferred
+   */
+  void SetDeferredRehash(bool deferred)
+  {
+    if (!deferred)
     {
-      task = q.top();
-      q.pop();
-
-      key_value_pair element, left, right;
-      stack_.Get(task.element, element);
-      if (element.is_leaf())
-      {
-        continue;
-      }
-
-      stack_.Get(element.left, left);
-      stack_.Get(element.right, right);
-      element.UpdateNode(left, right);
-      stack_.Set(task.element, element);
+      RehashScheduledNodes();
     }
 
-    schedule_update_.clear();
+    deferred_rehash_ = deferred;
   }
 
   void Delete(byte_array::ConstByteArray const & /*key*/)
@@ -459,19 +394,20 @@ public:
     // to it by scheduling updates until the next flush
     if ((kv.parent != index_type(-1)) && (update_parent))
     {
-      if (stack_.DirectWrite())
+      if (stack_.DirectWrite() && !deferred_rehash_)
       {
         UpdateParents(kv.parent, index, kv);
       }
       else
       {
-        schedule_update_[index] = kv;
+        schedule_update_.insert(index);
       }
     }
   }
 
   byte_array::ByteArray Hash()
   {
+    RehashScheduledNodes();
     stack_.Flush();
     key_value_pair kv;
     if (stack_.size() > 0)
@@ -516,16 +452,19 @@ public:
   using bookmark_type = uint64_t;
   bookmark_type Commit()
   {
+    RehashScheduledNodes();
     return stack_.Commit();
   }
 
   bookmark_type Commit(bookmark_type const &b)
   {
+    RehashScheduledNodes();
     return stack_.Commit(b);
   }
 
   void Revert(bookmark_type const &b)
   {
+    schedule_update_.clear();
     stack_.Revert(b);
 
     root_ = stack_.header_extra();
@@ -595,6 +534,9 @@ public:
 
   self_type::Iterator begin()
   {
+    // iteration compares node hashes, so they must be up to date
+    RehashScheduledNodes();
+
     if (this->empty())
     {
       return end();
@@ -617,6 +559,7 @@ public:
 
   self_type::Iterator Find(byte_array::ConstByteArray const &key_str)
   {
+    RehashScheduledNodes();
 
     key_type       key(key_str);
     bool           split      = true;
@@ -636,6 +579,8 @@ public:
 
   self_type::Iterator GetSubtree(byte_array::ConstByteArray const &key_str, uint64_t max_bits)
   {
+    RehashScheduledNodes();
+
     if (this->empty())
     {
       return end();
@@ -793,13 +738,112 @@ public:
   void UpdateVariables()
   {
     root_ = stack_.header_extra();
+    schedule_update_.clear();
   }
 
 private:
   stack_type stack_;
 
-  uint64_t                                     root_ = 0;
-  std::unordered_map<uint64_t, key_value_pair> schedule_update_;
+  uint64_t                     root_ = 0;
+  std::unordered_set<uint64_t> schedule_update_;  ///< Updated nodes whose ancestors need rehashing
+  bool                         deferred_rehash_{false};
+
+  /**
+   * Rehash the ancestors of all the nodes updated since the last rehash. The dirty nodes are
+   * grouped by their depth in the trie and processed from the deepest level upwards, so that each
+   * node is rehashed exactly once and after all of its children. The nodes of each level are
+   * independent of each other, which allows them to be hashed as a single batch.
+   */
+  void RehashScheduledNodes()
+  {
+    if (schedule_update_.empty())
+    {
+      return;
+    }
+
+    std::unordered_map<uint64_t, std::size_t> depths;
+    std::vector<std::vector<uint64_t>>        levels;
+    std::vector<uint64_t>                     path;
+    key_value_pair                            kv;
+
+    for (auto const &updated : schedule_update_)
+    {
+      // walk up the trie until reaching the root or a node whose depth is already known
+      std::size_t depth   = 0;
+      uint64_t    current = updated;
+
+      path.clear();
+      while (current != key_value_pair::TREE_ROOT_VALUE)
+      {
+        auto const it = depths.find(current);
+        if (it != depths.end())
+        {
+          depth = it->second + 1;
+          break;
+        }
+
+        path.push_back(current);
+        stack_.Get(current, kv);
+        current = kv.parent;
+      }
+
+      // assign the depths on the way back down the path
+      for (auto it = path.rbegin(); it != path.rend(); ++it, ++depth)
+      {
+        depths[*it] = depth;
+
+        if (levels.size() <= depth)
+        {
+          levels.resize(depth + 1);
+        }
+        levels[depth].push_back(*it);
+      }
+    }
+
+    std::vector<key_value_pair>           nodes;
+    std::vector<key_value_pair>           children;
+    std::vector<uint64_t>                 indices;
+    std::vector<crypto::SHA256DigestPair> pairs;
+
+    for (auto level = levels.rbegin(); level != levels.rend(); ++level)
+    {
+      nodes.resize(level->size());
+      children.resize(level->size() * 2);
+      indices.clear();
+
+      // gather the internal nodes of this level along with their (already rehashed) children
+      for (auto const &index : *level)
+      {
+        std::size_t const i = indices.size();
+
+        stack_.Get(index, nodes[i]);
+        if (nodes[i].is_leaf())
+        {
+          continue;
+        }
+
+        stack_.Get(nodes[i].left, children[2 * i]);
+        stack_.Get(nodes[i].right, children[(2 * i) + 1]);
+        indices.push_back(index);
+      }
+
+      // the node hash covers the right child followed by the left, matching UpdateNode
+      pairs.resize(indices.size());
+      for (std::size_t i = 0; i < indices.size(); ++i)
+      {
+        pairs[i] = {children[(2 * i) + 1].hash, children[2 * i].hash, nodes[i].hash};
+      }
+
+      crypto::HashDigestPairs(pairs.data(), pairs.size());
+
+      for (std::size_t i = 0; i < indices.size(); ++i)
+      {
+        stack_.Set(indices[i], nodes[i]);
+      }
+    }
+
+    schedule_update_.clear();
+  }
 
   /**
    * Update the parents of a changed node, since this changes the merkle tree
@@ -18,9 +18,11 @@
 //------------------------------------------------------------------------------
 
 #include "storage/document_store.hpp"
+#include "storage/journalled_file.hpp"
 #include "storage/new_versioned_random_access_stack.hpp"
 
 #include <cstddef>
+#include <memory>
 #include <string>
 
 namespace fetch {
@@ -36,6 +38,8 @@ public:
   using UnderlyingType = storage::Document;
   using Keys           = std::vector<ResourceID>;
 
+  void SetWriteAheadLog(std::string const &filename);
+
   bool New(std::string const &state, std::string const &state_history, std::string const &index,
            std::string const &index_history, bool create_if_not_exist);
   bool Load(std::string const &state, std::string const &state_history, std::string const &index,
@@ -63,10 +67,17 @@ private:
                                                                                      // index
       NewVersionedRandomAccessStack<FileBlockType<2048>>>;                           // File store
 
+  using JournalPtr = std::unique_ptr<Journal>;
+
+  void OpenJournal();
+  void ResetFiles();
+
   std::string state_path_;
   std::string state_history_path_;
   std::string index_path_;
   std::string index_history_path_;
+  std::string log_path_;
+  JournalPtr  journal_;
   Storage     storage_;
 };
 
@@ -37,6 +37,7 @@
 //       └──────┴──────┴──────┴──────┴──────┘
 
 #include "storage/cached_random_access_stack.hpp"
+#include "storage/journalled_file.hpp"
 #include "storage/key.hpp"
 #include "storage/random_access_stack.hpp"
 #include "storage/storage_exception.hpp"
@@ -320,6 +321,8 @@ public:
 
     hash_history_.Load("hash_history_" + history, create_if_not_exist);
     internal_bookmark_index_ = stack_.header_extra().bookmark;
+
+    AttachJournal();
   }
 
   void New(std::string const &filename, std::string const &history)
@@ -328,6 +331,8 @@ public:
     history_.New(history);
     hash_history_.New("hash_history_" + history);
     internal_bookmark_index_ = stack_.header_extra().bookmark;
+
+    AttachJournal();
   }
 
   void Clear()
@@ -337,6 +342,21 @@ public:
     hash_history_.Clear();
 
     internal_bookmark_index_ = stack_.header_extra().bookmark;
+
+    // the files have been truncated underneath any staged writes
+    AttachJournal();
+  }
+
+  /**
+   * Stage the writes to the stack and its histories in a journal, rather than writing them to the
+   * files directly. They are written to the files once the journal has been committed.
+   *
+   * @param: journal The journal, which must outlive the stack
+   */
+  void SetJournal(Journal *journal)
+  {
+    journal_ = journal;
+    AttachJournal();
   }
 
   type Get(std::size_t i) const
@@ -524,12 +544,23 @@ private:
   VariantStack                       history_;
   RandomAccessStack<HistoryBookmark> hash_history_;
   uint64_t                           internal_bookmark_index_{0};
+  Journal *                          journal_{nullptr};
 
   event_handler_type on_file_loaded_;
   event_handler_type on_before_flush_;
 
   stack_type stack_;
 
+  void AttachJournal()
+  {
+    if ((journal_ != nullptr) && stack_.is_open())
+    {
+      journal_->Attach(stack_.underlying_stream());
+      journal_->Attach(history_.underlying_stream());
+      journal_->Attach(hash_history_.underlying_stream());
+    }
+  }
+
   bool RevertBookmark(DefaultKey const &key_to_compare)
   {
     // Get bookmark from history
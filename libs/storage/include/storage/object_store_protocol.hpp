@@ -51,6 +51,7 @@ public:
   };
 
   using ElementList = std::vector<Element>;
+  using ResourceIDs = std::vector<ResourceID>;
 
   enum
   {
@@ -58,7 +59,8 @@ public:
     SET,
     SET_BULK,
     HAS,
-    GET_RECENT
+    GET_RECENT,
+    GET_BULK
   };
 
   ObjectStoreProtocol(TransientObjectStore<T> *obj_store)
@@ -70,6 +72,7 @@ public:
     this->Expose(SET_BULK, this, &self_type::SetBulk);
     this->Expose(HAS, obj_store, &TransientObjectStore<T>::Has);
     this->Expose(GET_RECENT, obj_store, &TransientObjectStore<T>::GetRecent);
+    this->Expose(GET_BULK, this, &self_type::GetBulk);
   }
 
 private:
@@ -106,6 +109,27 @@ private:
     return ret;
   }
 
+  ElementList GetBulk(ResourceIDs const &rids)
+  {
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Getting multiple objects across object store protocol");
+
+    ElementList elements{};
+    elements.reserve(rids.size());
+
+    // unlike the single lookup, missing elements are simply omitted from the response
+    for (ResourceID const &rid : rids)
+    {
+      Element element{rid, T{}};
+      if (obj_store_->Get(rid, element.value))
+      {
+        obj_store_->Confirm(rid);
+        elements.emplace_back(std::move(element));
+      }
+    }
+
+    return elements;
+  }
+
   TransientObjectStore<T> *obj_store_;
 };
 
@@ -31,6 +31,7 @@
 #include <string>
 
 #include "core/assert.hpp"
+#include "storage/journalled_file.hpp"
 #include "storage/storage_exception.hpp"
 
 namespace fetch {
@@ -69,7 +70,7 @@ private:
     uint64_t objects = 0;
     D        extra;
 
-    bool Write(std::fstream &stream) const
+    bool Write(JournalledFile &stream) const
     {
       if ((!stream) || (!stream.is_open()))
       {
@@ -82,7 +83,7 @@ private:
       return bool(stream);
     }
 
-    bool Read(std::fstream &stream)
+    bool Read(JournalledFile &stream)
     {
       if ((!stream) || (!stream.is_open()))
       {
@@ -170,14 +171,14 @@ public:
   {
 
     filename_    = filename;
-    file_handle_ = std::fstream(filename_, std::ios::in | std::ios::out | std::ios::binary);
+    file_handle_ = JournalledFile(filename_, std::ios::in | std::ios::out | std::ios::binary);
 
     if (!file_handle_)
     {
       if (create_if_not_exist)
       {
         Clear();
-        file_handle_ = std::fstream(filename_, std::ios::in | std::ios::out | std::ios::binary);
+        file_handle_ = JournalledFile(filename_, std::ios::in | std::ios::out | std::ios::binary);
       }
       else
       {
@@ -210,7 +211,7 @@ public:
   {
     filename_ = filename;
     Clear();
-    file_handle_ = std::fstream(filename_, std::ios::in | std::ios::out | std::ios::binary);
+    file_handle_ = JournalledFile(filename_, std::ios::in | std::ios::out | std::ios::binary);
 
     SignalFileLoaded();
   }
@@ -433,7 +434,7 @@ public:
   void Clear()
   {
     assert(filename_ != "");
-    std::fstream fin(filename_, std::ios::out | std::ios::binary);
+    JournalledFile fin(filename_, std::ios::out | std::ios::binary);
     header_ = Header();
 
     if (!header_.Write(fin))
@@ -483,17 +484,17 @@ public:
     return ret;
   }
 
-  std::fstream &underlying_stream()
+  JournalledFile &underlying_stream()
   {
     return file_handle_;
   }
 
 private:
-  event_handler_type   on_file_loaded_;
-  event_handler_type   on_before_flush_;
-  mutable std::fstream file_handle_;
-  std::string          filename_ = "";
-  Header               header_;
+  event_handler_type     on_file_loaded_;
+  event_handler_type     on_before_flush_;
+  mutable JournalledFile file_handle_;
+  std::string            filename_ = "";
+  Header                 header_;
 
   /**
    * Write the header to disk. Not usually necessary since we can just refer to our local one
@@ -35,6 +35,7 @@
 
 #include "core/assert.hpp"
 #include "core/macros.hpp"
+#include "storage/journalled_file.hpp"
 #include "storage/storage_exception.hpp"
 #include <cassert>
 #include <cstring>
@@ -109,13 +110,13 @@ public:
   {
 
     filename_    = filename;
-    file_handle_ = std::fstream(filename_, std::ios::in | std::ios::out | std::ios::binary);
+    file_handle_ = JournalledFile(filename_, std::ios::in | std::ios::out | std::ios::binary);
     if (!file_handle_)
     {
       if (create_if_not_exists)
       {
         Clear();
-        file_handle_ = std::fstream(filename_, std::ios::in | std::ios::out | std::ios::binary);
+        file_handle_ = JournalledFile(filename_, std::ios::in | std::ios::out | std::ios::binary);
       }
       else
       {
@@ -130,7 +131,7 @@ public:
   {
     filename_ = filename;
     Clear();
-    file_handle_ = std::fstream(filename_, std::ios::in | std::ios::out | std::ios::binary);
+    file_handle_ = JournalledFile(filename_, std::ios::in | std::ios::out | std::ios::binary);
     assert(bool(file_handle_));
   }
 
@@ -278,6 +279,11 @@ public:
     WriteHeader();
   }
 
+  JournalledFile &underlying_stream()
+  {
+    return file_handle_;
+  }
+
 protected:
   void ReadHeader()
   {
@@ -292,9 +298,9 @@ protected:
   }
 
 private:
-  std::fstream file_handle_;
-  std::string  filename_ = "";
-  Header       header_;
+  JournalledFile file_handle_;
+  std::string    filename_ = "";
+  Header         header_;
 };
 }  // namespace storage
 }  // namespace fetch
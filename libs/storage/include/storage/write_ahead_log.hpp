@@ -0,0 +1,141 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+//
+//                   WRITE AHEAD LOG
+//
+//  ┌──────┬─────┬───────┬───────┬──────┬─────┬───────┬──────┬─────┬───────┬───────┬───────┐
+//  │RECORD│FILE │ WRITE │ WRITE │RECORD│FILE │ WRITE │RECORD│FILE │ WRITE │ WRITE │ WRITE │
+//  │HEADER│     │       │       │HEADER│     │       │HEADER│     │       │       │       │......
+//  └──────┴─────┴───────┴───────┴──────┴─────┴───────┴──────┴─────┴───────┴───────┴───────┘
+//
+//  Each record holds the complete set of page writes for a single commit. Records are only ever
+//  appended, and are discarded once the files they refer to have been synced (a checkpoint).
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fetch {
+namespace storage {
+
+/**
+ * The WriteAheadLog is a sequential, append only log of the writes made to a set of files. A
+ * commit writes all of its changes to the log with a single write and sync. The changes are then
+ * applied to the files themselves, which are only synced to disk periodically by a background
+ * checkpoint, after which the log is truncated.
+ *
+ * Concurrent commits (for example from the different lanes of a node sharing a log) are grouped,
+ * so that one sync of the log makes all of them durable.
+ *
+ * When a log is opened any complete records it contains are replayed onto their files. Records
+ * which were only partially written are ignored, since they were never acknowledged.
+ */
+class WriteAheadLog
+{
+public:
+  static constexpr char const *LOGGING_NAME = "WriteAheadLog";
+
+  /// The size of the log which will trigger a checkpoint
+  static constexpr std::size_t CHECKPOINT_SIZE = 64u * 1024u * 1024u;
+
+  /// The maximum time between checkpoints of a non-empty log
+  static constexpr std::chrono::seconds CHECKPOINT_INTERVAL{30};
+
+  /**
+   * The set of writes made by a single commit
+   */
+  class Record
+  {
+  public:
+    using Paths = std::vector<std::string>;
+
+    Record();
+
+    uint32_t AddFile(std::string const &path);
+    void     AddWrite(uint32_t file, uint64_t offset, char const *data, std::size_t size);
+
+    bool         empty() const;
+    Paths const &paths() const;
+
+  private:
+    friend class WriteAheadLog;
+
+    Paths                paths_;
+    std::vector<uint8_t> buffer_;
+    std::size_t          writes_{0};
+  };
+
+  using WriteBack = std::function<void()>;
+  using LogPtr    = std::shared_ptr<WriteAheadLog>;
+
+  static LogPtr Open(std::string const &filename);
+
+  explicit WriteAheadLog(std::string filename);
+  WriteAheadLog(WriteAheadLog const &) = delete;
+  WriteAheadLog(WriteAheadLog &&)      = delete;
+  ~WriteAheadLog();
+
+  void Commit(Record &record, WriteBack const &write_back);
+  bool Checkpoint();
+
+  std::size_t size() const;
+
+  WriteAheadLog &operator=(WriteAheadLog const &) = delete;
+  WriteAheadLog &operator=(WriteAheadLog &&) = delete;
+
+private:
+  using Mutex       = std::mutex;
+  using Lock        = std::unique_lock<Mutex>;
+  using Condition   = std::condition_variable;
+  using RecordQueue = std::vector<Record *>;
+  using PathSet     = std::set<std::string>;
+
+  void Replay();
+  void Append(RecordQueue const &records);
+  void CheckpointLoop();
+
+  std::string const filename_;
+  int               fd_{-1};
+
+  mutable Mutex mutex_;
+  Condition     condition_;
+  RecordQueue   queue_;                 ///< Records waiting for the next sync
+  uint64_t      queued_{0};             ///< The sequence number of the last queued record
+  uint64_t      synced_{0};             ///< The sequence number of the last durable record
+  bool          syncing_{false};        ///< Whether a commit is currently syncing the log
+  bool          failed_{false};         ///< Whether a write to the log has failed
+  std::size_t   writing_back_{0};       ///< Commits which are durable but not yet applied
+  bool          checkpointing_{false};  ///< Whether a checkpoint is in progress
+  std::size_t   size_{0};               ///< The number of bytes in the log
+  PathSet       unsynced_files_;        ///< Files with writes since the last checkpoint
+  bool          running_{true};
+  std::thread   checkpoint_thread_;
+};
+
+}  // namespace storage
+}  // namespace fetch
@@ -0,0 +1,447 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "storage/journalled_file.hpp"
+#include "storage/storage_exception.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace fetch {
+namespace storage {
+
+constexpr std::ios_base::seekdir JournalledFile::beg;
+constexpr std::ios_base::seekdir JournalledFile::cur;
+constexpr std::ios_base::seekdir JournalledFile::end;
+constexpr std::size_t            JournalledFile::PAGE_SIZE;
+
+JournalledFile::JournalledFile(std::string filename, std::ios_base::openmode mode)
+  : stream_(filename, mode)
+  , filename_{std::move(filename)}
+{}
+
+JournalledFile::JournalledFile(JournalledFile &&other) noexcept
+{
+  *this = std::move(other);
+}
+
+JournalledFile::~JournalledFile()
+{
+  if (journal_ != nullptr)
+  {
+    journal_->Detach(*this);
+  }
+}
+
+JournalledFile &JournalledFile::seekg(int64_t position)
+{
+  if (journal_ == nullptr)
+  {
+    stream_.seekg(position);
+  }
+  else
+  {
+    position_ = position;
+  }
+
+  return *this;
+}
+
+JournalledFile &JournalledFile::seekg(int64_t offset, std::ios_base::seekdir direction)
+{
+  if (journal_ == nullptr)
+  {
+    stream_.seekg(offset, direction);
+  }
+  else if (direction == beg)
+  {
+    position_ = offset;
+  }
+  else if (direction == cur)
+  {
+    position_ += offset;
+  }
+  else
+  {
+    position_ = size_ + offset;
+  }
+
+  return *this;
+}
+
+int64_t JournalledFile::tellg()
+{
+  if (journal_ == nullptr)
+  {
+    return static_cast<int64_t>(stream_.tellg());
+  }
+
+  return failed_ ? -1 : position_;
+}
+
+JournalledFile &JournalledFile::read(char *data, std::streamsize size)
+{
+  if (journal_ == nullptr)
+  {
+    stream_.read(data, size);
+    return *this;
+  }
+
+  if (failed_ || (size < 0) || ((position_ + size) > size_))
+  {
+    failed_ = true;
+    return *this;
+  }
+
+  if (pages_.empty())
+  {
+    ReadFile(position_, data, static_cast<std::size_t>(size));
+  }
+  else
+  {
+    auto remaining = static_cast<std::size_t>(size);
+    auto position  = static_cast<uint64_t>(position_);
+
+    while (remaining > 0)
+    {
+      uint64_t const    index  = position / PAGE_SIZE;
+      std::size_t const offset = position % PAGE_SIZE;
+      std::size_t const chunk  = std::min(remaining, PAGE_SIZE - offset);
+
+      auto const it = pages_.find(index);
+      if (it != pages_.end())
+      {
+        std::memcpy(data, it->second.data.data() + offset, chunk);
+      }
+      else
+      {
+        ReadFile(static_cast<int64_t>(position), data, chunk);
+      }
+
+      data += chunk;
+      position += chunk;
+      remaining -= chunk;
+    }
+  }
+
+  position_ += size;
+
+  return *this;
+}
+
+JournalledFile &JournalledFile::write(char const *data, std::streamsize size)
+{
+  if (journal_ == nullptr)
+  {
+    stream_.write(data, size);
+    return *this;
+  }
+
+  auto remaining = static_cast<std::size_t>(size);
+  auto position  = static_cast<uint64_t>(position_);
+
+  while (remaining > 0)
+  {
+    std::size_t const offset = position % PAGE_SIZE;
+    std::size_t const chunk  = std::min(remaining, PAGE_SIZE - offset);
+
+    Page &page = StagePage(position / PAGE_SIZE);
+    std::memcpy(page.data.data() + offset, data, chunk);
+    page.begin = std::min(page.begin, static_cast<uint32_t>(offset));
+    page.end   = std::max(page.end, static_cast<uint32_t>(offset + chunk));
+
+    data += chunk;
+    position += chunk;
+    remaining -= chunk;
+  }
+
+  position_ += size;
+  size_ = std::max(size_, position_);
+
+  return *this;
+}
+
+JournalledFile &JournalledFile::flush()
+{
+  // while attached the staged writes are only written out by committing the journal
+  if (journal_ == nullptr)
+  {
+    stream_.flush();
+  }
+
+  return *this;
+}
+
+void JournalledFile::close()
+{
+  if (journal_ != nullptr)
+  {
+    journal_->Detach(*this);
+  }
+
+  stream_.close();
+}
+
+bool JournalledFile::is_open() const
+{
+  return stream_.is_open();
+}
+
+JournalledFile::operator bool() const
+{
+  return !failed_ && static_cast<bool>(stream_);
+}
+
+bool JournalledFile::operator!() const
+{
+  return !static_cast<bool>(*this);
+}
+
+/**
+ * Move the stream from another file. Any staged writes of either file are discarded and the
+ * result is not attached to a journal.
+ */
+JournalledFile &JournalledFile::operator=(JournalledFile &&other) noexcept
+{
+  if (this != &other)
+  {
+    if (journal_ != nullptr)
+    {
+      journal_->Detach(*this);
+    }
+
+    if (other.journal_ != nullptr)
+    {
+      other.journal_->Detach(other);
+    }
+
+    stream_   = std::move(other.stream_);
+    filename_ = std::move(other.filename_);
+  }
+
+  return *this;
+}
+
+/**
+ * Start staging writes for a journal, discarding anything previously staged
+ *
+ * @param journal The journal the file is now attached to
+ */
+void JournalledFile::Stage(Journal *journal)
+{
+  journal_  = journal;
+  failed_   = false;
+  position_ = 0;
+  pages_.clear();
+
+  stream_.flush();
+  stream_.clear();
+  stream_.seekg(0, std::ios_base::end);
+
+  file_size_ = std::max(int64_t{0}, static_cast<int64_t>(stream_.tellg()));
+  size_      = file_size_;
+}
+
+/**
+ * Return to writing directly to the stream, discarding any staged writes
+ */
+void JournalledFile::Unstage()
+{
+  journal_ = nullptr;
+  failed_  = false;
+  pages_.clear();
+
+  stream_.clear();
+}
+
+/**
+ * Add the staged writes to a log record
+ *
+ * @param record The record to be populated
+ */
+void JournalledFile::AddToRecord(WriteAheadLog::Record &record) const
+{
+  if (pages_.empty())
+  {
+    return;
+  }
+
+  uint32_t const file = record.AddFile(filename_);
+
+  for (auto const &element : pages_)
+  {
+    auto const &page = element.second;
+
+    record.AddWrite(file, (element.first * PAGE_SIZE) + page.begin, page.data.data() + page.begin,
+                    page.end - page.begin);
+  }
+}
+
+/**
+ * Write the staged pages to the stream once they have been committed to the log
+ */
+void JournalledFile::WriteBack()
+{
+  if (pages_.empty())
+  {
+    return;
+  }
+
+  for (auto const &element : pages_)
+  {
+    auto const &page = element.second;
+
+    stream_.seekp(static_cast<int64_t>((element.first * PAGE_SIZE) + page.begin));
+    stream_.write(page.data.data() + page.begin, page.end - page.begin);
+  }
+
+  stream_.flush();
+
+  if (!stream_)
+  {
+    throw StorageException("Unable to write committed pages to " + filename_);
+  }
+
+  file_size_ = size_;
+  pages_.clear();
+}
+
+/**
+ * Lookup the staged page with the given index, populating it from the file if required
+ *
+ * @param index The index of the page
+ * @return The staged page
+ */
+JournalledFile::Page &JournalledFile::StagePage(uint64_t index)
+{
+  auto it = pages_.find(index);
+
+  if (it == pages_.end())
+  {
+    it = pages_.emplace(index, Page{}).first;
+    ReadFile(static_cast<int64_t>(index * PAGE_SIZE), it->second.data.data(), PAGE_SIZE);
+  }
+
+  return it->second;
+}
+
+/**
+ * Read from the stream, treating anything after the end of the file as zeros
+ *
+ * @param position The position to read from
+ * @param data The buffer to be filled
+ * @param size The number of bytes to read
+ */
+void JournalledFile::ReadFile(int64_t position, char *data, std::size_t size)
+{
+  int64_t const remaining = std::min(file_size_ - position, static_cast<int64_t>(size));
+  auto const    available = static_cast<std::size_t>(std::max(int64_t{0}, remaining));
+
+  if (available > 0)
+  {
+    stream_.seekg(position);
+    stream_.read(data, static_cast<std::streamsize>(available));
+
+    if (!stream_)
+    {
+      stream_.clear();
+      failed_ = true;
+    }
+  }
+
+  std::memset(data + available, 0, size - available);
+}
+
+Journal::Journal(LogPtr log)
+  : log_{std::move(log)}
+{}
+
+Journal::~Journal()
+{
+  for (auto *file : files_)
+  {
+    file->Unstage();
+  }
+}
+
+/**
+ * Attach a file to the journal, discarding any writes which were previously staged. Files must be
+ * reattached if they are truncated.
+ *
+ * @param file The file to attach
+ */
+void Journal::Attach(JournalledFile &file)
+{
+  if ((file.journal_ != nullptr) && (file.journal_ != this))
+  {
+    file.journal_->Detach(file);
+  }
+
+  if (std::find(files_.begin(), files_.end(), &file) == files_.end())
+  {
+    files_.push_back(&file);
+  }
+
+  file.Stage(this);
+}
+
+/**
+ * Detach a file from the journal, discarding any staged writes
+ *
+ * @param file The file to detach
+ */
+void Journal::Detach(JournalledFile &file)
+{
+  files_.erase(std::remove(files_.begin(), files_.end(), &file), files_.end());
+  file.Unstage();
+}
+
+/**
+ * Commit the writes staged by all of the attached files as a single record in the log, and once
+ * it is durable write them to the files
+ */
+void Journal::Commit()
+{
+  WriteAheadLog::Record record;
+
+  for (auto const *file : files_)
+  {
+    file->AddToRecord(record);
+  }
+
+  if (record.empty())
+  {
+    return;
+  }
+
+  log_->Commit(record, [this]() {
+    for (auto *file : files_)
+    {
+      file->WriteBack();
+    }
+  });
+}
+
+WriteAheadLog &Journal::log()
+{
+  return *log_;
+}
+
+}  // namespace storage
+}  // namespace fetch
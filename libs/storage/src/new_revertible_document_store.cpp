@@ -62,6 +62,12 @@ bool NewRevertibleDocumentStore::Load(std::string const &state, std::string cons
   index_path_         = index;
   index_history_path_ = index_history;
 
+  // state hashes are only needed on commit, so avoid rehashing the index on every write
+  storage_.SetDeferredRehash(true);
+
+  // any changes committed by a previous run are replayed before the files are loaded
+  OpenJournal();
+
   // trigger the load
   storage_.Load(state, state_history, index, index_history, create);
   return true;
@@ -77,12 +83,26 @@ bool NewRevertibleDocumentStore::New(std::string const &state, std::string const
   index_path_         = index;
   index_history_path_ = index_history;
 
+  storage_.SetDeferredRehash(true);
+  OpenJournal();
+
   // trigger creation
-  storage_.New(state, state_history, index, index_history);
+  ResetFiles();
 
   return true;
 }
 
+/**
+ * Set the path of the write ahead log used to commit changes to the store. Stores sharing a log
+ * have their commits grouped together. Defaults to the state path with a .wal extension.
+ *
+ * @param filename The path of the log
+ */
+void NewRevertibleDocumentStore::SetWriteAheadLog(std::string const &filename)
+{
+  log_path_ = filename;
+}
+
 UnderlyingType NewRevertibleDocumentStore::Get(ResourceID const &rid)
 {
   return storage_.Get(rid);
@@ -121,13 +141,16 @@ bool NewRevertibleDocumentStore::RevertToHash(Hash const &state)
 
     // we are requesting to revert to a blank slate. The simplest way to handle this is to clear
     // out the database
-    storage_.New(state_path_, state_history_path_, index_path_, index_history_path_);
+    ResetFiles();
 
     success = true;
   }
-  else
+  else if (storage_.RevertToHash(state))
   {
-    success = storage_.RevertToHash(state);
+    // make the reverted state durable
+    storage_.Flush(false);
+
+    success = true;
   }
 
   return success;
@@ -165,6 +188,37 @@ NewRevertibleDocumentStore::Keys NewRevertibleDocumentStore::KeyDump()
 
 void NewRevertibleDocumentStore::Reset()
 {
+  ResetFiles();
+}
+
+void NewRevertibleDocumentStore::OpenJournal()
+{
+  if (journal_)
+  {
+    return;
+  }
+
+  if (log_path_.empty())
+  {
+    log_path_ = state_path_ + ".wal";
+  }
+
+  journal_ = std::make_unique<Journal>(WriteAheadLog::Open(log_path_));
+  storage_.SetJournal(journal_.get());
+}
+
+/**
+ * Recreate the store with empty files
+ */
+void NewRevertibleDocumentStore::ResetFiles()
+{
+  // committed changes must reach the files before they are truncated, otherwise they would be
+  // replayed over the new files after a restart. Before New() or Load() there is no log yet
+  if (journal_ && !journal_->log().Checkpoint())
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to checkpoint the write ahead log before reset");
+  }
+
   storage_.New(state_path_, state_history_path_, index_path_, index_history_path_);
 }
 
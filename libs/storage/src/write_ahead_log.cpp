@@ -0,0 +1,571 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/logger.hpp"
+#include "crypto/fnv_detail.hpp"
+#include "storage/storage_exception.hpp"
+#include "storage/write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+
+namespace fetch {
+namespace storage {
+namespace {
+
+constexpr uint64_t RECORD_MAGIC = 0x474f4c2d4c415746;  // "FWAL-LOG"
+
+enum EntryType : uint8_t
+{
+  ENTRY_FILE  = 1,
+  ENTRY_WRITE = 2
+};
+
+struct RecordHeader
+{
+  uint64_t magic;
+  uint64_t size;      ///< The size of the record, excluding this header
+  uint64_t checksum;  ///< The checksum of the record, excluding this header
+};
+
+static_assert(sizeof(RecordHeader) == 24, "Record header must be packed");
+
+uint64_t Checksum(uint8_t const *data, std::size_t size)
+{
+  crypto::detail::FNV1a hash;
+  hash.update(data, size);
+  return static_cast<uint64_t>(hash.context());
+}
+
+template <typename T>
+void Serialise(std::vector<uint8_t> &buffer, T const &value)
+{
+  auto const *bytes = reinterpret_cast<uint8_t const *>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+bool Deserialise(uint8_t const *&data, uint8_t const *end, T &value)
+{
+  if (static_cast<std::size_t>(end - data) < sizeof(T))
+  {
+    return false;
+  }
+
+  std::memcpy(&value, data, sizeof(T));
+  data += sizeof(T);
+  return true;
+}
+
+std::string ErrorMessage(char const *action, std::string const &filename)
+{
+  return std::string{action} + " " + filename + ": " + std::strerror(errno);
+}
+
+int SyncDescriptor(int fd)
+{
+#ifdef __linux__
+  return fdatasync(fd);
+#else
+  return fsync(fd);
+#endif
+}
+
+void WriteAll(int fd, uint8_t const *data, std::size_t size, std::string const &filename)
+{
+  while (size > 0)
+  {
+    ssize_t const written = write(fd, data, size);
+
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+
+      throw StorageException(ErrorMessage("Unable to append to", filename));
+    }
+
+    data += written;
+    size -= static_cast<std::size_t>(written);
+  }
+}
+
+bool SyncFile(std::string const &filename)
+{
+  int const fd = open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0)
+  {
+    // a file which no longer exists has nothing left to sync
+    return errno == ENOENT;
+  }
+
+  bool const success = SyncDescriptor(fd) == 0;
+  close(fd);
+
+  return success;
+}
+
+}  // namespace
+
+constexpr std::size_t          WriteAheadLog::CHECKPOINT_SIZE;
+constexpr std::chrono::seconds WriteAheadLog::CHECKPOINT_INTERVAL;
+
+WriteAheadLog::Record::Record()
+  : buffer_(sizeof(RecordHeader))
+{}
+
+/**
+ * Add a file to the record, this must be done before any writes to the file are added
+ *
+ * @param path The path of the file
+ * @return The index of the file within the record
+ */
+uint32_t WriteAheadLog::Record::AddFile(std::string const &path)
+{
+  auto const index = static_cast<uint32_t>(paths_.size());
+  paths_.push_back(path);
+
+  Serialise(buffer_, ENTRY_FILE);
+  Serialise(buffer_, static_cast<uint32_t>(path.size()));
+  buffer_.insert(buffer_.end(), path.begin(), path.end());
+
+  return index;
+}
+
+/**
+ * Add a write to the record
+ *
+ * @param file The index of the file, as returned by AddFile
+ * @param offset The offset in the file of the write
+ * @param data The data to be written
+ * @param size The number of bytes to be written
+ */
+void WriteAheadLog::Record::AddWrite(uint32_t file, uint64_t offset, char const *data,
+                                     std::size_t size)
+{
+  assert(file < paths_.size());
+
+  Serialise(buffer_, ENTRY_WRITE);
+  Serialise(buffer_, file);
+  Serialise(buffer_, offset);
+  Serialise(buffer_, static_cast<uint32_t>(size));
+  buffer_.insert(buffer_.end(), data, data + size);
+
+  ++writes_;
+}
+
+bool WriteAheadLog::Record::empty() const
+{
+  return writes_ == 0;
+}
+
+WriteAheadLog::Record::Paths const &WriteAheadLog::Record::paths() const
+{
+  return paths_;
+}
+
+/**
+ * Open a log, sharing the instance with any other users of the same file so that their commits
+ * can be grouped
+ *
+ * @param filename The path of the log
+ * @return The log
+ */
+WriteAheadLog::LogPtr WriteAheadLog::Open(std::string const &filename)
+{
+  static std::mutex                                                    registry_mutex;
+  static std::unordered_map<std::string, std::weak_ptr<WriteAheadLog>> registry;
+
+  std::lock_guard<std::mutex> lock(registry_mutex);
+
+  auto &entry = registry[filename];
+  auto  log   = entry.lock();
+
+  if (!log)
+  {
+    log   = std::make_shared<WriteAheadLog>(filename);
+    entry = log;
+  }
+
+  return log;
+}
+
+/**
+ * Open the log, replaying any records from a previous run onto their files
+ *
+ * @param filename The path of the log
+ */
+WriteAheadLog::WriteAheadLog(std::string filename)
+  : filename_{std::move(filename)}
+{
+  fd_ = open(filename_.c_str(), O_RDWR | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR | S_IRGRP);
+  if (fd_ < 0)
+  {
+    throw StorageException(ErrorMessage("Unable to open", filename_));
+  }
+
+  Replay();
+
+  checkpoint_thread_ = std::thread([this]() { CheckpointLoop(); });
+}
+
+WriteAheadLog::~WriteAheadLog()
+{
+  {
+    Lock lock(mutex_);
+    running_ = false;
+  }
+
+  condition_.notify_all();
+  checkpoint_thread_.join();
+
+  // leave the files in a consistent state so that no replay is required when they are next opened
+  Checkpoint();
+  close(fd_);
+}
+
+/**
+ * Make a record durable, and then apply it to the files. If other commits are in progress at the
+ * same time they will share a single sync of the log.
+ *
+ * @param record The record to be committed
+ * @param write_back The function which applies the record to the files once it is durable
+ */
+void WriteAheadLog::Commit(Record &record, WriteBack const &write_back)
+{
+  auto &header    = *reinterpret_cast<RecordHeader *>(record.buffer_.data());
+  header.magic    = RECORD_MAGIC;
+  header.size     = record.buffer_.size() - sizeof(RecordHeader);
+  header.checksum = Checksum(record.buffer_.data() + sizeof(RecordHeader), header.size);
+
+  Lock lock(mutex_);
+  condition_.wait(lock, [this]() { return !checkpointing_; });
+
+  queue_.push_back(&record);
+  uint64_t const sequence = ++queued_;
+
+  while ((synced_ < sequence) && !failed_)
+  {
+    if (syncing_)
+    {
+      condition_.wait(lock);
+      continue;
+    }
+
+    // become the leader for this group, writing and syncing every record which has been queued
+    RecordQueue records;
+    records.swap(queue_);
+    uint64_t const last = queued_;
+
+    syncing_ = true;
+    lock.unlock();
+
+    bool success{true};
+    try
+    {
+      Append(records);
+    }
+    catch (StorageException const &ex)
+    {
+      FETCH_LOG_ERROR(LOGGING_NAME, "Failed to commit records: ", ex.what());
+      success = false;
+    }
+
+    lock.lock();
+    syncing_ = false;
+
+    if (success)
+    {
+      for (auto const *committed : records)
+      {
+        size_ += committed->buffer_.size();
+        unsynced_files_.insert(committed->paths_.begin(), committed->paths_.end());
+      }
+
+      // the checkpoint must not truncate the log until every member of the group has applied
+      // its record
+      writing_back_ += records.size();
+      synced_ = last;
+    }
+    else
+    {
+      failed_ = true;
+    }
+
+    condition_.notify_all();
+  }
+
+  if (synced_ < sequence)
+  {
+    throw StorageException("Unable to commit to write ahead log: " + filename_);
+  }
+
+  lock.unlock();
+
+  try
+  {
+    write_back();
+  }
+  catch (...)
+  {
+    lock.lock();
+    --writing_back_;
+    condition_.notify_all();
+    throw;
+  }
+
+  lock.lock();
+  --writing_back_;
+  condition_.notify_all();
+}
+
+/**
+ * Sync all of the files written since the last checkpoint and truncate the log. Blocks any new
+ * commits until complete.
+ *
+ * @return true if the log is empty on completion, otherwise false
+ */
+bool WriteAheadLog::Checkpoint()
+{
+  Lock lock(mutex_);
+  condition_.wait(lock, [this]() { return !checkpointing_; });
+
+  if (size_ == 0)
+  {
+    return true;
+  }
+
+  checkpointing_ = true;
+  condition_.wait(lock, [this]() { return !syncing_ && queue_.empty() && (writing_back_ == 0); });
+
+  PathSet files;
+  files.swap(unsynced_files_);
+  lock.unlock();
+
+  bool success{true};
+  for (auto const &file : files)
+  {
+    if (!SyncFile(file))
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, ErrorMessage("Unable to sync", file));
+      success = false;
+    }
+  }
+
+  // the log is only truncated once it is no longer needed to recover the files
+  if (success && (ftruncate(fd_, 0) != 0))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, ErrorMessage("Unable to truncate", filename_));
+    success = false;
+  }
+
+  lock.lock();
+
+  if (success)
+  {
+    size_ = 0;
+  }
+  else
+  {
+    unsynced_files_.insert(files.begin(), files.end());
+  }
+
+  checkpointing_ = false;
+  condition_.notify_all();
+
+  return success;
+}
+
+/**
+ * @return The number of bytes written to the log since the last checkpoint
+ */
+std::size_t WriteAheadLog::size() const
+{
+  Lock lock(mutex_);
+  return size_;
+}
+
+/**
+ * Apply each complete record in the log to its files, then sync them and truncate the log
+ */
+void WriteAheadLog::Replay()
+{
+  std::ifstream              stream(filename_, std::ios::in | std::ios::binary);
+  std::vector<uint8_t> const contents{std::istreambuf_iterator<char>(stream),
+                                      std::istreambuf_iterator<char>()};
+
+  std::unordered_map<std::string, int> files;
+
+  uint8_t const *data    = contents.data();
+  uint8_t const *end     = data + contents.size();
+  std::size_t    records = 0;
+
+  RecordHeader header{};
+  while (Deserialise(data, end, header))
+  {
+    // a partially written record marks the point the previous run stopped
+    if ((header.magic != RECORD_MAGIC) || (header.size > static_cast<uint64_t>(end - data)) ||
+        (header.checksum != Checksum(data, header.size)))
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Discarding incomplete record at the end of ", filename_);
+      break;
+    }
+
+    uint8_t const *const record_end = data + header.size;
+
+    std::vector<int> descriptors;
+    uint8_t          type{0};
+    while (Deserialise(data, record_end, type))
+    {
+      if (type == ENTRY_FILE)
+      {
+        uint32_t length{0};
+        if (!Deserialise(data, record_end, length) ||
+            (length > static_cast<std::size_t>(record_end - data)))
+        {
+          throw StorageException("Malformed file entry in write ahead log: " + filename_);
+        }
+
+        std::string const path(reinterpret_cast<char const *>(data), length);
+        data += length;
+
+        auto it = files.find(path);
+        if (it == files.end())
+        {
+          int const fd = open(path.c_str(), O_WRONLY | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP);
+          if (fd < 0)
+          {
+            throw StorageException(ErrorMessage("Unable to replay log onto", path));
+          }
+
+          it = files.emplace(path, fd).first;
+        }
+
+        descriptors.push_back(it->second);
+      }
+      else if (type == ENTRY_WRITE)
+      {
+        uint32_t file{0};
+        uint64_t offset{0};
+        uint32_t size{0};
+        if (!Deserialise(data, record_end, file) || !Deserialise(data, record_end, offset) ||
+            !Deserialise(data, record_end, size) || (file >= descriptors.size()) ||
+            (size > static_cast<std::size_t>(record_end - data)))
+        {
+          throw StorageException("Malformed write entry in write ahead log: " + filename_);
+        }
+
+        if (pwrite(descriptors[file], data, size, static_cast<off_t>(offset)) !=
+            static_cast<ssize_t>(size))
+        {
+          throw StorageException(ErrorMessage("Unable to replay log onto file from", filename_));
+        }
+
+        data += size;
+      }
+      else
+      {
+        throw StorageException("Unknown entry in write ahead log: " + filename_);
+      }
+    }
+
+    ++records;
+  }
+
+  bool success{true};
+  for (auto const &file : files)
+  {
+    success &= (SyncDescriptor(file.second) == 0);
+    close(file.second);
+  }
+
+  if (!success)
+  {
+    throw StorageException("Unable to sync files replayed from " + filename_);
+  }
+
+  if (records > 0)
+  {
+    FETCH_LOG_INFO(LOGGING_NAME, "Replayed ", records, " records from ", filename_);
+  }
+
+  if (ftruncate(fd_, 0) != 0)
+  {
+    throw StorageException(ErrorMessage("Unable to truncate", filename_));
+  }
+}
+
+/**
+ * Write a group of records to the log with a single sync
+ *
+ * @param records The records to be written
+ */
+void WriteAheadLog::Append(RecordQueue const &records)
+{
+  for (auto const *record : records)
+  {
+    WriteAll(fd_, record->buffer_.data(), record->buffer_.size(), filename_);
+  }
+
+  if (SyncDescriptor(fd_) != 0)
+  {
+    throw StorageException(ErrorMessage("Unable to sync", filename_));
+  }
+}
+
+/**
+ * Periodically checkpoint the log, or sooner when it grows beyond CHECKPOINT_SIZE
+ */
+void WriteAheadLog::CheckpointLoop()
+{
+  Lock lock(mutex_);
+
+  while (running_)
+  {
+    condition_.wait_for(lock, CHECKPOINT_INTERVAL,
+                        [this]() { return !running_ || (size_ >= CHECKPOINT_SIZE); });
+
+    if (running_ && (size_ > 0) && !checkpointing_)
+    {
+      lock.unlock();
+      bool const success = Checkpoint();
+      lock.lock();
+
+      // back off rather than retrying a failing checkpoint immediately
+      if (!success)
+      {
+        condition_.wait_for(lock, CHECKPOINT_INTERVAL, [this]() { return !running_; });
+      }
+    }
+  }
+}
+
+}  // namespace storage
+}  // namespace fetch
@@ -298,6 +298,67 @@ TEST_F(KeyValueIndexTests, intermediate_flush_hash_consistency)
   ASSERT_TRUE(hash1 == hash3);
 }
 
+TEST_F(KeyValueIndexTests, deferred_rehash_hash_consistency)
+{
+  std::vector<TestData> values;
+  for (std::size_t i = 0; i < 1000; ++i)
+  {
+    byte_array::ByteArray key;
+    key.Resize(256 / 8);
+    for (std::size_t j = 0; j < key.size(); ++j)
+    {
+      key[j] = uint8_t(rng() >> 9u);
+    }
+
+    if (reference.find(key) != reference.end())
+    {
+      continue;
+    }
+
+    reference[key] = rng();
+    values.push_back({key, reference[key]});
+  }
+
+  // REF: rehash on every write
+  kv_index.New("test1.db");
+  for (auto const &val : values)
+  {
+    kv_index.Set(val.key, val.value, val.key);
+  }
+  auto hash1 = kv_index.Hash();
+
+  // deferred, with some keys overwritten and intermediate hash requests
+  KVIndex deferred_index;
+  deferred_index.SetDeferredRehash(true);
+  deferred_index.New("test2.db");
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    auto const &val = values[i];
+    deferred_index.Set(val.key, val.value + 1, val.key);
+
+    if ((i % 97) == 0)
+    {
+      deferred_index.Hash();
+    }
+  }
+
+  for (auto const &val : values)
+  {
+    deferred_index.Set(val.key, val.value, val.key);
+  }
+  auto hash2 = deferred_index.Hash();
+
+  EXPECT_EQ(hash1, hash2);
+
+  // iteration relies on the node hashes, so all of the keys must be visited
+  std::size_t count = 0;
+  for (auto it = deferred_index.begin(); it != deferred_index.end(); ++it)
+  {
+    ++count;
+  }
+  EXPECT_EQ(values.size(), count);
+}
+
 TEST_F(KeyValueIndexTests, double_insertion_hash_consistency)
 {
   std::vector<TestData> values;
@@ -0,0 +1,169 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "storage/journalled_file.hpp"
+#include "storage/write_ahead_log.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace fetch::storage;
+
+std::string ReadFile(std::string const &filename)
+{
+  std::ifstream stream(filename, std::ios::in | std::ios::binary);
+  return {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+}
+
+void WriteFile(std::string const &filename, std::string const &contents)
+{
+  std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  stream.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+// Write to the file while staged, spanning a page boundary and extending the file
+void StageWrite(JournalledFile &file, std::string &expected)
+{
+  std::string const update(JournalledFile::PAGE_SIZE, 'b');
+  std::size_t const offset = JournalledFile::PAGE_SIZE / 2;
+
+  file.seekg(static_cast<int64_t>(offset), JournalledFile::beg);
+  file.write(update.data(), static_cast<std::streamsize>(update.size()));
+
+  expected.resize(offset + update.size());
+  expected.replace(offset, update.size(), update);
+}
+
+TEST(write_ahead_log_gtest, staged_writes_are_only_written_on_commit)
+{
+  std::string const filename = "wal_test_staged.db";
+  std::string       expected(1000, 'a');
+  WriteFile(filename, expected);
+
+  Journal        journal{WriteAheadLog::Open("wal_test_staged.wal")};
+  JournalledFile file{filename, std::ios::in | std::ios::out | std::ios::binary};
+  journal.Attach(file);
+
+  StageWrite(file, expected);
+
+  // the staged writes are visible through the file, but have not reached the disk
+  std::string contents(expected.size(), '\0');
+  file.seekg(0, JournalledFile::beg);
+  file.read(&contents[0], static_cast<std::streamsize>(contents.size()));
+
+  EXPECT_TRUE(static_cast<bool>(file));
+  EXPECT_EQ(contents, expected);
+  EXPECT_EQ(ReadFile(filename), std::string(1000, 'a'));
+
+  // reading past the end fails, as it would with a stream
+  file.seekg(0, JournalledFile::end);
+  EXPECT_EQ(file.tellg(), static_cast<int64_t>(expected.size()));
+  file.read(&contents[0], 1);
+  EXPECT_FALSE(static_cast<bool>(file));
+
+  journal.Commit();
+  EXPECT_EQ(ReadFile(filename), expected);
+  EXPECT_GT(journal.log().size(), 0u);
+
+  EXPECT_TRUE(journal.log().Checkpoint());
+  EXPECT_EQ(journal.log().size(), 0u);
+  EXPECT_EQ(ReadFile("wal_test_staged.wal"), "");
+}
+
+TEST(write_ahead_log_gtest, committed_records_are_replayed_when_opened)
+{
+  std::string const filename     = "wal_test_replay.db";
+  std::string const log_filename = "wal_test_replay.wal";
+  std::string       expected(1000, 'a');
+  WriteFile(filename, expected);
+
+  std::string log_contents;
+  {
+    Journal        journal{WriteAheadLog::Open(log_filename)};
+    JournalledFile file{filename, std::ios::in | std::ios::out | std::ios::binary};
+    journal.Attach(file);
+
+    StageWrite(file, expected);
+    journal.Commit();
+
+    // capture the log as it would have been left by a crash before the next checkpoint
+    log_contents = ReadFile(log_filename);
+  }
+
+  ASSERT_FALSE(log_contents.empty());
+
+  // restore the files to their state before the commit, then append a partially written record
+  WriteFile(filename, std::string(1000, 'a'));
+  WriteFile(log_filename, log_contents + log_contents.substr(0, log_contents.size() / 2));
+
+  auto const log = WriteAheadLog::Open(log_filename);
+
+  EXPECT_EQ(ReadFile(filename), expected);
+  EXPECT_EQ(log->size(), 0u);
+  EXPECT_EQ(ReadFile(log_filename), "");
+}
+
+TEST(write_ahead_log_gtest, concurrent_commits_share_the_log)
+{
+  static constexpr std::size_t NUM_FILES   = 4;
+  static constexpr std::size_t NUM_COMMITS = 20;
+
+  auto const log = WriteAheadLog::Open("wal_test_concurrent.wal");
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < NUM_FILES; ++i)
+  {
+    threads.emplace_back([i, &log]() {
+      std::string const filename = "wal_test_concurrent_" + std::to_string(i) + ".db";
+      WriteFile(filename, "");
+
+      Journal        journal{log};
+      JournalledFile file{filename, std::ios::in | std::ios::out | std::ios::binary};
+      journal.Attach(file);
+
+      for (std::size_t commit = 0; commit < NUM_COMMITS; ++commit)
+      {
+        auto const value = static_cast<char>('a' + i);
+        file.seekg(static_cast<int64_t>(commit), JournalledFile::beg);
+        file.write(&value, 1);
+        journal.Commit();
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  for (std::size_t i = 0; i < NUM_FILES; ++i)
+  {
+    EXPECT_EQ(ReadFile("wal_test_concurrent_" + std::to_string(i) + ".db"),
+              std::string(NUM_COMMITS, static_cast<char>('a' + i)));
+  }
+}
+
+}  // namespace
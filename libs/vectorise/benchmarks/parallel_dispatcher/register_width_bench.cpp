@@ -0,0 +1,83 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/memory/shared_array.hpp"
+#include "vectorise/vectorise.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+
+using namespace fetch::memory;
+using namespace fetch::vectorize;
+
+namespace {
+
+/**
+ * Run the kernel of the parallel dispatcher benchmarks, exp(1 + log(x)), over the array with an
+ * explicitly chosen register width so that SSE, AVX and AVX-512 can be compared in one binary
+ */
+template <typename T, std::size_t S>
+void BM_ApproxExpLog(benchmark::State &state)
+{
+  using ArrayType          = SharedArray<T>;
+  using VectorRegisterType = VectorRegister<T, S>;
+  using IteratorType       = VectorRegisterIterator<T, S>;
+
+  std::size_t const size = static_cast<std::size_t>(state.range(0));
+
+  ArrayType a(size);
+  ArrayType b(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    b[i] = T(i + 1);
+  }
+
+  VectorRegisterType const one(T(1));
+
+  for (auto _ : state)
+  {
+    IteratorType       iter(b.pointer(), size);
+    VectorRegisterType x;
+
+    for (std::size_t i = 0; i < size; i += VectorRegisterType::E_BLOCK_COUNT)
+    {
+      iter.Next(x);
+      approx_exp(one + approx_log(x)).Store(a.pointer() + i);
+    }
+
+    benchmark::DoNotOptimize(a.pointer());
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_ApproxExpLog, float, 128)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ApproxExpLog, double, 128)->Range(1 << 10, 1 << 20);
+
+#ifdef __AVX__
+BENCHMARK_TEMPLATE(BM_ApproxExpLog, float, 256)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ApproxExpLog, double, 256)->Range(1 << 10, 1 << 20);
+#endif
+
+#ifdef __AVX512F__
+BENCHMARK_TEMPLATE(BM_ApproxExpLog, float, 512)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_ApproxExpLog, double, 512)->Range(1 << 10, 1 << 20);
+#endif
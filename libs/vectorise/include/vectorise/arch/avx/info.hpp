@@ -18,6 +18,8 @@
 //------------------------------------------------------------------------------
 
 #ifdef __AVX__
+#include "vectorise/info.hpp"
+
 #include <cstddef>
 #include <cstdint>
 #include <emmintrin.h>
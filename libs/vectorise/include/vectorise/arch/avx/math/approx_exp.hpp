@@ -0,0 +1,75 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#ifdef __AVX__
+#include "vectorise/arch/avx.hpp"
+
+#include <immintrin.h>
+#include <cmath>
+
+namespace fetch {
+namespace vectorize {
+
+inline VectorRegister<float, 256> approx_exp(VectorRegister<float, 256> const &x)
+{
+  enum
+  {
+    mantissa = 23,
+    exponent = 8,
+  };
+
+  constexpr float                  multiplier      = float(1ull << mantissa);
+  constexpr float                  exponent_offset = (float(((1ull << (exponent - 1)) - 1)));
+  const VectorRegister<float, 256> a(float(multiplier / M_LN2));
+  const VectorRegister<float, 256> b(float(exponent_offset * multiplier - 60801));
+
+  VectorRegister<float, 256> y    = a * x + b;
+  __m256i                    conv = _mm256_cvtps_epi32(y.data());
+
+  return VectorRegister<float, 256>(_mm256_castsi256_ps(conv));
+}
+
+inline VectorRegister<double, 256> approx_exp(VectorRegister<double, 256> const &x)
+{
+  enum
+  {
+    mantissa = 20,
+    exponent = 11,
+  };
+
+  constexpr double                  multiplier      = double(1ull << mantissa);
+  constexpr double                  exponent_offset = (double(((1ull << (exponent - 1)) - 1)));
+  const VectorRegister<double, 256> a(double(multiplier / M_LN2));
+  const VectorRegister<double, 256> b(double(exponent_offset * multiplier - 60801));
+
+  VectorRegister<double, 256> y    = a * x + b;
+  __m128i                     conv = _mm256_cvtpd_epi32(y.data());
+
+  // place each of the (32 bit) results in the upper half of its 64 bit element
+  __m128i const lo = _mm_unpacklo_epi32(_mm_setzero_si128(), conv);
+  __m128i const hi = _mm_unpackhi_epi32(_mm_setzero_si128(), conv);
+
+  __m256i ret = _mm256_insertf128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+  return VectorRegister<double, 256>(_mm256_castsi256_pd(ret));
+}
+
+}  // namespace vectorize
+}  // namespace fetch
+#endif
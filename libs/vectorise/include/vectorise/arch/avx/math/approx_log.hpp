@@ -0,0 +1,74 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#ifdef __AVX__
+#include "vectorise/arch/avx.hpp"
+
+#include <immintrin.h>
+#include <cmath>
+
+namespace fetch {
+namespace vectorize {
+
+inline VectorRegister<float, 256> approx_log(VectorRegister<float, 256> const &x)
+{
+  enum
+  {
+    mantissa = 23,
+    exponent = 8,
+  };
+
+  constexpr float                  multiplier      = float(1ull << mantissa);
+  constexpr float                  exponent_offset = (float(((1ull << (exponent - 1)) - 1)));
+  const VectorRegister<float, 256> a(float(M_LN2 / multiplier));
+  const VectorRegister<float, 256> b(float(exponent_offset * multiplier - 60801));
+
+  __m256i conv = _mm256_castps_si256(x.data());
+
+  VectorRegister<float, 256> y(_mm256_cvtepi32_ps(conv));
+
+  return a * (y - b);
+}
+
+inline VectorRegister<double, 256> approx_log(VectorRegister<double, 256> const &x)
+{
+  enum
+  {
+    mantissa = 20,
+    exponent = 11,
+  };
+
+  constexpr double                  multiplier      = double(1ull << mantissa);
+  constexpr double                  exponent_offset = (double(((1ull << (exponent - 1)) - 1)));
+  const VectorRegister<double, 256> a(double(M_LN2 / multiplier));
+  const VectorRegister<double, 256> b(double(exponent_offset * multiplier - 60801));
+
+  // gather the upper (32 bit) half of each 64 bit element
+  __m128 const lo   = _mm256_castps256_ps128(_mm256_castpd_ps(x.data()));
+  __m128 const hi   = _mm256_extractf128_ps(_mm256_castpd_ps(x.data()), 1);
+  __m128i      conv = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+
+  VectorRegister<double, 256> y(_mm256_cvtepi32_pd(conv));
+
+  return a * (y - b);
+}
+
+}  // namespace vectorize
+}  // namespace fetch
+#endif
@@ -0,0 +1,195 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#ifdef __AVX__
+#include "vectorise/arch/avx/info.hpp"
+#include "vectorise/info.hpp"
+#include "vectorise/register.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace fetch {
+namespace vectorize {
+
+template <>
+class VectorRegister<float, 256>
+{
+public:
+  using type             = float;
+  using mm_register_type = __m256;
+
+  enum
+  {
+    E_VECTOR_SIZE   = 256,
+    E_REGISTER_SIZE = sizeof(mm_register_type),
+    E_BLOCK_COUNT   = E_REGISTER_SIZE / sizeof(type)
+  };
+
+  static_assert((E_BLOCK_COUNT * sizeof(type)) == E_REGISTER_SIZE,
+                "type cannot be contained in the given register size.");
+
+  VectorRegister() = default;
+  VectorRegister(type const *d)
+  {
+    data_ = _mm256_load_ps(d);
+  }
+  VectorRegister(mm_register_type const &d)
+    : data_(d)
+  {}
+  VectorRegister(mm_register_type &&d)
+    : data_(d)
+  {}
+  VectorRegister(type const &c)
+  {
+    data_ = _mm256_set1_ps(c);
+  }
+
+  explicit operator mm_register_type()
+  {
+    return data_;
+  }
+
+  void Store(type *ptr) const
+  {
+    _mm256_store_ps(ptr, data_);
+  }
+  void Stream(type *ptr) const
+  {
+    _mm256_stream_ps(ptr, data_);
+  }
+
+  mm_register_type const &data() const
+  {
+    return data_;
+  }
+  mm_register_type &data()
+  {
+    return data_;
+  }
+
+private:
+  mm_register_type data_;
+};
+
+inline VectorRegister<float, 256> operator-(VectorRegister<float, 256> const &x)
+{
+  return VectorRegister<float, 256>(_mm256_sub_ps(_mm256_setzero_ps(), x.data()));
+}
+
+#define FETCH_ADD_OPERATOR(op, type, L, fnc)                                       \
+  inline VectorRegister<type, 256> operator op(VectorRegister<type, 256> const &a, \
+                                               VectorRegister<type, 256> const &b) \
+  {                                                                                \
+    L ret = fnc(a.data(), b.data());                                               \
+    return VectorRegister<type, 256>(ret);                                         \
+  }
+
+FETCH_ADD_OPERATOR(*, float, __m256, _mm256_mul_ps)
+FETCH_ADD_OPERATOR(-, float, __m256, _mm256_sub_ps)
+FETCH_ADD_OPERATOR(/, float, __m256, _mm256_div_ps)
+FETCH_ADD_OPERATOR(+, float, __m256, _mm256_add_ps)
+
+#undef FETCH_ADD_OPERATOR
+
+#define FETCH_ADD_OPERATOR(op, type, L, cmp)                                       \
+  inline VectorRegister<type, 256> operator op(VectorRegister<type, 256> const &a, \
+                                               VectorRegister<type, 256> const &b) \
+  {                                                                                \
+    L imm = _mm256_cmp_ps(a.data(), b.data(), cmp);                                \
+    L ret = _mm256_and_ps(imm, _mm256_set1_ps(type(1)));                           \
+    return VectorRegister<type, 256>(ret);                                         \
+  }
+
+FETCH_ADD_OPERATOR(==, float, __m256, _CMP_EQ_OQ)
+FETCH_ADD_OPERATOR(!=, float, __m256, _CMP_NEQ_UQ)
+FETCH_ADD_OPERATOR(>=, float, __m256, _CMP_GE_OQ)
+FETCH_ADD_OPERATOR(>, float, __m256, _CMP_GT_OQ)
+FETCH_ADD_OPERATOR(<=, float, __m256, _CMP_LE_OQ)
+FETCH_ADD_OPERATOR(<, float, __m256, _CMP_LT_OQ)
+
+#undef FETCH_ADD_OPERATOR
+
+// FREE FUNCTIONS
+
+inline VectorRegister<float, 256> vector_zero_below_element(VectorRegister<float, 256> const &a,
+                                                            int const &                       n)
+{
+  alignas(32) const uint32_t mask[8] = {uint32_t(-(0 >= n)), uint32_t(-(1 >= n)),
+                                        uint32_t(-(2 >= n)), uint32_t(-(3 >= n)),
+                                        uint32_t(-(4 >= n)), uint32_t(-(5 >= n)),
+                                        uint32_t(-(6 >= n)), uint32_t(-(7 >= n))};
+
+  __m256 conv = _mm256_load_ps(reinterpret_cast<float const *>(mask));
+  return VectorRegister<float, 256>(_mm256_and_ps(a.data(), conv));
+}
+
+inline VectorRegister<float, 256> vector_zero_above_element(VectorRegister<float, 256> const &a,
+                                                            int const &                       n)
+{
+  alignas(32) const uint32_t mask[8] = {uint32_t(-(0 <= n)), uint32_t(-(1 <= n)),
+                                        uint32_t(-(2 <= n)), uint32_t(-(3 <= n)),
+                                        uint32_t(-(4 <= n)), uint32_t(-(5 <= n)),
+                                        uint32_t(-(6 <= n)), uint32_t(-(7 <= n))};
+
+  __m256 conv = _mm256_load_ps(reinterpret_cast<float const *>(mask));
+  return VectorRegister<float, 256>(_mm256_and_ps(a.data(), conv));
+}
+
+inline VectorRegister<float, 256> shift_elements_left(VectorRegister<float, 256> const &x)
+{
+  __m256 t0 = _mm256_permute_ps(x.data(), 0x93);     // [x3 x0 x1 x2 | x7 x4 x5 x6]
+  __m256 t1 = _mm256_permute2f128_ps(t0, t0, 0x08);  // [ 0  0  0  0 | x3 x0 x1 x2]
+  return VectorRegister<float, 256>(_mm256_blend_ps(t0, t1, 0x11));  // [0 x0 .. x6]
+}
+
+inline VectorRegister<float, 256> shift_elements_right(VectorRegister<float, 256> const &x)
+{
+  __m256 t0 = _mm256_permute_ps(x.data(), 0x39);     // [x1 x2 x3 x0 | x5 x6 x7 x4]
+  __m256 t1 = _mm256_permute2f128_ps(t0, t0, 0x81);  // [x5 x6 x7 x4 |  0  0  0  0]
+  return VectorRegister<float, 256>(_mm256_blend_ps(t0, t1, 0x88));  // [x1 .. x7 0]
+}
+
+inline float first_element(VectorRegister<float, 256> const &x)
+{
+  return _mm256_cvtss_f32(x.data());
+}
+
+inline float reduce(VectorRegister<float, 256> const &x)
+{
+  __m128 r = _mm_add_ps(_mm256_castps256_ps128(x.data()), _mm256_extractf128_ps(x.data(), 1));
+  r        = _mm_hadd_ps(r, _mm_setzero_ps());
+  r        = _mm_hadd_ps(r, _mm_setzero_ps());
+  return _mm_cvtss_f32(r);
+}
+
+inline bool all_less_than(VectorRegister<float, 256> const &x, VectorRegister<float, 256> const &y)
+{
+  return _mm256_movemask_ps(_mm256_cmp_ps(x.data(), y.data(), _CMP_LT_OQ)) == 0xFF;
+}
+
+inline bool any_less_than(VectorRegister<float, 256> const &x, VectorRegister<float, 256> const &y)
+{
+  return _mm256_movemask_ps(_mm256_cmp_ps(x.data(), y.data(), _CMP_LT_OQ)) != 0;
+}
+
+}  // namespace vectorize
+}  // namespace fetch
+#endif
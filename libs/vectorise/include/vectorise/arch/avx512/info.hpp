@@ -17,63 +17,79 @@
 //
 //------------------------------------------------------------------------------
 
-#ifdef __AVX__
+#ifdef __AVX512F__
+#include "vectorise/info.hpp"
+
 #include <cstddef>
 #include <cstdint>
 #include <emmintrin.h>
 #include <immintrin.h>
 #include <smmintrin.h>
 
+// GCC 12 builds most unmasked AVX-512 intrinsics on top of the self initialised
+// _mm512_undefined_* values, which -Wuninitialized reports once they are inlined into the
+// kernels below. The register and math headers fence their definitions with these.
+#if defined(__GNUC__) && !defined(__clang__)
+#define FETCH_AVX512_DIAGNOSTICS_PUSH                       \
+  _Pragma("GCC diagnostic push")                            \
+  _Pragma("GCC diagnostic ignored \"-Wuninitialized\"")     \
+  _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+#define FETCH_AVX512_DIAGNOSTICS_POP _Pragma("GCC diagnostic pop")
+#else
+#define FETCH_AVX512_DIAGNOSTICS_PUSH
+#define FETCH_AVX512_DIAGNOSTICS_POP
+#endif
+
 namespace fetch {
 namespace vectorize {
 
 template <>
-struct VectorInfo<uint8_t, 256>
+struct VectorInfo<uint8_t, 512>
 {
   using naitve_type   = uint8_t;
-  using register_type = __m256i;
+  using register_type = __m512i;
 };
 
 template <>
-struct VectorInfo<uint16_t, 256>
+struct VectorInfo<uint16_t, 512>
 {
   using naitve_type   = uint16_t;
-  using register_type = __m256i;
+  using register_type = __m512i;
 };
 
 template <>
-struct VectorInfo<uint32_t, 256>
+struct VectorInfo<uint32_t, 512>
 {
   using naitve_type   = uint32_t;
-  using register_type = __m256i;
+  using register_type = __m512i;
 };
 
 template <>
-struct VectorInfo<uint64_t, 256>
+struct VectorInfo<uint64_t, 512>
 {
   using naitve_type   = uint64_t;
-  using register_type = __m256i;
+  using register_type = __m512i;
 };
 
 template <>
-struct VectorInfo<int, 256>
+struct VectorInfo<int, 512>
 {
   using naitve_type   = int;
-  using register_type = __m256i;
+  using register_type = __m512i;
 };
 
 template <>
-struct VectorInfo<float, 256>
+struct VectorInfo<float, 512>
 {
   using naitve_type   = float;
-  using register_type = __m256;
+  using register_type = __m512;
 };
 
 template <>
-struct VectorInfo<double, 256>
+struct VectorInfo<double, 512>
 {
   using naitve_type   = double;
-  using register_type = __m256d;
+  using register_type = __m512d;
 };
 }  // namespace vectorize
 }  // namespace fetch
@@ -0,0 +1,192 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#ifdef __AVX512F__
+#include "vectorise/arch/avx512/info.hpp"
+#include "vectorise/info.hpp"
+#include "vectorise/register.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+FETCH_AVX512_DIAGNOSTICS_PUSH
+
+namespace fetch {
+namespace vectorize {
+
+template <>
+class VectorRegister<float, 512>
+{
+public:
+  using type             = float;
+  using mm_register_type = __m512;
+
+  enum
+  {
+    E_VECTOR_SIZE   = 512,
+    E_REGISTER_SIZE = sizeof(mm_register_type),
+    E_BLOCK_COUNT   = E_REGISTER_SIZE / sizeof(type)
+  };
+
+  static_assert((E_BLOCK_COUNT * sizeof(type)) == E_REGISTER_SIZE,
+                "type cannot be contained in the given register size.");
+
+  VectorRegister() = default;
+  VectorRegister(type const *d)
+  {
+    data_ = _mm512_load_ps(d);
+  }
+  VectorRegister(mm_register_type const &d)
+    : data_(d)
+  {}
+  VectorRegister(mm_register_type &&d)
+    : data_(d)
+  {}
+  VectorRegister(type const &c)
+  {
+    data_ = _mm512_set1_ps(c);
+  }
+
+  explicit operator mm_register_type()
+  {
+    return data_;
+  }
+
+  void Store(type *ptr) const
+  {
+    _mm512_store_ps(ptr, data_);
+  }
+  void Stream(type *ptr) const
+  {
+    _mm512_stream_ps(ptr, data_);
+  }
+
+  mm_register_type const &data() const
+  {
+    return data_;
+  }
+  mm_register_type &data()
+  {
+    return data_;
+  }
+
+private:
+  mm_register_type data_;
+};
+
+inline VectorRegister<float, 512> operator-(VectorRegister<float, 512> const &x)
+{
+  return VectorRegister<float, 512>(_mm512_sub_ps(_mm512_setzero_ps(), x.data()));
+}
+
+#define FETCH_ADD_OPERATOR(op, type, L, fnc)                                       \
+  inline VectorRegister<type, 512> operator op(VectorRegister<type, 512> const &a, \
+                                               VectorRegister<type, 512> const &b) \
+  {                                                                                \
+    L ret = fnc(a.data(), b.data());                                               \
+    return VectorRegister<type, 512>(ret);                                         \
+  }
+
+FETCH_ADD_OPERATOR(*, float, __m512, _mm512_mul_ps)
+FETCH_ADD_OPERATOR(-, float, __m512, _mm512_sub_ps)
+FETCH_ADD_OPERATOR(/, float, __m512, _mm512_div_ps)
+FETCH_ADD_OPERATOR(+, float, __m512, _mm512_add_ps)
+
+#undef FETCH_ADD_OPERATOR
+
+#define FETCH_ADD_OPERATOR(op, type, L, cmp)                                       \
+  inline VectorRegister<type, 512> operator op(VectorRegister<type, 512> const &a, \
+                                               VectorRegister<type, 512> const &b) \
+  {                                                                                \
+    __mmask16 mask = _mm512_cmp_ps_mask(a.data(), b.data(), cmp);                  \
+    L         ret  = _mm512_maskz_mov_ps(mask, _mm512_set1_ps(type(1)));           \
+    return VectorRegister<type, 512>(ret);                                         \
+  }
+
+FETCH_ADD_OPERATOR(==, float, __m512, _CMP_EQ_OQ)
+FETCH_ADD_OPERATOR(!=, float, __m512, _CMP_NEQ_UQ)
+FETCH_ADD_OPERATOR(>=, float, __m512, _CMP_GE_OQ)
+FETCH_ADD_OPERATOR(>, float, __m512, _CMP_GT_OQ)
+FETCH_ADD_OPERATOR(<=, float, __m512, _CMP_LE_OQ)
+FETCH_ADD_OPERATOR(<, float, __m512, _CMP_LT_OQ)
+
+#undef FETCH_ADD_OPERATOR
+
+// FREE FUNCTIONS
+
+inline VectorRegister<float, 512> vector_zero_below_element(VectorRegister<float, 512> const &a,
+                                                            int const &                       n)
+{
+  // keep the elements i >= n
+  uint32_t const keep = (n <= 0) ? 0xFFFFu : ((n >= 16) ? 0u : ((0xFFFFu << n) & 0xFFFFu));
+
+  return VectorRegister<float, 512>(_mm512_maskz_mov_ps(__mmask16(keep), a.data()));
+}
+
+inline VectorRegister<float, 512> vector_zero_above_element(VectorRegister<float, 512> const &a,
+                                                            int const &                       n)
+{
+  // keep the elements i <= n
+  uint32_t const keep = (n < 0) ? 0u : ((n >= 15) ? 0xFFFFu : ((1u << (n + 1)) - 1u));
+
+  return VectorRegister<float, 512>(_mm512_maskz_mov_ps(__mmask16(keep), a.data()));
+}
+
+inline VectorRegister<float, 512> shift_elements_left(VectorRegister<float, 512> const &x)
+{
+  __m512i const index = _mm512_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14);
+  __m512 const  ret   = _mm512_maskz_permutexvar_ps(__mmask16(0xFFFFu - 1u), index, x.data());
+  return VectorRegister<float, 512>(ret);
+}
+
+inline VectorRegister<float, 512> shift_elements_right(VectorRegister<float, 512> const &x)
+{
+  __m512i const index = _mm512_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15);
+  __m512 const  ret   = _mm512_maskz_permutexvar_ps(__mmask16(0xFFFFu >> 1), index, x.data());
+  return VectorRegister<float, 512>(ret);
+}
+
+inline float first_element(VectorRegister<float, 512> const &x)
+{
+  return _mm_cvtss_f32(_mm512_castps512_ps128(x.data()));
+}
+
+inline float reduce(VectorRegister<float, 512> const &x)
+{
+  return _mm512_reduce_add_ps(x.data());
+}
+
+inline bool all_less_than(VectorRegister<float, 512> const &x,
+                          VectorRegister<float, 512> const &y)
+{
+  return _mm512_cmp_ps_mask(x.data(), y.data(), _CMP_LT_OQ) == __mmask16(0xFFFFu);
+}
+
+inline bool any_less_than(VectorRegister<float, 512> const &x,
+                          VectorRegister<float, 512> const &y)
+{
+  return _mm512_cmp_ps_mask(x.data(), y.data(), _CMP_LT_OQ) != 0;
+}
+
+}  // namespace vectorize
+}  // namespace fetch
+
+FETCH_AVX512_DIAGNOSTICS_POP
+#endif
@@ -0,0 +1,180 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#ifdef __AVX512F__
+#include "vectorise/arch/avx512/info.hpp"
+#include "vectorise/info.hpp"
+#include "vectorise/register.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+FETCH_AVX512_DIAGNOSTICS_PUSH
+
+namespace fetch {
+namespace vectorize {
+
+// AVX-512 integers
+template <>
+class VectorRegister<int32_t, 512>
+{
+public:
+  using type             = int32_t;
+  using mm_register_type = __m512i;
+
+  enum
+  {
+    E_VECTOR_SIZE   = 512,
+    E_REGISTER_SIZE = sizeof(mm_register_type),
+    E_BLOCK_COUNT   = E_REGISTER_SIZE / sizeof(type)
+  };
+
+  static_assert((E_BLOCK_COUNT * sizeof(type)) == E_REGISTER_SIZE,
+                "type cannot be contained in the given register size.");
+
+  VectorRegister() = default;
+  VectorRegister(type const *d)
+  {
+    data_ = _mm512_load_si512(reinterpret_cast<mm_register_type const *>(d));
+  }
+
+  VectorRegister(type const &c)
+  {
+    data_ = _mm512_set1_epi32(c);
+  }
+
+  VectorRegister(mm_register_type const &d)
+    : data_(d)
+  {}
+
+  VectorRegister(mm_register_type &&d)
+    : data_(d)
+  {}
+
+  explicit operator mm_register_type()
+  {
+    return data_;
+  }
+
+  void Store(type *ptr) const
+  {
+    _mm512_store_si512(reinterpret_cast<mm_register_type *>(ptr), data_);
+  }
+
+  void Stream(type *ptr) const
+  {
+    _mm512_stream_si512(reinterpret_cast<mm_register_type *>(ptr), data_);
+  }
+
+  mm_register_type const &data() const
+  {
+    return data_;
+  }
+  mm_register_type &data()
+  {
+    return data_;
+  }
+
+private:
+  mm_register_type data_;
+};
+
+inline VectorRegister<int32_t, 512> operator-(VectorRegister<int32_t, 512> const &x)
+{
+  return VectorRegister<int32_t, 512>(_mm512_sub_epi32(_mm512_setzero_si512(), x.data()));
+}
+
+inline VectorRegister<int32_t, 512> operator+(VectorRegister<int32_t, 512> const &a,
+                                              VectorRegister<int32_t, 512> const &b)
+{
+  __m512i ret = _mm512_add_epi32(a.data(), b.data());
+  return VectorRegister<int32_t, 512>(ret);
+}
+
+inline VectorRegister<int32_t, 512> operator-(VectorRegister<int32_t, 512> const &a,
+                                              VectorRegister<int32_t, 512> const &b)
+{
+  __m512i ret = _mm512_sub_epi32(a.data(), b.data());
+  return VectorRegister<int32_t, 512>(ret);
+}
+
+inline VectorRegister<int32_t, 512> operator*(VectorRegister<int32_t, 512> const &a,
+                                              VectorRegister<int32_t, 512> const &b)
+{
+  __m512i ret = _mm512_mullo_epi32(a.data(), b.data());
+  return VectorRegister<int32_t, 512>(ret);
+}
+
+inline VectorRegister<int32_t, 512> operator/(VectorRegister<int32_t, 512> const &a,
+                                              VectorRegister<int32_t, 512> const &b)
+{
+  // there is no integer division instruction, divide element by element
+  alignas(64) int32_t d1[16];
+  a.Store(d1);
+
+  alignas(64) int32_t d2[16];
+  b.Store(d2);
+
+  // don't divide by zero, those elements are set to 0
+  alignas(64) int32_t ret[16];
+  for (std::size_t i = 0; i < 16; ++i)
+  {
+    ret[i] = d2[i] != 0 ? d1[i] / d2[i] : 0;
+  }
+
+  return VectorRegister<int32_t, 512>(ret);
+}
+
+inline VectorRegister<int32_t, 512> operator==(VectorRegister<int32_t, 512> const &a,
+                                               VectorRegister<int32_t, 512> const &b)
+{
+  __m512i ret = _mm512_maskz_set1_epi32(_mm512_cmpeq_epi32_mask(a.data(), b.data()), -1);
+  return VectorRegister<int32_t, 512>(ret);
+}
+
+inline VectorRegister<int32_t, 512> operator<(VectorRegister<int32_t, 512> const &a,
+                                              VectorRegister<int32_t, 512> const &b)
+{
+  __m512i ret = _mm512_maskz_set1_epi32(_mm512_cmplt_epi32_mask(a.data(), b.data()), -1);
+  return VectorRegister<int32_t, 512>(ret);
+}
+
+inline int32_t first_element(VectorRegister<int32_t, 512> const &x)
+{
+  return static_cast<int32_t>(_mm_cvtsi128_si32(_mm512_castsi512_si128(x.data())));
+}
+
+inline VectorRegister<int32_t, 512> shift_elements_left(VectorRegister<int32_t, 512> const &x)
+{
+  __m512i const index = _mm512_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14);
+  return _mm512_maskz_permutexvar_epi32(__mmask16(0xFFFFu - 1u), index, x.data());
+}
+
+inline VectorRegister<int32_t, 512> shift_elements_right(VectorRegister<int32_t, 512> const &x)
+{
+  __m512i const index = _mm512_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15);
+  return _mm512_maskz_permutexvar_epi32(__mmask16(0xFFFFu >> 1), index, x.data());
+}
+
+}  // namespace vectorize
+}  // namespace fetch
+
+FETCH_AVX512_DIAGNOSTICS_POP
+#endif
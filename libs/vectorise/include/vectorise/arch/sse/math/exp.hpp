@@ -18,8 +18,11 @@
 //------------------------------------------------------------------------------
 
 #include "vectorise/arch/sse.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
 
 #include <cstddef>
+#include <cstdint>
+#include <smmintrin.h>
 
 namespace fetch {
 namespace vectorize {
@@ -43,5 +46,95 @@ VectorRegister<T, S> exp(VectorRegister<T, S> x, T const &precision = 0.00001)
   return ret;
 }
 
+namespace details {
+
+/**
+ * Internal: FixedPoint::Exp of the elements in [0, MAX_EXP - 1/2], the range reduction and the
+ * Pade approximant are evaluated with the same operations (and so the same rounding) as the
+ * scalar implementation
+ */
+template <uint16_t I, uint16_t F>
+VectorRegister<fixed_point::FixedPoint<I, F>, 128> ExpNonNegative(
+    VectorRegister<fixed_point::FixedPoint<I, F>, 128> const &x)
+{
+  using Type         = fixed_point::FixedPoint<I, F>;
+  using RegisterType = VectorRegister<Type, 128>;
+
+  RegisterType const one(Type::_1);
+  RegisterType const ln2(Type::CONST_LN2);
+  RegisterType const integer_mask(Type::FromBase(Type::INTEGER_MASK));
+
+  // x = k * ln(2) + r, so that exp(x) = 2^k * exp(r), k = Floor(x / ln(2)) is non negative
+  RegisterType const k(_mm_and_si128((x / ln2).data(), integer_mask.data()));
+  RegisterType       r  = x - k * ln2;
+  RegisterType const e1 = one << k;
+
+  RegisterType r2 = r * r;
+  RegisterType r3 = r2 * r;
+  RegisterType r4 = r3 * r;
+  RegisterType r5 = r4 * r;
+  r               = r * RegisterType(Type{0.5});
+  r2              = r2 * RegisterType(Type{0.1111111111111111});
+  r3              = r3 * RegisterType(Type{0.01388888888888889});
+  r4              = r4 * RegisterType(Type{0.0009920634920634921});
+  r5              = r5 * RegisterType(Type{3.306878306878307e-05});
+
+  RegisterType const P   = one + r + r2 + r3 + r4 + r5;
+  RegisterType const Q   = one - r + r2 - r3 + r4 - r5;
+  RegisterType       ret = e1 * (P / Q);
+
+  // the special cases of the scalar implementation
+  ret = vector_select(x == one, RegisterType(Type::CONST_E), ret);
+  ret = vector_select(x == RegisterType(Type::_0), one, ret);
+
+  return ret;
+}
+
+}  // namespace details
+
+/**
+ * Exponential of fixed point numbers, bit identical to FixedPoint::Exp. Registers with elements
+ * which are not finite, or in (MAX_EXP - 1/2, MIN_EXP + 1/2) less the values below MIN_EXP, are
+ * evaluated element by element.
+ */
+template <uint16_t I, uint16_t F>
+VectorRegister<fixed_point::FixedPoint<I, F>, 128> exp(
+    VectorRegister<fixed_point::FixedPoint<I, F>, 128> const &x)
+{
+  using Type         = fixed_point::FixedPoint<I, F>;
+  using RegisterType = VectorRegister<Type, 128>;
+
+  RegisterType const zero(Type::_0);
+  RegisterType const one(Type::_1);
+  RegisterType const limit(Type::MAX_EXP - Type{0.5});
+
+  if (any_not_finite(x))
+  {
+    return details::ApplyElementwise([](Type const &a) { return Type::Exp(a); }, x);
+  }
+
+  // the elements below MIN_EXP are 0
+  RegisterType const underflow = x < RegisterType(Type::MIN_EXP);
+  RegisterType const negative  = x < zero;
+
+  __m128i const outside =
+      _mm_or_si128((limit < x).data(), _mm_andnot_si128(underflow.data(), (x < -limit).data()));
+  if (!_mm_testz_si128(outside, outside))
+  {
+    return details::ApplyElementwise([](Type const &a) { return Type::Exp(a); }, x);
+  }
+
+  // exp(x) = 1 / exp(-x) for the negative elements
+  RegisterType const a = vector_select(underflow, zero, vector_select(negative, -x, x));
+  RegisterType       e = details::ExpNonNegative(a);
+
+  if (!_mm_testz_si128(negative.data(), negative.data()))
+  {
+    e = vector_select(negative, one / e, e);
+  }
+
+  return vector_select(underflow, zero, e);
+}
+
 }  // namespace vectorize
 }  // namespace fetch
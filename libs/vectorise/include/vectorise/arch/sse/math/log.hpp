@@ -0,0 +1,82 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/arch/sse.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
+#include <cstdint>
+#include <smmintrin.h>
+
+namespace fetch {
+namespace vectorize {
+
+/**
+ * Natural logarithm of fixed point numbers, bit identical to FixedPoint::Log. Registers with
+ * elements outside [2^-(I - 3), 2^(I - 3)], where the range reduction would overflow, are
+ * evaluated element by element.
+ */
+template <uint16_t I, uint16_t F>
+VectorRegister<fixed_point::FixedPoint<I, F>, 128> log(
+    VectorRegister<fixed_point::FixedPoint<I, F>, 128> const &x)
+{
+  using Type         = fixed_point::FixedPoint<I, F>;
+  using RegisterType = VectorRegister<Type, 128>;
+  using BaseType     = typename Type::Type;
+
+  RegisterType const one(Type::_1);
+  RegisterType const lower(Type::FromBase(BaseType(1) << (F - I + 3)));
+  RegisterType const upper(Type::FromBase(BaseType(1) << (F + I - 3)));
+
+  if (any_not_finite(x))
+  {
+    return details::ApplyElementwise([](Type const &a) { return Type::Log(a); }, x);
+  }
+
+  __m128i const outside = _mm_or_si128((x < lower).data(), (upper < x).data());
+  if (!_mm_testz_si128(outside, outside))
+  {
+    return details::ApplyElementwise([](Type const &a) { return Type::Log(a); }, x);
+  }
+
+  // x = 2^k * r with r in [1/2, 1), reducing 1 / x for the elements below one
+  RegisterType const below = x < one;
+  RegisterType const sign  = vector_select(below, -one, one);
+  RegisterType const y     = vector_select(below, one / x, x);
+  RegisterType const k     = highest_set_bit(y) - RegisterType(Type(F));
+  RegisterType const r     = y / (one << k);
+
+  RegisterType const P00(Type{137});
+  RegisterType const P01(Type{1762});
+  RegisterType const P02(Type{3762});
+  RegisterType const P04(Type{137});
+  RegisterType const Q0(Type{30});
+  RegisterType const Q01(Type{24});
+  RegisterType const Q02(Type{76});
+  RegisterType const ln2(Type::CONST_LN2);
+  RegisterType const P = (-one + r) * (P00 + r * (P01 + r * (P02 + r * (P01 + r * P04))));
+  RegisterType const Q = Q0 * (one + r) * (one + r * (Q01 + r * (Q02 + r * (Q01 + r)))) * ln2;
+
+  RegisterType log2 = sign * (k + P / Q);
+  log2              = vector_select(x == one, RegisterType(Type::_0), log2);
+
+  return log2 / RegisterType(Type::CONST_LOG2E);
+}
+
+}  // namespace vectorize
+}  // namespace fetch
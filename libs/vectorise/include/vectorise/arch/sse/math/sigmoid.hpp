@@ -0,0 +1,84 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/arch/sse.hpp"
+#include "vectorise/arch/sse/math/exp.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
+#include <cstdint>
+#include <smmintrin.h>
+
+namespace fetch {
+namespace vectorize {
+
+/**
+ * The numerically stable sigmoid of fixed point numbers, bit identical to the scalar evaluation
+ * 1 / (1 + exp(-x)) for x >= 0 and exp(x) / (exp(x) + 1) otherwise. Registers with elements
+ * which are not finite, in [MAX_EXP - 1/2, MAX_EXP] in magnitude or for which -x overflows, are
+ * evaluated element by element.
+ */
+template <uint16_t I, uint16_t F>
+VectorRegister<fixed_point::FixedPoint<I, F>, 128> sigmoid(
+    VectorRegister<fixed_point::FixedPoint<I, F>, 128> const &x)
+{
+  using Type         = fixed_point::FixedPoint<I, F>;
+  using RegisterType = VectorRegister<Type, 128>;
+
+  RegisterType const zero(Type::_0);
+  RegisterType const one(Type::_1);
+  RegisterType const limit(Type::MAX_EXP - Type{0.5});
+  RegisterType const min_exp(Type::MIN_EXP);
+  // the largest x for which -1 * x, the first step of the scalar evaluation, does not overflow
+  RegisterType const max_negation(Type::FromBase(-Type::MIN));
+
+  auto const scalar = [](Type const &a) {
+    if (a >= Type::_0)
+    {
+      Type const e = Type::Exp(Type{-1} * a);
+      return Type(Type::_1 / (e + Type::_1));
+    }
+    Type const e = Type::Exp(a);
+    return Type(e / (e + Type::_1));
+  };
+
+  if (any_not_finite(x))
+  {
+    return details::ApplyElementwise(scalar, x);
+  }
+
+  // exp(-|x|) is 0 below MIN_EXP, leaving 0 and 1
+  RegisterType const saturated(_mm_or_si128((x < min_exp).data(), (-min_exp < x).data()));
+  RegisterType const negative  = x < zero;
+
+  __m128i const outside = _mm_or_si128(
+      (max_negation < x).data(),
+      _mm_andnot_si128(saturated.data(), _mm_or_si128((limit < x).data(), (x < -limit).data())));
+  if (!_mm_testz_si128(outside, outside))
+  {
+    return details::ApplyElementwise(scalar, x);
+  }
+
+  RegisterType const a = vector_select(saturated, zero, vector_select(negative, -x, x));
+  RegisterType const e = vector_select(saturated, zero, one / details::ExpNonNegative(a));
+
+  return vector_select(negative, e, one) / (e + one);
+}
+
+}  // namespace vectorize
+}  // namespace fetch
@@ -0,0 +1,67 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/arch/sse.hpp"
+#include "vectorise/arch/sse/math/exp.hpp"
+#include "vectorise/fixed_point/fixed_point.hpp"
+
+#include <cstdint>
+#include <smmintrin.h>
+
+namespace fetch {
+namespace vectorize {
+
+/**
+ * Hyperbolic tangent of fixed point numbers, bit identical to FixedPoint::TanH. Registers with
+ * elements which are not finite, or beyond MAX_EXP - 1/2 in magnitude, are evaluated element by
+ * element.
+ */
+template <uint16_t I, uint16_t F>
+VectorRegister<fixed_point::FixedPoint<I, F>, 128> tanh(
+    VectorRegister<fixed_point::FixedPoint<I, F>, 128> const &x)
+{
+  using Type         = fixed_point::FixedPoint<I, F>;
+  using RegisterType = VectorRegister<Type, 128>;
+
+  RegisterType const one(Type::_1);
+  RegisterType const limit(Type::MAX_EXP - Type{0.5});
+
+  if (any_not_finite(x))
+  {
+    return details::ApplyElementwise([](Type const &a) { return Type::TanH(a); }, x);
+  }
+
+  __m128i const outside = _mm_or_si128((limit < x).data(), (x < -limit).data());
+  if (!_mm_testz_si128(outside, outside))
+  {
+    return details::ApplyElementwise([](Type const &a) { return Type::TanH(a); }, x);
+  }
+
+  // exp(x) and exp(-x) share one evaluation, the negative one is 1 / exp(|x|) as in FixedPoint::Exp
+  RegisterType const negative = x < RegisterType(Type::_0);
+  RegisterType const e        = details::ExpNonNegative(vector_select(negative, -x, x));
+  RegisterType const e_inv    = one / e;
+  RegisterType const e1       = vector_select(negative, e_inv, e);
+  RegisterType const e2       = vector_select(negative, e, e_inv);
+
+  return (e1 - e2) / (e1 + e2);
+}
+
+}  // namespace vectorize
+}  // namespace fetch
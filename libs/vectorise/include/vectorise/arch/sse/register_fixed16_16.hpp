@@ -20,25 +20,46 @@
 #include "vectorise/arch/sse/info.hpp"
 #include "vectorise/arch/sse/register_int32.hpp"
 #include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/register.hpp"
 
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <emmintrin.h>
 #include <immintrin.h>
+#include <limits>
 #include <smmintrin.h>
 
 #include <iostream>
 
 namespace fetch {
+namespace platform {
+
+// there are no wider fixed point registers, keep them at 128 bits when AVX is available
+template <>
+struct VectorRegisterSize<fixed_point::FixedPoint<16, 16>>
+{
+  enum
+  {
+    value = 128
+  };
+};
+
+}  // namespace platform
+
 namespace vectorize {
 
+/**
+ * Register of four FixedPoint<16, 16> numbers. The arithmetic is bit identical to the one of
+ * FixedPoint, including the overflow state. The packed instructions only handle finite numbers,
+ * registers holding NaN or infinities are evaluated element by element with the scalar operators.
+ */
 template <>
 class VectorRegister<fixed_point::FixedPoint<16, 16>, 128>
 {
 public:
   using type             = fixed_point::FixedPoint<16, 16>;
-  using mm_register_type = __m128;
+  using mm_register_type = __m128i;
 
   enum
   {
@@ -51,34 +72,34 @@ public:
                 "type cannot be contained in the given register size.");
 
   VectorRegister() = default;
-  VectorRegister(type const * /*d*/)
-  {
-    throw std::runtime_error("load pointer not implemented");
-  }
+  // the loads and stores are unaligned, the elementwise tensor operations walk runs of elements
+  // which do not start on a register boundary
+  VectorRegister(type const *d)
+    : data_(_mm_loadu_si128(reinterpret_cast<mm_register_type const *>(d)))
+  {}
   VectorRegister(mm_register_type const &d)
     : data_(d)
   {}
   VectorRegister(mm_register_type &&d)
     : data_(d)
   {}
-  VectorRegister(type const & /*c*/)
-  {
-    throw std::runtime_error("load data not implemented");
-  }
+  VectorRegister(type const &c)
+    : data_(_mm_set1_epi32(c.Data()))
+  {}
 
   explicit operator mm_register_type()
   {
     return data_;
   }
 
-  void Store(type * /*ptr*/) const
+  void Store(type *ptr) const
   {
-    throw std::runtime_error("store pointer not implemented");
+    _mm_storeu_si128(reinterpret_cast<mm_register_type *>(ptr), data_);
   }
 
-  void Stream(type * /*ptr*/) const
+  void Stream(type *ptr) const
   {
-    throw std::runtime_error("stream pointer not implemented");
+    _mm_stream_si128(reinterpret_cast<mm_register_type *>(ptr), data_);
   }
 
   mm_register_type const &data() const
@@ -94,133 +115,394 @@ private:
   mm_register_type data_;
 };
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator-(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/)
+/**
+ * Test whether any element of the register may be NaN or infinite, these are left to the scalar
+ * operators
+ */
+inline bool any_not_finite(VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  // NaN and the infinities only differ in the two highest fractional bits
+  __m128i const mask    = _mm_set1_epi32(~(int32_t(3) << (Type::FRACTIONAL_BITS - 2)));
+  __m128i const special = _mm_cmpeq_epi32(_mm_and_si128(x.data(), mask),
+                                          _mm_set1_epi32(Type::NaN.Data()));
+
+  return !_mm_testz_si128(special, special);
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator*(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+namespace details {
+
+/**
+ * Internal: update the state after a packed operation as the scalar operators do, the results
+ * which overflow flag STATE_OVERFLOW and the ones equal to NaN flag STATE_NAN
+ */
+inline void UpdateState(VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &ret,
+                        __m128i const &                                             overflow)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  __m128i const nan = _mm_cmpeq_epi32(ret.data(), _mm_set1_epi32(Type::NaN.Data()));
+
+  if (!_mm_testz_si128(overflow, overflow))
+  {
+    Type::fp_state |= Type::STATE_OVERFLOW;
+  }
+  if (!_mm_testz_si128(nan, nan))
+  {
+    Type::fp_state |= Type::STATE_NAN;
+  }
 }
 
+}  // namespace details
+
 inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator-(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  if (any_not_finite(x))
+  {
+    return details::ApplyElementwise([](Type const &a) { return -a; }, x);
+  }
+
+  return VectorRegister<Type, 128>(_mm_sub_epi32(_mm_setzero_si128(), x.data()));
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator/(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator+(
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  if (any_not_finite(x) || any_not_finite(y))
+  {
+    return details::ApplyElementwise([](Type const &a, Type const &b) { return a + b; }, x, y);
+  }
+
+  VectorRegister<Type, 128> const ret(_mm_add_epi32(x.data(), y.data()));
+
+  // the sums which wrap around or fall below MIN overflow
+  __m128i const wrapped =
+      _mm_and_si128(_mm_xor_si128(x.data(), ret.data()), _mm_xor_si128(y.data(), ret.data()));
+  __m128i const overflow = _mm_or_si128(_mm_srai_epi32(wrapped, 31),
+                                        _mm_cmplt_epi32(ret.data(), _mm_set1_epi32(Type::MIN)));
+  details::UpdateState(ret, overflow);
+
+  return ret;
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator+(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator-(
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  if (any_not_finite(x) || any_not_finite(y))
+  {
+    return details::ApplyElementwise([](Type const &a, Type const &b) { return a - b; }, x, y);
+  }
+
+  VectorRegister<Type, 128> const ret(_mm_sub_epi32(x.data(), y.data()));
+
+  // the differences which wrap around or fall below MIN overflow
+  __m128i const wrapped =
+      _mm_and_si128(_mm_xor_si128(x.data(), y.data()), _mm_xor_si128(x.data(), ret.data()));
+  __m128i const overflow = _mm_or_si128(_mm_srai_epi32(wrapped, 31),
+                                        _mm_cmplt_epi32(ret.data(), _mm_set1_epi32(Type::MIN)));
+  details::UpdateState(ret, overflow);
+
+  return ret;
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator==(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+/**
+ * Multiplication, the full 64 bit products are shifted right by the fractional bits (i.e. rounded
+ * down) exactly as FixedPoint::operator*=
+ */
+inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator*(
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  if (any_not_finite(x) || any_not_finite(y))
+  {
+    return details::ApplyElementwise([](Type const &a, Type const &b) { return a * b; }, x, y);
+  }
+
+  __m128i const even = _mm_mul_epi32(x.data(), y.data());
+  __m128i const odd  = _mm_mul_epi32(_mm_srli_epi64(x.data(), 32), _mm_srli_epi64(y.data(), 32));
+
+  // the products overflow when they are outside of [MIN, MAX] after the shift
+  __m128i const upper = _mm_set1_epi64x((int64_t(Type::MAX) << Type::FRACTIONAL_BITS) |
+                                        int64_t(Type::FRACTIONAL_MASK));
+  __m128i const lower = _mm_set1_epi64x(int64_t(Type::MIN) * int64_t(Type::ONE_MASK));
+  __m128i const overflow =
+      _mm_or_si128(_mm_or_si128(_mm_cmpgt_epi64(even, upper), _mm_cmpgt_epi64(lower, even)),
+                   _mm_or_si128(_mm_cmpgt_epi64(odd, upper), _mm_cmpgt_epi64(lower, odd)));
+
+  // bits [16, 48) of each product
+  VectorRegister<Type, 128> const ret(_mm_blend_epi16(_mm_srli_epi64(even, Type::FRACTIONAL_BITS),
+                                                      _mm_slli_epi64(odd, Type::FRACTIONAL_BITS),
+                                                      0xCC));
+  details::UpdateState(ret, overflow);
+
+  return ret;
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator!=(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+namespace details {
+
+/**
+ * Internal: floor(n / d) for the (exact) non negative integers n < 2^48 and 0 < d < 2^32
+ */
+inline __m128d FloorDivide(__m128d const &n, __m128d const &d)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  __m128d const zero = _mm_setzero_pd();
+  __m128d const one  = _mm_set1_pd(1.0);
+
+  // the rounded quotient is at most one away from the exact one, correct it with the remainder
+  __m128d       q = _mm_round_pd(_mm_div_pd(n, d), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  __m128d const r = _mm_sub_pd(n, _mm_mul_pd(q, d));
+  q               = _mm_sub_pd(q, _mm_and_pd(_mm_cmplt_pd(r, zero), one));
+  q               = _mm_add_pd(q, _mm_and_pd(_mm_cmpge_pd(r, d), one));
+
+  return q;
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator>=(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+}  // namespace details
+
+/**
+ * Division, the quotient of the absolute values is evaluated exactly in double precision and
+ * truncated as FixedPoint::operator/=
+ */
+inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator/(
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  auto const fallback = [&x, &y]() {
+    return details::ApplyElementwise([](Type const &a, Type const &b) { return a / b; }, x, y);
+  };
+
+  // the division by zero, and the absolute value of the lowest number, are left to FixedPoint
+  __m128i const invalid = _mm_or_si128(
+      _mm_cmpeq_epi32(y.data(), _mm_setzero_si128()),
+      _mm_cmpeq_epi32(x.data(), _mm_set1_epi32(std::numeric_limits<int32_t>::min())));
+  if (any_not_finite(x) || any_not_finite(y) || !_mm_testz_si128(invalid, invalid))
+  {
+    return fallback();
+  }
+
+  __m128d const sign  = _mm_set1_pd(-0.0);
+  __m128d const scale = _mm_set1_pd(double(Type::ONE_MASK));
+
+  __m128d const n0 = _mm_mul_pd(_mm_andnot_pd(sign, _mm_cvtepi32_pd(x.data())), scale);
+  __m128d const d0 = _mm_andnot_pd(sign, _mm_cvtepi32_pd(y.data()));
+  __m128d const n1 =
+      _mm_mul_pd(_mm_andnot_pd(sign, _mm_cvtepi32_pd(_mm_unpackhi_epi64(x.data(), x.data()))),
+                 scale);
+  __m128d const d1 = _mm_andnot_pd(sign, _mm_cvtepi32_pd(_mm_unpackhi_epi64(y.data(), y.data())));
+
+  __m128d const q0 = details::FloorDivide(n0, d0);
+  __m128d const q1 = details::FloorDivide(n1, d1);
+
+  // the quotients whose signed result would overflow are left to FixedPoint as well
+  __m128d const limit = _mm_set1_pd(double(Type::MAX - Type::ONE_MASK));
+  if ((_mm_movemask_pd(_mm_cmpgt_pd(q0, limit)) | _mm_movemask_pd(_mm_cmpgt_pd(q1, limit))) != 0)
+  {
+    return fallback();
+  }
+
+  __m128i const quotient = _mm_unpacklo_epi64(_mm_cvttpd_epi32(q0), _mm_cvttpd_epi32(q1));
+
+  // the result takes the sign of x / y
+  __m128i const negative = _mm_srai_epi32(_mm_xor_si128(x.data(), y.data()), 31);
+  __m128i const ret      = _mm_sub_epi32(_mm_xor_si128(quotient, negative), negative);
+
+  return VectorRegister<Type, 128>(ret);
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator>(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+// the comparisons give 1 or 0 for each element, the ordering of finite numbers is the one of the
+// underlying integers
+#define FETCH_ADD_OPERATOR(op, fnc)                                                        \
+  inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator op(                 \
+      VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,                       \
+      VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)                       \
+  {                                                                                        \
+    using Type = fixed_point::FixedPoint<16, 16>;                                          \
+                                                                                           \
+    if (any_not_finite(x) || any_not_finite(y))                                            \
+    {                                                                                      \
+      return details::ApplyElementwise(                                                    \
+          [](Type const &a, Type const &b) { return (a op b) ? Type::_1 : Type::_0; }, x,  \
+          y);                                                                              \
+    }                                                                                      \
+                                                                                           \
+    __m128i const mask = fnc(x.data(), y.data());                                          \
+    return VectorRegister<Type, 128>(_mm_and_si128(mask, _mm_set1_epi32(Type::ONE_MASK))); \
+  }
+
+FETCH_ADD_OPERATOR(==, _mm_cmpeq_epi32)
+FETCH_ADD_OPERATOR(>, _mm_cmpgt_epi32)
+FETCH_ADD_OPERATOR(<, _mm_cmplt_epi32)
+
+#undef FETCH_ADD_OPERATOR
+
+#define FETCH_ADD_OPERATOR(op, fnc)                                                           \
+  inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator op(                    \
+      VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,                          \
+      VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)                          \
+  {                                                                                           \
+    using Type = fixed_point::FixedPoint<16, 16>;                                             \
+                                                                                              \
+    if (any_not_finite(x) || any_not_finite(y))                                               \
+    {                                                                                         \
+      return details::ApplyElementwise(                                                       \
+          [](Type const &a, Type const &b) { return (a op b) ? Type::_1 : Type::_0; }, x,     \
+          y);                                                                                 \
+    }                                                                                         \
+                                                                                              \
+    __m128i const mask = fnc(x.data(), y.data());                                             \
+    return VectorRegister<Type, 128>(_mm_andnot_si128(mask, _mm_set1_epi32(Type::ONE_MASK))); \
+  }
+
+FETCH_ADD_OPERATOR(!=, _mm_cmpeq_epi32)
+FETCH_ADD_OPERATOR(<=, _mm_cmpgt_epi32)
+FETCH_ADD_OPERATOR(>=, _mm_cmplt_epi32)
+
+#undef FETCH_ADD_OPERATOR
+
+/**
+ * Select the elements of x where the condition is non zero, the ones of y elsewhere
+ */
+inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> vector_select(
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &condition,
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  __m128i const mask = _mm_cmpeq_epi32(condition.data(), _mm_setzero_si128());
+  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(
+      _mm_blendv_epi8(x.data(), y.data(), mask));
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator<=(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+/**
+ * Shift the elements of x left by the integer parts of the elements of n, in [0, 32), as
+ * FixedPoint::operator<<=
+ */
+inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator<<(
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &n)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  // multiply by 2^n, assembled in the exponent of a float (2^31 converts to 1 << 31)
+  __m128i const shift = _mm_srai_epi32(n.data(), Type::FRACTIONAL_BITS);
+  __m128i const power = _mm_cvttps_epi32(
+      _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(shift, _mm_set1_epi32(127)), 23)));
+
+  return VectorRegister<Type, 128>(_mm_mullo_epi32(x.data(), power));
 }
 
-inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> operator<(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*y*/)
+/**
+ * The platform::HighestSetBit of the underlying integers of the non negative elements, as
+ * FixedPoint integers
+ */
+inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> highest_set_bit(
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  // smear the highest bit into all the lower ones, adding one leaves 2^bit which converts to a
+  // float exactly
+  __m128i n = x.data();
+  n         = _mm_or_si128(n, _mm_srli_epi32(n, 1));
+  n         = _mm_or_si128(n, _mm_srli_epi32(n, 2));
+  n         = _mm_or_si128(n, _mm_srli_epi32(n, 4));
+  n         = _mm_or_si128(n, _mm_srli_epi32(n, 8));
+  n         = _mm_or_si128(n, _mm_srli_epi32(n, 16));
+  n         = _mm_add_epi32(n, _mm_set1_epi32(1));
+
+  __m128i exponent = _mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(n)), 23);
+  exponent         = _mm_sub_epi32(_mm_and_si128(exponent, _mm_set1_epi32(0xFF)),
+                                   _mm_set1_epi32(127));
+
+  return VectorRegister<Type, 128>(_mm_slli_epi32(exponent, Type::FRACTIONAL_BITS));
 }
 
 inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> vector_zero_below_element(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*a*/, int const & /*n*/)
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &a, int const &n)
 {
-  throw std::runtime_error("vector_zero_below_element not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  alignas(16) const uint32_t mask[4] = {uint32_t(-(0 >= n)), uint32_t(-(1 >= n)),
+                                        uint32_t(-(2 >= n)), uint32_t(-(3 >= n))};
+
+  __m128i conv = _mm_and_si128(a.data(), *reinterpret_cast<__m128i const *>(mask));
+
+  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(conv);
 }
 
 inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> vector_zero_above_element(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*a*/, int const & /*n*/)
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &a, int const &n)
 {
-  throw std::runtime_error("vector_zero_above_element not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  alignas(16) const uint32_t mask[4] = {uint32_t(-(0 <= n)), uint32_t(-(1 <= n)),
+                                        uint32_t(-(2 <= n)), uint32_t(-(3 <= n))};
+
+  __m128i conv = _mm_and_si128(a.data(), *reinterpret_cast<__m128i const *>(mask));
+
+  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(conv);
 }
 
 inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> shift_elements_left(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/)
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x)
 {
-  throw std::runtime_error("shift_elements_left not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(_mm_bslli_si128(x.data(), 4));
 }
 
 inline VectorRegister<fixed_point::FixedPoint<16, 16>, 128> shift_elements_right(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/)
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x)
 {
-  throw std::runtime_error("shift_elements_right not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(fixed_point::FixedPoint<16, 16>{});
+  return VectorRegister<fixed_point::FixedPoint<16, 16>, 128>(_mm_bsrli_si128(x.data(), 4));
 }
 
 inline fixed_point::FixedPoint<16, 16> first_element(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/)
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x)
 {
-  throw std::runtime_error("first_element not implemented.");
-  return fixed_point::FixedPoint<16, 16>{};
+  return fixed_point::FixedPoint<16, 16>::FromBase(_mm_cvtsi128_si32(x.data()));
 }
 
+/**
+ * Sum of the elements, added in order so that the result (and the overflow state) is the one of
+ * a scalar loop
+ */
 inline fixed_point::FixedPoint<16, 16> reduce(
-    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const & /*x*/)
+    VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x)
+{
+  using Type = fixed_point::FixedPoint<16, 16>;
+
+  alignas(16) Type values[4];
+  x.Store(values);
+
+  Type ret{Type::_0};
+  for (auto const &value : values)
+  {
+    ret += value;
+  }
+
+  return ret;
+}
+
+inline bool all_less_than(VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,
+                          VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)
+{
+  __m128i const less = (x < y).data();
+  return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(less, _mm_setzero_si128()))) == 0;
+}
+
+inline bool any_less_than(VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &x,
+                          VectorRegister<fixed_point::FixedPoint<16, 16>, 128> const &y)
 {
-  throw std::runtime_error("reduce not implemented.");
-  return fixed_point::FixedPoint<16, 16>{};
+  __m128i const less = (x < y).data();
+  return !_mm_testz_si128(less, less);
 }
 
 }  // namespace vectorize
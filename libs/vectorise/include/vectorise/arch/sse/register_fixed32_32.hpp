@@ -20,6 +20,8 @@
 #include "vectorise/arch/sse/info.hpp"
 #include "vectorise/arch/sse/register_int32.hpp"
 #include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/platform.hpp"
+#include "vectorise/register.hpp"
 
 #include <cmath>
 #include <cstddef>
@@ -31,14 +33,33 @@
 #include <iostream>
 
 namespace fetch {
+namespace platform {
+
+// there are no wider fixed point registers, keep them at 128 bits when AVX is available
+template <>
+struct VectorRegisterSize<fixed_point::FixedPoint<32, 32>>
+{
+  enum
+  {
+    value = 128
+  };
+};
+
+}  // namespace platform
+
 namespace vectorize {
 
+/**
+ * Register of two FixedPoint<32, 32> numbers. The arithmetic is bit identical to the one of
+ * FixedPoint, including the overflow state. The packed instructions only handle finite numbers,
+ * registers holding NaN or infinities are evaluated element by element with the scalar operators.
+ */
 template <>
 class VectorRegister<fixed_point::FixedPoint<32, 32>, 128>
 {
 public:
   using type             = fixed_point::FixedPoint<32, 32>;
-  using mm_register_type = __m128;
+  using mm_register_type = __m128i;
 
   enum
   {
@@ -51,34 +72,34 @@ public:
                 "type cannot be contained in the given register size.");
 
   VectorRegister() = default;
-  VectorRegister(type const * /*d*/)
-  {
-    throw std::runtime_error("load pointer not implemented");
-  }
+  // the loads and stores are unaligned, the elementwise tensor operations walk runs of elements
+  // which do not start on a register boundary
+  VectorRegister(type const *d)
+    : data_(_mm_loadu_si128(reinterpret_cast<mm_register_type const *>(d)))
+  {}
   VectorRegister(mm_register_type const &d)
     : data_(d)
   {}
   VectorRegister(mm_register_type &&d)
     : data_(d)
   {}
-  VectorRegister(type const & /*c*/)
-  {
-    throw std::runtime_error("load data not implemented");
-  }
+  VectorRegister(type const &c)
+    : data_(_mm_set1_epi64x(c.Data()))
+  {}
 
   explicit operator mm_register_type()
   {
     return data_;
   }
 
-  void Store(type * /*ptr*/) const
+  void Store(type *ptr) const
   {
-    throw std::runtime_error("store pointer not implemented");
+    _mm_storeu_si128(reinterpret_cast<mm_register_type *>(ptr), data_);
   }
 
-  void Stream(type * /*ptr*/) const
+  void Stream(type *ptr) const
   {
-    throw std::runtime_error("stream pointer not implemented");
+    _mm_stream_si128(reinterpret_cast<mm_register_type *>(ptr), data_);
   }
 
   mm_register_type const &data() const
@@ -94,133 +115,337 @@ private:
   mm_register_type data_;
 };
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator-(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/)
+/**
+ * Test whether any element of the register may be NaN or infinite, these are left to the scalar
+ * operators
+ */
+inline bool any_not_finite(VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  using Type = fixed_point::FixedPoint<32, 32>;
+
+  // NaN and the infinities only differ in the two highest fractional bits
+  __m128i const mask    = _mm_set1_epi64x(~(int64_t(3) << (Type::FRACTIONAL_BITS - 2)));
+  __m128i const special = _mm_cmpeq_epi64(_mm_and_si128(x.data(), mask),
+                                          _mm_set1_epi64x(Type::NaN.Data()));
+
+  return !_mm_testz_si128(special, special);
 }
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator*(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+namespace details {
+
+/**
+ * Internal: update the state after a packed operation as the scalar operators do, the results
+ * which overflow flag STATE_OVERFLOW and the ones equal to NaN flag STATE_NAN
+ */
+inline void UpdateState(VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &ret,
+                        __m128i const &                                             overflow)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  using Type = fixed_point::FixedPoint<32, 32>;
+
+  __m128i const nan = _mm_cmpeq_epi64(ret.data(), _mm_set1_epi64x(Type::NaN.Data()));
+
+  if (!_mm_testz_si128(overflow, overflow))
+  {
+    Type::fp_state |= Type::STATE_OVERFLOW;
+  }
+  if (!_mm_testz_si128(nan, nan))
+  {
+    Type::fp_state |= Type::STATE_NAN;
+  }
 }
 
+}  // namespace details
+
 inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator-(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
-}
+  using Type = fixed_point::FixedPoint<32, 32>;
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator/(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
-{
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  if (any_not_finite(x))
+  {
+    return details::ApplyElementwise([](Type const &a) { return -a; }, x);
+  }
+
+  return VectorRegister<Type, 128>(_mm_sub_epi64(_mm_setzero_si128(), x.data()));
 }
 
 inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator+(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  using Type = fixed_point::FixedPoint<32, 32>;
+
+  if (any_not_finite(x) || any_not_finite(y))
+  {
+    return details::ApplyElementwise([](Type const &a, Type const &b) { return a + b; }, x, y);
+  }
+
+  VectorRegister<Type, 128> const ret(_mm_add_epi64(x.data(), y.data()));
+
+  // the sums which wrap around or fall below MIN overflow
+  __m128i const minimum = _mm_set1_epi64x(Type::MIN);
+  __m128i const wrapped =
+      _mm_and_si128(_mm_xor_si128(x.data(), ret.data()), _mm_xor_si128(y.data(), ret.data()));
+  __m128i const overflow = _mm_or_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), wrapped),
+                                        _mm_cmpgt_epi64(minimum, ret.data()));
+  details::UpdateState(ret, overflow);
+
+  return ret;
 }
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator==(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator-(
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  using Type = fixed_point::FixedPoint<32, 32>;
+
+  if (any_not_finite(x) || any_not_finite(y))
+  {
+    return details::ApplyElementwise([](Type const &a, Type const &b) { return a - b; }, x, y);
+  }
+
+  VectorRegister<Type, 128> const ret(_mm_sub_epi64(x.data(), y.data()));
+
+  // the differences which wrap around or fall below MIN overflow
+  __m128i const minimum = _mm_set1_epi64x(Type::MIN);
+  __m128i const wrapped =
+      _mm_and_si128(_mm_xor_si128(x.data(), y.data()), _mm_xor_si128(x.data(), ret.data()));
+  __m128i const overflow = _mm_or_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), wrapped),
+                                        _mm_cmpgt_epi64(minimum, ret.data()));
+  details::UpdateState(ret, overflow);
+
+  return ret;
 }
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator!=(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+/**
+ * Multiplication, the full 128 bit products are shifted right by the fractional bits (i.e.
+ * rounded down) exactly as FixedPoint::operator*=. The products are assembled from the unsigned
+ * 32 x 32 bit partial products and corrected for the signs of the factors.
+ */
+inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator*(
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  using Type = fixed_point::FixedPoint<32, 32>;
+
+  if (any_not_finite(x) || any_not_finite(y))
+  {
+    return details::ApplyElementwise([](Type const &a, Type const &b) { return a * b; }, x, y);
+  }
+
+  __m128i const low  = _mm_set1_epi64x(0xFFFFFFFFLL);
+  __m128i const zero = _mm_setzero_si128();
+  __m128i const xh   = _mm_srli_epi64(x.data(), 32);
+  __m128i const yh   = _mm_srli_epi64(y.data(), 32);
+
+  __m128i const ll = _mm_mul_epu32(x.data(), y.data());
+  __m128i const lh = _mm_mul_epu32(x.data(), yh);
+  __m128i const hl = _mm_mul_epu32(xh, y.data());
+  __m128i const hh = _mm_mul_epu32(xh, yh);
+
+  // bits [32, 64) of the product and the carry into the upper half
+  __m128i const middle =
+      _mm_add_epi64(_mm_add_epi64(_mm_srli_epi64(ll, 32), _mm_and_si128(lh, low)),
+                    _mm_and_si128(hl, low));
+
+  // bits [64, 128) of the unsigned product, less the corrections for the negative factors
+  __m128i upper = _mm_add_epi64(_mm_add_epi64(hh, _mm_srli_epi64(lh, 32)),
+                                _mm_add_epi64(_mm_srli_epi64(hl, 32), _mm_srli_epi64(middle, 32)));
+  upper         = _mm_sub_epi64(upper, _mm_and_si128(_mm_cmpgt_epi64(zero, x.data()), y.data()));
+  upper         = _mm_sub_epi64(upper, _mm_and_si128(_mm_cmpgt_epi64(zero, y.data()), x.data()));
+
+  VectorRegister<Type, 128> const ret(
+      _mm_or_si128(_mm_slli_epi64(upper, 32), _mm_and_si128(middle, low)));
+
+  // the shifted products overflow when their upper 32 bits are not the sign extension of the
+  // result, or when the result is below MIN
+  __m128i const high     = _mm_set1_epi64x(~0xFFFFFFFFLL);
+  __m128i const sign     = _mm_shuffle_epi32(_mm_srai_epi32(upper, 31), _MM_SHUFFLE(2, 2, 0, 0));
+  __m128i const extended = _mm_and_si128(_mm_cmpeq_epi32(upper, sign), high);
+  __m128i const overflow = _mm_or_si128(_mm_xor_si128(extended, high),
+                                        _mm_cmpgt_epi64(_mm_set1_epi64x(Type::MIN), ret.data()));
+  details::UpdateState(ret, overflow);
+
+  return ret;
 }
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator>=(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+/**
+ * Division, there is no packed 64 bit division so the elements are divided with the scalar
+ * operator
+ */
+inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator/(
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  using Type = fixed_point::FixedPoint<32, 32>;
+
+  return details::ApplyElementwise([](Type const &a, Type const &b) { return a / b; }, x, y);
 }
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator>(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+// the comparisons give 1 or 0 for each element, the ordering of finite numbers is the one of the
+// underlying integers
+#define FETCH_ADD_OPERATOR(op, fnc)                                                         \
+  inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator op(                  \
+      VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,                        \
+      VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)                        \
+  {                                                                                         \
+    using Type = fixed_point::FixedPoint<32, 32>;                                           \
+                                                                                            \
+    if (any_not_finite(x) || any_not_finite(y))                                             \
+    {                                                                                       \
+      return details::ApplyElementwise(                                                     \
+          [](Type const &a, Type const &b) { return (a op b) ? Type::_1 : Type::_0; }, x,   \
+          y);                                                                               \
+    }                                                                                       \
+                                                                                            \
+    __m128i const mask = fnc;                                                               \
+    return VectorRegister<Type, 128>(_mm_and_si128(mask, _mm_set1_epi64x(Type::ONE_MASK))); \
+  }
+
+FETCH_ADD_OPERATOR(==, _mm_cmpeq_epi64(x.data(), y.data()))
+FETCH_ADD_OPERATOR(>, _mm_cmpgt_epi64(x.data(), y.data()))
+FETCH_ADD_OPERATOR(<, _mm_cmpgt_epi64(y.data(), x.data()))
+
+#undef FETCH_ADD_OPERATOR
+
+#define FETCH_ADD_OPERATOR(op, fnc)                                                            \
+  inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator op(                     \
+      VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,                           \
+      VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)                           \
+  {                                                                                            \
+    using Type = fixed_point::FixedPoint<32, 32>;                                              \
+                                                                                               \
+    if (any_not_finite(x) || any_not_finite(y))                                                \
+    {                                                                                          \
+      return details::ApplyElementwise(                                                        \
+          [](Type const &a, Type const &b) { return (a op b) ? Type::_1 : Type::_0; }, x,      \
+          y);                                                                                  \
+    }                                                                                          \
+                                                                                               \
+    __m128i const mask = fnc;                                                                  \
+    return VectorRegister<Type, 128>(_mm_andnot_si128(mask, _mm_set1_epi64x(Type::ONE_MASK))); \
+  }
+
+FETCH_ADD_OPERATOR(!=, _mm_cmpeq_epi64(x.data(), y.data()))
+FETCH_ADD_OPERATOR(<=, _mm_cmpgt_epi64(x.data(), y.data()))
+FETCH_ADD_OPERATOR(>=, _mm_cmpgt_epi64(y.data(), x.data()))
+
+#undef FETCH_ADD_OPERATOR
+
+/**
+ * Select the elements of x where the condition is non zero, the ones of y elsewhere
+ */
+inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> vector_select(
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &condition,
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  __m128i const mask = _mm_cmpeq_epi64(condition.data(), _mm_setzero_si128());
+  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(
+      _mm_blendv_epi8(x.data(), y.data(), mask));
 }
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator<=(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+/**
+ * Shift the elements of x left by the integer parts of the elements of n, in [0, 64), as
+ * FixedPoint::operator<<=
+ */
+inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator<<(
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &n)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  // the integer parts are the upper halves of the elements
+  __m128i const first  = _mm_sll_epi64(x.data(), _mm_cvtsi32_si128(_mm_extract_epi32(n.data(), 1)));
+  __m128i const second = _mm_sll_epi64(x.data(), _mm_cvtsi32_si128(_mm_extract_epi32(n.data(), 3)));
+
+  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(
+      _mm_blend_epi16(first, second, 0xF0));
 }
 
-inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> operator<(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/,
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*y*/)
+/**
+ * The platform::HighestSetBit of the underlying integers of the non negative elements, as
+ * FixedPoint integers
+ */
+inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> highest_set_bit(
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x)
 {
-  throw std::runtime_error("operator not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  int64_t const first  = platform::HighestSetBit(_mm_cvtsi128_si64(x.data()));
+  int64_t const second = platform::HighestSetBit(_mm_extract_epi64(x.data(), 1));
+
+  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(
+      _mm_set_epi64x(second << 32, first << 32));
 }
 
 inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> vector_zero_below_element(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*a*/, int const & /*n*/)
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &a, int const &n)
 {
-  throw std::runtime_error("vector_zero_below_element not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  alignas(16) const uint64_t mask[2] = {uint64_t(-(0 >= n)), uint64_t(-(1 >= n))};
+
+  __m128i conv = _mm_and_si128(a.data(), *reinterpret_cast<__m128i const *>(mask));
+
+  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(conv);
 }
 
 inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> vector_zero_above_element(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*a*/, int const & /*n*/)
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &a, int const &n)
 {
-  throw std::runtime_error("vector_zero_above_element not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  alignas(16) const uint64_t mask[2] = {uint64_t(-(0 <= n)), uint64_t(-(1 <= n))};
+
+  __m128i conv = _mm_and_si128(a.data(), *reinterpret_cast<__m128i const *>(mask));
+
+  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(conv);
 }
 
 inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> shift_elements_left(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/)
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x)
 {
-  throw std::runtime_error("shift_elements_left not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(_mm_bslli_si128(x.data(), 8));
 }
 
 inline VectorRegister<fixed_point::FixedPoint<32, 32>, 128> shift_elements_right(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/)
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x)
 {
-  throw std::runtime_error("shift_elements_right not implemented.");
-  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(fixed_point::FixedPoint<32, 32>{});
+  return VectorRegister<fixed_point::FixedPoint<32, 32>, 128>(_mm_bsrli_si128(x.data(), 8));
 }
 
 inline fixed_point::FixedPoint<32, 32> first_element(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/)
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x)
 {
-  throw std::runtime_error("first_element not implemented.");
-  return fixed_point::FixedPoint<32, 32>{};
+  return fixed_point::FixedPoint<32, 32>::FromBase(_mm_cvtsi128_si64(x.data()));
 }
 
+/**
+ * Sum of the elements, added in order so that the result (and the overflow state) is the one of
+ * a scalar loop
+ */
 inline fixed_point::FixedPoint<32, 32> reduce(
-    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const & /*x*/)
+    VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x)
+{
+  using Type = fixed_point::FixedPoint<32, 32>;
+
+  alignas(16) Type values[2];
+  x.Store(values);
+
+  Type ret{Type::_0};
+  for (auto const &value : values)
+  {
+    ret += value;
+  }
+
+  return ret;
+}
+
+inline bool all_less_than(VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,
+                          VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)
+{
+  __m128i const less = (x < y).data();
+  return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(less, _mm_setzero_si128()))) == 0;
+}
+
+inline bool any_less_than(VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &x,
+                          VectorRegister<fixed_point::FixedPoint<32, 32>, 128> const &y)
 {
-  throw std::runtime_error("reduce not implemented.");
-  return fixed_point::FixedPoint<32, 32>{};
+  __m128i const less = (x < y).data();
+  return !_mm_testz_si128(less, less);
 }
 
 }  // namespace vectorize
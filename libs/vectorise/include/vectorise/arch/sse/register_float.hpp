@@ -192,22 +192,15 @@ inline float reduce(VectorRegister<float, 128> const &x)
   return _mm_cvtss_f32(r);
 }
 
-/*
-// TODO (issue 1115): Float equivalent
-inline bool all_less_than(VectorRegister<double, 128> const &x,
-                          VectorRegister<double, 128> const &y)
+inline bool all_less_than(VectorRegister<float, 128> const &x, VectorRegister<float, 128> const &y)
 {
-  __m128i r = _mm_castpd_si128(_mm_cmplt_pd(x.data(), y.data()));
-  return _mm_movemask_epi8(r) == 0xFFFF;
+  return _mm_movemask_ps(_mm_cmplt_ps(x.data(), y.data())) == 0xF;
 }
 
-inline bool any_less_than(VectorRegister<double, 128> const &x,
-                          VectorRegister<double, 128> const &y)
+inline bool any_less_than(VectorRegister<float, 128> const &x, VectorRegister<float, 128> const &y)
 {
-  __m128i r = _mm_castpd_si128(_mm_cmplt_pd(x.data(), y.data()));
-  return _mm_movemask_epi8(r) != 0;
+  return _mm_movemask_ps(_mm_cmplt_ps(x.data(), y.data())) != 0;
 }
-*/
 
 }  // namespace vectorize
 }  // namespace fetch
@@ -198,7 +198,8 @@ public:
     STATE_OVERFLOW         = 1 << 3,
     STATE_INFINITY         = 1 << 4,
   };
-  static uint32_t fp_state;
+  // the state is per thread, so that operations on other threads neither race on nor raise it
+  static thread_local uint32_t fp_state;
 
   static constexpr void StateClear();
   static constexpr bool IsState(const uint32_t state);
@@ -481,7 +482,7 @@ std::function<FixedPoint<I, F>(FixedPoint<I, F> const &x)>
         [](FixedPoint<I, F> const &x) { return FixedPoint<I, F>::SinPi2(x); }};
 
 template <std::uint16_t I, std::uint16_t F>
-uint32_t FixedPoint<I, F>::fp_state{FixedPoint<I, F>::STATE_OK};
+thread_local uint32_t FixedPoint<I, F>::fp_state{FixedPoint<I, F>::STATE_OK};
 
 template <std::uint16_t I, std::uint16_t F>
 constexpr typename FixedPoint<I, F>::Type FixedPoint<I, F>::SMALLEST_FRACTION;
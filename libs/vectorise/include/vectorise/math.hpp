@@ -17,11 +17,26 @@
 //
 //------------------------------------------------------------------------------
 
+#include "vectorise/arch/avx/math/abs.hpp"
+#include "vectorise/arch/avx/math/approx_exp.hpp"
+#include "vectorise/arch/avx/math/approx_log.hpp"
+#include "vectorise/arch/avx/math/max.hpp"
+#include "vectorise/arch/avx/math/min.hpp"
+#include "vectorise/arch/avx/math/sqrt.hpp"
+#include "vectorise/arch/avx512/math/abs.hpp"
+#include "vectorise/arch/avx512/math/approx_exp.hpp"
+#include "vectorise/arch/avx512/math/approx_log.hpp"
+#include "vectorise/arch/avx512/math/max.hpp"
+#include "vectorise/arch/avx512/math/min.hpp"
+#include "vectorise/arch/avx512/math/sqrt.hpp"
 #include "vectorise/arch/sse/math/abs.hpp"
 #include "vectorise/arch/sse/math/approx_exp.hpp"
 #include "vectorise/arch/sse/math/approx_log.hpp"
 #include "vectorise/arch/sse/math/exp.hpp"
+#include "vectorise/arch/sse/math/log.hpp"
 #include "vectorise/arch/sse/math/max.hpp"
 #include "vectorise/arch/sse/math/min.hpp"
 #include "vectorise/arch/sse/math/pow.hpp"
+#include "vectorise/arch/sse/math/sigmoid.hpp"
 #include "vectorise/arch/sse/math/sqrt.hpp"
+#include "vectorise/arch/sse/math/tanh.hpp"
@@ -72,8 +72,9 @@ public:
     , data_(other.data_)
   {}
 
+  // the offset is relative to the start of other, so that slices of slices compose
   SharedArray(SharedArray const &other, uint64_t offset, uint64_t size) noexcept
-    : super_type(other.data_.get() + offset, size)
+    : super_type(other.pointer_ + offset, size)
     , data_(other.data_)
   {}
 
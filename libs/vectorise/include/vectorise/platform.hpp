@@ -37,7 +37,9 @@ struct VectorRegisterSize
 {
   enum
   {
-#ifdef __AVX__
+#ifdef __AVX512F__
+    value = 512
+#elif defined __AVX__
     value = 256
 #elif defined __SSE__
     value = 128
@@ -57,7 +59,11 @@ struct VectorRegisterSize
     };                                \
   }
 
-#ifdef __AVX2__
+#ifdef __AVX512F__
+
+ADD_REGISTER_SIZE(int, 512);
+
+#elif defined __AVX2__
 
 ADD_REGISTER_SIZE(int, 256);
 
@@ -104,6 +110,15 @@ constexpr bool has_avx2()
 #endif
 }
 
+constexpr bool has_avx512()
+{
+#ifdef __AVX512F__
+  return true;
+#else
+  return false;
+#endif
+}
+
 constexpr bool has_sse()
 {
 #ifdef __SSE__
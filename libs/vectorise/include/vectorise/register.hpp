@@ -20,25 +20,7 @@
 #include "vectorise/info.hpp"
 
 #include <cstddef>
-
-namespace details {
-template <typename T, std::size_t N>
-struct UnrollSet
-{
-  static void Set(T *ptr, T const &c)
-  {
-    (*ptr) = c;
-    UnrollSet<T, N - 1>::Set(ptr + 1, c);
-  }
-};
-
-template <typename T>
-struct UnrollSet<T, 0>
-{
-  static void Set(T * /*ptr*/, T const & /*c*/)
-  {}
-};
-}  // namespace details
+#include <new>
 
 // clang-format off
 // NOLINTNEXTLINE
@@ -106,5 +88,78 @@ private:
 };
 
 #undef APPLY_OPERATOR_LIST
+
+namespace details {
+
+template <typename T, std::size_t N>
+struct UnrollSet
+{
+  static void Set(T *ptr, T const &c)
+  {
+    (*ptr) = c;
+    UnrollSet<T, N - 1>::Set(ptr + 1, c);
+  }
+};
+
+template <typename T>
+struct UnrollSet<T, 0>
+{
+  static void Set(T * /*ptr*/, T const & /*c*/)
+  {}
+};
+
+/**
+ * Evaluate a scalar function element by element over a register, for the cases which a register
+ * implementation does not handle with packed instructions
+ *
+ * @param function The scalar function
+ * @param x The register
+ * @return The register of the results
+ */
+template <typename R, typename F>
+R ApplyElementwise(F &&function, R const &x)
+{
+  using Type = typename R::type;
+
+  alignas(64) Type values[R::E_BLOCK_COUNT];
+  x.Store(values);
+
+  // the results are copy constructed in place, assigning a FixedPoint NaN would flag its state
+  for (auto &value : values)
+  {
+    new (&value) Type(function(value));
+  }
+
+  return R(values);
+}
+
+/**
+ * Evaluate a scalar function element by element over two registers, for the cases which a
+ * register implementation does not handle with packed instructions
+ *
+ * @param function The scalar function
+ * @param x The first register
+ * @param y The second register
+ * @return The register of the results
+ */
+template <typename R, typename F>
+R ApplyElementwise(F &&function, R const &x, R const &y)
+{
+  using Type = typename R::type;
+
+  alignas(64) Type values[R::E_BLOCK_COUNT];
+  alignas(64) Type others[R::E_BLOCK_COUNT];
+  x.Store(values);
+  y.Store(others);
+
+  for (std::size_t i = 0; i < std::size_t(R::E_BLOCK_COUNT); ++i)
+  {
+    new (&values[i]) Type(function(values[i], others[i]));
+  }
+
+  return R(values);
+}
+
+}  // namespace details
 }  // namespace vectorize
 }  // namespace fetch
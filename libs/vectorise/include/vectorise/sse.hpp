@@ -31,25 +31,6 @@
 namespace fetch {
 namespace vectorize {
 
-namespace details {
-template <typename T, std::size_t N>
-struct UnrollSet
-{
-  static void Set(T *ptr, T const &c)
-  {
-    (*ptr) = c;
-    UnrollSet<T, N - 1>::Set(ptr + 1, c);
-  }
-};
-
-template <typename T>
-struct UnrollSet<T, 0>
-{
-  static void Set(T * /*ptr*/, T const & /*c*/)
-  {}
-};
-}  // namespace details
-
 // SSE integers
 template <typename T>
 class VectorRegister<T, 128>
@@ -0,0 +1,412 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/threading.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fetch {
+namespace threading {
+
+/**
+ * A persistent, work stealing pool of threads for data parallel (compute bound) work.
+ *
+ * Work is submitted as a ParallelFor over an index range. The range is split into a bounded number
+ * of chunks which are distributed over the per worker queues, workers take chunks from the back
+ * of their own queue and, once it is empty, steal from the front of the other queues. The calling
+ * thread participates in the work and only returns once every chunk of its range has completed.
+ *
+ * A ParallelFor issued from within a worker (i.e. nested parallelism) is executed inline on the
+ * calling thread.
+ *
+ * The process wide instance is sized on first use, from SetDefaultConcurrency() if it has been
+ * called, otherwise from the FETCH_COMPUTE_THREADS environment variable, otherwise from the number
+ * of hardware threads.
+ */
+class ComputePool
+{
+public:
+  static constexpr std::size_t CHUNKS_PER_THREAD = 4;
+
+  // Construction / Destruction
+  explicit ComputePool(std::size_t concurrency);
+  ComputePool(ComputePool const &) = delete;
+  ComputePool(ComputePool &&)      = delete;
+  ~ComputePool();
+
+  static ComputePool &Instance();
+  static void         SetDefaultConcurrency(std::size_t concurrency);
+
+  template <typename F>
+  void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain, F &&function);
+
+  std::size_t concurrency() const;
+
+  // Operators
+  ComputePool &operator=(ComputePool const &) = delete;
+  ComputePool &operator=(ComputePool &&) = delete;
+
+private:
+  using Mutex     = std::mutex;
+  using Condition = std::condition_variable;
+  using Invoker   = void (*)(void *, std::size_t, std::size_t);
+
+  struct Job
+  {
+    Invoker                  invoke;
+    void *                   context;
+    std::atomic<std::size_t> pending;  ///< The number of chunks which have not completed
+    Mutex                    error_lock;
+    std::exception_ptr       error;  ///< The first exception raised by a chunk
+  };
+
+  struct Task
+  {
+    Job *       job;
+    std::size_t begin;
+    std::size_t end;
+  };
+
+  struct Queue
+  {
+    Mutex            lock;
+    std::deque<Task> tasks;
+  };
+
+  using QueuePtr = std::unique_ptr<Queue>;
+  using Queues   = std::vector<QueuePtr>;
+  using Threads  = std::vector<std::thread>;
+
+  static std::atomic<std::size_t> &DefaultConcurrency();
+  static bool &                    IsWorkerThread();
+  static void                      Execute(Task const &task);
+
+  void Submit(Job &job, std::size_t begin, std::size_t end, std::size_t chunks);
+  void Work(std::size_t index);
+  bool Pop(std::size_t index, Task &task);
+  bool Steal(std::size_t index, Task &task);
+
+  std::size_t const        concurrency_;  ///< The number of threads (including the caller)
+  Queues                   queues_;       ///< The task queue of each worker
+  std::atomic<std::size_t> queued_{0};    ///< The number of tasks across all the queues
+  std::atomic<std::size_t> next_queue_{0};
+  std::atomic<bool>        running_{true};
+  Mutex                    sleep_lock_;
+  Condition                wake_;
+  Threads                  workers_;
+};
+
+/**
+ * Construct the pool
+ *
+ * @param concurrency The number of threads working on each parallel region (including the caller)
+ */
+inline ComputePool::ComputePool(std::size_t concurrency)
+  : concurrency_{std::max<std::size_t>(concurrency, 1u)}
+{
+  for (std::size_t i = 1; i < concurrency_; ++i)
+  {
+    queues_.emplace_back(std::make_unique<Queue>());
+  }
+
+  for (std::size_t i = 0; i < queues_.size(); ++i)
+  {
+    workers_.emplace_back([this, i]() {
+      SetThreadName("compute", i);
+      IsWorkerThread() = true;
+
+      Work(i);
+    });
+  }
+}
+
+inline ComputePool::~ComputePool()
+{
+  {
+    std::lock_guard<Mutex> lock(sleep_lock_);
+    running_ = false;
+  }
+  wake_.notify_all();
+
+  for (auto &worker : workers_)
+  {
+    worker.join();
+  }
+}
+
+/**
+ * Get the process wide compute pool
+ *
+ * @return The pool
+ */
+inline ComputePool &ComputePool::Instance()
+{
+  static ComputePool pool{DefaultConcurrency()};
+  return pool;
+}
+
+/**
+ * Set the number of threads used by the process wide compute pool. Only effective if called
+ * before the pool is first used.
+ *
+ * @param concurrency The number of threads (including the caller)
+ */
+inline void ComputePool::SetDefaultConcurrency(std::size_t concurrency)
+{
+  DefaultConcurrency() = concurrency;
+}
+
+/**
+ * Execute the function over the range [begin, end) in parallel. The function is called with
+ * disjoint sub ranges (begin, end) which together cover the range. The range is split into no
+ * more than CHUNKS_PER_THREAD sub ranges per thread, each of roughly grain items or more.
+ *
+ * @param begin The start of the range
+ * @param end The end of the range (exclusive)
+ * @param grain The minimum (useful) size of a sub range
+ * @param function The function to be called for each sub range
+ */
+template <typename F>
+void ComputePool::ParallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                              F &&function)
+{
+  using Function = typename std::remove_reference<F>::type;
+
+  if (end <= begin)
+  {
+    return;
+  }
+
+  std::size_t const length = end - begin;
+  std::size_t const step   = std::max<std::size_t>(grain, 1u);
+  std::size_t const chunks =
+      std::min((length + step - 1u) / step, CHUNKS_PER_THREAD * concurrency_);
+
+  if ((chunks <= 1u) || workers_.empty() || IsWorkerThread())
+  {
+    function(begin, end);
+    return;
+  }
+
+  Job job{};
+  job.invoke = [](void *context, std::size_t b, std::size_t e) {
+    (*static_cast<Function *>(context))(b, e);
+  };
+  job.context = const_cast<void *>(static_cast<void const *>(&function));
+  job.pending = chunks;
+
+  Submit(job, begin, end, chunks);
+
+  // help out until all the chunks of this job are complete
+  while (job.pending.load(std::memory_order_acquire) != 0)
+  {
+    Task task{};
+    if (Steal(queues_.size(), task))
+    {
+      Execute(task);
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  if (job.error)
+  {
+    std::rethrow_exception(job.error);
+  }
+}
+
+/**
+ * Get the number of threads working on each parallel region (including the caller)
+ *
+ * @return The number of threads
+ */
+inline std::size_t ComputePool::concurrency() const
+{
+  return concurrency_;
+}
+
+/**
+ * Internal: Get the configured size of the process wide pool
+ */
+inline std::atomic<std::size_t> &ComputePool::DefaultConcurrency()
+{
+  static std::atomic<std::size_t> concurrency{[]() -> std::size_t {
+    char const *value = std::getenv("FETCH_COMPUTE_THREADS");
+    if (value != nullptr)
+    {
+      auto const parsed = std::strtoul(value, nullptr, 10);
+      if (parsed > 0)
+      {
+        return static_cast<std::size_t>(parsed);
+      }
+    }
+
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1u);
+  }()};
+
+  return concurrency;
+}
+
+/**
+ * Internal: Flag signalling that the current thread is one of the workers of a pool
+ */
+inline bool &ComputePool::IsWorkerThread()
+{
+  static thread_local bool is_worker = false;
+  return is_worker;
+}
+
+/**
+ * Internal: Run a chunk of a job, recording any exception raised
+ */
+inline void ComputePool::Execute(Task const &task)
+{
+  Job &job = *task.job;
+
+  try
+  {
+    job.invoke(job.context, task.begin, task.end);
+  }
+  catch (...)
+  {
+    std::lock_guard<Mutex> lock(job.error_lock);
+    if (!job.error)
+    {
+      job.error = std::current_exception();
+    }
+  }
+
+  // must be the last access to the job, the submitting thread may return as soon as it completes
+  job.pending.fetch_sub(1u, std::memory_order_acq_rel);
+}
+
+/**
+ * Internal: Split the range into chunks and distribute them over the worker queues
+ */
+inline void ComputePool::Submit(Job &job, std::size_t begin, std::size_t end, std::size_t chunks)
+{
+  std::size_t const length    = end - begin;
+  std::size_t const base      = length / chunks;
+  std::size_t const remainder = length % chunks;
+  std::size_t const first     = next_queue_.fetch_add(1u, std::memory_order_relaxed);
+
+  // the tasks are counted before they are queued, so that a worker taking one can never bring the
+  // count below the number of tasks which are actually queued
+  {
+    std::lock_guard<Mutex> lock(sleep_lock_);
+    queued_.fetch_add(chunks, std::memory_order_release);
+  }
+
+  std::size_t start = begin;
+  for (std::size_t i = 0; i < chunks; ++i)
+  {
+    std::size_t const size = base + ((i < remainder) ? 1u : 0u);
+
+    auto &queue = *queues_[(first + i) % queues_.size()];
+    {
+      std::lock_guard<Mutex> lock(queue.lock);
+      queue.tasks.push_back(Task{&job, start, start + size});
+    }
+
+    start += size;
+  }
+
+  wake_.notify_all();
+}
+
+/**
+ * Internal: The main loop of a worker thread
+ */
+inline void ComputePool::Work(std::size_t index)
+{
+  while (running_)
+  {
+    Task task{};
+    if (Pop(index, task) || Steal(index, task))
+    {
+      Execute(task);
+      continue;
+    }
+
+    std::unique_lock<Mutex> lock(sleep_lock_);
+    wake_.wait(lock, [this]() {
+      return !running_ || (queued_.load(std::memory_order_acquire) != 0);
+    });
+  }
+}
+
+/**
+ * Internal: Take the most recently queued task from the worker's own queue
+ */
+inline bool ComputePool::Pop(std::size_t index, Task &task)
+{
+  auto &queue = *queues_[index];
+
+  std::lock_guard<Mutex> lock(queue.lock);
+  if (queue.tasks.empty())
+  {
+    return false;
+  }
+
+  task = queue.tasks.back();
+  queue.tasks.pop_back();
+  queued_.fetch_sub(1u, std::memory_order_relaxed);
+
+  return true;
+}
+
+/**
+ * Internal: Take the oldest task from one of the other queues (index may be past the end of the
+ * queues when called from a thread which is not a worker)
+ */
+inline bool ComputePool::Steal(std::size_t index, Task &task)
+{
+  for (std::size_t i = 1; i <= queues_.size(); ++i)
+  {
+    auto &queue = *queues_[(index + i) % queues_.size()];
+
+    std::lock_guard<Mutex> lock(queue.lock);
+    if (!queue.tasks.empty())
+    {
+      task = queue.tasks.front();
+      queue.tasks.pop_front();
+      queued_.fetch_sub(1u, std::memory_order_relaxed);
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace threading
+}  // namespace fetch
@@ -0,0 +1,277 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/fixed_point/fixed_point.hpp"
+#include "vectorise/vectorise.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace {
+
+using namespace fetch::vectorize;
+using fetch::fixed_point::fp32_t;
+using fetch::fixed_point::fp64_t;
+
+template <typename T>
+class FixedPointRegisterTest : public ::testing::Test
+{
+};
+
+using RegisterTypes = ::testing::Types<VectorRegister<fp32_t, 128>, VectorRegister<fp64_t, 128>>;
+TYPED_TEST_CASE(FixedPointRegisterTest, RegisterTypes);
+
+/**
+ * Random underlying integers biased towards the interesting ones: small values, values around the
+ * integer range, the special values and the limits
+ */
+template <typename T>
+class Generator
+{
+public:
+  using BaseType = typename T::Type;
+
+  BaseType operator()()
+  {
+    constexpr int BITS = int(sizeof(BaseType) * 8);
+
+    switch (rng_() % 8)
+    {
+    case 0:
+      return BaseType(rng_());
+    case 1:
+    {
+      BaseType const values[] = {T::NaN.Data(), T::POSITIVE_INFINITY.Data(),
+                                 T::NEGATIVE_INFINITY.Data(), T::MIN, T::MAX, 0,
+                                 std::numeric_limits<BaseType>::min(), BaseType(T::ONE_MASK)};
+      return values[rng_() % 8];
+    }
+    case 2:
+      return BaseType(BaseType(rng_()) >> (rng_() % BITS));
+    default:
+      return BaseType(BaseType(rng_()) >> (BITS / 2 + 10 - int(rng_() % 20)));
+    }
+  }
+
+private:
+  std::mt19937_64 rng_{42};
+};
+
+/**
+ * The values and the fp_state of a register function of two registers must be those of the scalar
+ * function evaluated element by element
+ */
+template <typename R, typename V, typename S>
+::testing::AssertionResult Equivalent(typename R::type const *a, typename R::type const *b,
+                                      V &&vector, S &&scalar)
+{
+  using Type = typename R::type;
+
+  typename Type::Type expected[R::E_BLOCK_COUNT];
+
+  Type::fp_state = 0;
+  for (std::size_t i = 0; i < std::size_t(R::E_BLOCK_COUNT); ++i)
+  {
+    // copy constructed, as assigning a NaN flags the state
+    expected[i] = Type(scalar(a[i], b[i])).Data();
+  }
+  uint32_t const expected_state = Type::fp_state;
+
+  Type::fp_state = 0;
+  alignas(16) Type actual[R::E_BLOCK_COUNT];
+  vector(R(a), R(b)).Store(actual);
+  uint32_t const actual_state = Type::fp_state;
+
+  for (std::size_t i = 0; i < std::size_t(R::E_BLOCK_COUNT); ++i)
+  {
+    if ((actual[i].Data() != expected[i]) || (actual_state != expected_state))
+    {
+      return ::testing::AssertionFailure()
+             << "element " << i << " of (" << a[i].Data() << ", " << b[i].Data() << ") is "
+             << actual[i].Data() << " (state " << actual_state << ") expected " << expected[i]
+             << " (state " << expected_state << ")";
+    }
+  }
+
+  return ::testing::AssertionSuccess();
+}
+
+/**
+ * The values and the fp_state of a register function must be those of the scalar function
+ * evaluated element by element
+ */
+template <typename R, typename V, typename S>
+::testing::AssertionResult Equivalent(typename R::type const *values, V &&vector, S &&scalar)
+{
+  using Type = typename R::type;
+
+  return Equivalent<R>(values, values, [&vector](R const &x, R const &) { return vector(x); },
+                       [&scalar](Type const &x, Type const &) { return scalar(x); });
+}
+
+TYPED_TEST(FixedPointRegisterTest, operators_match_scalar)
+{
+  using Type = typename TypeParam::type;
+  using R    = TypeParam;
+
+  Generator<Type> generate;
+
+  for (std::size_t iteration = 0; iteration < 100000; ++iteration)
+  {
+    alignas(16) Type a[R::E_BLOCK_COUNT];
+    alignas(16) Type b[R::E_BLOCK_COUNT];
+    for (std::size_t i = 0; i < std::size_t(R::E_BLOCK_COUNT); ++i)
+    {
+      a[i] = Type::FromBase(generate());
+      b[i] = Type::FromBase(generate());
+    }
+
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x + y; },
+                              [](Type const &x, Type const &y) { return x + y; }));
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x - y; },
+                              [](Type const &x, Type const &y) { return x - y; }));
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x * y; },
+                              [](Type const &x, Type const &y) { return x * y; }));
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x / y; },
+                              [](Type const &x, Type const &y) { return x / y; }));
+    ASSERT_TRUE(
+        Equivalent<R>(a, [](R const &x) { return -x; }, [](Type const &x) { return -x; }));
+
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x == y; },
+                              [](Type const &x, Type const &y) {
+                                return (x == y) ? Type::_1 : Type::_0;
+                              }));
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x != y; },
+                              [](Type const &x, Type const &y) {
+                                return (x != y) ? Type::_1 : Type::_0;
+                              }));
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x < y; },
+                              [](Type const &x, Type const &y) {
+                                return (x < y) ? Type::_1 : Type::_0;
+                              }));
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x <= y; },
+                              [](Type const &x, Type const &y) {
+                                return (x <= y) ? Type::_1 : Type::_0;
+                              }));
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x > y; },
+                              [](Type const &x, Type const &y) {
+                                return (x > y) ? Type::_1 : Type::_0;
+                              }));
+    ASSERT_TRUE(Equivalent<R>(a, b, [](R const &x, R const &y) { return x >= y; },
+                              [](Type const &x, Type const &y) {
+                                return (x >= y) ? Type::_1 : Type::_0;
+                              }));
+  }
+}
+
+/**
+ * The scalar sigmoid, evaluated as fetch::math::Sigmoid does
+ */
+template <typename Type>
+Type Sigmoid(Type x)
+{
+  if (x >= Type::_0)
+  {
+    return Type::_1 / (Type::Exp(Type{-1} * x) + Type::_1);
+  }
+
+  Type const e = Type::Exp(x);
+  return e / (e + Type::_1);
+}
+
+/**
+ * Check the kernels against the scalar functions over consecutive underlying integers in
+ * [first, last) and random registers
+ */
+template <typename R>
+void CheckKernels(typename R::type::Type first, typename R::type::Type last, std::size_t count)
+{
+  using Type     = typename R::type;
+  using BaseType = typename Type::Type;
+
+  auto const check = [](Type const *values) {
+    ASSERT_TRUE(Equivalent<R>(values, [](R const &x) { return exp(x); },
+                              [](Type x) { return Type::Exp(x); }));
+    ASSERT_TRUE(Equivalent<R>(values, [](R const &x) { return log(x); },
+                              [](Type x) { return Type::Log(x); }));
+    ASSERT_TRUE(Equivalent<R>(values, [](R const &x) { return tanh(x); },
+                              [](Type x) { return Type::TanH(x); }));
+    ASSERT_TRUE(Equivalent<R>(values, [](R const &x) { return sigmoid(x); },
+                              [](Type x) { return Sigmoid(x); }));
+  };
+
+  alignas(16) Type values[R::E_BLOCK_COUNT];
+
+  for (BaseType base = first; base < last; base += BaseType(R::E_BLOCK_COUNT))
+  {
+    for (std::size_t i = 0; i < std::size_t(R::E_BLOCK_COUNT); ++i)
+    {
+      values[i] = Type::FromBase(BaseType(base + BaseType(i)));
+    }
+    check(values);
+    if (::testing::Test::HasFatalFailure())
+    {
+      return;
+    }
+  }
+
+  Generator<Type> generate;
+  for (std::size_t iteration = 0; iteration < count; ++iteration)
+  {
+    for (auto &value : values)
+    {
+      value = Type::FromBase(generate());
+    }
+    check(values);
+    if (::testing::Test::HasFatalFailure())
+    {
+      return;
+    }
+  }
+}
+
+TEST(FixedPointRegisterKernelTest, kernels_match_scalar_16_16)
+{
+  using R = VectorRegister<fp32_t, 128>;
+
+  // every value in [-12, 12), beyond the exp domain either side
+  CheckKernels<R>(-12 * 65536, 12 * 65536, 200000);
+}
+
+TEST(FixedPointRegisterKernelTest, kernels_match_scalar_32_32)
+{
+  using R = VectorRegister<fp64_t, 128>;
+
+  int64_t const window   = int64_t(1) << 17;
+  int64_t const max_exp  = fp64_t::MAX_EXP.Data();
+  int64_t const boundary = (fp64_t::MAX_EXP - fp64_t{0.5}).Data();
+
+  // the values around 0, the bounds of the exp domain and the limits of the kernels
+  CheckKernels<R>(-window, window, 0);
+  CheckKernels<R>(-max_exp - window, -max_exp + window, 0);
+  CheckKernels<R>(-boundary - window, -boundary + window, 0);
+  CheckKernels<R>(boundary - window, boundary + window, 0);
+  CheckKernels<R>(max_exp - window, max_exp + window, 0);
+  CheckKernels<R>(0, 0, 200000);
+}
+
+}  // namespace
@@ -0,0 +1,282 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/vectorise.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using namespace fetch::vectorize;
+
+template <typename T>
+class VectoriseRegisterTest : public ::testing::Test
+{
+};
+
+// the wider registers are only available when the compiler targets them
+using RegisterTypes = ::testing::Types<VectorRegister<float, 128>, VectorRegister<double, 128>
+#ifdef __AVX__
+                                       ,
+                                       VectorRegister<float, 256>, VectorRegister<double, 256>
+#endif
+#ifdef __AVX512F__
+                                       ,
+                                       VectorRegister<float, 512>, VectorRegister<double, 512>
+#endif
+                                       >;
+TYPED_TEST_CASE(VectoriseRegisterTest, RegisterTypes);
+
+constexpr std::size_t MAX_ELEMENTS = 16;
+
+/**
+ * Load the values of the function into a register, element i being function(i)
+ */
+template <typename R, typename F>
+R Load(F &&function)
+{
+  using Type = typename R::type;
+
+  alignas(64) Type values[MAX_ELEMENTS];
+  for (std::size_t i = 0; i < std::size_t(R::E_BLOCK_COUNT); ++i)
+  {
+    values[i] = function(Type(i));
+  }
+
+  return R(values);
+}
+
+TYPED_TEST(VectoriseRegisterTest, arithmetic)
+{
+  using Type             = typename TypeParam::type;
+  constexpr std::size_t N = TypeParam::E_BLOCK_COUNT;
+
+  auto const a = Load<TypeParam>([](Type i) { return i + Type(1); });
+  auto const b = Load<TypeParam>([](Type i) { return Type(2) * i - Type(5); });
+
+  alignas(64) Type sum[MAX_ELEMENTS];
+  alignas(64) Type difference[MAX_ELEMENTS];
+  alignas(64) Type product[MAX_ELEMENTS];
+  alignas(64) Type quotient[MAX_ELEMENTS];
+  alignas(64) Type negated[MAX_ELEMENTS];
+  (a + b).Store(sum);
+  (a - b).Store(difference);
+  (a * b).Store(product);
+  (b / a).Store(quotient);
+  (-a).Store(negated);
+
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    Type const x = Type(i) + Type(1);
+    Type const y = Type(2) * Type(i) - Type(5);
+
+    EXPECT_EQ(x + y, sum[i]);
+    EXPECT_EQ(x - y, difference[i]);
+    EXPECT_EQ(x * y, product[i]);
+    EXPECT_EQ(y / x, quotient[i]);
+    EXPECT_EQ(-x, negated[i]);
+  }
+}
+
+TYPED_TEST(VectoriseRegisterTest, comparisons)
+{
+  using Type             = typename TypeParam::type;
+  constexpr std::size_t N = TypeParam::E_BLOCK_COUNT;
+
+  // alternate between less than, equal to and greater than
+  auto const a = Load<TypeParam>([](Type i) { return i; });
+  auto const b = Load<TypeParam>([](Type i) { return i + Type((int(i) + 2) % 3) - Type(1); });
+
+  alignas(64) Type equal[MAX_ELEMENTS];
+  alignas(64) Type not_equal[MAX_ELEMENTS];
+  alignas(64) Type less[MAX_ELEMENTS];
+  alignas(64) Type less_equal[MAX_ELEMENTS];
+  alignas(64) Type greater[MAX_ELEMENTS];
+  alignas(64) Type greater_equal[MAX_ELEMENTS];
+  (a == b).Store(equal);
+  (a != b).Store(not_equal);
+  (a < b).Store(less);
+  (a <= b).Store(less_equal);
+  (a > b).Store(greater);
+  (a >= b).Store(greater_equal);
+
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    Type const x = Type(i);
+    Type const y = Type(i) + Type((int(i) + 2) % 3) - Type(1);
+
+    EXPECT_EQ(Type(x == y), equal[i]);
+    EXPECT_EQ(Type(x != y), not_equal[i]);
+    EXPECT_EQ(Type(x < y), less[i]);
+    EXPECT_EQ(Type(x <= y), less_equal[i]);
+    EXPECT_EQ(Type(x > y), greater[i]);
+    EXPECT_EQ(Type(x >= y), greater_equal[i]);
+  }
+
+  EXPECT_TRUE(any_less_than(a, b));
+  EXPECT_FALSE(all_less_than(a, b));
+  EXPECT_TRUE(all_less_than(a, a + TypeParam(Type(1))));
+  EXPECT_FALSE(any_less_than(a, a));
+}
+
+TYPED_TEST(VectoriseRegisterTest, element_manipulation)
+{
+  using Type     = typename TypeParam::type;
+  constexpr int N = TypeParam::E_BLOCK_COUNT;
+
+  auto const a = Load<TypeParam>([](Type i) { return i + Type(1); });
+
+  EXPECT_EQ(Type(1), first_element(a));
+  EXPECT_EQ(Type(N * (N + 1) / 2), reduce(a));
+
+  alignas(64) Type left[MAX_ELEMENTS];
+  alignas(64) Type right[MAX_ELEMENTS];
+  shift_elements_left(a).Store(left);
+  shift_elements_right(a).Store(right);
+
+  for (int i = 0; i < N; ++i)
+  {
+    EXPECT_EQ((i == 0) ? Type(0) : Type(i), left[i]);
+    EXPECT_EQ((i == N - 1) ? Type(0) : Type(i + 2), right[i]);
+  }
+
+  for (int n = 0; n < N; ++n)
+  {
+    alignas(64) Type below[MAX_ELEMENTS];
+    alignas(64) Type above[MAX_ELEMENTS];
+    vector_zero_below_element(a, n).Store(below);
+    vector_zero_above_element(a, n).Store(above);
+
+    for (int i = 0; i < N; ++i)
+    {
+      EXPECT_EQ((i >= n) ? Type(i + 1) : Type(0), below[i]);
+      EXPECT_EQ((i <= n) ? Type(i + 1) : Type(0), above[i]);
+    }
+  }
+}
+
+TYPED_TEST(VectoriseRegisterTest, math_functions)
+{
+  using Type             = typename TypeParam::type;
+  using SseRegister      = VectorRegister<Type, 128>;
+  constexpr std::size_t N = TypeParam::E_BLOCK_COUNT;
+  constexpr std::size_t M = SseRegister::E_BLOCK_COUNT;
+
+  auto const value = [](Type i) { return (i - Type(3)) * Type(0.75); };
+  auto const a     = Load<TypeParam>(value);
+  auto const b     = Load<TypeParam>([](Type i) { return Type(1) - i * Type(0.5); });
+
+  alignas(64) Type maximum[MAX_ELEMENTS];
+  alignas(64) Type minimum[MAX_ELEMENTS];
+  alignas(64) Type absolute[MAX_ELEMENTS];
+  alignas(64) Type root[MAX_ELEMENTS];
+  alignas(64) Type exponential[MAX_ELEMENTS];
+  alignas(64) Type logarithm[MAX_ELEMENTS];
+  max(a, b).Store(maximum);
+  min(a, b).Store(minimum);
+  abs(a).Store(absolute);
+  sqrt(abs(a)).Store(root);
+  approx_exp(a).Store(exponential);
+  approx_log(abs(a) + TypeParam(Type(1))).Store(logarithm);
+
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    Type const x = value(Type(i));
+    Type const y = Type(1) - Type(i) * Type(0.5);
+
+    EXPECT_EQ(std::max(x, y), maximum[i]);
+    EXPECT_EQ(std::min(x, y), minimum[i]);
+    EXPECT_EQ(std::abs(x), absolute[i]);
+    EXPECT_EQ(std::sqrt(std::abs(x)), root[i]);
+  }
+
+  // the approximations must be identical to the SSE ones, element by element
+  for (std::size_t offset = 0; offset < N; offset += M)
+  {
+    auto const x = Load<SseRegister>([&](Type i) { return value(i + Type(offset)); });
+
+    alignas(64) Type expected_exponential[MAX_ELEMENTS];
+    alignas(64) Type expected_logarithm[MAX_ELEMENTS];
+    approx_exp(x).Store(expected_exponential);
+    approx_log(abs(x) + SseRegister(Type(1))).Store(expected_logarithm);
+
+    for (std::size_t i = 0; i < M; ++i)
+    {
+      EXPECT_EQ(expected_exponential[i], exponential[offset + i]);
+      EXPECT_EQ(expected_logarithm[i], logarithm[offset + i]);
+    }
+  }
+}
+
+template <std::size_t S>
+void CheckIntegerRegister()
+{
+  using Register          = VectorRegister<int32_t, S>;
+  constexpr std::size_t N = Register::E_BLOCK_COUNT;
+
+  auto const a = Load<Register>([](int32_t i) { return (i * 7) - 20; });
+  auto const b = Load<Register>([](int32_t i) { return (i % 3) - 1; });
+
+  alignas(64) int32_t sum[MAX_ELEMENTS];
+  alignas(64) int32_t product[MAX_ELEMENTS];
+  alignas(64) int32_t quotient[MAX_ELEMENTS];
+  alignas(64) int32_t equal[MAX_ELEMENTS];
+  alignas(64) int32_t less[MAX_ELEMENTS];
+  alignas(64) int32_t left[MAX_ELEMENTS];
+  alignas(64) int32_t right[MAX_ELEMENTS];
+  (a + b).Store(sum);
+  (a * b).Store(product);
+  (a / b).Store(quotient);
+  (a == b).Store(equal);
+  (b < a).Store(less);
+  shift_elements_left(a).Store(left);
+  shift_elements_right(a).Store(right);
+
+  EXPECT_EQ(-20, first_element(a));
+
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    int32_t const x = (int32_t(i) * 7) - 20;
+    int32_t const y = (int32_t(i) % 3) - 1;
+
+    EXPECT_EQ(x + y, sum[i]);
+    EXPECT_EQ(x * y, product[i]);
+    EXPECT_EQ((y != 0) ? (x / y) : 0, quotient[i]);
+    EXPECT_EQ((x == y) ? -1 : 0, equal[i]);
+    EXPECT_EQ((y < x) ? -1 : 0, less[i]);
+    EXPECT_EQ((i == 0) ? 0 : x - 7, left[i]);
+    EXPECT_EQ((i == N - 1) ? 0 : x + 7, right[i]);
+  }
+}
+
+TEST(VectoriseIntegerRegisterTest, integer_registers)
+{
+  CheckIntegerRegister<128>();
+#ifdef __AVX2__
+  CheckIntegerRegister<256>();
+#endif
+#ifdef __AVX512F__
+  CheckIntegerRegister<512>();
+#endif
+}
+
+}  // namespace
@@ -0,0 +1,179 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vectorise/threading/compute_pool.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::threading::ComputePool;
+
+TEST(ComputePoolTests, RangeIsCoveredExactlyOnce)
+{
+  ComputePool pool{4};
+
+  std::vector<std::atomic<uint32_t>> counts(10007);
+  for (auto &count : counts)
+  {
+    count = 0;
+  }
+
+  pool.ParallelFor(0, counts.size(), 16, [&counts](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      ++counts[i];
+    }
+  });
+
+  for (auto const &count : counts)
+  {
+    EXPECT_EQ(1u, count.load());
+  }
+}
+
+TEST(ComputePoolTests, WorkIsSpreadOverThreads)
+{
+  ComputePool pool{4};
+
+  std::mutex                lock;
+  std::set<std::thread::id> threads;
+  std::atomic<std::size_t>  started{0};
+  std::size_t const         chunks = ComputePool::CHUNKS_PER_THREAD * pool.concurrency();
+
+  pool.ParallelFor(0, chunks, 1, [&](std::size_t, std::size_t) {
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      threads.insert(std::this_thread::get_id());
+    }
+
+    // hold each chunk until every thread has had the chance to pick one up
+    ++started;
+    for (std::size_t i = 0; (i < 1000) && (started < pool.concurrency()); ++i)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  EXPECT_EQ(pool.concurrency(), threads.size());
+}
+
+TEST(ComputePoolTests, SmallRangesRunOnTheCallingThread)
+{
+  ComputePool pool{4};
+
+  std::thread::id executor{};
+  pool.ParallelFor(0, 100, 1000, [&executor](std::size_t begin, std::size_t end) {
+    EXPECT_EQ(0u, begin);
+    EXPECT_EQ(100u, end);
+
+    executor = std::this_thread::get_id();
+  });
+
+  EXPECT_EQ(std::this_thread::get_id(), executor);
+}
+
+TEST(ComputePoolTests, NestedRegionsAreExecutedInline)
+{
+  ComputePool pool{4};
+
+  std::atomic<std::size_t> total{0};
+  pool.ParallelFor(0, 64, 1, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      pool.ParallelFor(0, 100, 1, [&total](std::size_t b, std::size_t e) { total += (e - b); });
+    }
+  });
+
+  EXPECT_EQ(6400u, total.load());
+}
+
+TEST(ComputePoolTests, ExceptionsArePropagatedToTheCaller)
+{
+  ComputePool pool{4};
+
+  std::atomic<std::size_t> completed{0};
+  auto const               run = [&]() {
+    pool.ParallelFor(0, 1000, 1, [&completed](std::size_t begin, std::size_t end) {
+      if ((begin <= 500) && (500 < end))
+      {
+        throw std::runtime_error("failed chunk");
+      }
+
+      completed += (end - begin);
+    });
+  };
+
+  EXPECT_THROW(run(), std::runtime_error);
+
+  // all the other chunks have completed before the exception is rethrown
+  EXPECT_GT(completed.load(), 0u);
+  EXPECT_LT(completed.load(), 1000u);
+}
+
+TEST(ComputePoolTests, SingleThreadedPoolRunsInline)
+{
+  ComputePool pool{1};
+
+  std::size_t calls = 0;
+  pool.ParallelFor(0, 1000, 1, [&calls](std::size_t begin, std::size_t end) {
+    EXPECT_EQ(0u, begin);
+    EXPECT_EQ(1000u, end);
+    ++calls;
+  });
+
+  EXPECT_EQ(1u, calls);
+}
+
+TEST(ComputePoolTests, ConcurrentCallers)
+{
+  ComputePool pool{4};
+
+  std::atomic<std::size_t> total{0};
+
+  std::vector<std::thread> callers;
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    callers.emplace_back([&pool, &total]() {
+      for (std::size_t j = 0; j < 50; ++j)
+      {
+        pool.ParallelFor(0, 1000, 10,
+                         [&total](std::size_t begin, std::size_t end) { total += (end - begin); });
+      }
+    });
+  }
+
+  for (auto &caller : callers)
+  {
+    caller.join();
+  }
+
+  EXPECT_EQ(4u * 50u * 1000u, total.load());
+}
+
+}  // namespace
@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/compiler.hpp"
+#include "vm/ir.hpp"
+#include "vm/module.hpp"
+#include "vm/variant.hpp"
+#include "vm/vm.hpp"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using fetch::vm::Compiler;
+using fetch::vm::Executable;
+using fetch::vm::IR;
+using fetch::vm::Module;
+using fetch::vm::Variant;
+using fetch::vm::VM;
+
+char const *INTEGER_LOOP = R"(
+  function main() : Int64
+    var total = 0i64;
+    for (i in 0:10000)
+      total = total + toInt64(i) * 3i64 - 1i64;
+    endfor
+    return total;
+  endfunction
+)";
+
+char const *FLOAT_LOOP = R"(
+  function main() : Float64
+    var total = 0.0;
+    var x = 1.0;
+    for (i in 0:10000)
+      x = x * 0.5 + 1.0;
+      total += x;
+    endfor
+    return total;
+  endfunction
+)";
+
+char const *WHILE_LOOP = R"(
+  function main() : Int32
+    var i = 0;
+    var count = 0;
+    while (i < 10000)
+      if ((i % 3) == 0)
+        count = count + 1;
+      endif
+      i = i + 1;
+    endwhile
+    return count;
+  endfunction
+)";
+
+char const *ARRAY_LOOP = R"(
+  function main() : Int32
+    var values = Array<Int32>(100);
+    for (j in 0:100)
+      for (i in 0:100)
+        values[i] = values[i] + j;
+      endfor
+    endfor
+    return values[99];
+  endfunction
+)";
+
+char const *FUNCTION_CALLS = R"(
+  function square(x : Int32) : Int32
+    return x * x;
+  endfunction
+
+  function main() : Int32
+    var total = 0;
+    for (i in 0:10000)
+      total = total + square(i % 100);
+    endfor
+    return total;
+  endfunction
+)";
+
+class EtchProgram
+{
+public:
+  explicit EtchProgram(char const *source)
+  {
+    std::vector<std::string> errors;
+
+    Compiler compiler{&module_};
+    IR       ir;
+    if (!compiler.Compile(source, "benchmark", ir, errors))
+    {
+      throw std::runtime_error("Unable to compile benchmark program");
+    }
+
+    vm_ = std::make_unique<VM>(&module_);
+    if (!vm_->GenerateExecutable(ir, "benchmark_ir", executable_, errors))
+    {
+      throw std::runtime_error("Unable to generate benchmark executable");
+    }
+  }
+
+  bool Run()
+  {
+    std::string error;
+    Variant     output;
+    return vm_->Execute(executable_, "main", error, output);
+  }
+
+  uint64_t CountInstructions()
+  {
+    vm_->SetInstructionCounting(true);
+    uint64_t const start = vm_->instruction_count();
+    Run();
+    vm_->SetInstructionCounting(false);
+
+    return vm_->instruction_count() - start;
+  }
+
+private:
+  Module              module_{};
+  Executable          executable_{};
+  std::unique_ptr<VM> vm_{};
+};
+
+void RunProgram(benchmark::State &state, char const *source)
+{
+  EtchProgram program{source};
+
+  auto const instructions_per_run = static_cast<double>(program.CountInstructions());
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(program.Run());
+  }
+
+  state.counters["instructions/s"] = benchmark::Counter(
+      instructions_per_run * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+void Etch_IntegerLoop(benchmark::State &state)
+{
+  RunProgram(state, INTEGER_LOOP);
+}
+
+void Etch_FloatLoop(benchmark::State &state)
+{
+  RunProgram(state, FLOAT_LOOP);
+}
+
+void Etch_WhileLoop(benchmark::State &state)
+{
+  RunProgram(state, WHILE_LOOP);
+}
+
+void Etch_ArrayLoop(benchmark::State &state)
+{
+  RunProgram(state, ARRAY_LOOP);
+}
+
+void Etch_FunctionCalls(benchmark::State &state)
+{
+  RunProgram(state, FUNCTION_CALLS);
+}
+
+}  // namespace
+
+BENCHMARK(Etch_IntegerLoop);
+BENCHMARK(Etch_FloatLoop);
+BENCHMARK(Etch_WhileLoop);
+BENCHMARK(Etch_ArrayLoop);
+BENCHMARK(Etch_FunctionCalls);
@@ -213,6 +213,8 @@ class Ptr;
 class Object;
 
 using Handler                   = std::function<void(VM *)>;
+using OpcodeHandler             = void (*)(VM *);
+using OpcodeHandlerArray        = std::vector<OpcodeHandler>;
 using DefaultConstructorHandler = std::function<Ptr<Object>(VM *, TypeId)>;
 
 struct FunctionInfo
@@ -177,14 +177,15 @@ struct Executable
       auto it = pc_to_line_map_.lower_bound(uint16_t(pc + 1));
       return (--it)->second;
     }
-    std::string      name;
-    AnnotationArray  annotations;
-    int              num_variables;  // parameters + locals
-    int              num_parameters;
-    TypeId           return_type_id;
-    VariableArray    variables;  // parameters + locals
-    InstructionArray instructions;
-    PcToLineMap      pc_to_line_map_;
+    std::string        name;
+    AnnotationArray    annotations;
+    int                num_variables;  // parameters + locals
+    int                num_parameters;
+    TypeId             return_type_id;
+    VariableArray      variables;  // parameters + locals
+    InstructionArray   instructions;
+    PcToLineMap        pc_to_line_map_;
+    OpcodeHandlerArray handlers;  // pre-resolved handler per instruction, empty if unresolved
   };
   using FunctionArray = std::vector<Function>;
 
@@ -356,6 +357,7 @@ private:
                                TypeId rhs_type_id, uint16_t opcode1, uint16_t opcode2,
                                uint16_t opcode3, uint16_t opcode4, TypeId &type_id,
                                TypeId &other_type_id);
+  void     FuseInstructions(Executable::Function &function);
 
   friend class VM;
 };
@@ -312,6 +312,8 @@ public:
     return ClassInterface<Type>(this, type_index);
   }
 
+  void RegisterBindings();
+
 private:
   void CompilerSetup(Compiler *compiler)
   {
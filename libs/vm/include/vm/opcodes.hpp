@@ -101,7 +101,31 @@ static const uint16_t VariableObjectInplaceDivide        = 74;
 static const uint16_t VariableObjectInplaceRightDivide   = 75;
 static const uint16_t PrimitiveModulo                    = 76;
 static const uint16_t VariablePrimitiveInplaceModulo     = 77;
-static const uint16_t NumReserved                        = 78;
+
+// Superinstructions, each executing a sequence of the opcodes above in a single dispatch
+static const uint16_t PushVariablePushConstant                               = 78;
+static const uint16_t PushVariablePushVariable                               = 79;
+static const uint16_t PushConstantPrimitiveAdd                               = 80;
+static const uint16_t PushConstantPrimitiveSubtract                          = 81;
+static const uint16_t PushConstantPrimitiveMultiply                          = 82;
+static const uint16_t PushConstantPrimitiveModulo                            = 83;
+static const uint16_t PrimitiveAddPopToVariable                              = 84;
+static const uint16_t PrimitiveSubtractPopToVariable                         = 85;
+static const uint16_t PrimitiveMultiplyPopToVariable                         = 86;
+static const uint16_t PushConstantVariablePrimitiveInplaceAdd                = 87;
+static const uint16_t PushConstantVariablePrimitiveInplaceSubtract           = 88;
+static const uint16_t PushVariableVariablePrimitiveInplaceAdd                = 89;
+static const uint16_t PrimitiveEqualJumpIfFalse                              = 90;
+static const uint16_t PrimitiveNotEqualJumpIfFalse                           = 91;
+static const uint16_t PrimitiveLessThanJumpIfFalse                           = 92;
+static const uint16_t PrimitiveLessThanOrEqualJumpIfFalse                    = 93;
+static const uint16_t PrimitiveGreaterThanJumpIfFalse                        = 94;
+static const uint16_t PrimitiveGreaterThanOrEqualJumpIfFalse                 = 95;
+static const uint16_t PopToVariableJump                                      = 96;
+static const uint16_t PushVariablePushConstantPrimitiveAddPopToVariable      = 97;
+static const uint16_t PushVariablePushConstantPrimitiveSubtractPopToVariable = 98;
+
+static const uint16_t NumReserved = 99;
 }  // namespace Opcodes
 
 }  // namespace vm
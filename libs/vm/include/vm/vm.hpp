@@ -244,6 +244,37 @@ public:
   bool GenerateExecutable(IR const &ir, std::string const &name, Executable &executable,
                           std::vector<std::string> &errors);
 
+  void Reset();
+  void ResolveOpcodeHandlers(Executable &executable) const;
+
+  /// @name Instrumentation
+  /// @{
+  struct OpcodePairStatistic
+  {
+    std::string first;   ///< The name of the first opcode
+    std::string second;  ///< The name of the opcode which immediately followed it
+    uint64_t    count;   ///< The number of times the pair was executed
+  };
+  using OpcodePairStatistics = std::vector<OpcodePairStatistic>;
+
+  void SetInstructionCounting(bool enabled)
+  {
+    instruction_counting_ = enabled;
+  }
+
+  uint64_t instruction_count() const
+  {
+    return instruction_count_;
+  }
+
+  void SetOpcodeStatistics(bool enabled)
+  {
+    opcode_statistics_ = enabled;
+  }
+
+  OpcodePairStatistics GetOpcodePairStatistics() const;
+  /// @}
+
   template <typename... Ts>
   bool Execute(Executable const &executable, std::string const &name, std::string &error,
                Variant &output, Ts const &... parameters)
@@ -334,6 +365,37 @@ public:
     return new T(this, GetTypeId<T>(), std::forward<Ts>(args)...);
   }
 
+  /**
+   * Set the (caller owned) context object for the subsequent executions. This allows modules which
+   * are shared between many users to lookup the details of the current caller.
+   *
+   * @tparam T The type of the context object
+   * @param context The pointer to the context object
+   */
+  template <typename T>
+  void SetContext(T *context)
+  {
+    context_      = context;
+    context_type_ = TypeIndex(typeid(T));
+  }
+
+  /**
+   * Lookup the context object for the current execution
+   *
+   * @tparam T The expected type of the context object
+   * @return The pointer to the context if present and of the correct type, otherwise nullptr
+   */
+  template <typename T>
+  T *GetContext() const
+  {
+    if (context_ && (context_type_ == TypeIndex(typeid(T))))
+    {
+      return static_cast<T *>(context_);
+    }
+
+    return nullptr;
+  }
+
   void SetIOObserver(IoObserverInterface &observer)
   {
     io_observer_ = &observer;
@@ -494,12 +556,19 @@ private:
       : name(std::move(name__))
       , handler(std::move(handler__))
     {}
+    OpcodeInfo(std::string name__, OpcodeHandler direct_handler__)
+      : name(std::move(name__))
+      , handler(direct_handler__)
+      , direct_handler(direct_handler__)
+    {}
 
-    std::string name;
-    Handler     handler;
+    std::string   name;
+    Handler       handler;
+    OpcodeHandler direct_handler{nullptr};  // only present for the built-in opcodes
   };
-  using OpcodeInfoArray = std::vector<OpcodeInfo>;
-  using OpcodeMap       = std::unordered_map<std::string, uint16_t>;
+  using OpcodeInfoArray  = std::vector<OpcodeInfo>;
+  using OpcodeMap        = std::unordered_map<std::string, uint16_t>;
+  using OpcodePairCounts = std::unordered_map<uint32_t, uint64_t>;
 
   struct Frame
   {
@@ -567,16 +636,53 @@ private:
   std::string                    error_;
   std::ostringstream             output_buffer_;
   IoObserverInterface *          io_observer_{nullptr};
+  void *                         context_{nullptr};
+  TypeIndex                      context_type_{typeid(void)};
   OutputDeviceMap                output_devices_;
   InputDeviceMap                 input_devices_;
   DeserializeConstructorMap      deserialization_constructors_;
+  Executable const *             prepared_executable_{nullptr};
+  std::size_t                    num_system_types_{0};
+  bool                           instruction_counting_{false};
+  uint64_t                       instruction_count_{0};
+  bool                           opcode_statistics_{false};
+  OpcodePairCounts               opcode_pair_counts_;
 
-  void AddOpcodeInfo(uint16_t opcode, std::string const &name, Handler const &handler)
+  void AddOpcodeInfo(uint16_t opcode, std::string const &name, OpcodeHandler handler)
   {
     opcode_info_array_[opcode] = OpcodeInfo(name, handler);
   }
 
+  void AddFunctionOpcodeInfo(uint16_t opcode, std::string const &name, Handler const &handler)
+  {
+    opcode_info_array_[opcode] = OpcodeInfo(name, handler);
+  }
+
+  void DispatchOpcode()
+  {
+    uint16_t const opcode = instruction_->opcode;
+    if ((opcode < opcode_info_array_.size()) && opcode_info_array_[opcode].handler)
+    {
+      opcode_info_array_[opcode].handler(this);
+    }
+    else
+    {
+      RuntimeError("unknown opcode");
+    }
+  }
+
+  // Move on to the next instruction of a superinstruction. Only the final instruction of a fused
+  // sequence is permitted to raise an error or transfer control, so no checks are needed here.
+  void NextFusedInstruction()
+  {
+    instruction_pc_ = pc_;
+    instruction_    = &function_->instructions[pc_++];
+  }
+
   bool Execute(std::string &error, Variant &output);
+  void ExecuteInstrumented();
+  void PrepareExecutable();
+  void ReleaseExecutable();
   void Destruct(uint16_t scope_number);
 
   TypeId FindType(std::string const &name) const
@@ -1594,6 +1700,27 @@ private:
   void Handler__VariableObjectInplaceRightDivide();
   void Handler__PrimitiveModulo();
   void Handler__VariablePrimitiveInplaceModulo();
+  void Handler__PushVariablePushConstant();
+  void Handler__PushVariablePushVariable();
+  void Handler__PushConstantPrimitiveAdd();
+  void Handler__PushConstantPrimitiveSubtract();
+  void Handler__PushConstantPrimitiveMultiply();
+  void Handler__PushConstantPrimitiveModulo();
+  void Handler__PrimitiveAddPopToVariable();
+  void Handler__PrimitiveSubtractPopToVariable();
+  void Handler__PrimitiveMultiplyPopToVariable();
+  void Handler__PushConstantVariablePrimitiveInplaceAdd();
+  void Handler__PushConstantVariablePrimitiveInplaceSubtract();
+  void Handler__PushVariableVariablePrimitiveInplaceAdd();
+  void Handler__PrimitiveEqualJumpIfFalse();
+  void Handler__PrimitiveNotEqualJumpIfFalse();
+  void Handler__PrimitiveLessThanJumpIfFalse();
+  void Handler__PrimitiveLessThanOrEqualJumpIfFalse();
+  void Handler__PrimitiveGreaterThanJumpIfFalse();
+  void Handler__PrimitiveGreaterThanOrEqualJumpIfFalse();
+  void Handler__PopToVariableJump();
+  void Handler__PushVariablePushConstantPrimitiveAddPopToVariable();
+  void Handler__PushVariablePushConstantPrimitiveSubtractPopToVariable();
 
   friend class Object;
   friend class Module;
@@ -0,0 +1,103 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace fetch {
+namespace vm {
+
+class Module;
+class VM;
+
+/**
+ * Pool of initialised VM instances for a single thread.
+ *
+ * Constructing a VM requires the module details and opcode tables to be rebuilt which, for small
+ * contracts, can take longer than running the contract itself. The pool retains a small number of
+ * idle VMs per module which are reset and handed out again on the next acquisition.
+ *
+ * The pool is not thread safe, each thread is expected to use its own instance.
+ */
+class VMPool
+{
+public:
+  using ModulePtr = std::shared_ptr<Module>;
+
+  class Releaser
+  {
+  public:
+    Releaser() = default;
+    Releaser(VMPool *pool, ModulePtr module);
+
+    void operator()(VM *vm) const;
+
+  private:
+    VMPool *  pool_{nullptr};
+    ModulePtr module_{};
+  };
+
+  using VMPtr = std::unique_ptr<VM, Releaser>;
+
+  static constexpr std::size_t DEFAULT_MAX_MODULES  = 16;
+  static constexpr std::size_t DEFAULT_MAX_IDLE_VMS = 2;
+
+  static VMPool &ThreadLocal();
+
+  // Construction / Destruction
+  explicit VMPool(std::size_t max_modules  = DEFAULT_MAX_MODULES,
+                  std::size_t max_idle_vms = DEFAULT_MAX_IDLE_VMS);
+  VMPool(VMPool const &) = delete;
+  VMPool(VMPool &&)      = delete;
+  ~VMPool();
+
+  VMPtr Acquire(ModulePtr const &module);
+
+  /// @name Statistics
+  /// @{
+  std::size_t num_modules() const;
+  std::size_t num_idle() const;
+  /// @}
+
+  // Operators
+  VMPool &operator=(VMPool const &) = delete;
+  VMPool &operator=(VMPool &&) = delete;
+
+private:
+  using VMList = std::vector<std::unique_ptr<VM>>;
+
+  struct Slot
+  {
+    ModulePtr module;  ///< The module the VMs were created from
+    VMList    idle;    ///< The idle VMs for this module
+  };
+
+  using Slots = std::vector<Slot>;
+
+  Slot *Find(Module const *module);
+  void  Release(ModulePtr const &module, VM *vm);
+
+  std::size_t const max_modules_;
+  std::size_t const max_idle_vms_;
+  Slots             slots_{};  ///< The module slots, most recently used last
+};
+
+}  // namespace vm
+}  // namespace fetch
@@ -28,6 +28,81 @@
 
 namespace fetch {
 namespace vm {
+namespace {
+
+struct FusionPattern
+{
+  std::vector<uint16_t> opcodes;       ///< The sequence of opcodes to be matched
+  uint16_t              fused_opcode;  ///< The superinstruction which executes the sequence
+};
+
+using FusionPatterns = std::vector<FusionPattern>;
+
+/**
+ * The instruction sequences which are replaced by superinstructions, longest first. Chosen from the
+ * opcode pair statistics of loop heavy contracts. Only the last opcode of each sequence is allowed
+ * to transfer control or raise a runtime error.
+ */
+FusionPatterns const &GetFusionPatterns()
+{
+  static FusionPatterns const patterns = {
+      {{Opcodes::PushVariable, Opcodes::PushConstant, Opcodes::PrimitiveAdd,
+        Opcodes::PopToVariable},
+       Opcodes::PushVariablePushConstantPrimitiveAddPopToVariable},
+      {{Opcodes::PushVariable, Opcodes::PushConstant, Opcodes::PrimitiveSubtract,
+        Opcodes::PopToVariable},
+       Opcodes::PushVariablePushConstantPrimitiveSubtractPopToVariable},
+      {{Opcodes::PushVariable, Opcodes::PushConstant}, Opcodes::PushVariablePushConstant},
+      {{Opcodes::PushVariable, Opcodes::PushVariable}, Opcodes::PushVariablePushVariable},
+      {{Opcodes::PushConstant, Opcodes::PrimitiveAdd}, Opcodes::PushConstantPrimitiveAdd},
+      {{Opcodes::PushConstant, Opcodes::PrimitiveSubtract}, Opcodes::PushConstantPrimitiveSubtract},
+      {{Opcodes::PushConstant, Opcodes::PrimitiveMultiply}, Opcodes::PushConstantPrimitiveMultiply},
+      {{Opcodes::PushConstant, Opcodes::PrimitiveModulo}, Opcodes::PushConstantPrimitiveModulo},
+      {{Opcodes::PrimitiveAdd, Opcodes::PopToVariable}, Opcodes::PrimitiveAddPopToVariable},
+      {{Opcodes::PrimitiveSubtract, Opcodes::PopToVariable},
+       Opcodes::PrimitiveSubtractPopToVariable},
+      {{Opcodes::PrimitiveMultiply, Opcodes::PopToVariable},
+       Opcodes::PrimitiveMultiplyPopToVariable},
+      {{Opcodes::PushConstant, Opcodes::VariablePrimitiveInplaceAdd},
+       Opcodes::PushConstantVariablePrimitiveInplaceAdd},
+      {{Opcodes::PushConstant, Opcodes::VariablePrimitiveInplaceSubtract},
+       Opcodes::PushConstantVariablePrimitiveInplaceSubtract},
+      {{Opcodes::PushVariable, Opcodes::VariablePrimitiveInplaceAdd},
+       Opcodes::PushVariableVariablePrimitiveInplaceAdd},
+      {{Opcodes::PrimitiveEqual, Opcodes::JumpIfFalse}, Opcodes::PrimitiveEqualJumpIfFalse},
+      {{Opcodes::PrimitiveNotEqual, Opcodes::JumpIfFalse}, Opcodes::PrimitiveNotEqualJumpIfFalse},
+      {{Opcodes::PrimitiveLessThan, Opcodes::JumpIfFalse}, Opcodes::PrimitiveLessThanJumpIfFalse},
+      {{Opcodes::PrimitiveLessThanOrEqual, Opcodes::JumpIfFalse},
+       Opcodes::PrimitiveLessThanOrEqualJumpIfFalse},
+      {{Opcodes::PrimitiveGreaterThan, Opcodes::JumpIfFalse},
+       Opcodes::PrimitiveGreaterThanJumpIfFalse},
+      {{Opcodes::PrimitiveGreaterThanOrEqual, Opcodes::JumpIfFalse},
+       Opcodes::PrimitiveGreaterThanOrEqualJumpIfFalse},
+      {{Opcodes::PopToVariable, Opcodes::Jump}, Opcodes::PopToVariableJump}};
+
+  return patterns;
+}
+
+bool Matches(Executable::InstructionArray const &instructions, std::size_t pc,
+             FusionPattern const &pattern)
+{
+  if (pc + pattern.opcodes.size() > instructions.size())
+  {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < pattern.opcodes.size(); ++i)
+  {
+    if (instructions[pc + i].opcode != pattern.opcodes[i])
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
 
 Generator::Generator()
 {
@@ -79,6 +154,13 @@ bool Generator::GenerateExecutable(IR const &ir, std::string const &name, Execut
   CreateFunctions(ir.root_);
   HandleBlock(ir.root_);
 
+  for (auto &function : executable_.functions)
+  {
+    FuseInstructions(function);
+  }
+
+  vm_->ResolveOpcodeHandlers(executable_);
+
   executable = std::move(executable_);
   scopes_.clear();
   loops_.clear();
@@ -1780,6 +1862,38 @@ uint16_t Generator::GetArithmeticOpcode(bool lhs_is_primitive, TypeId node_type_
   return opcode;
 }
 
+/**
+ * Peephole pass which replaces frequently executed instruction sequences with superinstructions.
+ *
+ * Only the opcode of the first instruction in a matched sequence is rewritten. The superinstruction
+ * steps over the instructions that follow it, which remain in place, so jump targets and line
+ * numbers are unaffected and a jump into the middle of a sequence still executes correctly.
+ *
+ * @param function The function to be optimised
+ */
+void Generator::FuseInstructions(Executable::Function &function)
+{
+  auto &      instructions = function.instructions;
+  auto const &patterns     = GetFusionPatterns();
+
+  std::size_t pc = 0;
+  while (pc < instructions.size())
+  {
+    std::size_t length = 1;
+    for (auto const &pattern : patterns)
+    {
+      if (Matches(instructions, pc, pattern))
+      {
+        instructions[pc].opcode = pattern.fused_opcode;
+        length                  = pattern.opcodes.size();
+        break;
+      }
+    }
+
+    pc += length;
+  }
+}
+
 bool Generator::ConstantComparator::operator()(Variant const &lhs, Variant const &rhs) const
 {
   if (lhs.type_id < rhs.type_id)
@@ -282,5 +282,16 @@ Module::Module()
               &IShardedState::Set));
 }
 
+/**
+ * Register the bindings of the module, which populates the type and function details needed to run
+ * an executable. This is done as part of setting up a compiler with the module, so it only needs to
+ * be called for executables which were compiled against another module instance
+ */
+void Module::RegisterBindings()
+{
+  // setting up the compiler runs each of the registration functions and collects the details
+  Compiler compiler{this};
+}
+
 }  // namespace vm
 }  // namespace fetch
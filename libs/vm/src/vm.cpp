@@ -17,13 +17,38 @@
 //------------------------------------------------------------------------------
 
 #include "vm/module.hpp"
+#include "vm/string.hpp"
 #include "vm/vm.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <string>
 
 namespace fetch {
 namespace vm {
+namespace {
+
+bool IsSameType(TypeInfo const &a, TypeInfo const &b)
+{
+  return (a.type_kind == b.type_kind) && (a.template_type_id == b.template_type_id) &&
+         (a.name == b.name) && (a.parameter_type_ids == b.parameter_type_ids);
+}
+
+bool HasResolvedHandlers(Executable const &executable)
+{
+  for (auto const &function : executable.functions)
+  {
+    if (function.handlers.size() != function.instructions.size())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
 
 VM::VM(Module *module)
 {
@@ -31,6 +56,7 @@ VM::VM(Module *module)
 
   module->GetDetails(type_info_array_, type_info_map_, registered_types_, function_info_array,
                      deserialization_constructors_);
+  num_system_types_  = type_info_array_.size();
   auto num_types     = static_cast<uint16_t>(type_info_array_.size());
   auto num_functions = static_cast<uint16_t>(function_info_array.size());
   auto num_opcodes   = static_cast<uint16_t>(Opcodes::NumReserved + num_functions);
@@ -166,13 +192,63 @@ VM::VM(Module *module)
                 [](VM *vm) { vm->Handler__PrimitiveModulo(); });
   AddOpcodeInfo(Opcodes::VariablePrimitiveInplaceModulo, "VariablePrimitiveInplaceModulo",
                 [](VM *vm) { vm->Handler__VariablePrimitiveInplaceModulo(); });
+  AddOpcodeInfo(Opcodes::PushVariablePushConstant, "PushVariablePushConstant",
+                [](VM *vm) { vm->Handler__PushVariablePushConstant(); });
+  AddOpcodeInfo(Opcodes::PushVariablePushVariable, "PushVariablePushVariable",
+                [](VM *vm) { vm->Handler__PushVariablePushVariable(); });
+  AddOpcodeInfo(Opcodes::PushConstantPrimitiveAdd, "PushConstantPrimitiveAdd",
+                [](VM *vm) { vm->Handler__PushConstantPrimitiveAdd(); });
+  AddOpcodeInfo(Opcodes::PushConstantPrimitiveSubtract, "PushConstantPrimitiveSubtract",
+                [](VM *vm) { vm->Handler__PushConstantPrimitiveSubtract(); });
+  AddOpcodeInfo(Opcodes::PushConstantPrimitiveMultiply, "PushConstantPrimitiveMultiply",
+                [](VM *vm) { vm->Handler__PushConstantPrimitiveMultiply(); });
+  AddOpcodeInfo(Opcodes::PushConstantPrimitiveModulo, "PushConstantPrimitiveModulo",
+                [](VM *vm) { vm->Handler__PushConstantPrimitiveModulo(); });
+  AddOpcodeInfo(Opcodes::PrimitiveAddPopToVariable, "PrimitiveAddPopToVariable",
+                [](VM *vm) { vm->Handler__PrimitiveAddPopToVariable(); });
+  AddOpcodeInfo(Opcodes::PrimitiveSubtractPopToVariable, "PrimitiveSubtractPopToVariable",
+                [](VM *vm) { vm->Handler__PrimitiveSubtractPopToVariable(); });
+  AddOpcodeInfo(Opcodes::PrimitiveMultiplyPopToVariable, "PrimitiveMultiplyPopToVariable",
+                [](VM *vm) { vm->Handler__PrimitiveMultiplyPopToVariable(); });
+  AddOpcodeInfo(Opcodes::PushConstantVariablePrimitiveInplaceAdd,
+                "PushConstantVariablePrimitiveInplaceAdd",
+                [](VM *vm) { vm->Handler__PushConstantVariablePrimitiveInplaceAdd(); });
+  AddOpcodeInfo(Opcodes::PushConstantVariablePrimitiveInplaceSubtract,
+                "PushConstantVariablePrimitiveInplaceSubtract",
+                [](VM *vm) { vm->Handler__PushConstantVariablePrimitiveInplaceSubtract(); });
+  AddOpcodeInfo(Opcodes::PushVariableVariablePrimitiveInplaceAdd,
+                "PushVariableVariablePrimitiveInplaceAdd",
+                [](VM *vm) { vm->Handler__PushVariableVariablePrimitiveInplaceAdd(); });
+  AddOpcodeInfo(Opcodes::PrimitiveEqualJumpIfFalse, "PrimitiveEqualJumpIfFalse",
+                [](VM *vm) { vm->Handler__PrimitiveEqualJumpIfFalse(); });
+  AddOpcodeInfo(Opcodes::PrimitiveNotEqualJumpIfFalse, "PrimitiveNotEqualJumpIfFalse",
+                [](VM *vm) { vm->Handler__PrimitiveNotEqualJumpIfFalse(); });
+  AddOpcodeInfo(Opcodes::PrimitiveLessThanJumpIfFalse, "PrimitiveLessThanJumpIfFalse",
+                [](VM *vm) { vm->Handler__PrimitiveLessThanJumpIfFalse(); });
+  AddOpcodeInfo(Opcodes::PrimitiveLessThanOrEqualJumpIfFalse, "PrimitiveLessThanOrEqualJumpIfFalse",
+                [](VM *vm) { vm->Handler__PrimitiveLessThanOrEqualJumpIfFalse(); });
+  AddOpcodeInfo(Opcodes::PrimitiveGreaterThanJumpIfFalse, "PrimitiveGreaterThanJumpIfFalse",
+                [](VM *vm) { vm->Handler__PrimitiveGreaterThanJumpIfFalse(); });
+  AddOpcodeInfo(Opcodes::PrimitiveGreaterThanOrEqualJumpIfFalse,
+                "PrimitiveGreaterThanOrEqualJumpIfFalse",
+                [](VM *vm) { vm->Handler__PrimitiveGreaterThanOrEqualJumpIfFalse(); });
+  AddOpcodeInfo(Opcodes::PopToVariableJump, "PopToVariableJump",
+                [](VM *vm) { vm->Handler__PopToVariableJump(); });
+  AddOpcodeInfo(Opcodes::PushVariablePushConstantPrimitiveAddPopToVariable,
+                "PushVariablePushConstantPrimitiveAddPopToVariable",
+                [](VM *vm) { vm->Handler__PushVariablePushConstantPrimitiveAddPopToVariable(); });
+  AddOpcodeInfo(Opcodes::PushVariablePushConstantPrimitiveSubtractPopToVariable,
+                "PushVariablePushConstantPrimitiveSubtractPopToVariable",
+                [](VM *vm) {
+                  vm->Handler__PushVariablePushConstantPrimitiveSubtractPopToVariable();
+                });
 
   opcode_map_.clear();
   for (uint16_t i = 0; i < num_functions; ++i)
   {
     auto        opcode = static_cast<uint16_t>(Opcodes::NumReserved + i);
     auto const &info   = function_info_array[i];
-    AddOpcodeInfo(opcode, info.unique_id, info.handler);
+    AddFunctionOpcodeInfo(opcode, info.unique_id, info.handler);
     opcode_map_[info.unique_id] = opcode;
   }
 
@@ -185,22 +261,62 @@ bool VM::GenerateExecutable(IR const &ir, std::string const &name, Executable &e
   return generator_.GenerateExecutable(ir, name, executable, errors);
 }
 
-bool VM::Execute(std::string &error, Variant &output)
+/**
+ * Reset the caller specific state of the VM so that it can be reused for another invocation. The
+ * opcode tables, the stack and the resources prepared for the last executable are retained.
+ */
+void VM::Reset()
 {
-  std::size_t const num_strings = executable_->strings.size();
-  strings_                      = std::vector<Ptr<String>>(num_strings);
-  for (std::size_t i = 0; i < num_strings; ++i)
-  {
-    std::string const &str = executable_->strings[i];
-    strings_[i]            = Ptr<String>(new String(this, str, true));
-  }
+  io_observer_  = nullptr;
+  context_      = nullptr;
+  context_type_ = TypeIndex(typeid(void));
+  output_devices_.clear();
+  input_devices_.clear();
+  output_buffer_.str(std::string{});
+  output_buffer_.clear();
+  error_.clear();
+  opcode_statistics_ = false;
+  opcode_pair_counts_.clear();
+}
+
+/**
+ * Pre-resolve the handler for each of the instructions in the executable so that they can be
+ * dispatched directly, rather than through the (type erased) opcode table. The built-in opcodes
+ * are resolved to their handler functions and all module registered functions are routed through
+ * the opcode table. Since neither depends on the VM instance the resolved executable can be run
+ * on any VM created from the same module.
+ *
+ * @param executable The executable to be updated
+ */
+void VM::ResolveOpcodeHandlers(Executable &executable) const
+{
+  OpcodeHandler const dispatch = [](VM *vm) { vm->DispatchOpcode(); };
 
-  std::size_t const num_local_types = executable_->types.size();
-  for (std::size_t i = 0; i < num_local_types; ++i)
+  for (auto &function : executable.functions)
   {
-    TypeInfo const &type_info = executable_->types[i];
-    type_info_array_.push_back(type_info);
+    function.handlers.clear();
+    function.handlers.reserve(function.instructions.size());
+
+    for (auto const &instruction : function.instructions)
+    {
+      OpcodeHandler handler = dispatch;
+      if (instruction.opcode < Opcodes::NumReserved)
+      {
+        OpcodeHandler const direct_handler = opcode_info_array_[instruction.opcode].direct_handler;
+        if (direct_handler)
+        {
+          handler = direct_handler;
+        }
+      }
+
+      function.handlers.push_back(handler);
+    }
   }
+}
+
+bool VM::Execute(std::string &error, Variant &output)
+{
+  PrepareExecutable();
 
   frame_sp_       = -1;
   bsp_            = 0;
@@ -214,33 +330,32 @@ bool VM::Execute(std::string &error, Variant &output)
   error_.clear();
   error.clear();
 
-  do
+  if (instruction_counting_ || opcode_statistics_)
   {
-    instruction_pc_  = pc_;
-    instruction_     = &function_->instructions[pc_++];
-    OpcodeInfo &info = opcode_info_array_[instruction_->opcode];
-    if (info.handler)
+    ExecuteInstrumented();
+  }
+  else if (HasResolvedHandlers(*executable_))
+  {
+    // direct threaded dispatch
+    do
     {
-      info.handler(this);
-    }
-    else
+      instruction_pc_ = pc_;
+      instruction_    = &function_->instructions[pc_];
+      function_->handlers[pc_++](this);
+    } while (!stop_);
+  }
+  else
+  {
+    do
     {
-      RuntimeError("unknown opcode");
-      break;
-    }
-  } while (!stop_);
+      instruction_pc_ = pc_;
+      instruction_    = &function_->instructions[pc_++];
+      DispatchOpcode();
+    } while (!stop_);
+  }
 
   bool const ok = !HasError();
 
-  // Remove the executable's strings
-  strings_.clear();
-
-  // Remove the executable's local types
-  for (std::size_t i = 0; i < num_local_types; ++i)
-  {
-    type_info_array_.pop_back();
-  }
-
   if (ok)
   {
     if (sp_ == 0)
@@ -263,6 +378,144 @@ bool VM::Execute(std::string &error, Variant &output)
   return false;
 }
 
+/**
+ * Execution loop used when any of the instrumentation is enabled. Opcode pairs are only recorded
+ * when the second instruction directly follows the first in the code, since only those sequences
+ * are candidates for fusing into a single instruction.
+ */
+void VM::ExecuteInstrumented()
+{
+  Executable::Function const *previous_function{nullptr};
+  uint16_t                    previous_pc{0};
+  uint16_t                    previous_opcode{0};
+
+  do
+  {
+    instruction_pc_ = pc_;
+    instruction_    = &function_->instructions[pc_++];
+
+    if (instruction_counting_)
+    {
+      ++instruction_count_;
+    }
+
+    if (opcode_statistics_)
+    {
+      if ((previous_function == function_) && (instruction_pc_ == previous_pc + 1))
+      {
+        uint32_t const key = (static_cast<uint32_t>(previous_opcode) << 16u) | instruction_->opcode;
+        ++opcode_pair_counts_[key];
+      }
+
+      previous_function = function_;
+      previous_pc       = instruction_pc_;
+      previous_opcode   = instruction_->opcode;
+    }
+
+    DispatchOpcode();
+  } while (!stop_);
+}
+
+/**
+ * Get the opcode pair frequencies which have been collected while the opcode statistics were
+ * enabled
+ *
+ * @return The opcode pairs, most frequent first
+ */
+VM::OpcodePairStatistics VM::GetOpcodePairStatistics() const
+{
+  auto const lookup_name = [this](uint16_t opcode) -> std::string {
+    if ((opcode < opcode_info_array_.size()) && !opcode_info_array_[opcode].name.empty())
+    {
+      return opcode_info_array_[opcode].name;
+    }
+
+    return "Opcode" + std::to_string(opcode);
+  };
+
+  OpcodePairStatistics statistics;
+  statistics.reserve(opcode_pair_counts_.size());
+
+  for (auto const &element : opcode_pair_counts_)
+  {
+    auto const first  = static_cast<uint16_t>(element.first >> 16u);
+    auto const second = static_cast<uint16_t>(element.first & 0xFFFFu);
+
+    statistics.push_back({lookup_name(first), lookup_name(second), element.second});
+  }
+
+  std::sort(statistics.begin(), statistics.end(),
+            [](OpcodePairStatistic const &a, OpcodePairStatistic const &b) {
+              return a.count > b.count;
+            });
+
+  return statistics;
+}
+
+/**
+ * Populate the string literals and local types of the current executable. When the same executable
+ * is run repeatedly the previously created objects are reused, provided that they have not been
+ * modified or retained by a previous execution.
+ */
+void VM::PrepareExecutable()
+{
+  auto const &strings = executable_->strings;
+  auto const &types   = executable_->types;
+
+  bool const rebuild = (executable_ != prepared_executable_) ||
+                       (strings_.size() != strings.size()) ||
+                       (type_info_array_.size() != (num_system_types_ + types.size()));
+
+  if (rebuild)
+  {
+    ReleaseExecutable();
+
+    strings_.reserve(strings.size());
+    for (auto const &str : strings)
+    {
+      strings_.emplace_back(new String(this, str, true));
+    }
+
+    type_info_array_.insert(type_info_array_.end(), types.begin(), types.end());
+
+    prepared_executable_ = executable_;
+    return;
+  }
+
+  // literals are mutable objects, so only reuse the ones which are still pristine
+  for (std::size_t i = 0; i < strings.size(); ++i)
+  {
+    Ptr<String> &literal = strings_[i];
+    if ((literal.RefCount() != 1) || (literal->str != strings[i]))
+    {
+      literal = Ptr<String>(new String(this, strings[i], true));
+    }
+  }
+
+  // guard against a different executable having been allocated at the same address
+  for (std::size_t i = 0; i < types.size(); ++i)
+  {
+    TypeInfo &type_info = type_info_array_[num_system_types_ + i];
+    if (!IsSameType(type_info, types[i]))
+    {
+      type_info = types[i];
+    }
+  }
+}
+
+/**
+ * Release the string literals and local types of the previously prepared executable
+ */
+void VM::ReleaseExecutable()
+{
+  strings_.clear();
+
+  auto const num_system_types = static_cast<std::ptrdiff_t>(num_system_types_);
+  type_info_array_.erase(type_info_array_.begin() + num_system_types, type_info_array_.end());
+
+  prepared_executable_ = nullptr;
+}
+
 void VM::RuntimeError(std::string const &message)
 {
   uint16_t const    line = function_->FindLineNumber(instruction_pc_);
@@ -700,5 +700,165 @@ void VM::Handler__VariablePrimitiveInplaceModulo()
   DoVariableIntegralInplaceOp<PrimitiveModulo>();
 }
 
+//
+// Superinstructions. The generator only replaces the opcode of the first instruction of a fused
+// sequence, the remaining instructions are left in place and are stepped over here.
+//
+
+void VM::Handler__PushVariablePushConstant()
+{
+  Handler__PushVariable();
+  NextFusedInstruction();
+  Handler__PushConstant();
+}
+
+void VM::Handler__PushVariablePushVariable()
+{
+  Handler__PushVariable();
+  NextFusedInstruction();
+  Handler__PushVariable();
+}
+
+void VM::Handler__PushConstantPrimitiveAdd()
+{
+  Handler__PushConstant();
+  NextFusedInstruction();
+  Handler__PrimitiveAdd();
+}
+
+void VM::Handler__PushConstantPrimitiveSubtract()
+{
+  Handler__PushConstant();
+  NextFusedInstruction();
+  Handler__PrimitiveSubtract();
+}
+
+void VM::Handler__PushConstantPrimitiveMultiply()
+{
+  Handler__PushConstant();
+  NextFusedInstruction();
+  Handler__PrimitiveMultiply();
+}
+
+void VM::Handler__PushConstantPrimitiveModulo()
+{
+  Handler__PushConstant();
+  NextFusedInstruction();
+  Handler__PrimitiveModulo();
+}
+
+void VM::Handler__PrimitiveAddPopToVariable()
+{
+  Handler__PrimitiveAdd();
+  NextFusedInstruction();
+  Handler__PopToVariable();
+}
+
+void VM::Handler__PrimitiveSubtractPopToVariable()
+{
+  Handler__PrimitiveSubtract();
+  NextFusedInstruction();
+  Handler__PopToVariable();
+}
+
+void VM::Handler__PrimitiveMultiplyPopToVariable()
+{
+  Handler__PrimitiveMultiply();
+  NextFusedInstruction();
+  Handler__PopToVariable();
+}
+
+void VM::Handler__PushConstantVariablePrimitiveInplaceAdd()
+{
+  Handler__PushConstant();
+  NextFusedInstruction();
+  Handler__VariablePrimitiveInplaceAdd();
+}
+
+void VM::Handler__PushConstantVariablePrimitiveInplaceSubtract()
+{
+  Handler__PushConstant();
+  NextFusedInstruction();
+  Handler__VariablePrimitiveInplaceSubtract();
+}
+
+void VM::Handler__PushVariableVariablePrimitiveInplaceAdd()
+{
+  Handler__PushVariable();
+  NextFusedInstruction();
+  Handler__VariablePrimitiveInplaceAdd();
+}
+
+void VM::Handler__PrimitiveEqualJumpIfFalse()
+{
+  Handler__PrimitiveEqual();
+  NextFusedInstruction();
+  Handler__JumpIfFalse();
+}
+
+void VM::Handler__PrimitiveNotEqualJumpIfFalse()
+{
+  Handler__PrimitiveNotEqual();
+  NextFusedInstruction();
+  Handler__JumpIfFalse();
+}
+
+void VM::Handler__PrimitiveLessThanJumpIfFalse()
+{
+  Handler__PrimitiveLessThan();
+  NextFusedInstruction();
+  Handler__JumpIfFalse();
+}
+
+void VM::Handler__PrimitiveLessThanOrEqualJumpIfFalse()
+{
+  Handler__PrimitiveLessThanOrEqual();
+  NextFusedInstruction();
+  Handler__JumpIfFalse();
+}
+
+void VM::Handler__PrimitiveGreaterThanJumpIfFalse()
+{
+  Handler__PrimitiveGreaterThan();
+  NextFusedInstruction();
+  Handler__JumpIfFalse();
+}
+
+void VM::Handler__PrimitiveGreaterThanOrEqualJumpIfFalse()
+{
+  Handler__PrimitiveGreaterThanOrEqual();
+  NextFusedInstruction();
+  Handler__JumpIfFalse();
+}
+
+void VM::Handler__PopToVariableJump()
+{
+  Handler__PopToVariable();
+  NextFusedInstruction();
+  Handler__Jump();
+}
+
+void VM::Handler__PushVariablePushConstantPrimitiveAddPopToVariable()
+{
+  Handler__PushVariable();
+  NextFusedInstruction();
+  Handler__PushConstant();
+  NextFusedInstruction();
+  Handler__PrimitiveAdd();
+  NextFusedInstruction();
+  Handler__PopToVariable();
+}
+
+void VM::Handler__PushVariablePushConstantPrimitiveSubtractPopToVariable()
+{
+  Handler__PushVariable();
+  NextFusedInstruction();
+  Handler__PushConstant();
+  NextFusedInstruction();
+  Handler__PrimitiveSubtract();
+  NextFusedInstruction();
+  Handler__PopToVariable();
+}
+
 }  // namespace vm
 }  // namespace fetch
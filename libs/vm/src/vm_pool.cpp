@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/module.hpp"
+#include "vm/vm.hpp"
+#include "vm/vm_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace fetch {
+namespace vm {
+
+VMPool::Releaser::Releaser(VMPool *pool, ModulePtr module)
+  : pool_{pool}
+  , module_{std::move(module)}
+{}
+
+void VMPool::Releaser::operator()(VM *vm) const
+{
+  if (pool_)
+  {
+    pool_->Release(module_, vm);
+  }
+  else
+  {
+    delete vm;
+  }
+}
+
+/**
+ * Get the pool for the calling thread
+ *
+ * @return The thread local pool instance
+ */
+VMPool &VMPool::ThreadLocal()
+{
+  static thread_local VMPool pool;
+  return pool;
+}
+
+/**
+ * Construct a VM pool
+ *
+ * @param max_modules The maximum number of modules for which idle VMs are retained
+ * @param max_idle_vms The maximum number of idle VMs retained per module
+ */
+VMPool::VMPool(std::size_t max_modules, std::size_t max_idle_vms)
+  : max_modules_{max_modules}
+  , max_idle_vms_{max_idle_vms}
+{}
+
+VMPool::~VMPool() = default;
+
+/**
+ * Acquire a VM for the specified module. The VM is returned to the pool when the pointer is
+ * released, which must happen on the same thread and before the pool is destroyed.
+ *
+ * @param module The module which the VM should be created from
+ * @return The VM instance
+ */
+VMPool::VMPtr VMPool::Acquire(ModulePtr const &module)
+{
+  std::unique_ptr<VM> vm{};
+
+  Slot *slot = Find(module.get());
+  if (slot && !slot->idle.empty())
+  {
+    vm = std::move(slot->idle.back());
+    slot->idle.pop_back();
+  }
+  else
+  {
+    vm = std::make_unique<VM>(module.get());
+  }
+
+  return VMPtr{vm.release(), Releaser{this, module}};
+}
+
+std::size_t VMPool::num_modules() const
+{
+  return slots_.size();
+}
+
+std::size_t VMPool::num_idle() const
+{
+  std::size_t count{0};
+  for (auto const &slot : slots_)
+  {
+    count += slot.idle.size();
+  }
+
+  return count;
+}
+
+/**
+ * Lookup the slot for a module, marking it as the most recently used
+ *
+ * @param module The module to search for
+ * @return The slot if found, otherwise nullptr
+ */
+VMPool::Slot *VMPool::Find(Module const *module)
+{
+  auto it = std::find_if(slots_.begin(), slots_.end(),
+                         [module](Slot const &slot) { return slot.module.get() == module; });
+
+  if (it == slots_.end())
+  {
+    return nullptr;
+  }
+
+  // move the slot to the back of the list
+  std::rotate(it, it + 1, slots_.end());
+
+  return &slots_.back();
+}
+
+/**
+ * Return a VM to the pool, resetting it ready for the next acquisition
+ *
+ * @param module The module the VM was created from
+ * @param vm The VM being returned
+ */
+void VMPool::Release(ModulePtr const &module, VM *vm)
+{
+  std::unique_ptr<VM> instance{vm};
+
+  Slot *slot = Find(module.get());
+  if (slot == nullptr)
+  {
+    // evict the least recently used module if needed
+    if (!slots_.empty() && (slots_.size() >= max_modules_))
+    {
+      slots_.erase(slots_.begin());
+    }
+
+    if (max_modules_ == 0)
+    {
+      return;
+    }
+
+    slots_.push_back(Slot{module, {}});
+    slot = &slots_.back();
+  }
+
+  if (slot->idle.size() < max_idle_vms_)
+  {
+    instance->Reset();
+    slot->idle.emplace_back(std::move(instance));
+  }
+}
+
+}  // namespace vm
+}  // namespace fetch
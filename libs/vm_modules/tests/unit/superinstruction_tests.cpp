@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm_test_toolkit.hpp"
+
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+namespace {
+
+class SuperinstructionTests : public ::testing::Test
+{
+public:
+  std::stringstream stdout;
+  VmTestToolkit     toolkit{&stdout};
+};
+
+TEST_F(SuperinstructionTests, fused_arithmetic_produces_the_same_results)
+{
+  static char const *TEXT = R"(
+    function main()
+      var total = 0i64;
+      var x = 1.0;
+      for (i in 0:10)
+        total = total + toInt64(i) * 3i64 - 1i64;
+        x = x * 0.5 + 1.0;
+        total -= 2i64;
+        total += toInt64(i);
+      endfor
+      var count = 0;
+      count = count + 5;
+      count = count - 2;
+      print(total);
+      print(' ');
+      print(x);
+      print(' ');
+      print(count);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  ASSERT_EQ(stdout.str(), "150 1.99902 3");
+}
+
+TEST_F(SuperinstructionTests, fused_comparisons_take_the_correct_branch)
+{
+  static char const *TEXT = R"(
+    function main()
+      var i = 0;
+      while (i < 12)
+        if (i == 1)
+          print('a');
+        endif
+        if (i != 2)
+          print('b');
+        endif
+        if (i <= 3)
+          print('c');
+        endif
+        if (i > 9)
+          print('d');
+        endif
+        if (i >= 11)
+          print('e');
+        endif
+        i = i + 1;
+      endwhile
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  ASSERT_EQ(stdout.str(), "bcabccbcbbbbbbbdbde");
+}
+
+TEST_F(SuperinstructionTests, jumps_to_fused_sequences_are_preserved)
+{
+  // each iteration jumps back to the fused loop condition, and leaves the body through a fused jump
+  static char const *TEXT = R"(
+    function main()
+      var i = 0;
+      var j = 3;
+      while (j > i)
+        i = i + 1;
+      endwhile
+      print(i);
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+
+  ASSERT_EQ(stdout.str(), "3");
+}
+
+TEST_F(SuperinstructionTests, errors_in_fused_sequences_report_the_correct_line)
+{
+  static char const *TEXT = R"(
+    function main()
+      var x = 7;
+      var y = 0;
+      var z = x % y;
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_FALSE(toolkit.Run());
+
+  ASSERT_THAT(stdout.str(), ::testing::HasSubstr("line 5: division by zero"));
+}
+
+TEST_F(SuperinstructionTests, opcode_statistics_report_the_most_frequent_pairs_first)
+{
+  static char const *TEXT = R"(
+    function main()
+      var total = 0;
+      for (i in 0:100)
+        total = total + i * i;
+      endfor
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+
+  toolkit.vm_->SetOpcodeStatistics(true);
+  ASSERT_TRUE(toolkit.Run());
+
+  auto const statistics = toolkit.vm_->GetOpcodePairStatistics();
+  ASSERT_FALSE(statistics.empty());
+
+  EXPECT_EQ(100u, statistics.front().count);
+  for (std::size_t i = 1; i < statistics.size(); ++i)
+  {
+    EXPECT_GE(statistics[i - 1].count, statistics[i].count);
+  }
+}
+
+}  // namespace
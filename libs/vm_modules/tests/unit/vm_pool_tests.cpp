@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/vm_pool.hpp"
+#include "vm_test_toolkit.hpp"
+
+#include "gmock/gmock.h"
+
+namespace {
+
+using fetch::vm::VMPool;
+
+class VMPoolTests : public ::testing::Test
+{
+public:
+  std::stringstream stdout;
+  VmTestToolkit     toolkit{&stdout};
+};
+
+TEST_F(VMPoolTests, repeated_execution_does_not_observe_modified_literals)
+{
+  static char const *TEXT = R"(
+    function main()
+      var text = '   abc';
+      print(text);
+      text.trim();
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+  ASSERT_TRUE(toolkit.Run());
+  ASSERT_TRUE(toolkit.Run());
+
+  ASSERT_EQ(stdout.str(), "   abc   abc");
+}
+
+TEST_F(VMPoolTests, returned_literals_are_not_reused)
+{
+  static char const *TEXT = R"(
+    function main() : String
+      return 'abc';
+    endfunction
+  )";
+
+  ASSERT_TRUE(toolkit.Compile(TEXT));
+
+  Variant first{};
+  ASSERT_TRUE(toolkit.Run(&first));
+
+  Variant second{};
+  ASSERT_TRUE(toolkit.Run(&second));
+
+  ASSERT_NE(first.Get<fetch::vm::Ptr<fetch::vm::String>>(),
+            second.Get<fetch::vm::Ptr<fetch::vm::String>>());
+  ASSERT_EQ(second.Get<fetch::vm::Ptr<fetch::vm::String>>()->str, "abc");
+}
+
+TEST_F(VMPoolTests, released_vms_are_reused)
+{
+  VMPool pool{};
+
+  auto const module = toolkit.module();
+
+  fetch::vm::VM *first_instance{nullptr};
+  {
+    auto vm        = pool.Acquire(module);
+    first_instance = vm.get();
+  }
+
+  EXPECT_EQ(1u, pool.num_modules());
+  EXPECT_EQ(1u, pool.num_idle());
+
+  {
+    auto first  = pool.Acquire(module);
+    auto second = pool.Acquire(module);
+
+    EXPECT_EQ(first_instance, first.get());
+    EXPECT_NE(first_instance, second.get());
+    EXPECT_EQ(0u, pool.num_idle());
+  }
+
+  EXPECT_EQ(2u, pool.num_idle());
+}
+
+TEST_F(VMPoolTests, idle_vms_are_bounded)
+{
+  VMPool pool{1, 1};
+
+  auto const module       = toolkit.module();
+  auto const other_module = VMFactory::GetModule(VMFactory::USE_SMART_CONTRACTS);
+
+  {
+    auto first  = pool.Acquire(module);
+    auto second = pool.Acquire(module);
+  }
+
+  EXPECT_EQ(1u, pool.num_modules());
+  EXPECT_EQ(1u, pool.num_idle());
+
+  // a different module evicts the idle VMs of the least recently used module
+  {
+    auto vm = pool.Acquire(other_module);
+  }
+
+  EXPECT_EQ(1u, pool.num_modules());
+  EXPECT_EQ(1u, pool.num_idle());
+}
+
+TEST_F(VMPoolTests, reset_vm_is_detached_from_previous_caller)
+{
+  VMPool pool{};
+
+  int context{0};
+  {
+    auto vm = pool.Acquire(toolkit.module());
+    vm->SetIOObserver(toolkit.observer());
+    vm->SetContext(&context);
+  }
+
+  auto vm = pool.Acquire(toolkit.module());
+  EXPECT_FALSE(vm->HasIoObserver());
+  EXPECT_EQ(nullptr, vm->GetContext<int>());
+}
+
+}  // namespace